@@ -20,6 +20,8 @@
 #ifndef CAMGEN_OPENGLGRABBER_H_
 #define CAMGEN_OPENGLGRABBER_H_
 
+#include <vector>
+
 #include <opencv/cv.h>
 #include <opencv/highgui.h>
 
@@ -39,6 +41,13 @@ namespace camgen {
     /**
      * This class implements a grabber providing images from
      * a given OpenGL scene.
+     *
+     * If pixel buffer objects are available, the frame buffer is read
+     * back asynchronously by alternating between two PBOs: The readback
+     * of frame N is only mapped after frame N + 1 has been rendered so
+     * that the transfer overlaps with rendering. The shared memory is
+     * locked only for copying the final frame into it; thus, published
+     * images lag one frame behind.
      */
     class OpenGLGrabber : public hesperia::io::camera::ImageGrabber {
         public:
@@ -49,6 +58,10 @@ namespace camgen {
             };
 
         private:
+            enum {
+                NUMBER_OF_PIXEL_BUFFERS = 2
+            };
+
             /**
              * "Forbidden" copy constructor. Goal: The compiler should warn
              * already at compile time for unwanted bugs caused by any misuse
@@ -97,6 +110,34 @@ namespace camgen {
             core::SharedPointer<hesperia::threeD::TransformGroup> m_extrinsicCalibrationRoot;
             core::SharedPointer<hesperia::threeD::TransformGroup> m_intrinsicCalibrationRoot;
             hesperia::data::environment::EgoState &m_egoState;
+            vector<uint32_t> m_pixelBuffers;
+            uint32_t m_currentPixelBuffer;
+            uint32_t m_numberOfPendingReadbacks;
+            vector<char> m_readback;
+            vector<char> m_frame;
+
+            /**
+             * This method creates the pixel buffer objects if supported
+             * by the current OpenGL context.
+             *
+             * @return true if pixel buffer objects are used.
+             */
+            bool initializePixelBuffers();
+
+            /**
+             * This method reads back the current frame buffer and
+             * publishes the oldest completed frame.
+             */
+            void readPixels();
+
+            /**
+             * This method flips the given frame horizontally into a
+             * staging buffer and copies the result into the shared
+             * memory while holding its lock.
+             *
+             * @param pixels BGR pixels as read by glReadPixels.
+             */
+            void publishFrame(const char *pixels);
 
             /**
              * This method renders the real word.
@@ -19,8 +19,14 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
 
+// Declare the OpenGL 1.5 buffer object functions.
+#define GL_GLEXT_PROTOTYPES
 #include <GL/gl.h>
+#include <GL/glext.h>
 #include <GL/glut.h>
 
 #include "core/base/Thread.h"
@@ -36,6 +42,7 @@
 #include "hesperia/threeD/NodeDescriptor.h"
 #include "hesperia/threeD/RenderingConfiguration.h"
 #include "hesperia/threeD/decorator/DecoratorFactory.h"
+#include "hesperia/threeD/loaders/OBJXArchiveFactory.h"
 #include "hesperia/threeD/models/CheckerBoard.h"
 #include "hesperia/threeD/models/Grid.h"
 #include "hesperia/threeD/models/XYZAxes.h"
@@ -64,13 +71,26 @@ namespace camgen {
             m_root(),
             m_extrinsicCalibrationRoot(),
             m_intrinsicCalibrationRoot(),
-            m_egoState(egoState) {
+            m_egoState(egoState),
+            m_pixelBuffers(),
+            m_currentPixelBuffer(0),
+            m_numberOfPendingReadbacks(0),
+            m_readback(),
+            m_frame() {
 
         const URL urlOfSCNXFile(m_kvc.getValue<string>("global.scenario"));
         const bool SHOW_GRID = (m_kvc.getValue<uint8_t>("global.showgrid") == 1);
         if (urlOfSCNXFile.isValid()) {
             m_root = core::SharedPointer<TransformGroup>(new hesperia::threeD::TransformGroup());
-            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+
+            // Parsed complex models can be cached in their binary form.
+            try {
+                hesperia::threeD::loaders::OBJXArchiveFactory::getInstance().setCacheDirectory(m_kvc.getValue<string>("camgen.objxcache"));
+            }
+            catch (const core::exceptions::ValueForKeyNotFoundException &e) {
+            }
+
+            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, m_kvc);
 
             // Read scnxArchive and decorate it for getting displayed in an OpenGL scene.
             const bool SHOW_LANE_CONNECTORS = false;
@@ -85,7 +105,16 @@ namespace camgen {
             m_image = core::SharedPointer<core::wrapper::Image>(core::wrapper::ImageFactory::getInstance().getImage(640, 480, core::wrapper::Image::BGR_24BIT, static_cast<char*>(m_sharedMemory->getSharedMemory())));
 
             if (m_image.isValid()) {
-                cerr << "OpenGLGrabber initialized." << endl;
+                const uint32_t size = m_image->getWidth() * m_image->getHeight() * 3;
+                m_frame.resize(size);
+
+                if (initializePixelBuffers()) {
+                    cerr << "OpenGLGrabber initialized using " << m_pixelBuffers.size() << " pixel buffer objects." << endl;
+                }
+                else {
+                    m_readback.resize(size);
+                    cerr << "OpenGLGrabber initialized." << endl;
+                }
             }
         }
 
@@ -101,17 +130,57 @@ namespace camgen {
         m_extrinsicCalibrationRoot->setRotation(Point3(core::data::Constants::PI/2, core::data::Constants::PI/2, 0));
     }
 
-    OpenGLGrabber::~OpenGLGrabber() {}
+    OpenGLGrabber::~OpenGLGrabber() {
+        if (!m_pixelBuffers.empty()) {
+            glDeleteBuffers(m_pixelBuffers.size(), &m_pixelBuffers[0]);
+        }
+    }
+
+    bool OpenGLGrabber::initializePixelBuffers() {
+        // Pixel buffer objects are part of OpenGL 2.1 and available as ARB extension before.
+        const char *version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+        const char *extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        if (version == NULL) {
+            return false;
+        }
+
+        uint32_t major = 0;
+        uint32_t minor = 0;
+        char dot = 0;
+        stringstream sstr(version);
+        sstr >> major >> dot >> minor;
+
+        const bool hasPBO = ( (major > 2) || ( (major == 2) && (minor >= 1) ) ) ||
+                            ( (extensions != NULL) && (string(extensions).find("GL_ARB_pixel_buffer_object") != string::npos) );
+        if (!hasPBO) {
+            return false;
+        }
+
+        const uint32_t size = m_image->getWidth() * m_image->getHeight() * 3;
+        m_pixelBuffers.resize(NUMBER_OF_PIXEL_BUFFERS, 0);
+        glGenBuffers(m_pixelBuffers.size(), &m_pixelBuffers[0]);
+        for (uint32_t i = 0; i < m_pixelBuffers.size(); i++) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelBuffers[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (glGetError() != GL_NO_ERROR) {
+            glDeleteBuffers(m_pixelBuffers.size(), &m_pixelBuffers[0]);
+            m_pixelBuffers.clear();
+            return false;
+        }
+
+        return true;
+    }
 
     void OpenGLGrabber::delay() {
         Thread::usleep(1000 * 10);
     }
 
     core::SharedPointer<core::wrapper::Image> OpenGLGrabber::getNextImage() {
-        if ( (m_sharedMemory.isValid()) && (m_sharedMemory->isValid()) ) {
-            m_sharedMemory->lock();
-
-            // Render the image right before grabbing it.
+        if ( (m_sharedMemory.isValid()) && (m_sharedMemory->isValid()) && (m_image.isValid()) ) {
+            // Render the image right before grabbing it; the shared memory is not locked meanwhile.
             switch (m_render) {
                 case  OpenGLGrabber::WORLD:
                     renderNextImageFromRealWord();
@@ -124,18 +193,67 @@ namespace camgen {
                 break;
             }
 
-            // TODO Read pixels using BGRA!!!
-            glReadBuffer(GL_BACK);
-            glPixelStorei(GL_PACK_ALIGNMENT, 1);
-            glReadPixels(0, 0, m_image->getWidth(), m_image->getHeight(), GL_BGR, GL_UNSIGNED_BYTE, m_sharedMemory->getSharedMemory());
+            readPixels();
+        }
+
+        return m_image;
+    }
 
-            // Flip the image horizontally.
-            m_image->flipHorizontally();
+    void OpenGLGrabber::readPixels() {
+        const int32_t width = m_image->getWidth();
+        const int32_t height = m_image->getHeight();
 
-            m_sharedMemory->unlock();
+        // TODO Read pixels using BGRA!!!
+        glReadBuffer(GL_BACK);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        if (m_pixelBuffers.empty()) {
+            glReadPixels(0, 0, width, height, GL_BGR, GL_UNSIGNED_BYTE, &m_readback[0]);
+            publishFrame(&m_readback[0]);
+            return;
         }
 
-        return m_image;
+        // Start the asynchronous readback of the current frame.
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelBuffers[m_currentPixelBuffer]);
+        glReadPixels(0, 0, width, height, GL_BGR, GL_UNSIGNED_BYTE, NULL);
+        m_currentPixelBuffer = (m_currentPixelBuffer + 1) % m_pixelBuffers.size();
+        m_numberOfPendingReadbacks++;
+
+        // Map the oldest readback once all buffers are in flight.
+        if (m_numberOfPendingReadbacks == m_pixelBuffers.size()) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelBuffers[m_currentPixelBuffer]);
+            const char *pixels = static_cast<const char*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+            if (pixels != NULL) {
+                publishFrame(pixels);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            m_numberOfPendingReadbacks--;
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    void OpenGLGrabber::publishFrame(const char *pixels) {
+        const uint32_t width = m_image->getWidth();
+        const uint32_t height = m_image->getHeight();
+        const uint32_t rowSize = width * 3;
+
+        // Flip the image horizontally while copying into the staging buffer.
+        for (uint32_t y = 0; y < height; y++) {
+            const char *src = pixels + y * rowSize;
+            char *dst = &m_frame[y * rowSize];
+            for (uint32_t x = 0; x < width; x++) {
+                const uint32_t mirrored = (width - 1 - x) * 3;
+                dst[mirrored] = src[0];
+                dst[mirrored + 1] = src[1];
+                dst[mirrored + 2] = src[2];
+                src += 3;
+            }
+        }
+
+        m_sharedMemory->lock();
+        memcpy(m_sharedMemory->getSharedMemory(), &m_frame[0], m_frame.size());
+        m_sharedMemory->unlock();
     }
 
     void OpenGLGrabber::renderNextImageFromRealWord() {
@@ -159,7 +277,9 @@ namespace camgen {
 //                          0, 3,  0,
 //                          0, 0,  -1); // -1 is necessary to rotate the entire model by PI around the y-axis.
 
+        // Skip all parts of the scenario outside the camera's view.
         RenderingConfiguration r = RenderingConfiguration();
+        r.setFrustumCulling(true);
         m_root->render(r);
     }
 
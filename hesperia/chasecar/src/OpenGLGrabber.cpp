@@ -82,7 +82,7 @@ namespace chasecar {
             m_car = core::SharedPointer<TransformGroup>(new hesperia::threeD::TransformGroup());
             m_sensors = core::SharedPointer<TransformGroup>(new hesperia::threeD::TransformGroup());
 
-            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, m_kvc);
 
             // Read scnxArchive and decorate it for getting displayed in an OpenGL scene.
             const bool SHOW_LANE_CONNECTORS = false;
@@ -216,7 +216,9 @@ namespace chasecar {
     }
 
     void OpenGLGrabber::renderNextImageInCar() {
+        // Skip all parts of the scenario outside the camera's view.
         RenderingConfiguration r = RenderingConfiguration();
+        r.setFrustumCulling(true);
         m_root->render(r);
     }
 
@@ -250,8 +252,9 @@ namespace chasecar {
                       lookAtPointCamera.getX(), lookAtPointCamera.getY(), lookAtPointCamera.getZ(),
                       0, 0, 1);
 
-            // Draw scene.
+            // Draw scene; skip all parts outside the camera's view.
             RenderingConfiguration r = RenderingConfiguration();
+            r.setFrustumCulling(true);
             m_root->render(r);
 
             // Update ego position.
@@ -21,6 +21,7 @@
 #ifndef PLUGINS_BIRDSEYEMAP_BIRDSEYEMAPMAPWIDGET_H_
 #define PLUGINS_BIRDSEYEMAP_BIRDSEYEMAPMAPWIDGET_H_
 
+#include <deque>
 #include <map>
 
 #include "core/base/Mutex.h"
@@ -29,9 +30,11 @@
 #include "core/data/environment/Point3.h"
 
 #include "hesperia/data/environment/EgoState.h"
+#include "hesperia/data/environment/Obstacle.h"
 
 #include "hesperia/scenegraph/SceneNode.h"
 #include "hesperia/scenegraph/models/SimpleCar.h"
+#include "hesperia/scenegraph/primitives/Trace.h"
 #include "hesperia/scenegraph/renderer/RenderingConfiguration.h"
 
 #include "plugins/PlugIn.h"
@@ -66,6 +69,10 @@ namespace cockpit {
                     BirdsEyeMapMapWidget& operator=(const BirdsEyeMapMapWidget &/*obj*/);
 
                 public:
+                    enum CONSTANTS {
+                        EGO_TRACE_CAPACITY = 10000
+                    };
+
                     /**
                      * Constructor.
                      *
@@ -132,17 +139,28 @@ namespace cockpit {
                     core::data::environment::Point3 m_centerOfMap;
                     core::data::environment::Point3 m_mouseOld;
 
-                    uint32_t m_numberOfReceivedEgoStates;
                     hesperia::data::environment::EgoState m_egoState;
-                    hesperia::data::environment::EgoState m_lastEgoState;
                     hesperia::scenegraph::models::SimpleCar *m_egoCar;
-                    hesperia::scenegraph::SceneNode *m_egoCarTrace;
+                    hesperia::scenegraph::primitives::Trace *m_egoCarTrace;
 
                     hesperia::scenegraph::SceneNode *m_obstaclesRoot;
                     map<uint32_t, hesperia::scenegraph::SceneNode*> m_mapOfObstacles;
 
+                    // Received data is staged here by nextContainer and applied to the scene graph by paintEvent.
+                    core::base::Mutex m_inboxMutex;
+                    bool m_hasInboxEgoState;
+                    hesperia::data::environment::EgoState m_inboxEgoState;
+                    deque<core::data::environment::Point3> m_inboxEgoPositions;
+                    map<uint32_t, hesperia::data::environment::Obstacle> m_inboxObstacles;
+
                     void createSceneGraph();
 
+                    /**
+                     * This method applies the received data to the scene
+                     * graph. It must be called with m_rootMutex being locked.
+                     */
+                    void processInbox();
+
                     void modifyRenderingConfiguration(core::base::TreeNode<SelectableNodeDescriptor> *node);
             };
 
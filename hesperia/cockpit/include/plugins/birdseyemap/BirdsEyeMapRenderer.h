@@ -68,6 +68,8 @@ namespace cockpit {
 
                     virtual void render(hesperia::scenegraph::primitives::Polygon *p);
 
+                    virtual void render(hesperia::scenegraph::primitives::Trace *t);
+
                 private:
                     QPainter *m_painter;
                     hesperia::scenegraph::renderer::RenderingConfiguration &m_renderingConfiguration;
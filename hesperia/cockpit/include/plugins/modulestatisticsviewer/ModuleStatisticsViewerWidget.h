@@ -30,6 +30,7 @@
 #include "core/io/ContainerListener.h"
 #include "core/data/dmcp/ModuleDescriptor.h"
 #include "core/data/dmcp/ModuleDescriptorComparator.h"
+#include "core/data/InstrumentationStatistic.h"
 #include "core/data/dmcp/ModuleStatistics.h"
 
 #include "plugins/PlugIn.h"
@@ -83,8 +84,23 @@ namespace cockpit {
           virtual void
           nextContainer(core::data::Container &c);
 
+        private:
+          /**
+           * This method replaces the displayed instrumentation data
+           * for the given module; metrics are sorted by their 99th
+           * percentile to show tail-latency offenders first.
+           *
+           * @param md Module.
+           * @param is Instrumentation data.
+           */
+          void
+          updateInstrumentation(const core::data::dmcp::ModuleDescriptor &md, const core::data::InstrumentationStatistic &is);
+
         private:
           LoadPlot *m_plot;
+          QTreeWidget *m_instrumentationView;
+          map<core::data::dmcp::ModuleDescriptor, QTreeWidgetItem*,
+              core::data::dmcp::ModuleDescriptorComparator> m_instrumentationPerModule;
           deque<core::data::dmcp::ModuleStatistics> m_moduleStatistics;
           map<core::data::dmcp::ModuleDescriptor, core::SharedPointer<
               LoadPerModule>, core::data::dmcp::ModuleDescriptorComparator>
@@ -0,0 +1,169 @@
+/**
+ * cockpit - Visualization environment
+ * Copyright (C) 2012 - 2015 Christian Berger
+ * Copyright (C) 2008 - 2011 (as monitor component) Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef COCKPIT_PLUGINS_SHAREDIMAGEVIEWER_SHAREDIMAGEDECIMATOR_H_
+#define COCKPIT_PLUGINS_SHAREDIMAGEVIEWER_SHAREDIMAGEDECIMATOR_H_
+
+#ifdef PANDABOARD
+#include <stdc-predef.h>
+#endif
+
+#include <vector>
+
+#include "QtIncludes.h"
+
+#include "core/SharedPointer.h"
+#include "core/base/Condition.h"
+#include "core/base/Mutex.h"
+#include "core/base/Service.h"
+#include "core/wrapper/SharedMemory.h"
+#include "core/data/image/SharedImage.h"
+
+namespace cockpit {
+
+    namespace plugins {
+
+        namespace sharedimageviewer {
+
+            using namespace std;
+
+            /**
+             * This class copies the newest frame from a shared image and
+             * decimates it to the resolution of the displaying widget in
+             * its own thread. The shared memory is only locked for a
+             * single memcpy into a preallocated buffer so that the
+             * producer is not blocked by the conversion.
+             *
+             * Decimated frames are handed over to the GUI thread using
+             * three preallocated QImages: The worker writes into the
+             * back buffer and swaps it with the ready buffer; paintEvent
+             * swaps the ready buffer with its front buffer only if a new
+             * frame has arrived. The widget's update() is scheduled once
+             * per decimated frame.
+             */
+            class SharedImageDecimator : public core::base::Service {
+                private:
+                    enum {
+                        NUMBER_OF_BUFFERS = 3
+                    };
+
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    SharedImageDecimator(const SharedImageDecimator &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    SharedImageDecimator& operator=(const SharedImageDecimator &/*obj*/);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param widget Widget to be updated for every new frame.
+                     */
+                    SharedImageDecimator(QWidget &widget);
+
+                    virtual ~SharedImageDecimator();
+
+                    /**
+                     * This method selects the shared image to be read. The
+                     * shared memory is attached by the decimator's thread.
+                     *
+                     * @param si Shared image's description.
+                     */
+                    void setSharedImage(const core::data::image::SharedImage &si);
+
+                    /**
+                     * This method sets the size to which frames are decimated.
+                     * Frames are never magnified.
+                     *
+                     * @param width Maximum width.
+                     * @param height Maximum height.
+                     */
+                    void setTargetSize(const uint32_t &width, const uint32_t &height);
+
+                    /**
+                     * This method notifies the decimator that the producer
+                     * has written a new frame into a shared memory. Frames
+                     * from other shared images than the selected one are
+                     * ignored.
+                     *
+                     * @param si Shared image's description sent with the new frame.
+                     */
+                    void notifyNewFrame(const core::data::image::SharedImage &si);
+
+                    /**
+                     * This method returns the newest decimated frame and must
+                     * only be called from the GUI thread. The returned image
+                     * is valid until the next call.
+                     *
+                     * @return Newest decimated frame; might be a null QImage.
+                     */
+                    const QImage& getImageForDisplay();
+
+                private:
+                    virtual void beforeStop();
+
+                    virtual void run();
+
+                    /**
+                     * This method decimates m_frame into the given image.
+                     *
+                     * @param si Shared image's description.
+                     * @param targetWidth Maximum width.
+                     * @param targetHeight Maximum height.
+                     * @param image Image to be reused or reallocated if its size does not match.
+                     * @return true if the frame's format is supported.
+                     */
+                    bool decimate(const core::data::image::SharedImage &si, const uint32_t &targetWidth, const uint32_t &targetHeight, QImage &image);
+
+                private:
+                    QWidget &m_widget;
+
+                    core::base::Condition m_frameCondition;
+                    bool m_hasNewFrame;
+                    bool m_hasNewSharedImage;
+                    core::data::image::SharedImage m_sharedImage;
+                    uint32_t m_targetWidth;
+                    uint32_t m_targetHeight;
+
+                    // Only accessed by the decimator's thread.
+                    core::SharedPointer<core::wrapper::SharedMemory> m_sharedImageMemory;
+                    vector<char> m_frame;
+
+                    core::base::Mutex m_bufferMutex;
+                    vector<QImage> m_buffers;
+                    uint32_t m_backBuffer;
+                    uint32_t m_readyBuffer;
+                    uint32_t m_frontBuffer;
+                    bool m_hasNewImage;
+            };
+
+        }
+    }
+}
+
+#endif /*COCKPIT_PLUGINS_SHAREDIMAGEVIEWER_SHAREDIMAGEDECIMATOR_H_*/
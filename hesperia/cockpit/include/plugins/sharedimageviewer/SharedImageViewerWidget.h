@@ -31,13 +31,11 @@
 
 #include "QtIncludes.h"
 
-#include "core/SharedPointer.h"
-#include "core/base/Mutex.h"
 #include "core/io/ContainerListener.h"
-#include "core/wrapper/SharedMemory.h"
 #include "core/data/image/SharedImage.h"
 
 #include "plugins/PlugIn.h"
+#include "plugins/sharedimageviewer/SharedImageDecimator.h"
 
 namespace cockpit {
 
@@ -86,17 +84,15 @@ namespace cockpit {
 				    void selectedSharedImage(QListWidgetItem *item);
 
                 private:
-                    mutable core::base::Mutex m_sharedImageMemoryMutex;
-                    core::data::image::SharedImage m_sharedImage;
-                    core::SharedPointer<core::wrapper::SharedMemory> m_sharedImageMemory;
-                    QImage *m_drawableImage;
-                    QVector<QRgb> m_grayscale;
+                    SharedImageDecimator m_decimator;
 
                     QListWidget *m_list;
                     vector<string> m_listOfAvailableSharedImages;
                     map<string, core::data::image::SharedImage> m_mapOfAvailableSharedImages;
 
                     virtual void paintEvent(QPaintEvent *evnt);
+
+                    virtual void resizeEvent(QResizeEvent *evnt);
             };
 
         }
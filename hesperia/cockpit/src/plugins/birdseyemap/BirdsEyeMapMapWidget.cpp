@@ -78,13 +78,16 @@ namespace cockpit {
                 m_scaleFactor(9.99995),
                 m_centerOfMap(),
                 m_mouseOld(-1, -1, 0),
-                m_numberOfReceivedEgoStates(0),
                 m_egoState(),
-                m_lastEgoState(),
                 m_egoCar(NULL),
                 m_egoCarTrace(NULL),
                 m_obstaclesRoot(NULL),
-                m_mapOfObstacles() {
+                m_mapOfObstacles(),
+                m_inboxMutex(),
+                m_hasInboxEgoState(false),
+                m_inboxEgoState(),
+                m_inboxEgoPositions(),
+                m_inboxObstacles() {
 
                 m_root->addChild(m_scales);
                 m_root->addChild(m_stationaryElements);
@@ -145,7 +148,7 @@ namespace cockpit {
                 // Setup surroundings.
                 const URL urlOfSCNXFile(m_plugIn.getKeyValueConfiguration().getValue<string>("global.scenario"));
                 if (urlOfSCNXFile.isValid()) {
-                    hesperia::scenario::SCNXArchive &scnxArchive = hesperia::scenario::SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+                    hesperia::scenario::SCNXArchive &scnxArchive = hesperia::scenario::SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, m_plugIn.getKeyValueConfiguration());
 
                     // Read scnxArchive and transform it into renderable scene graph.
                     SceneNode *surroundings = hesperia::scenegraph::transformation::SceneGraphFactory::getInstance().transform(scnxArchive);
@@ -167,7 +170,8 @@ namespace cockpit {
                 m_egoCar = new SimpleCar(egoStateNodeDescriptor, 4, 2, Point3(), 0, Point3(1, 0.84, 0), 2);
                 m_dynamicElements->addChild(m_egoCar);
 
-                m_egoCarTrace = new SceneNode(SceneNodeDescriptor("EgoCar (Trace)"));
+                // The trace keeps the most recent positions at least 0.5m apart.
+                m_egoCarTrace = new hesperia::scenegraph::primitives::Trace(SceneNodeDescriptor("EgoCar (Trace)"), BirdsEyeMapMapWidget::EGO_TRACE_CAPACITY, 0.5, Point3(1, 0.84, 0), 2);
                 m_dynamicElements->addChild(m_egoCarTrace);
 
                 // EgoCar is assignable.
@@ -272,6 +276,8 @@ namespace cockpit {
                 scaledCartesianCoordinates = magnify * cartesianCoordinates;
 
                 {
+                    processInbox();
+
                     // Update position of ego car and renderer it.
                     m_egoCar->setPosition(m_egoState.getPosition(), m_egoState.getRotation().getAngleXY());
 
@@ -298,7 +304,7 @@ namespace cockpit {
             void BirdsEyeMapMapWidget::resetEgoTrace() {
                 Lock l(m_rootMutex);
                 if (m_egoCarTrace != NULL) {
-                    m_egoCarTrace->deleteAllChildren();
+                    m_egoCarTrace->clear();
                 }
             }
 
@@ -319,55 +325,71 @@ namespace cockpit {
             }
 
             void BirdsEyeMapMapWidget::nextContainer(Container &c) {
+                // The scene graph is only modified by the rendering thread; thus, received data is only staged here.
                 if (c.getDataType() == Container::EGOSTATE) {
-                    Lock l(m_rootMutex);
-                    m_egoState = c.getData<EgoState>();
-                    m_numberOfReceivedEgoStates++;
+                    const EgoState es = c.getData<EgoState>();
 
-                    if ( (m_numberOfReceivedEgoStates % 10) == 0 ) {
-                        hesperia::scenegraph::primitives::Line *line = new hesperia::scenegraph::primitives::Line(m_egoCarTrace->getSceneNodeDescriptor(), m_lastEgoState.getPosition(), m_egoState.getPosition(), Point3(1, 0.84, 0), 2);
-                        m_egoCarTrace->addChild(line);
+                    Lock l(m_inboxMutex);
+                    m_inboxEgoState = es;
+                    m_hasInboxEgoState = true;
 
-                        m_lastEgoState = m_egoState;
+                    m_inboxEgoPositions.push_back(es.getPosition());
+                    if (m_inboxEgoPositions.size() > BirdsEyeMapMapWidget::EGO_TRACE_CAPACITY) {
+                        m_inboxEgoPositions.pop_front();
                     }
                 }
 
                 if (c.getDataType() == Container::OBSTACLE) {
-                    if (m_obstaclesRoot != NULL) {
-                        Lock l(m_rootMutex);
-                        Obstacle obstacle = c.getData<Obstacle>();
-                        switch (obstacle.getState()) {
-                            case Obstacle::REMOVE:
-                            {
-                                // Remove obstacle.
-                                map<uint32_t, SceneNode*>::iterator result = m_mapOfObstacles.find(obstacle.getID());
-                                if (result != m_mapOfObstacles.end()) {
-                                    // Remove child from scene graph node.
-                                    m_obstaclesRoot->removeChild(result->second);
-
-                                    // Remove entry from map.
-                                    m_mapOfObstacles.erase(result);
-                                }
-                            }
-                            break;
-
-                            case Obstacle::UPDATE:
-                            {
-                                map<uint32_t, SceneNode*>::iterator result = m_mapOfObstacles.find(obstacle.getID());
-                                if (result != m_mapOfObstacles.end()) {
-                                    // Remove child from scene graph node.
-                                    m_obstaclesRoot->removeChild(result->second);
-
-                                    // Remove entry from map.
-                                    m_mapOfObstacles.erase(result);
-                                }
-                                stringstream contourName;
-                                contourName << "Obstacles";
-                                hesperia::scenegraph::primitives::Polygon *contour = new hesperia::scenegraph::primitives::Polygon(SceneNodeDescriptor(contourName.str()), obstacle.getPolygon().getVertices(), Point3(0, 1, 0), 2);
-                                m_mapOfObstacles[obstacle.getID()] = contour;
-                                m_obstaclesRoot->addChild(contour);
-                            }
-                            break;
+                    const Obstacle obstacle = c.getData<Obstacle>();
+
+                    // Only the most recent state of every obstacle is relevant.
+                    Lock l(m_inboxMutex);
+                    m_inboxObstacles[obstacle.getID()] = obstacle;
+                }
+            }
+
+            void BirdsEyeMapMapWidget::processInbox() {
+                deque<Point3> egoPositions;
+                map<uint32_t, Obstacle> obstacles;
+                {
+                    Lock l(m_inboxMutex);
+                    if (m_hasInboxEgoState) {
+                        m_egoState = m_inboxEgoState;
+                        m_hasInboxEgoState = false;
+                    }
+                    egoPositions.swap(m_inboxEgoPositions);
+                    obstacles.swap(m_inboxObstacles);
+                }
+
+                if (m_egoCarTrace != NULL) {
+                    deque<Point3>::const_iterator it = egoPositions.begin();
+                    while (it != egoPositions.end()) {
+                        m_egoCarTrace->add(*it++);
+                    }
+                }
+
+                if (m_obstaclesRoot != NULL) {
+                    map<uint32_t, Obstacle>::const_iterator it = obstacles.begin();
+                    while (it != obstacles.end()) {
+                        const Obstacle &obstacle = it->second;
+                        ++it;
+
+                        // Remove previous contour.
+                        map<uint32_t, SceneNode*>::iterator result = m_mapOfObstacles.find(obstacle.getID());
+                        if (result != m_mapOfObstacles.end()) {
+                            // Remove child from scene graph node.
+                            m_obstaclesRoot->removeChild(result->second);
+
+                            // Remove entry from map.
+                            m_mapOfObstacles.erase(result);
+                        }
+
+                        if (obstacle.getState() == Obstacle::UPDATE) {
+                            stringstream contourName;
+                            contourName << "Obstacles";
+                            hesperia::scenegraph::primitives::Polygon *contour = new hesperia::scenegraph::primitives::Polygon(SceneNodeDescriptor(contourName.str()), obstacle.getPolygon().getVertices(), Point3(0, 1, 0), 2);
+                            m_mapOfObstacles[obstacle.getID()] = contour;
+                            m_obstaclesRoot->addChild(contour);
                         }
                     }
                 }
@@ -96,6 +96,27 @@ namespace cockpit {
                 }
             }
 
+            void BirdsEyeMapRenderer::render(hesperia::scenegraph::primitives::Trace *t) {
+                if ( (t != NULL) && (t->getNumberOfPoints() > 1) && (m_renderingConfiguration.getSceneNodeRenderingConfiguration(t->getSceneNodeDescriptor()).hasParameter(SceneNodeRenderingConfiguration::ENABLED)) ) {
+                    QPen pen;
+                    pen.setWidth(t->getWidth()*m_pixelPerMeter/10);
+                    pen.setColor(QColor(255*t->getColor().getX(), 255*t->getColor().getY(), 255*t->getColor().getZ()));
+
+                    m_painter->setPen(pen);
+
+                    // Draw the entire trace at once.
+                    const uint32_t size = t->getNumberOfPoints();
+                    QPolygonF polyline;
+                    polyline.reserve(size);
+                    for (uint32_t i = 0; i < size; i++) {
+                        const core::data::environment::Point3 &p = t->getPoint(i);
+                        polyline << QPointF(p.getX()*m_pixelPerMeter, p.getY()*m_pixelPerMeter);
+                    }
+
+                    m_painter->drawPolyline(polyline);
+                }
+            }
+
         }
     }
 } // plugins::birdseyemap
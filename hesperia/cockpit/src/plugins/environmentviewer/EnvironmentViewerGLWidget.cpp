@@ -123,7 +123,7 @@ namespace cockpit {
                 // Setup surroundings.
                 const URL urlOfSCNXFile(getPlugIn().getKeyValueConfiguration().getValue<string>("global.scenario"));
                 if (urlOfSCNXFile.isValid()) {
-                    SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+                    SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, getPlugIn().getKeyValueConfiguration());
 
                     // Read scnxArchive and decorate it for getting displayed in an OpenGL scene.
                     Node *surroundings = DecoratorFactory::getInstance().decorate(scnxArchive);
@@ -18,6 +18,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "QtIncludes.h"
 
 #include "core/macros.h"
@@ -35,9 +38,18 @@ namespace cockpit {
             using namespace core::data;
             using namespace core::data::dmcp;
 
+            /**
+             * Comparator for sorting metrics descending by their 99th percentile.
+             */
+            static bool greaterPercentile99(const InstrumentationMetric &a, const InstrumentationMetric &b) {
+                return a.getPercentile99() > b.getPercentile99();
+            }
+
             ModuleStatisticsViewerWidget::ModuleStatisticsViewerWidget(const PlugIn &/*plugIn*/, QWidget *prnt) :
                     QWidget(prnt),
                     m_plot(NULL),
+                    m_instrumentationView(NULL),
+                    m_instrumentationPerModule(),
                     m_moduleStatistics(),
                     m_loadPerModule(),
                     m_color(0) {
@@ -50,8 +62,17 @@ namespace cockpit {
                 // Show the axes
                 m_plot->setCanvasLineWidth(2);
 
+                // Instrumentation data per module; durations are given in nanoseconds.
+                m_instrumentationView = new QTreeWidget(this);
+                m_instrumentationView->setColumnCount(7);
+                QStringList headerLabel;
+                headerLabel << tr("Module/Metric") << tr("Count") << tr("Mean") << tr("p50") << tr("p99") << tr("p99.9") << tr("Max");
+                m_instrumentationView->setColumnWidth(0, 300);
+                m_instrumentationView->setHeaderLabels(headerLabel);
+
                 QGridLayout* mainGrid = new QGridLayout(this);
                 mainGrid->addWidget(m_plot, 0, 0, 1, 3);
+                mainGrid->addWidget(m_instrumentationView, 1, 0, 1, 3);
 
                 QTimer *timer = new QTimer(this);
                 connect(timer, SIGNAL(timeout()), m_plot, SLOT(replot()));
@@ -61,9 +82,43 @@ namespace cockpit {
 
             ModuleStatisticsViewerWidget::~ModuleStatisticsViewerWidget() {
                 m_loadPerModule.clear();
+                m_instrumentationPerModule.clear();
+                OPENDAVINCI_CORE_DELETE_POINTER(m_instrumentationView);
                 OPENDAVINCI_CORE_DELETE_POINTER(m_plot);
             }
 
+            void ModuleStatisticsViewerWidget::updateInstrumentation(const ModuleDescriptor &md, const InstrumentationStatistic &is) {
+                QTreeWidgetItem *moduleItem = m_instrumentationPerModule[md];
+                if (moduleItem == NULL) {
+                    moduleItem = new QTreeWidgetItem(m_instrumentationView);
+                    moduleItem->setText(0, (md.getName() + " (" + md.getIdentifier() + ")").c_str());
+                    moduleItem->setExpanded(true);
+                    m_instrumentationPerModule[md] = moduleItem;
+                }
+
+                // Replace the data from the previous interval.
+                QList<QTreeWidgetItem*> children = moduleItem->takeChildren();
+                qDeleteAll(children);
+
+                vector<InstrumentationMetric> metrics = is.getListOfMetrics();
+                sort(metrics.begin(), metrics.end(), greaterPercentile99);
+
+                vector<InstrumentationMetric>::const_iterator it = metrics.begin();
+                while (it != metrics.end()) {
+                    QTreeWidgetItem *metricItem = new QTreeWidgetItem(moduleItem);
+                    metricItem->setText(0, it->getName().c_str());
+                    metricItem->setText(1, QString::number(it->getCount()));
+                    if (it->getType() == InstrumentationMetric::HISTOGRAM) {
+                        metricItem->setText(2, QString::number(it->getMean(), 'f', 0));
+                        metricItem->setText(3, QString::number(it->getPercentile50(), 'f', 0));
+                        metricItem->setText(4, QString::number(it->getPercentile99(), 'f', 0));
+                        metricItem->setText(5, QString::number(it->getPercentile999(), 'f', 0));
+                        metricItem->setText(6, QString::number(it->getMaximum(), 'f', 0));
+                    }
+                    it++;
+                }
+            }
+
             void ModuleStatisticsViewerWidget::nextContainer(Container &c) {
                 if (c.getDataType() == Container::MODULESTATISTICS) {
                     ModuleStatistics ms = c.getData<ModuleStatistics>();
@@ -95,6 +150,13 @@ namespace cockpit {
 
                         it++;
                     }
+
+                    map<ModuleDescriptor, InstrumentationStatistic, ModuleDescriptorComparator> instrumentation = ms.getInstrumentationStatistic();
+                    map<ModuleDescriptor, InstrumentationStatistic, ModuleDescriptorComparator>::iterator jt = instrumentation.begin();
+                    while (jt != instrumentation.end()) {
+                        updateInstrumentation(jt->first, jt->second);
+                        jt++;
+                    }
                 }
             }
         }
@@ -0,0 +1,215 @@
+/**
+ * cockpit - Visualization environment
+ * Copyright (C) 2012 - 2015 Christian Berger
+ * Copyright (C) 2008 - 2011 (as monitor component) Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifdef PANDABOARD
+#include <stdc-predef.h>
+#endif
+
+#include <cstring>
+
+#include "QtIncludes.h"
+
+#include "core/base/Lock.h"
+#include "core/wrapper/SharedMemoryFactory.h"
+
+#include "plugins/sharedimageviewer/SharedImageDecimator.h"
+
+namespace cockpit {
+
+    namespace plugins {
+
+        namespace sharedimageviewer {
+
+            using namespace std;
+            using namespace core::base;
+            using namespace core::data::image;
+
+            SharedImageDecimator::SharedImageDecimator(QWidget &widget) :
+                m_widget(widget),
+                m_frameCondition(),
+                m_hasNewFrame(false),
+                m_hasNewSharedImage(false),
+                m_sharedImage(),
+                m_targetWidth(0),
+                m_targetHeight(0),
+                m_sharedImageMemory(),
+                m_frame(),
+                m_bufferMutex(),
+                m_buffers(NUMBER_OF_BUFFERS),
+                m_backBuffer(0),
+                m_readyBuffer(1),
+                m_frontBuffer(2),
+                m_hasNewImage(false) {}
+
+            SharedImageDecimator::~SharedImageDecimator() {}
+
+            void SharedImageDecimator::setSharedImage(const SharedImage &si) {
+                Lock l(m_frameCondition);
+                m_sharedImage = si;
+                m_hasNewSharedImage = true;
+                m_hasNewFrame = true;
+                m_frameCondition.wakeAll();
+            }
+
+            void SharedImageDecimator::setTargetSize(const uint32_t &width, const uint32_t &height) {
+                Lock l(m_frameCondition);
+                m_targetWidth = width;
+                m_targetHeight = height;
+            }
+
+            void SharedImageDecimator::notifyNewFrame(const SharedImage &si) {
+                Lock l(m_frameCondition);
+                if ( (m_sharedImage.getName().size() > 0) && (m_sharedImage.getName() == si.getName()) ) {
+                    m_sharedImage = si;
+                    m_hasNewFrame = true;
+                    m_frameCondition.wakeAll();
+                }
+            }
+
+            const QImage& SharedImageDecimator::getImageForDisplay() {
+                Lock l(m_bufferMutex);
+                if (m_hasNewImage) {
+                    const uint32_t tmp = m_frontBuffer;
+                    m_frontBuffer = m_readyBuffer;
+                    m_readyBuffer = tmp;
+                    m_hasNewImage = false;
+                }
+                return m_buffers[m_frontBuffer];
+            }
+
+            void SharedImageDecimator::beforeStop() {
+                // Awake our thread.
+                Lock l(m_frameCondition);
+                m_frameCondition.wakeAll();
+            }
+
+            void SharedImageDecimator::run() {
+                serviceReady();
+                while (isRunning()) {
+                    SharedImage si;
+                    bool hasNewSharedImage = false;
+                    uint32_t targetWidth = 0;
+                    uint32_t targetHeight = 0;
+                    {
+                        Lock l(m_frameCondition);
+                        while (!m_hasNewFrame && isRunning()) {
+                            m_frameCondition.waitOnSignal();
+                        }
+                        m_hasNewFrame = false;
+                        hasNewSharedImage = m_hasNewSharedImage;
+                        m_hasNewSharedImage = false;
+                        si = m_sharedImage;
+                        targetWidth = m_targetWidth;
+                        targetHeight = m_targetHeight;
+                    }
+
+                    if (!isRunning()) {
+                        break;
+                    }
+
+                    if (hasNewSharedImage) {
+                        m_sharedImageMemory = core::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+                    }
+
+                    const uint32_t size = si.getWidth() * si.getHeight() * si.getBytesPerPixel();
+                    if ( (size > 0) && (m_sharedImageMemory.isValid()) && (m_sharedImageMemory->isValid()) && (size <= m_sharedImageMemory->getSize()) ) {
+                        if (m_frame.size() < size) {
+                            m_frame.resize(size);
+                        }
+
+                        // Keep the producer's critical section as short as possible.
+                        m_sharedImageMemory->lock();
+                        memcpy(&m_frame[0], m_sharedImageMemory->getSharedMemory(), size);
+                        m_sharedImageMemory->unlock();
+
+                        // The back buffer is only accessed by this thread.
+                        if (decimate(si, targetWidth, targetHeight, m_buffers[m_backBuffer])) {
+                            {
+                                Lock l(m_bufferMutex);
+                                const uint32_t tmp = m_readyBuffer;
+                                m_readyBuffer = m_backBuffer;
+                                m_backBuffer = tmp;
+                                m_hasNewImage = true;
+                            }
+
+                            // Repaint only for new frames.
+                            QMetaObject::invokeMethod(&m_widget, "update", Qt::QueuedConnection);
+                        }
+                    }
+                }
+            }
+
+            bool SharedImageDecimator::decimate(const SharedImage &si, const uint32_t &targetWidth, const uint32_t &targetHeight, QImage &image) {
+                const uint32_t bytesPerPixel = si.getBytesPerPixel();
+                if ( (bytesPerPixel != 1) && (bytesPerPixel != 3) ) {
+                    return false;
+                }
+
+                const uint32_t width = si.getWidth();
+                const uint32_t height = si.getHeight();
+
+                // Use the smallest integral step that fits the frame into the target size.
+                uint32_t step = 1;
+                if ( (targetWidth > 0) && (targetHeight > 0) ) {
+                    const uint32_t stepX = (width + targetWidth - 1) / targetWidth;
+                    const uint32_t stepY = (height + targetHeight - 1) / targetHeight;
+                    step = (stepX > stepY) ? stepX : stepY;
+                    step = (step > 1) ? step : 1;
+                }
+
+                const int decimatedWidth = static_cast<int>(width / step);
+                const int decimatedHeight = static_cast<int>(height / step);
+                if ( (decimatedWidth == 0) || (decimatedHeight == 0) ) {
+                    return false;
+                }
+
+                // Reallocate only if the widget or the shared image was resized.
+                if ( (image.width() != decimatedWidth) || (image.height() != decimatedHeight) || (image.format() != QImage::Format_RGB32) ) {
+                    image = QImage(decimatedWidth, decimatedHeight, QImage::Format_RGB32);
+                }
+
+                const uchar *src = reinterpret_cast<const uchar*>(&m_frame[0]);
+                const uint32_t rowStride = step * width * bytesPerPixel;
+                const uint32_t columnStride = step * bytesPerPixel;
+                for (int y = 0; y < decimatedHeight; y++) {
+                    const uchar *srcPixel = src + y * rowStride;
+                    QRgb *dstPixel = reinterpret_cast<QRgb*>(image.scanLine(y));
+
+                    if (bytesPerPixel == 3) {
+                        // Shared images are stored as BGR.
+                        for (int x = 0; x < decimatedWidth; x++) {
+                            dstPixel[x] = qRgb(srcPixel[2], srcPixel[1], srcPixel[0]);
+                            srcPixel += columnStride;
+                        }
+                    }
+                    else {
+                        for (int x = 0; x < decimatedWidth; x++) {
+                            dstPixel[x] = qRgb(srcPixel[0], srcPixel[0], srcPixel[0]);
+                            srcPixel += columnStride;
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+        }
+    }
+}
@@ -26,10 +26,7 @@
 
 #include "QtIncludes.h"
 
-#include "core/macros.h"
-#include "core/base/Lock.h"
 #include "core/data/Container.h"
-#include "core/wrapper/SharedMemoryFactory.h"
 
 #include "plugins/sharedimageviewer/SharedImageViewerWidget.h"
 
@@ -46,11 +43,7 @@ namespace cockpit {
 
             SharedImageViewerWidget::SharedImageViewerWidget(const PlugIn &/*plugIn*/, QWidget *prnt) :
                     QWidget(prnt),
-                    m_sharedImageMemoryMutex(),
-                    m_sharedImage(),
-                    m_sharedImageMemory(),
-                    m_drawableImage(NULL),
-                    m_grayscale(),
+                    m_decimator(*this),
                     m_list(NULL),
 				    m_listOfAvailableSharedImages(),
 				    m_mapOfAvailableSharedImages() {
@@ -58,9 +51,6 @@ namespace cockpit {
                 // Set size.
                 setMinimumSize(640, 480);
 
-                // Create grayscale table.
-                for(int i = 0; i < 256; i++) m_grayscale.push_back(qRgb(i,i,i));
-
                 QGridLayout *gridLayout = new QGridLayout(this);
 
                 m_list = new QListWidget(this);
@@ -70,16 +60,13 @@ namespace cockpit {
 
                 setLayout(gridLayout);
 
-                QTimer *timer = new QTimer(this);
-                connect(timer, SIGNAL(timeout()), this, SLOT(update()));
-                const uint32_t fps = 25;
-                timer->start(1000 / fps);
+                // The decimator schedules a repaint for every new frame.
+                m_decimator.setTargetSize(width(), height());
+                m_decimator.start();
             }
 
             SharedImageViewerWidget::~SharedImageViewerWidget() {
-                Lock l(m_sharedImageMemoryMutex);
-
-                OPENDAVINCI_CORE_DELETE_POINTER(m_drawableImage);
+                m_decimator.stop();
             }
 
             void SharedImageViewerWidget::selectedSharedImage(QListWidgetItem *item) {
@@ -88,13 +75,10 @@ namespace cockpit {
             		SharedImage si = m_mapOfAvailableSharedImages[item->text().toStdString()];
 
             		if ( (si.getWidth() * si.getHeight()) > 0 ) {
-            			Lock l(m_sharedImageMemoryMutex);
-
             			cerr << "Using shared image: " << si.toString() << endl;
                         setWindowTitle(QString::fromStdString(si.toString()));
 
-            			m_sharedImageMemory = core::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
-            			m_sharedImage = si;
+            			m_decimator.setSharedImage(si);
 
             			// Remove the selection box.
             			m_list->hide();
@@ -118,34 +102,26 @@ namespace cockpit {
                     		// Store for further usage.
                     		m_mapOfAvailableSharedImages[si.getName()] = si;
                     	}
+
+                    	// Decimate the new frame if it belongs to the selected shared image.
+                    	m_decimator.notifyNewFrame(si);
                     }
                 }
             }
 
             void SharedImageViewerWidget::paintEvent(QPaintEvent * /*evnt*/) {
-                Lock l(m_sharedImageMemoryMutex);
-
-                if ( (m_sharedImageMemory.isValid()) && (m_sharedImageMemory->isValid()) ) {
-                    m_sharedImageMemory->lock();
-
-                    OPENDAVINCI_CORE_DELETE_POINTER(m_drawableImage);
-                    if (m_sharedImage.getBytesPerPixel() == 3) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_RGB888);
-                        *m_drawableImage = m_drawableImage->rgbSwapped();
-                    }
-                    else if (m_sharedImage.getBytesPerPixel() == 1) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_Indexed8);
-                        m_drawableImage->setColorTable(m_grayscale);
-                    }
-
-                    if (m_drawableImage != NULL) {
-                        QPainter widgetPainter(this);
-                        widgetPainter.drawImage(0, 0, *m_drawableImage);
-                    }
-                    m_sharedImageMemory->unlock();
+                const QImage &image = m_decimator.getImageForDisplay();
+                if (!image.isNull()) {
+                    QPainter widgetPainter(this);
+                    widgetPainter.drawImage(0, 0, image);
                 }
             }
 
+            void SharedImageViewerWidget::resizeEvent(QResizeEvent *evnt) {
+                QWidget::resizeEvent(evnt);
+                m_decimator.setTargetSize(width(), height());
+            }
+
         }
     }
 }
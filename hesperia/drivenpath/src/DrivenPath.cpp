@@ -22,6 +22,7 @@
 
 #include "core/macros.h"
 #include "core/base/KeyValueConfiguration.h"
+#include "core/base/KeyValueConfigurationHandle.h"
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
 #include "core/io/URL.h"
@@ -32,6 +33,8 @@
 #include "hesperia/scenario/SCNXArchive.h"
 #include "hesperia/scenario/SCNXArchiveFactory.h"
 #include "hesperia/data/scenario/Scenario.h"
+#include "hesperia/scenario/LaneMatch.h"
+#include "hesperia/scenario/LaneMatcher.h"
 #include "hesperia/scenario/LaneVisitor.h"
 #include "hesperia/data/environment/EgoState.h"
 #include "core/data/environment/Point3.h"
@@ -74,7 +77,7 @@ namespace measurements {
         // Read scenario.
         vector<NamedLine> listOfLines;
         if (urlOfSCNXFile.isValid()) {
-            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, getKeyValueConfiguration());
 
             hesperia::data::scenario::Scenario &scenario = scnxArchive.getScenario();
 
@@ -110,6 +113,11 @@ namespace measurements {
         }
 
 
+        // Index all lane segments once.
+        LaneMatcher laneMatcher(listOfLines);
+        const KeyValueConfigurationHandle<double> &searchRadius = getKeyValueConfigurationHandle<double>("drivenpath.searchradius", 20);
+        vector<LaneMatch> matches;
+
         unsigned int counter = 0;
 
         while (getModuleState() == ModuleState::RUNNING) {
@@ -121,46 +129,29 @@ namespace measurements {
 
             // Algorithm:
             // 1. Get position of vehicle.
-            // 2. Calculate perpendicular point to all lines in the list.
-            // 3. Determine the distance between the position and the perpendicular point.
-            // 4. Iterate through all named lines and determine the smallest distance.
-            // 5. Print the smallest distance/named line.
-
-            string oldName = "";
-            double oldDistance = numeric_limits<double>::max();
-            string oldNameOverall = "";
-            double oldDistanceOverall = numeric_limits<double>::max();
-            it = listOfLines.begin();
-            while (it != listOfLines.end()) {
-                NamedLine l =(*it++);
-                if (l.getName().compare(oldName) != 0) {
-                    // Print results:
-                    if (oldName.compare("") != 0) {
-                        cout << counter << ";Distance;" << oldName << ";" << oldDistance << endl;
-                    }
-
-                    // Reset values because we are starting a new turn.
-                    oldDistance = numeric_limits<double>::max();
+            // 2. Query all lane segments within the search radius.
+            // 3. Print the smallest distance for every named line found (matches are sorted by distance).
+            // 4. Print the smallest distance overall.
+            const Point3 vehiclePosition = es.getPosition();
+
+            vector<bool> isLanePrinted(laneMatcher.getNumberOfLanes(), false);
+            laneMatcher.findWithinRadius(vehiclePosition, *searchRadius, matches);
+            vector<LaneMatch>::const_iterator jt = matches.begin();
+            while (jt != matches.end()) {
+                const LaneMatch &m = (*jt++);
+                if (!isLanePrinted[m.getLaneID()]) {
+                    isLanePrinted[m.getLaneID()] = true;
+                    cout << counter << ";Distance;" << laneMatcher.getLaneName(m.getLaneID()) << ";" << m.getDistance() << endl;
                 }
-
-                Point3 vehiclePosition = es.getPosition();
-                Point3 perpendicularPoint = l.getPerpendicularPoint(vehiclePosition);
-
-                // Compute distance between vehicle's position and lane segment.
-                double length = (perpendicularPoint - vehiclePosition).lengthXY();
-                if (length < oldDistance) {
-                    oldDistance = length;
-                }
-
-                if (length < oldDistanceOverall) {
-                    oldDistanceOverall = length;
-                    oldNameOverall = l.getName();
-                }
-
-                oldName = l.getName();
             }
 
-            cout << counter << ";DistanceOverall;" << oldNameOverall << ";" << oldDistanceOverall << endl;
+            // Nearest segment without limiting the distance.
+            if (matches.empty()) {
+                laneMatcher.findNearest(vehiclePosition, 1, numeric_limits<double>::max(), matches);
+            }
+            if (!matches.empty()) {
+                cout << counter << ";DistanceOverall;" << laneMatcher.getLaneName(matches.front().getLaneID()) << ";" << matches.front().getDistance() << endl;
+            }
 
             counter++;
         }
@@ -79,7 +79,7 @@ namespace irus {
         // Load scenario.
         const URL urlOfSCNXFile(getKeyValueConfiguration().getValue<string>("global.scenario"));
         if (urlOfSCNXFile.isValid()) {
-            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+            SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, getKeyValueConfiguration());
 
             hesperia::data::scenario::Scenario &scenario = scnxArchive.getScenario();
 
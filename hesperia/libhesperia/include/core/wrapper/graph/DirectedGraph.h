@@ -27,9 +27,6 @@
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
 
-#include <boost/graph/graph_traits.hpp>
-#include <boost/graph/adjacency_list.hpp>
-
 #include "core/wrapper/graph/Edge.h"
 #include "core/wrapper/graph/Vertex.h"
 
@@ -40,7 +37,16 @@ namespace core {
             using namespace std;
 
             /**
-             * This interface encapsulates all necessary method for a graph's vertex.
+             * This class implements a directed graph for routing. Vertices
+             * and edges are collected in a map; before the first query
+             * after any modification, the graph is compiled into a
+             * compressed sparse row (CSR) representation and distances
+             * from and to a small set of landmarks are precomputed (ALT).
+             * These distances are used as lower bounds for the A* search
+             * and do not depend on the vertices' positions.
+             *
+             * Queries reuse internal buffers; thus, an instance must not
+             * be queried concurrently.
              */
             class OPENDAVINCI_API DirectedGraph {
                 private:
@@ -103,6 +109,13 @@ namespace core {
                      */
                     const string toString() const;
 
+                    /**
+                     * This method compiles the graph and precomputes the
+                     * landmark distances. It is called implicitly by the
+                     * first query after the graph was modified.
+                     */
+                    void prepare();
+
                     /**
                      * This method returns the shortest path between two given vertices.
                      *
@@ -112,15 +125,127 @@ namespace core {
                      */
                     vector<const Vertex*> getShortestPath(const Vertex &v1, const Vertex &v2);
 
+                    /**
+                     * This method returns the shortest paths from one
+                     * vertex to several vertices using one search.
+                     *
+                     * @param v1 Start vertex.
+                     * @param listOfVertices End vertices.
+                     * @return One list of vertices for every end vertex (empty if not reachable).
+                     */
+                    vector<vector<const Vertex*> > getShortestPaths(const Vertex &v1, const vector<const Vertex*> &listOfVertices);
+
+                    /**
+                     * This method returns the lengths of the shortest
+                     * paths between all pairs of the given vertices.
+                     *
+                     * @param listOfStartVertices Start vertices.
+                     * @param listOfEndVertices End vertices.
+                     * @return Matrix with one row per start vertex containing the costs to each end vertex (-1 if not reachable).
+                     */
+                    vector<vector<double> > getDistances(const vector<const Vertex*> &listOfStartVertices, const vector<const Vertex*> &listOfEndVertices);
+
                 private:
-                    typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS, const Vertex*, boost::property<boost::edge_weight_t, double> > GraphDefinition;
-                    typedef boost::property_map<GraphDefinition, boost::edge_weight_t>::type WeightMap;
+                    enum {
+                        NUMBER_OF_LANDMARKS = 8
+                    };
+
+                    static const uint32_t NONE;
+                    static const double INFINITE;
 
-                    GraphDefinition m_graph; // Graph.
-                    WeightMap m_weightMap; // Edges' weights.
-                    map<int32_t, GraphDefinition::vertex_descriptor> m_mapOfVertices; // Map of vertices.
-                    vector<const Vertex*> m_listOfVertices;
+                    vector<const Vertex*> m_listOfVertices; // Index is the vertex' number.
                     vector<const Edge*> m_listOfEdges;
+                    map<int32_t, uint32_t> m_mapOfVertices; // Vertex' identifier to number.
+                    map<pair<uint32_t, uint32_t>, double> m_mapOfEdges; // Edge from first to second number and its costs.
+                    bool m_prepared;
+
+                    // CSR representation of the outgoing and incoming edges.
+                    vector<uint32_t> m_forwardOffsets;
+                    vector<uint32_t> m_forwardTargets;
+                    vector<double> m_forwardCosts;
+                    vector<uint32_t> m_backwardOffsets;
+                    vector<uint32_t> m_backwardTargets;
+                    vector<double> m_backwardCosts;
+
+                    // Distances from and to every landmark (one row per landmark).
+                    uint32_t m_numberOfLandmarks;
+                    vector<double> m_distancesFromLandmarks;
+                    vector<double> m_distancesToLandmarks;
+
+                    // Buffers for the searches; an entry is valid if its stamp matches m_stamp.
+                    vector<double> m_distances;
+                    vector<uint32_t> m_predecessors;
+                    vector<uint32_t> m_stamps;
+                    vector<bool> m_settled;
+                    uint32_t m_stamp;
+
+                    /**
+                     * This method returns the vertex' number.
+                     *
+                     * @param v Vertex.
+                     * @return Number or NONE.
+                     */
+                    uint32_t getNumber(const Vertex &v) const;
+
+                    /**
+                     * This method computes the costs from (or to) the
+                     * given vertex to all other vertices.
+                     *
+                     * @param source Vertex' number.
+                     * @param forward true to follow the edges' direction.
+                     * @param distances Resulting costs (INFINITE if not reachable).
+                     */
+                    void computeAllDistances(const uint32_t &source, const bool &forward, double *distances) const;
+
+                    /**
+                     * This method returns the landmark based lower bound
+                     * for the costs from v to target.
+                     *
+                     * @param v Vertex' number.
+                     * @param target Target's number.
+                     * @return Lower bound.
+                     */
+                    double getLowerBound(const uint32_t &v, const uint32_t &target) const;
+
+                    /**
+                     * This method resets the search buffers.
+                     *
+                     * @param source Start vertex' number.
+                     */
+                    void resetSearch(const uint32_t &source);
+
+                    /**
+                     * This method returns the costs to v found by the last search.
+                     *
+                     * @param v Vertex' number.
+                     * @return Costs or INFINITE.
+                     */
+                    double getDistance(const uint32_t &v) const;
+
+                    /**
+                     * This method searches the shortest path using A*.
+                     *
+                     * @param source Start vertex' number.
+                     * @param target End vertex' number.
+                     */
+                    void search(const uint32_t &source, const uint32_t &target);
+
+                    /**
+                     * This method searches the shortest paths to all
+                     * targets using Dijkstra's algorithm.
+                     *
+                     * @param source Start vertex' number.
+                     * @param targets End vertices' numbers.
+                     */
+                    void search(const uint32_t &source, const vector<uint32_t> &targets);
+
+                    /**
+                     * This method returns the path to target found by the last search.
+                     *
+                     * @param target End vertex' number.
+                     * @return List of vertices or empty list if target was not reached.
+                     */
+                    vector<const Vertex*> getPath(const uint32_t &target) const;
             };
 
         }
@@ -0,0 +1,146 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_WRAPPER_PARSER_PARALLELPARSER_H_
+#define HESPERIA_CORE_WRAPPER_PARSER_PARALLELPARSER_H_
+
+#include <string>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/base/Mutex.h"
+#include "core/base/ParallelTask.h"
+#include "core/base/ParallelExecutor.h"
+
+namespace core {
+    namespace wrapper {
+        namespace parser {
+
+            using namespace std;
+
+            /**
+             * This interface describes one part of a document to be
+             * parsed by ParallelParser.
+             */
+            class OPENDAVINCI_API ParallelParserJob {
+                public:
+                    virtual ~ParallelParserJob();
+
+                    /**
+                     * This method is called in the calling thread before
+                     * any job is executed. It must create the grammar and
+                     * let Boost.Spirit instantiate the grammar's definition
+                     * (for example by parsing an empty string) since
+                     * Boost.Spirit registers definitions in unsynchronized
+                     * static data.
+                     */
+                    virtual void prepare() = 0;
+
+                    /**
+                     * This method is called from a worker thread and parses
+                     * the part of the document. It must not throw.
+                     */
+                    virtual void execute() = 0;
+            };
+
+            /**
+             * This class executes ParallelParserJobs by a
+             * core::base::ParallelExecutor. All jobs are prepared and
+             * destroyed in the calling thread; only the actual parsing
+             * and AST visiting is done concurrently. Callers must
+             * therefore ensure that no other instance of the same
+             * grammar type is created, used, or destroyed while
+             * execute() is running.
+             *
+             * @code
+             * vector<ParallelParserJob*> jobs;
+             * ...
+             * ParallelParser pp(ParallelParser::getNumberOfProcessors());
+             * pp.execute(jobs);
+             * @endcode
+             */
+            class OPENDAVINCI_API ParallelParser : public core::base::ParallelTask {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    ParallelParser(const ParallelParser &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    ParallelParser& operator=(const ParallelParser &);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param numberOfWorkers Number of worker threads; 0 or 1 parses in the calling thread.
+                     */
+                    ParallelParser(const uint32_t &numberOfWorkers);
+
+                    virtual ~ParallelParser();
+
+                    /**
+                     * This method returns the number of online processors.
+                     *
+                     * @return Number of processors (at least 1).
+                     */
+                    static uint32_t getNumberOfProcessors();
+
+                    /**
+                     * This method splits the given document into lines
+                     * and returns the first word of every line, which is
+                     * the keyword for the line-oriented grammars.
+                     *
+                     * @param s Document.
+                     * @param keywords First word of every line (empty for blank lines).
+                     * @param lineBegins Offset of every line's first character followed by s.size().
+                     */
+                    static void getKeywords(const string &s, vector<string> &keywords, vector<uint32_t> &lineBegins);
+
+                    /**
+                     * This method prepares all jobs in the calling thread
+                     * and executes them concurrently. It returns after all
+                     * jobs have been executed.
+                     *
+                     * @param jobs Jobs to be executed.
+                     */
+                    void execute(const vector<ParallelParserJob*> &jobs);
+
+                    virtual void execute(const uint32_t &index);
+
+                private:
+                    core::base::ParallelExecutor m_parallelExecutor;
+
+                    core::base::Mutex m_jobsMutex;
+                    const vector<ParallelParserJob*> *m_jobs;
+            };
+
+        }
+    }
+} // core::wrapper::parser
+
+#endif /*HESPERIA_CORE_WRAPPER_PARSER_PARALLELPARSER_H_*/
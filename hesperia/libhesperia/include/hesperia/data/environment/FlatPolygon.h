@@ -0,0 +1,222 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_DATA_ENVIRONMENT_FLATPOLYGON_H_
+#define HESPERIA_DATA_ENVIRONMENT_FLATPOLYGON_H_
+
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/Polygon.h"
+
+namespace hesperia {
+    namespace data {
+        namespace environment {
+
+            using namespace std;
+
+            using namespace core::data::environment;
+
+            /**
+             * This class stores the vertices of a polygon as two flat
+             * arrays of X and Y coordinates (structure-of-arrays) for
+             * geometric computations ignoring the Z coordinate. It is
+             * not serializable and has no virtual methods; the loops in
+             * its kernels operate on contiguous doubles without creating
+             * temporary Point3 or Line objects so that the compiler can
+             * vectorize them.
+             *
+             * Use this class for bulk queries like sensor simulation and
+             * convert from/to Polygon at the boundaries.
+             */
+            class OPENDAVINCI_API FlatPolygon {
+                private:
+                    const static double EPSILON;
+
+                public:
+                    FlatPolygon();
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param polygon Polygon to be converted; vertex order is kept.
+                     */
+                    FlatPolygon(const Polygon &polygon);
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param vertices List of vertices; vertex order is kept.
+                     */
+                    FlatPolygon(const vector<Point3> &vertices);
+
+                    /**
+                     * Copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    FlatPolygon(const FlatPolygon &obj);
+
+                    ~FlatPolygon();
+
+                    /**
+                     * Assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    FlatPolygon& operator=(const FlatPolygon &obj);
+
+                    /**
+                     * This method adds a vertex.
+                     *
+                     * @param x X coordinate.
+                     * @param y Y coordinate.
+                     */
+                    void add(const double &x, const double &y);
+
+                    /**
+                     * This method adds a vertex.
+                     *
+                     * @param p Vertex to be added; Z is ignored.
+                     */
+                    void add(const Point3 &p);
+
+                    /**
+                     * This method reserves memory for the given number of vertices.
+                     *
+                     * @param size Number of vertices.
+                     */
+                    void reserve(const uint32_t &size);
+
+                    /**
+                     * This method removes all vertices but keeps the allocated memory.
+                     */
+                    void clear();
+
+                    /**
+                     * This method returns this polygon's size.
+                     *
+                     * @return Number of vertices.
+                     */
+                    uint32_t getSize() const;
+
+                    /**
+                     * This method returns the X coordinates.
+                     *
+                     * @return Pointer to getSize() X coordinates or NULL if empty.
+                     */
+                    const double* getX() const;
+
+                    /**
+                     * This method returns the Y coordinates.
+                     *
+                     * @return Pointer to getSize() Y coordinates or NULL if empty.
+                     */
+                    const double* getY() const;
+
+                    /**
+                     * This method converts this polygon into a Polygon
+                     * (Z is set to 0). Note that Polygon sorts its vertices
+                     * by angle when being copied.
+                     *
+                     * @return Polygon.
+                     */
+                    Polygon toPolygon() const;
+
+                    /**
+                     * This method computes the axis aligned bounding box.
+                     *
+                     * @param minX Smallest X coordinate.
+                     * @param minY Smallest Y coordinate.
+                     * @param maxX Greatest X coordinate.
+                     * @param maxY Greatest Y coordinate.
+                     * @return false if this polygon is empty.
+                     */
+                    bool getBoundingBox(double &minX, double &minY, double &maxX, double &maxY) const;
+
+                    /**
+                     * This method checks if the given point is within this
+                     * polygon using the crossing number test.
+                     *
+                     * @param x X coordinate of the point.
+                     * @param y Y coordinate of the point.
+                     * @return true, if the point is within this polygon.
+                     */
+                    bool containsIgnoreZ(const double &x, const double &y) const;
+
+                    /**
+                     * This method checks for all vertices of points whether
+                     * they are within this polygon.
+                     *
+                     * @param points Points to be tested.
+                     * @param inside Result for every point (1 for inside, 0 otherwise); resized to points.getSize().
+                     * @return Number of points within this polygon.
+                     */
+                    uint32_t containsIgnoreZ(const FlatPolygon &points, vector<uint8_t> &inside) const;
+
+                    /**
+                     * This method intersects the segment from A to B with
+                     * all edges of this polygon and returns the intersection
+                     * nearest to A.
+                     *
+                     * @param ax X coordinate of A.
+                     * @param ay Y coordinate of A.
+                     * @param bx X coordinate of B.
+                     * @param by Y coordinate of B.
+                     * @param t Parameter in [0, 1] of the nearest intersection along A to B.
+                     * @return true, if an intersection point could be found.
+                     */
+                    bool intersectSegmentIgnoreZ(const double &ax, const double &ay, const double &bx, const double &by, double &t) const;
+
+                    /**
+                     * This method clips this polygon against the given
+                     * convex polygon (Sutherland-Hodgman).
+                     *
+                     * @param convexClip Convex clipping polygon with any orientation.
+                     * @param result Resulting polygon; previous contents are replaced.
+                     * @return Number of vertices in result.
+                     */
+                    uint32_t clipIgnoreZ(const FlatPolygon &convexClip, FlatPolygon &result) const;
+
+                    /**
+                     * This method computes the point on the outline of this
+                     * polygon nearest to the given point.
+                     *
+                     * @param x X coordinate of the point.
+                     * @param y Y coordinate of the point.
+                     * @param nearestX X coordinate of the nearest point.
+                     * @param nearestY Y coordinate of the nearest point.
+                     * @return Distance to the nearest point or -1 if this polygon is empty.
+                     */
+                    double getNearestPointIgnoreZ(const double &x, const double &y, double &nearestX, double &nearestY) const;
+
+                private:
+                    vector<double> m_x;
+                    vector<double> m_y;
+            };
+
+        }
+    }
+} // hesperia::data::environment
+
+#endif /*HESPERIA_DATA_ENVIRONMENT_FLATPOLYGON_H_*/
@@ -82,7 +82,7 @@ namespace hesperia {
                      *
                      * @return Vertices from this polygon.
                      */
-                    vector<Point3> getVertices() const;
+                    const vector<Point3>& getVertices() const;
 
                     /**
                      * This method returns this polygon's size.
@@ -0,0 +1,107 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_DECORATOR_DATA2COLUMNS_H_
+#define HESPERIA_CORE_DECORATOR_DATA2COLUMNS_H_
+
+#include <string>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/data/Container.h"
+
+namespace hesperia {
+    namespace decorator {
+
+        using namespace std;
+
+        /**
+         * This class converts the contents of containers into rows of
+         * fixed-width numeric columns for offline analysis. Every row
+         * starts with the container's sent and received time stamps
+         * in microseconds followed by the fields of the data type;
+         * boolean fields are stored as 0 or 1.
+         *
+         * All data types with the same DATATYPE have the same number
+         * of columns; thus, rows can be stored as consecutive arrays of
+         * doubles.
+         */
+        class OPENDAVINCI_API Data2Columns {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                Data2Columns(const Data2Columns &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                Data2Columns& operator=(const Data2Columns &);
+
+            private:
+                Data2Columns();
+
+            public:
+                virtual ~Data2Columns();
+
+                /**
+                 * This method returns all supported data types.
+                 *
+                 * @return List of supported data types.
+                 */
+                static const vector<core::data::Container::DATATYPE> getListOfSupportedDataTypes();
+
+                /**
+                 * This method returns the name of the given data type as
+                 * returned by Container::toString().
+                 *
+                 * @param dataType Data type.
+                 * @return Name or "" if the data type is not supported.
+                 */
+                static const string getName(const core::data::Container::DATATYPE &dataType);
+
+                /**
+                 * This method returns the names of all columns for the
+                 * given data type.
+                 *
+                 * @param dataType Data type.
+                 * @return Names of the columns or an empty list if the data type is not supported.
+                 */
+                static const vector<string> getColumnNames(const core::data::Container::DATATYPE &dataType);
+
+                /**
+                 * This method appends the columns of the given container
+                 * to row.
+                 *
+                 * @param c Container to convert.
+                 * @param row Row to append the values to.
+                 * @return Number of appended values; 0 if the data type is not supported.
+                 */
+                static uint32_t toColumns(core::data::Container &c, vector<double> &row);
+        };
+
+    }
+} // hesperia::decorator
+
+#endif /*HESPERIA_CORE_DECORATOR_DATA2COLUMNS_H_*/
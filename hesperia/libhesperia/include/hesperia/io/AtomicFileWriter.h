@@ -0,0 +1,76 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_IO_ATOMICFILEWRITER_H_
+#define HESPERIA_IO_ATOMICFILEWRITER_H_
+
+#include <string>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+namespace hesperia {
+    namespace io {
+
+        using namespace std;
+
+        /**
+         * This class replaces files atomically: The contents are
+         * written into a temporary file next to the destination
+         * which is renamed afterwards. Thus, concurrent readers see
+         * either the previous or the complete new file but never a
+         * partially written one.
+         */
+        class OPENDAVINCI_API AtomicFileWriter {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                AtomicFileWriter(const AtomicFileWriter &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                AtomicFileWriter& operator=(const AtomicFileWriter &);
+
+            private:
+                AtomicFileWriter();
+
+            public:
+                virtual ~AtomicFileWriter();
+
+                /**
+                 * This method replaces the given file by the given
+                 * contents. The temporary file is removed on failure.
+                 *
+                 * @param fileName File to be replaced.
+                 * @param contents Contents to be written.
+                 * @return true if the file was replaced.
+                 */
+                static bool write(const string &fileName, const string &contents);
+        };
+
+    }
+} // hesperia::io
+
+#endif /*HESPERIA_IO_ATOMICFILEWRITER_H_*/
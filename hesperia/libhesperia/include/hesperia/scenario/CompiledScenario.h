@@ -0,0 +1,140 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENARIO_COMPILEDSCENARIO_H_
+#define HESPERIA_SCENARIO_COMPILEDSCENARIO_H_
+
+#include <iostream>
+#include <string>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/wrapper/DecompressedData.h"
+#include "hesperia/data/scenario/Scenario.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        /**
+         * This class reads and writes the compiled form of a parsed
+         * Scenario. The compiled form consists of a header (magic
+         * number, format version, checksum and length of the SCN source
+         * it was created from) followed by the serialized Scenario.
+         * Thus, loading a compiled scenario only needs to deserialize
+         * the data structure instead of parsing the SCN grammar again.
+         *
+         * A compiled scenario is stored next to its SCNX archive using
+         * the suffix ".scnc" and is only used by SCNXArchiveFactory if
+         * its checksum matches the archive's scenario.scn.
+         */
+        class OPENDAVINCI_API CompiledScenario {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                CompiledScenario(const CompiledScenario &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                CompiledScenario& operator=(const CompiledScenario &);
+
+            private:
+                CompiledScenario();
+
+            public:
+                enum CONSTANTS {
+                    MAGIC_NUMBER = 0x53434E43, // "SCNC"
+                    VERSION = 1
+                };
+
+                virtual ~CompiledScenario();
+
+                /**
+                 * This method returns the name of the compiled scenario
+                 * for the given SCNX archive.
+                 *
+                 * @param scnxFileName File name of the SCNX archive.
+                 * @return File name of the compiled scenario.
+                 */
+                static const string getFileName(const string &scnxFileName);
+
+                /**
+                 * This method reads the entire scenario.scn from the
+                 * given archive.
+                 *
+                 * @param data Decompressed SCNX archive.
+                 * @param scn SCN source.
+                 * @return true if the archive contains scenario.scn.
+                 */
+                static bool getSCN(core::wrapper::DecompressedData &data, string &scn);
+
+                /**
+                 * This method computes the checksum (CRC-32) of the SCN
+                 * source.
+                 *
+                 * @param scn SCN source.
+                 * @return Checksum.
+                 */
+                static uint32_t getChecksum(const string &scn);
+
+                /**
+                 * This method writes the compiled form of a scenario.
+                 *
+                 * @param out Stream to write to.
+                 * @param scn SCN source the scenario was parsed from.
+                 * @param scenario Parsed scenario.
+                 */
+                static void write(ostream &out, const string &scn, const data::scenario::Scenario &scenario);
+
+                /**
+                 * This method reads the compiled form of a scenario if
+                 * it was created from the given SCN source with the
+                 * current format version.
+                 *
+                 * @param in Stream to read from.
+                 * @param scn SCN source to be matched.
+                 * @param scenario Scenario to be read.
+                 * @return true if the compiled scenario could be used.
+                 */
+                static bool read(istream &in, const string &scn, data::scenario::Scenario &scenario);
+
+                /**
+                 * This method parses the scenario.scn from the given
+                 * SCNX archive and stores its compiled form next to it
+                 * (cf. getFileName).
+                 *
+                 * @param scnxFileName File name of the SCNX archive.
+                 * @return true if the compiled scenario was written.
+                 * @throws InvalidArgumentException if the SCN file could not be parsed.
+                 */
+                static bool compile(const string &scnxFileName);
+        };
+
+    }
+} // hesperia::scenario
+
+#endif /*HESPERIA_SCENARIO_COMPILEDSCENARIO_H_*/
@@ -0,0 +1,126 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENARIO_LANEMATCH_H_
+#define HESPERIA_SCENARIO_LANEMATCH_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/data/environment/Point3.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        /**
+         * This class describes the result of matching a position
+         * against one lane segment (cf. LaneMatcher).
+         */
+        class OPENDAVINCI_API LaneMatch {
+            public:
+                LaneMatch();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param segment Index of the matched segment.
+                 * @param laneID ID of the lane the segment belongs to.
+                 * @param distance Distance in the XY plane between the position and the segment.
+                 * @param t Parameter in [0, 1] of the matched point along the segment.
+                 * @param point Matched point on the segment.
+                 * @param heading Direction of the segment.
+                 */
+                LaneMatch(const uint32_t &segment, const uint32_t &laneID, const double &distance,
+                          const double &t, const core::data::environment::Point3 &point, const double &heading);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                LaneMatch(const LaneMatch &obj);
+
+                virtual ~LaneMatch();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                LaneMatch& operator=(const LaneMatch &obj);
+
+                /**
+                 * This method returns the index of the matched segment
+                 * in the list of lines the LaneMatcher was created from.
+                 *
+                 * @return Index of the segment.
+                 */
+                uint32_t getSegment() const;
+
+                /**
+                 * This method returns the ID of the matched lane.
+                 *
+                 * @return Lane ID (cf. LaneMatcher::getLaneName).
+                 */
+                uint32_t getLaneID() const;
+
+                /**
+                 * This method returns the distance in the XY plane.
+                 *
+                 * @return Distance to the matched point.
+                 */
+                double getDistance() const;
+
+                /**
+                 * This method returns the position along the segment.
+                 *
+                 * @return 0 for the segment's start and 1 for its end.
+                 */
+                double getT() const;
+
+                /**
+                 * This method returns the matched point.
+                 *
+                 * @return Point on the segment nearest to the position.
+                 */
+                const core::data::environment::Point3 getPoint() const;
+
+                /**
+                 * This method returns the direction of the segment.
+                 *
+                 * @return Heading in [-PI, PI].
+                 */
+                double getHeading() const;
+
+            private:
+                uint32_t m_segment;
+                uint32_t m_laneID;
+                double m_distance;
+                double m_t;
+                core::data::environment::Point3 m_point;
+                double m_heading;
+        };
+
+    }
+} // hesperia::scenario
+
+#endif /*HESPERIA_SCENARIO_LANEMATCH_H_*/
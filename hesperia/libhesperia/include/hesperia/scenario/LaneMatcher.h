@@ -0,0 +1,253 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENARIO_LANEMATCHER_H_
+#define HESPERIA_SCENARIO_LANEMATCHER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/NamedLine.h"
+#include "hesperia/scenario/LaneMatch.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        /**
+         * This class matches positions against the lane segments
+         * computed by LaneVisitor. The segments are stored in flat
+         * arrays and indexed by a uniform grid in the XY plane so that
+         * a query only computes the distance to the segments in the
+         * cells around the position instead of projecting the position
+         * onto all segments of the map.
+         *
+         * Segments are directed from A to B. Lanes are identified by
+         * the names of the NamedLines and numbered in the order of
+         * their first appearance.
+         *
+         * All queries are const and do not modify the index; thus, one
+         * instance can be shared between threads once it is constructed.
+         *
+         * @code
+         * LaneVisitor lv(graph, scenario);
+         * scenario.accept(lv);
+         * LaneMatcher matcher(lv.getListOfLines());
+         *
+         * vector<LaneMatch> matches;
+         * matcher.findNearest(egoState.getPosition(), egoState.getRotation().getAngleXY(), 0.5, 1, 10, matches);
+         * @endcode
+         */
+        class OPENDAVINCI_API LaneMatcher {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                LaneMatcher(const LaneMatcher &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                LaneMatcher& operator=(const LaneMatcher &);
+
+            public:
+                enum CONSTANTS {
+                    ANY_LANE = 0xFFFFFFFF
+                };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param listOfLines Lane segments (cf. LaneVisitor::getListOfLines).
+                 * @param cellSize Edge length of a grid cell in m; enlarged if the grid would be too sparse.
+                 */
+                LaneMatcher(const vector<hesperia::data::environment::NamedLine> &listOfLines, const double &cellSize = 10);
+
+                virtual ~LaneMatcher();
+
+                /**
+                 * This method returns the number of indexed segments.
+                 *
+                 * @return Number of segments.
+                 */
+                uint32_t getNumberOfSegments() const;
+
+                /**
+                 * This method returns the number of lanes.
+                 *
+                 * @return Number of lanes.
+                 */
+                uint32_t getNumberOfLanes() const;
+
+                /**
+                 * This method returns the name of a lane.
+                 *
+                 * @param laneID ID of the lane.
+                 * @return Name of the lane or "" for an unknown ID.
+                 */
+                const string getLaneName(const uint32_t &laneID) const;
+
+                /**
+                 * This method returns the ID of a lane.
+                 *
+                 * @param laneName Name of the lane.
+                 * @return ID of the lane or ANY_LANE for an unknown name.
+                 */
+                uint32_t getLaneID(const string &laneName) const;
+
+                /**
+                 * This method returns the edge length of the grid cells.
+                 *
+                 * @return Cell size in m.
+                 */
+                double getCellSize() const;
+
+                /**
+                 * This method finds the k segments nearest to the given
+                 * position.
+                 *
+                 * @param position Position; Z is ignored.
+                 * @param k Maximum number of matches.
+                 * @param maxDistance Maximum distance of a match.
+                 * @param matches Matches sorted by ascending distance; previous contents are replaced.
+                 * @return Number of matches.
+                 */
+                uint32_t findNearest(const core::data::environment::Point3 &position, const uint32_t &k,
+                                     const double &maxDistance, vector<LaneMatch> &matches) const;
+
+                /**
+                 * This method finds the k segments nearest to the given
+                 * position whose direction differs at most by the given
+                 * tolerance from the given heading.
+                 *
+                 * @param position Position; Z is ignored.
+                 * @param heading Heading in rad.
+                 * @param headingTolerance Maximum deviation in rad; a negative value disables the check.
+                 * @param k Maximum number of matches.
+                 * @param maxDistance Maximum distance of a match.
+                 * @param matches Matches sorted by ascending distance; previous contents are replaced.
+                 * @return Number of matches.
+                 */
+                uint32_t findNearest(const core::data::environment::Point3 &position, const double &heading, const double &headingTolerance,
+                                     const uint32_t &k, const double &maxDistance, vector<LaneMatch> &matches) const;
+
+                /**
+                 * This method finds all segments within the given radius.
+                 *
+                 * @param position Position; Z is ignored.
+                 * @param radius Radius.
+                 * @param matches Matches sorted by ascending distance; previous contents are replaced.
+                 * @return Number of matches.
+                 */
+                uint32_t findWithinRadius(const core::data::environment::Point3 &position, const double &radius,
+                                          vector<LaneMatch> &matches) const;
+
+                /**
+                 * This method finds all segments within the given radius
+                 * whose direction differs at most by the given tolerance
+                 * from the given heading.
+                 *
+                 * @param position Position; Z is ignored.
+                 * @param heading Heading in rad.
+                 * @param headingTolerance Maximum deviation in rad; a negative value disables the check.
+                 * @param radius Radius.
+                 * @param matches Matches sorted by ascending distance; previous contents are replaced.
+                 * @return Number of matches.
+                 */
+                uint32_t findWithinRadius(const core::data::environment::Point3 &position, const double &heading, const double &headingTolerance,
+                                          const double &radius, vector<LaneMatch> &matches) const;
+
+                /**
+                 * This method finds the segment of the given lane nearest
+                 * to the given position.
+                 *
+                 * @param position Position; Z is ignored.
+                 * @param laneID ID of the lane.
+                 * @param maxDistance Maximum distance of the match.
+                 * @param match Nearest segment of the lane.
+                 * @return true if a segment of the lane was found within maxDistance.
+                 */
+                bool findNearestOnLane(const core::data::environment::Point3 &position, const uint32_t &laneID,
+                                       const double &maxDistance, LaneMatch &match) const;
+
+            private:
+                /**
+                 * This method searches the grid in rings of cells around
+                 * the given position until no unvisited cell can contain
+                 * a closer match.
+                 */
+                uint32_t find(const double &x, const double &y, const bool &checkHeading, const double &heading, const double &headingTolerance,
+                              const uint32_t &laneID, const uint32_t &k, const double &maxDistance, vector<LaneMatch> &matches) const;
+
+                /**
+                 * This method returns true if the given cell is the
+                 * first cell visited by find() that contains the given
+                 * segment; thus, a segment overlapping several cells
+                 * is matched only once per query without keeping track
+                 * of the visited segments.
+                 */
+                bool isFirstCell(const uint32_t &segment, const int32_t &cx, const int32_t &cy, const int32_t &ring, const int32_t &column, const int32_t &row) const;
+
+                /**
+                 * This method matches the given position against one
+                 * segment.
+                 */
+                LaneMatch match(const uint32_t &segment, const double &x, const double &y) const;
+
+            private:
+                // Segments.
+                vector<double> m_ax;
+                vector<double> m_ay;
+                vector<double> m_az;
+                vector<double> m_dx;
+                vector<double> m_dy;
+                vector<double> m_dz;
+                vector<double> m_heading;
+                vector<uint32_t> m_lane;
+
+                // Lanes.
+                vector<string> m_laneNames;
+                map<string, uint32_t> m_laneIDs;
+
+                // Grid: the segments of cell i are stored in m_cellSegments[m_cellOffsets[i], m_cellOffsets[i+1]).
+                double m_cellSize;
+                double m_minX;
+                double m_minY;
+                int32_t m_columns;
+                int32_t m_rows;
+                vector<uint32_t> m_cellOffsets;
+                vector<uint32_t> m_cellSegments;
+                // Cells overlapped by segment i: columns m_cellBounds[4i, 4i+1], rows m_cellBounds[4i+2, 4i+3].
+                vector<int32_t> m_cellBounds;
+        };
+
+    }
+} // hesperia::scenario
+
+#endif /*HESPERIA_SCENARIO_LANEMATCHER_H_*/
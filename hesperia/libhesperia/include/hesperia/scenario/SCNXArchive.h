@@ -76,6 +76,16 @@ namespace hesperia {
                  */
                 SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd);
 
+                /**
+                 * Constructor for already decoded images.
+                 *
+                 * @param scenario Scenario data structure.
+                 * @param dd Decompressed contents of an SCNX archive.
+                 * @param aerialImage Aerial image or NULL.
+                 * @param heightImage Height image or NULL.
+                 */
+                SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd, core::wrapper::Image *aerialImage, core::wrapper::Image *heightImage);
+
             public:
                 virtual ~SCNXArchive();
 
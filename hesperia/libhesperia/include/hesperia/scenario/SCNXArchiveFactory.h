@@ -25,9 +25,12 @@
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
+#include "core/SharedPointer.h"
+#include "core/base/KeyValueConfiguration.h"
 #include "core/base/Mutex.h"
 #include "core/exceptions/Exceptions.h"
 #include "core/io/URL.h"
+#include "core/wrapper/SharedMemory.h"
 #include "core/wrapper/StringComparator.h"
 
 #include "hesperia/scenario/SCNXArchive.h"
@@ -80,6 +83,66 @@ namespace hesperia {
                  */
                 SCNXArchive& getSCNXArchive(const core::io::URL &u) throw (core::exceptions::InvalidArgumentException);
 
+                /**
+                 * This method returns the SCNXArchive data structure. If
+                 * "global.scenario.sharedmemory" is set to 1 in the given
+                 * configuration, SCNX archives are shared with all modules
+                 * on this host: The first module decompresses and parses
+                 * the archive and stores it in a segment named by the SCNX
+                 * file's checksum; all further modules only attach to this
+                 * segment. The segment exists as long as the SCNXArchive
+                 * of the first module exists. If the segment cannot be
+                 * used, the archive is loaded from the file.
+                 *
+                 * @param u URL describing the source of the SCNX archive file.
+                 * @param configuration Configuration of the calling module.
+                 * @return SCNXArchive.
+                 * @throws InvalidArgumentException if the URL could not be used to create the data structure.
+                 */
+                SCNXArchive& getSCNXArchive(const core::io::URL &u, const core::base::KeyValueConfiguration &configuration) throw (core::exceptions::InvalidArgumentException);
+
+            private:
+                /**
+                 * This method creates an SCNXArchive in this module's heap.
+                 *
+                 * @param in Input stream to read the SCNX archive file from.
+                 * @param fileName File name of the SCNX archive to find its compiled scenario.
+                 * @return SCNXArchive.
+                 * @throws InvalidArgumentException if the input could not be used to create the data structure.
+                 */
+                SCNXArchive* createSCNXArchive(istream &in, const string &fileName) throw (core::exceptions::InvalidArgumentException);
+
+                /**
+                 * This method creates an SCNXArchive from memory shared
+                 * with other modules or stores a new one in a shared
+                 * memory segment.
+                 *
+                 * @param fileName File name of the SCNX archive.
+                 * @return SCNXArchive or NULL if the file could not be read.
+                 * @throws InvalidArgumentException if the file could not be used to create the data structure.
+                 */
+                SCNXArchive* getSharedSCNXArchive(const string &fileName) throw (core::exceptions::InvalidArgumentException);
+
+                /**
+                 * This method creates an SCNXArchive using the contents
+                 * of the given shared memory segment.
+                 *
+                 * @param sharedMemory Shared memory segment.
+                 * @param checksum Checksum of the SCNX file.
+                 * @return SCNXArchive or NULL if the segment cannot be used.
+                 */
+                SCNXArchive* getSCNXArchive(core::SharedPointer<core::wrapper::SharedMemory> sharedMemory, const uint32_t &checksum);
+
+                /**
+                 * This method returns the SCNXArchive data structure.
+                 *
+                 * @param u URL describing the source of the SCNX archive file.
+                 * @param useSharedMemory true to share SCNX archives between modules.
+                 * @return SCNXArchive.
+                 * @throws InvalidArgumentException if the URL could not be used to create the data structure.
+                 */
+                SCNXArchive& getSCNXArchive(const core::io::URL &u, const bool &useSharedMemory) throw (core::exceptions::InvalidArgumentException);
+
             private:
                 static core::base::Mutex m_singletonMutex;
                 static SCNXArchiveFactory* m_singleton;
@@ -21,12 +21,14 @@
 #define HESPERIA_SCENARIO_SCENARIOFACTORY_H_
 
 #include <string>
+#include <vector>
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
 
 #include "core/base/Mutex.h"
 #include "core/exceptions/Exceptions.h"
+#include "core/wrapper/parser/ParallelParser.h"
 #include "core/wrapper/parser/ParserErrorListener.h"
 #include "core/wrapper/parser/ParserTokenListener.h"
 
@@ -37,6 +39,8 @@ namespace hesperia {
 
         using namespace std;
 
+        class SCNGrammar;
+
         /**
          * This class produces the complex core::data::Scenario data structure.
          */
@@ -56,6 +60,11 @@ namespace hesperia {
                  */
                 ScenarioFactory& operator=(const ScenarioFactory &);
 
+            private:
+                enum {
+                    MAXIMUM_PART_SIZE = 8192 // Bytes of roads per part.
+                };
+
             private:
                 ScenarioFactory();
 
@@ -78,10 +87,62 @@ namespace hesperia {
                  */
                 data::scenario::Scenario getScenario(const string &s) throw (core::exceptions::InvalidArgumentException);
 
+                /**
+                 * This method sets the number of threads used to parse
+                 * the roads of a scenario concurrently. The document is
+                 * split at road boundaries into parts of at most
+                 * MAXIMUM_PART_SIZE bytes (at least one part per thread);
+                 * every part is parsed and visited on its own and all
+                 * parts are merged in document order afterwards.
+                 *
+                 * @param numberOfWorkers Number of threads; 0 parses the entire document at once.
+                 */
+                void setNumberOfWorkers(const uint32_t &numberOfWorkers);
+
+                /**
+                 * This method returns the number of threads used to parse
+                 * a scenario (default: number of processors).
+                 *
+                 * @return Number of threads.
+                 */
+                uint32_t getNumberOfWorkers() const;
+
+                /**
+                 * This method returns the number of parts the document
+                 * of the last call to getScenario() was split into.
+                 *
+                 * @return Number of concurrently parsed parts or 1 if the document was parsed at once.
+                 */
+                uint32_t getNumberOfPartsOfLastScenario() const;
+
+            private:
+                /**
+                 * This method parses the entire scenario in the calling thread.
+                 *
+                 * @param s String to be parsed.
+                 * @param scenario Scenario data structure to be filled.
+                 * @throws InvalidArgumentException if the input could be parsed.
+                 */
+                void getScenarioSequentially(const string &s, data::scenario::Scenario &scenario) throw (core::exceptions::InvalidArgumentException);
+
+                /**
+                 * This method splits the scenario at road boundaries and
+                 * parses all parts concurrently.
+                 *
+                 * @param s String to be parsed.
+                 * @param scenario Scenario data structure to be filled.
+                 * @return false if the scenario could not be split or any part could not be parsed.
+                 */
+                bool getScenarioInParallel(const string &s, data::scenario::Scenario &scenario);
+
             private:
                 static core::base::Mutex m_singletonMutex;
                 static ScenarioFactory* m_singleton;
 
+                mutable core::base::Mutex m_parserMutex;
+                uint32_t m_numberOfWorkers;
+                uint32_t m_numberOfParts;
+
                 /**
                  * This class is responsible for creating the data structure.
                  */
@@ -153,6 +214,62 @@ namespace hesperia {
                     private:
                         string m_lastError;
                 };
+
+                /**
+                 * This class parses one part of a split scenario.
+                 */
+                class SCNParserJob : public core::wrapper::parser::ParallelParserJob {
+                    private:
+                        /**
+                         * "Forbidden" copy constructor. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the copy constructor.
+                         */
+                        SCNParserJob(const SCNParserJob &);
+
+                        /**
+                         * "Forbidden" assignment operator. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the assignment operator.
+                         */
+                        SCNParserJob& operator=(const SCNParserJob &);
+
+                    public:
+                        /**
+                         * Constructor.
+                         *
+                         * @param document Complete scenario containing this part.
+                         */
+                        SCNParserJob(const string &document);
+
+                        virtual ~SCNParserJob();
+
+                        virtual void prepare();
+
+                        virtual void execute();
+
+                        /**
+                         * This method returns true if this part was parsed successfully.
+                         *
+                         * @return true if getScenario() is valid.
+                         */
+                        bool hasScenario() const;
+
+                        /**
+                         * This method returns the parsed part.
+                         *
+                         * @return Scenario for this part.
+                         */
+                        const data::scenario::Scenario& getScenario() const;
+
+                    private:
+                        string m_document;
+                        data::scenario::Scenario m_scenario;
+                        SCNGrammarTokenListener m_tokenListener;
+                        SCNGrammarErrorListener m_errorListener;
+                        SCNGrammar *m_grammar;
+                        bool m_hasScenario;
+                };
         };
 
     }
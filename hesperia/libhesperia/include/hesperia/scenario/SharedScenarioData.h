@@ -0,0 +1,242 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENARIO_SHAREDSCENARIODATA_H_
+#define HESPERIA_SCENARIO_SHAREDSCENARIODATA_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/SharedPointer.h"
+#include "core/io/MemoryStreamBuffer.h"
+#include "core/wrapper/DecompressedData.h"
+#include "core/wrapper/Image.h"
+#include "core/wrapper/SharedMemory.h"
+#include "core/wrapper/StringComparator.h"
+#include "hesperia/data/scenario/Scenario.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        /**
+         * This class provides the contents of an SCNX archive that
+         * were stored once in a memory segment shared by all modules
+         * on one host. The segment does not contain any pointers but
+         * only offsets relative to its beginning:
+         *
+         * - a header (magic number, format version, checksum of the
+         *   SCNX file, used size, completion flag, and the offsets
+         *   and lengths of the following sections),
+         * - the compiled scenario (cf. CompiledScenario),
+         * - a table of all archive entries together with their names
+         *   and decompressed contents, and
+         * - the decoded pixels of the aerial and height image.
+         *
+         * Entries are exposed as DecompressedData without copying.
+         * The scenario itself is deserialized into the heap of every
+         * module as its data structure contains pointers.
+         */
+        class OPENDAVINCI_API SharedScenarioData : public core::wrapper::DecompressedData {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                SharedScenarioData(const SharedScenarioData &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                SharedScenarioData& operator=(const SharedScenarioData &);
+
+            public:
+                enum CONSTANTS {
+                    MAGIC_NUMBER = 0x53434E53, // "SCNS"
+                    VERSION = 1
+                };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param memory Beginning of the segment.
+                 * @param size Size of the segment.
+                 * @param sharedMemory Shared memory containing the segment to be kept attached as long as this instance exists (might be invalid).
+                 */
+                SharedScenarioData(const char *memory, const uint32_t &size, const core::SharedPointer<core::wrapper::SharedMemory> &sharedMemory);
+
+                virtual ~SharedScenarioData();
+
+                /**
+                 * This method returns the name of the shared memory
+                 * for an SCNX file with the given checksum. Thus, a
+                 * modified SCNX file results in a new segment.
+                 *
+                 * @param checksum Checksum of the SCNX file.
+                 * @return Name of the shared memory.
+                 */
+                static const string getName(const uint32_t &checksum);
+
+                /**
+                 * This method computes the size of the segment that
+                 * is required to store the given contents.
+                 *
+                 * @param data Decompressed SCNX archive.
+                 * @param compiledScenario Compiled scenario (cf. CompiledScenario::write).
+                 * @param aerialImage Aerial image or NULL.
+                 * @param heightImage Height image or NULL.
+                 * @return Size of the segment.
+                 */
+                static uint32_t getSize(core::wrapper::DecompressedData &data, const string &compiledScenario, const core::wrapper::Image *aerialImage, const core::wrapper::Image *heightImage);
+
+                /**
+                 * This method writes the given contents into a segment.
+                 * The segment is marked complete as the last step.
+                 *
+                 * @param memory Beginning of the segment.
+                 * @param size Size of the segment.
+                 * @param checksum Checksum of the SCNX file.
+                 * @param data Decompressed SCNX archive.
+                 * @param compiledScenario Compiled scenario (cf. CompiledScenario::write).
+                 * @param aerialImage Aerial image or NULL.
+                 * @param heightImage Height image or NULL.
+                 * @return true if the contents fit into the segment and it does not contain another scenario.
+                 */
+                static bool write(char *memory, const uint32_t &size, const uint32_t &checksum, core::wrapper::DecompressedData &data, const string &compiledScenario, const core::wrapper::Image *aerialImage, const core::wrapper::Image *heightImage);
+
+                /**
+                 * This method returns true if the segment is complete,
+                 * has the current format version, and all its offsets
+                 * are within the segment.
+                 *
+                 * @return true if the segment can be used.
+                 */
+                bool isValid() const;
+
+                /**
+                 * This method returns the checksum of the SCNX file
+                 * this segment was created from.
+                 *
+                 * @return Checksum.
+                 */
+                uint32_t getChecksum() const;
+
+                /**
+                 * This method deserializes the compiled scenario.
+                 *
+                 * @param scenario Scenario to be read.
+                 * @return true if the scenario could be read.
+                 */
+                bool getScenario(data::scenario::Scenario &scenario);
+
+                /**
+                 * This method returns an image wrapping the shared
+                 * pixels of the aerial image. The pixels must not be
+                 * modified.
+                 *
+                 * @return Image to be deleted by the caller or NULL.
+                 */
+                core::wrapper::Image* getAerialImage() const;
+
+                /**
+                 * This method returns an image wrapping the shared
+                 * pixels of the height image. The pixels must not be
+                 * modified.
+                 *
+                 * @return Image to be deleted by the caller or NULL.
+                 */
+                core::wrapper::Image* getHeightImage() const;
+
+                virtual vector<string> getListOfEntries();
+
+                virtual istream* getInputStreamFor(const string &entry);
+
+                virtual bool getBufferFor(const string &entry, const char* &buffer, uint32_t &length);
+
+            private:
+                /**
+                 * This class exposes one entry of the segment as
+                 * input stream.
+                 */
+                class Entry : public core::io::MemoryStreamBuffer {
+                    private:
+                        /**
+                         * "Forbidden" copy constructor. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the copy constructor.
+                         */
+                        Entry(const Entry &);
+
+                        /**
+                         * "Forbidden" assignment operator. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the assignment operator.
+                         */
+                        Entry& operator=(const Entry &);
+
+                    public:
+                        Entry(const char *buffer, const uint32_t &length);
+
+                        virtual ~Entry();
+                };
+
+                /**
+                 * This method returns the header field at the given index.
+                 *
+                 * @param index Index of the field.
+                 * @return Value.
+                 */
+                uint32_t getField(const uint32_t &index) const;
+
+                /**
+                 * This method validates the header and reads the table
+                 * of entries.
+                 */
+                void readSegment();
+
+                /**
+                 * This method returns an image wrapping the shared pixels
+                 * described at the given header index.
+                 *
+                 * @param index Index of the image description.
+                 * @return Image or NULL.
+                 */
+                core::wrapper::Image* getImage(const uint32_t &index) const;
+
+                Entry* getEntry(const string &entry);
+
+                const char *m_memory;
+                uint32_t m_size;
+                core::SharedPointer<core::wrapper::SharedMemory> m_sharedMemory;
+                bool m_valid;
+                map<string, Entry*, core::wrapper::StringComparator> m_mapOfEntries;
+        };
+
+    }
+} // hesperia::scenario
+
+#endif /*HESPERIA_SCENARIO_SHAREDSCENARIODATA_H_*/
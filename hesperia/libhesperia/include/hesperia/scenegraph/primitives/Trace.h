@@ -0,0 +1,133 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENEGRAPH_PRIMITIVES_TRACE_H_
+#define HESPERIA_SCENEGRAPH_PRIMITIVES_TRACE_H_
+
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/scenegraph/SceneNode.h"
+#include "hesperia/scenegraph/SceneNodeDescriptor.h"
+
+namespace hesperia {
+    namespace scenegraph {
+        namespace primitives {
+
+            using namespace std;
+
+            /**
+             * This class represents a polyline of the most recent
+             * positions of a moving object. The points are stored in a
+             * ring of fixed capacity; a new point is only added if it
+             * is at least the given distance away from the previously
+             * added point. Thus, the memory and the rendering costs
+             * are bounded regardless of the duration of a drive.
+             */
+            class Trace : public SceneNode {
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param sceneNodeDesciptor Description for this scene node.
+                     * @param capacity Maximum number of points; older points are overwritten.
+                     * @param minimumDistance Minimum distance in the XY plane between two consecutive points.
+                     * @param color Trace's color.
+                     * @param width Trace's width.
+                     */
+                    Trace(const SceneNodeDescriptor &sceneNodeDescriptor, const uint32_t &capacity, const double &minimumDistance, const core::data::environment::Point3 &color, const float &width);
+
+                    /**
+                     * Copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    Trace(const Trace &obj);
+
+                    /**
+                     * Assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    Trace& operator=(const Trace &obj);
+
+                    virtual ~Trace();
+
+                    /**
+                     * This method adds a point unless it is too close to
+                     * the previously added point.
+                     *
+                     * @param p Point to be added.
+                     * @return true if the point was added.
+                     */
+                    bool add(const core::data::environment::Point3 &p);
+
+                    /**
+                     * This method removes all points.
+                     */
+                    void clear();
+
+                    /**
+                     * @return Number of points.
+                     */
+                    uint32_t getNumberOfPoints() const;
+
+                    /**
+                     * @return Maximum number of points.
+                     */
+                    uint32_t getCapacity() const;
+
+                    /**
+                     * This method returns a point.
+                     *
+                     * @param i Index of the point; 0 is the oldest point.
+                     * @return Point.
+                     */
+                    const core::data::environment::Point3& getPoint(const uint32_t &i) const;
+
+                    /**
+                     * @return Trace's color.
+                     */
+                    const core::data::environment::Point3& getColor() const;
+
+                    /**
+                     * @return Trace's width.
+                     */
+                    float getWidth() const;
+
+                private:
+                    uint32_t m_capacity;
+                    double m_minimumDistance;
+                    core::data::environment::Point3 m_color;
+                    float m_width;
+
+                    // m_points[m_first] is the oldest point.
+                    vector<core::data::environment::Point3> m_points;
+                    uint32_t m_first;
+            };
+
+        }
+    }
+} // hesperia::scenegraph::primitives
+
+#endif /*HESPERIA_SCENEGRAPH_PRIMITIVES_TRACE_H_*/
@@ -26,6 +26,7 @@
 #include "hesperia/scenegraph/primitives/Point.h"
 #include "hesperia/scenegraph/primitives/Line.h"
 #include "hesperia/scenegraph/primitives/Polygon.h"
+#include "hesperia/scenegraph/primitives/Trace.h"
 
 namespace hesperia {
     namespace scenegraph {
@@ -82,6 +83,14 @@ namespace hesperia {
                      * @param p Polygon to be rendered.
                      */
                     virtual void render(hesperia::scenegraph::primitives::Polygon *p) = 0;
+
+                    /**
+                     * This method needs to be implemented in sub classes to
+                     * implement the rendering of a trace.
+                     *
+                     * @param t Trace to be rendered.
+                     */
+                    virtual void render(hesperia::scenegraph::primitives::Trace *t) = 0;
             };
 
         }
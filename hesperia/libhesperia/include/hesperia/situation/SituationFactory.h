@@ -21,11 +21,13 @@
 #define HESPERIA_SITUATION_SITUATIONFACTORY_H_
 
 #include <string>
+#include <vector>
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
 #include "core/base/Mutex.h"
 #include "core/exceptions/Exceptions.h"
+#include "core/wrapper/parser/ParallelParser.h"
 #include "core/wrapper/parser/ParserErrorListener.h"
 #include "core/wrapper/parser/ParserTokenListener.h"
 
@@ -36,6 +38,8 @@ namespace hesperia {
 
         using namespace std;
 
+        class SITGrammar;
+
         /**
          * This class produces the complex core::data::Situation data structure.
          */
@@ -55,6 +59,11 @@ namespace hesperia {
                  */
                 SituationFactory& operator=(const SituationFactory &);
 
+            private:
+                enum {
+                    MAXIMUM_PART_SIZE = 8192 // Bytes of objects per part.
+                };
+
             private:
                 SituationFactory();
 
@@ -77,10 +86,61 @@ namespace hesperia {
                  */
                 data::situation::Situation getSituation(const string &s) throw (core::exceptions::InvalidArgumentException);
 
+                /**
+                 * This method sets the number of threads used to parse
+                 * the objects of a situation concurrently. The document
+                 * is split at object boundaries into parts of at most
+                 * MAXIMUM_PART_SIZE bytes (at least one part per thread)
+                 * which are merged in document order afterwards.
+                 *
+                 * @param numberOfWorkers Number of threads; 0 parses the entire document at once.
+                 */
+                void setNumberOfWorkers(const uint32_t &numberOfWorkers);
+
+                /**
+                 * This method returns the number of threads used to parse
+                 * a situation (default: number of processors).
+                 *
+                 * @return Number of threads.
+                 */
+                uint32_t getNumberOfWorkers() const;
+
+                /**
+                 * This method returns the number of parts the document
+                 * of the last call to getSituation() was split into.
+                 *
+                 * @return Number of concurrently parsed parts or 1 if the document was parsed at once.
+                 */
+                uint32_t getNumberOfPartsOfLastSituation() const;
+
+            private:
+                /**
+                 * This method parses the entire situation in the calling thread.
+                 *
+                 * @param s String to be parsed.
+                 * @param situation Situation data structure to be filled.
+                 * @throws InvalidArgumentException if the input could be parsed.
+                 */
+                void getSituationSequentially(const string &s, data::situation::Situation &situation) throw (core::exceptions::InvalidArgumentException);
+
+                /**
+                 * This method splits the situation at object boundaries
+                 * and parses all parts concurrently.
+                 *
+                 * @param s String to be parsed.
+                 * @param situation Situation data structure to be filled.
+                 * @return false if the situation could not be split or any part could not be parsed.
+                 */
+                bool getSituationInParallel(const string &s, data::situation::Situation &situation);
+
             private:
                 static core::base::Mutex m_singletonMutex;
                 static SituationFactory* m_singleton;
 
+                mutable core::base::Mutex m_parserMutex;
+                uint32_t m_numberOfWorkers;
+                uint32_t m_numberOfParts;
+
                 /**
                  * This class is responsible for creating the data structure.
                  */
@@ -152,6 +212,62 @@ namespace hesperia {
                     private:
                         string m_lastError;
                 };
+
+                /**
+                 * This class parses one part of a split situation.
+                 */
+                class SITParserJob : public core::wrapper::parser::ParallelParserJob {
+                    private:
+                        /**
+                         * "Forbidden" copy constructor. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the copy constructor.
+                         */
+                        SITParserJob(const SITParserJob &);
+
+                        /**
+                         * "Forbidden" assignment operator. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the assignment operator.
+                         */
+                        SITParserJob& operator=(const SITParserJob &);
+
+                    public:
+                        /**
+                         * Constructor.
+                         *
+                         * @param document Complete situation containing this part.
+                         */
+                        SITParserJob(const string &document);
+
+                        virtual ~SITParserJob();
+
+                        virtual void prepare();
+
+                        virtual void execute();
+
+                        /**
+                         * This method returns true if this part was parsed successfully.
+                         *
+                         * @return true if getSituation() is valid.
+                         */
+                        bool hasSituation() const;
+
+                        /**
+                         * This method returns the parsed part.
+                         *
+                         * @return Situation for this part.
+                         */
+                        const data::situation::Situation& getSituation() const;
+
+                    private:
+                        string m_document;
+                        data::situation::Situation m_situation;
+                        SITGrammarTokenListener m_tokenListener;
+                        SITGrammarErrorListener m_errorListener;
+                        SITGrammar *m_grammar;
+                        bool m_hasSituation;
+                };
         };
 
     }
@@ -0,0 +1,118 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_THREED_BOUNDINGSPHERE_H_
+#define HESPERIA_THREED_BOUNDINGSPHERE_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/data/environment/Point3.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        /**
+         * This class describes a sphere enclosing a node's geometry.
+         * A default constructed sphere is invalid, i.e. the extent of
+         * the enclosed geometry is unknown.
+         */
+        class OPENDAVINCI_API BoundingSphere {
+            public:
+                /**
+                 * Constructor for an invalid sphere.
+                 */
+                BoundingSphere();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param center Center of the sphere.
+                 * @param radius Radius of the sphere.
+                 */
+                BoundingSphere(const core::data::environment::Point3 &center, const double &radius);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                BoundingSphere(const BoundingSphere &obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                BoundingSphere& operator=(const BoundingSphere &obj);
+
+                virtual ~BoundingSphere();
+
+                /**
+                 * This method returns true if this sphere describes a known extent.
+                 *
+                 * @return true if this sphere is valid.
+                 */
+                bool isValid() const;
+
+                /**
+                 * This method returns the center.
+                 *
+                 * @return Center.
+                 */
+                const core::data::environment::Point3 getCenter() const;
+
+                /**
+                 * This method returns the radius.
+                 *
+                 * @return Radius.
+                 */
+                double getRadius() const;
+
+                /**
+                 * This method grows this sphere to the smallest sphere
+                 * enclosing both this and the given sphere. An invalid
+                 * sphere is replaced by the given one.
+                 *
+                 * @param sphere Sphere to be enclosed.
+                 */
+                void enclose(const BoundingSphere &sphere);
+
+                /**
+                 * This method returns the sphere enclosing this sphere
+                 * after applying the transformation of a TransformGroup,
+                 * i.e. translation * Rx * Ry * Rz * scaling.
+                 *
+                 * @param translation Translation.
+                 * @param rotation Rotation in RAD.
+                 * @param scaling Scaling.
+                 * @return Transformed sphere.
+                 */
+                BoundingSphere transform(const core::data::environment::Point3 &translation, const core::data::environment::Point3 &rotation, const core::data::environment::Point3 &scaling) const;
+
+            private:
+                core::data::environment::Point3 m_center;
+                double m_radius;
+        };
+
+    }
+} // hesperia::threeD
+
+#endif /*HESPERIA_THREED_BOUNDINGSPHERE_H_*/
@@ -0,0 +1,117 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_THREED_FRUSTUM_H_
+#define HESPERIA_THREED_FRUSTUM_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "hesperia/threeD/BoundingSphere.h"
+#include "hesperia/threeD/TransformationMatrix.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        /**
+         * This class describes the viewing volume of an OpenGL scene
+         * by the six planes extracted from the product of the projection
+         * and modelview matrix (Gribb/Hartmann). It does not call OpenGL
+         * itself; TransformGroup passes the current matrices. The
+         * modelview matrix is kept to measure distances to the camera.
+         */
+        class OPENDAVINCI_API Frustum {
+            public:
+                enum {
+                    NUMBER_OF_PLANES = 6
+                };
+
+            public:
+                /**
+                 * Constructor for an unbounded frustum; everything is visible.
+                 */
+                Frustum();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param projection Projection matrix (16 values in OpenGL's column-major order).
+                 * @param modelView Modelview matrix (16 values in OpenGL's column-major order).
+                 */
+                Frustum(const double *projection, const double *modelView);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                Frustum(const Frustum &obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                Frustum& operator=(const Frustum &obj);
+
+                virtual ~Frustum();
+
+                /**
+                 * This method checks whether the given sphere, specified
+                 * in the coordinate system of the modelview matrix, is at
+                 * least partly within this frustum. Invalid spheres are
+                 * always visible.
+                 *
+                 * @param sphere Sphere to be checked.
+                 * @return false if the sphere is completely outside.
+                 */
+                bool isVisible(const BoundingSphere &sphere) const;
+
+                /**
+                 * This method returns this frustum in the coordinate
+                 * system resulting from applying the given transformation
+                 * (cf. TransformGroup) to the current one. Thus, nested
+                 * transformations do not need to query OpenGL.
+                 *
+                 * @param transformation Transformation to be applied.
+                 * @return Transformed frustum.
+                 */
+                Frustum transform(const TransformationMatrix &transformation) const;
+
+                /**
+                 * This method returns the distance between the camera and
+                 * the given point, specified in the coordinate system of
+                 * the modelview matrix, in eye coordinates.
+                 *
+                 * @param p Point.
+                 * @return Distance to the camera.
+                 */
+                double getDistanceToCamera(const core::data::environment::Point3 &p) const;
+
+            private:
+                bool m_bounded;
+                double m_planes[NUMBER_OF_PLANES][4];
+                double m_modelView[16];
+        };
+
+    }
+} // hesperia::threeD
+
+#endif /*HESPERIA_THREED_FRUSTUM_H_*/
@@ -0,0 +1,124 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_THREED_LEVELOFDETAIL_H_
+#define HESPERIA_THREED_LEVELOFDETAIL_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include <vector>
+
+#include "hesperia/threeD/Node.h"
+#include "hesperia/threeD/NodeDescriptor.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+
+        /**
+         * This class renders one of several representations of the
+         * same object depending on the distance between the camera and
+         * the center of its bounding sphere. Levels are added from the
+         * most detailed to the coarsest one; beyond the distance of
+         * the last level, nothing is drawn.
+         */
+        class OPENDAVINCI_API LevelOfDetail : public Node {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                LevelOfDetail(const LevelOfDetail &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                LevelOfDetail& operator=(const LevelOfDetail &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param nodeDescriptor Description for this node.
+                 */
+                LevelOfDetail(const NodeDescriptor &nodeDescriptor);
+
+                /**
+                 * Destructor. All levels are deleted.
+                 */
+                virtual ~LevelOfDetail();
+
+                virtual void render(RenderingConfiguration &renderingConfiguration);
+
+                /**
+                 * This method adds a level. This node takes ownership.
+                 *
+                 * @param level Representation to be added.
+                 * @param maximumDistance Distance up to which this level is drawn; must be greater than the previous level's one.
+                 */
+                void addLevel(Node *level, const double &maximumDistance);
+
+                /**
+                 * This method returns the number of levels.
+                 *
+                 * @return Number of levels.
+                 */
+                uint32_t getNumberOfLevels() const;
+
+                /**
+                 * This method returns a level.
+                 *
+                 * @param index Index of the level.
+                 * @return Level or NULL if index is invalid.
+                 */
+                Node* getLevel(const uint32_t &index) const;
+
+                /**
+                 * This method returns the distance up to which a level is drawn.
+                 *
+                 * @param index Index of the level.
+                 * @return Maximum distance or 0 if index is invalid.
+                 */
+                double getMaximumDistance(const uint32_t &index) const;
+
+                /**
+                 * This method selects the level to be drawn.
+                 *
+                 * @param distance Distance between camera and this node.
+                 * @return Index of the level or getNumberOfLevels() if nothing should be drawn.
+                 */
+                uint32_t selectLevel(const double &distance) const;
+
+            protected:
+                virtual BoundingSphere computeBoundingSphere() const;
+
+            private:
+                vector<Node*> m_listOfLevels;
+                vector<double> m_listOfMaximumDistances;
+        };
+
+    }
+} // hesperia::threeD
+
+#endif /*HESPERIA_THREED_LEVELOFDETAIL_H_*/
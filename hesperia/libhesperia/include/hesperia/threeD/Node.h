@@ -24,6 +24,7 @@
 #include "core/native.h"
 
 #include "core/wrapper/Disposable.h"
+#include "hesperia/threeD/BoundingSphere.h"
 #include "hesperia/threeD/NodeDescriptor.h"
 #include "hesperia/threeD/RenderingConfiguration.h"
 
@@ -35,6 +36,9 @@ namespace hesperia {
          * to be drawn in an OpenGL scene.
          */
         class OPENDAVINCI_API Node : public core::wrapper::Disposable {
+            friend class LevelOfDetail;
+            friend class TransformGroup;
+
             private:
                 /**
                  * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -85,8 +89,45 @@ namespace hesperia {
                  */
                 void setNodeDescriptor(const NodeDescriptor &nodeDescriptor);
 
+                /**
+                 * This method returns a sphere enclosing this node's
+                 * geometry in the coordinate system of its parent. The
+                 * sphere is computed once and cached until this node or
+                 * one of its descendants calls invalidateBoundingSphere().
+                 *
+                 * @return Bounding sphere; invalid if the extent is unknown.
+                 */
+                const BoundingSphere getBoundingSphere() const;
+
+            protected:
+                /**
+                 * This method computes the bounding sphere. Nodes with an
+                 * unknown extent keep this default implementation and
+                 * are never culled.
+                 *
+                 * @return Bounding sphere; invalid if the extent is unknown.
+                 */
+                virtual BoundingSphere computeBoundingSphere() const;
+
+                /**
+                 * This method must be called whenever this node's geometry
+                 * changes; it discards the cached bounding spheres of this
+                 * node and all its ancestors.
+                 */
+                void invalidateBoundingSphere();
+
             private:
                 NodeDescriptor m_nodeDescriptor;
+                Node *m_parent;
+                mutable bool m_hasCachedBoundingSphere;
+                mutable BoundingSphere m_boundingSphere;
+
+                /**
+                 * This method sets the node containing this node.
+                 *
+                 * @param parent Containing node or NULL.
+                 */
+                void setParent(Node *parent);
         };
 
     }
@@ -72,6 +72,23 @@ namespace hesperia {
                  */
                 void setDrawTextures(const bool &drawTextures);
 
+                /**
+                 * This method returns true if TransformGroups should skip
+                 * children outside the current view frustum.
+                 *
+                 * @return true if frustum culling is enabled.
+                 */
+                bool hasFrustumCulling() const;
+
+                /**
+                 * This method enables or disables frustum culling. Enable
+                 * it only if the projection and modelview matrix are set
+                 * up before rendering, i.e. for perspective views.
+                 *
+                 * @param frustumCulling true if nodes outside the view frustum should be skipped.
+                 */
+                void setFrustumCulling(const bool &frustumCulling);
+
                 /**
                  * This method returns a NodeRenderingConfiguration
                  * for the given NodeDescriptor.
@@ -92,6 +109,7 @@ namespace hesperia {
 
             private:
                 bool m_drawTextures;
+                bool m_frustumCulling;
                 map<NodeDescriptor, NodeRenderingConfiguration, NodeDescriptorComparator> m_nodesRenderingConfiguration;
         };
 
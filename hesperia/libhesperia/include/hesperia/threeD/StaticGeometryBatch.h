@@ -0,0 +1,122 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_STATICGEOMETRYBATCH_H_
+#define HESPERIA_CORE_THREED_STATICGEOMETRYBATCH_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include <vector>
+
+#include "hesperia/threeD/Material.h"
+#include "hesperia/threeD/VertexBuffer.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+
+        /**
+         * This class merges the geometry of static nodes on the CPU
+         * side: All vertex buffers with an equal material (same
+         * texture, colors, and shininess) and primitive are appended
+         * into one vertex buffer so that they can be drawn with a
+         * single call. The vertex buffers must already be transformed
+         * into a common coordinate frame.
+         */
+        class OPENDAVINCI_API StaticGeometryBatch {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                StaticGeometryBatch(const StaticGeometryBatch &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                StaticGeometryBatch& operator=(const StaticGeometryBatch &);
+
+            public:
+                StaticGeometryBatch();
+
+                virtual ~StaticGeometryBatch();
+
+                /**
+                 * This method adds a vertex buffer to the batch of
+                 * its material.
+                 *
+                 * @param material Material of the vertex buffer.
+                 * @param vertexBuffer Vertex buffer to be added.
+                 */
+                void add(const Material &material, const VertexBuffer &vertexBuffer);
+
+                /**
+                 * This method returns the number of batches.
+                 *
+                 * @return Number of batches.
+                 */
+                uint32_t getNumberOfBatches() const;
+
+                /**
+                 * This method returns the number of added vertex buffers.
+                 *
+                 * @return Number of added vertex buffers.
+                 */
+                uint32_t getNumberOfAddedVertexBuffers() const;
+
+                /**
+                 * This method returns a batch's material.
+                 *
+                 * @param index Index of the batch.
+                 * @return Material.
+                 */
+                const Material& getMaterial(const uint32_t &index) const;
+
+                /**
+                 * This method returns a batch's merged vertex buffer.
+                 *
+                 * @param index Index of the batch.
+                 * @return Vertex buffer.
+                 */
+                const VertexBuffer& getVertexBuffer(const uint32_t &index) const;
+
+                /**
+                 * This method checks whether two materials are rendered equally.
+                 *
+                 * @param a First material.
+                 * @param b Second material.
+                 * @return true if both materials are rendered equally.
+                 */
+                static bool isEqual(const Material &a, const Material &b);
+
+            private:
+                vector<Material> m_materials;
+                vector<VertexBuffer> m_vertexBuffers;
+                uint32_t m_numberOfAddedVertexBuffers;
+        };
+
+    }
+} // hesperia::threeD
+
+#endif /*HESPERIA_CORE_THREED_STATICGEOMETRYBATCH_H_*/
@@ -27,6 +27,7 @@
 
 #include "core/base/Mutex.h"
 #include "core/data/environment/Point3.h"
+#include "hesperia/threeD/Frustum.h"
 #include "hesperia/threeD/Node.h"
 #include "hesperia/threeD/NodeDescriptor.h"
 #include "hesperia/threeD/TransformGroupVisitor.h"
@@ -37,7 +38,12 @@ namespace hesperia {
         using namespace std;
 
         /**
-         * This class creates a scene graph.
+         * This class creates a scene graph. If frustum culling is
+         * enabled in the RenderingConfiguration, children whose
+         * bounding sphere is outside the view frustum are skipped and
+         * the numbers of drawn and culled nodes are reported once per
+         * frame through the Instrumentation counters
+         * TransformGroup.drawnNodes and TransformGroup.culledNodes.
          */
         class OPENDAVINCI_API TransformGroup : public Node {
             private:
@@ -133,6 +139,14 @@ namespace hesperia {
                  */
                 void deleteAllChildren();
 
+                /**
+                 * This method returns the list of children. The children
+                 * are still owned by this transform group.
+                 *
+                 * @return List of children.
+                 */
+                vector<Node*> getChildren() const;
+
                 /**
                  * This method accepts a visitor.
                  *
@@ -140,6 +154,19 @@ namespace hesperia {
                  */
                 void accept(TransformGroupVisitor &visitor);
 
+                /**
+                 * This method returns the view frustum in the coordinate
+                 * system of the transform group currently rendering its
+                 * children on the calling thread. Thus, nodes do not need
+                 * to query OpenGL for the modelview matrix.
+                 *
+                 * @return Frustum or NULL if no transform group is rendering.
+                 */
+                static const Frustum* getCurrentFrustum();
+
+            protected:
+                virtual BoundingSphere computeBoundingSphere() const;
+
             private:
                 core::data::environment::Point3 m_translation;
                 core::data::environment::Point3 m_rotation;
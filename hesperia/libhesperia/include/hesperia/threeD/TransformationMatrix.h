@@ -0,0 +1,114 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_THREED_TRANSFORMATIONMATRIX_H_
+#define HESPERIA_THREED_TRANSFORMATIONMATRIX_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/data/environment/Point3.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        /**
+         * This class computes the transformation applied by a
+         * TransformGroup without OpenGL, i.e. the matrix
+         * T * Rx * Ry * Rz * S built by glTranslated, glRotated around
+         * the X, Y, and Z axis, and glScaled. All rotations follow
+         * glRotated: They are counterclockwise when looking from the
+         * positive axis towards the origin.
+         */
+        class OPENDAVINCI_API TransformationMatrix {
+            public:
+                /**
+                 * Constructor for the identity.
+                 */
+                TransformationMatrix();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param translation Translation.
+                 * @param rotation Rotation in RAD around the X, Y, and Z axis.
+                 * @param scaling Scaling.
+                 */
+                TransformationMatrix(const core::data::environment::Point3 &translation, const core::data::environment::Point3 &rotation, const core::data::environment::Point3 &scaling);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                TransformationMatrix(const TransformationMatrix &obj);
+
+                virtual ~TransformationMatrix();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                TransformationMatrix& operator=(const TransformationMatrix &obj);
+
+                /**
+                 * This method returns the matrix in column-major order
+                 * like glGetDoublev(GL_MODELVIEW_MATRIX, ...).
+                 *
+                 * @return 16 values.
+                 */
+                const double* getMatrix() const;
+
+                /**
+                 * This method transforms a point.
+                 *
+                 * @param p Point to be transformed.
+                 * @return Transformed point.
+                 */
+                core::data::environment::Point3 transformPoint(const core::data::environment::Point3 &p) const;
+
+                /**
+                 * This method transforms a normal by the inverse transpose
+                 * of the rotation and scaling and normalizes it; degenerated
+                 * scaling axes are kept.
+                 *
+                 * @param n Normal to be transformed.
+                 * @return Transformed normal.
+                 */
+                core::data::environment::Point3 transformNormal(const core::data::environment::Point3 &n) const;
+
+                /**
+                 * This method returns the greatest absolute scaling factor.
+                 *
+                 * @return Greatest absolute scaling factor.
+                 */
+                double getMaximumScaling() const;
+
+            private:
+                double m_matrix[16];
+                double m_normalMatrix[9];
+                double m_maximumScaling;
+        };
+
+    }
+} // hesperia::threeD
+
+#endif /*HESPERIA_THREED_TRANSFORMATIONMATRIX_H_*/
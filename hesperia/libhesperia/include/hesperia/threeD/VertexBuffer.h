@@ -0,0 +1,341 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_VERTEXBUFFER_H_
+#define HESPERIA_CORE_THREED_VERTEXBUFFER_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include <iostream>
+#include <vector>
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/threeD/BoundingSphere.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+
+        /**
+         * This class stores geometry as one interleaved array of
+         * floats per vertex (position, normal, texture coordinate,
+         * and color) and an index array. It does not call OpenGL;
+         * models::Mesh uploads and draws it.
+         *
+         * Vertex attributes other than the position are taken from
+         * the current normal, texture coordinate, and color set
+         * before calling addVertex like in OpenGL's immediate mode:
+         *
+         * @code
+         * VertexBuffer vb(VertexBuffer::TRIANGLES);
+         * vb.setNormal(Point3(0, 0, 1));
+         * const uint32_t i = vb.addVertex(a);
+         * const uint32_t j = vb.addVertex(b);
+         * const uint32_t k = vb.addVertex(c);
+         * vb.addTriangle(i, j, k);
+         * @endcode
+         */
+        class OPENDAVINCI_API VertexBuffer {
+            public:
+                enum PRIMITIVE {
+                    LINES,
+                    TRIANGLES
+                };
+
+                enum {
+                    POSITION = 0,
+                    NORMAL = 3,
+                    TEXTURECOORDINATE = 6,
+                    COLOR = 8,
+                    FLOATS_PER_VERTEX = 11
+                };
+
+                enum CONSTANTS {
+                    MAXIMUM_NUMBER_OF_VERTICES = 0x1000000,
+                    MAXIMUM_NUMBER_OF_INDICES = 0x3000000
+                };
+
+            public:
+                VertexBuffer();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param primitive Primitive to be drawn from the indices.
+                 */
+                VertexBuffer(const enum PRIMITIVE &primitive);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                VertexBuffer(const VertexBuffer &obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                VertexBuffer& operator=(const VertexBuffer &obj);
+
+                virtual ~VertexBuffer();
+
+                /**
+                 * This method returns the primitive.
+                 *
+                 * @return Primitive.
+                 */
+                enum PRIMITIVE getPrimitive() const;
+
+                /**
+                 * This method sets the normal for subsequently added vertices.
+                 *
+                 * @param normal Normal.
+                 */
+                void setNormal(const core::data::environment::Point3 &normal);
+
+                /**
+                 * This method sets the texture coordinate (X and Y are
+                 * used) for subsequently added vertices.
+                 *
+                 * @param textureCoordinate Texture coordinate.
+                 */
+                void setTextureCoordinate(const core::data::environment::Point3 &textureCoordinate);
+
+                /**
+                 * This method sets the RGB color for subsequently added vertices.
+                 *
+                 * @param color Color.
+                 */
+                void setColor(const core::data::environment::Point3 &color);
+
+                /**
+                 * This method adds a vertex using the current attributes.
+                 *
+                 * @param position Vertex's position.
+                 * @return Index of the new vertex.
+                 */
+                uint32_t addVertex(const core::data::environment::Point3 &position);
+
+                /**
+                 * This method adds an index.
+                 *
+                 * @param index Index of an already added vertex.
+                 */
+                void addIndex(const uint32_t &index);
+
+                /**
+                 * This method adds the indices for a line.
+                 *
+                 * @param a Index of the first vertex.
+                 * @param b Index of the second vertex.
+                 */
+                void addLine(const uint32_t &a, const uint32_t &b);
+
+                /**
+                 * This method adds the indices for a triangle.
+                 *
+                 * @param a Index of the first vertex.
+                 * @param b Index of the second vertex.
+                 * @param c Index of the third vertex.
+                 */
+                void addTriangle(const uint32_t &a, const uint32_t &b, const uint32_t &c);
+
+                /**
+                 * This method adds the indices for a quad as two triangles.
+                 *
+                 * @param a Index of the first vertex.
+                 * @param b Index of the second vertex.
+                 * @param c Index of the third vertex.
+                 * @param d Index of the fourth vertex.
+                 */
+                void addQuad(const uint32_t &a, const uint32_t &b, const uint32_t &c, const uint32_t &d);
+
+                /**
+                 * This method appends the vertices and indices of the
+                 * given vertex buffer which must use the same primitive.
+                 *
+                 * @param vb Vertex buffer to be appended.
+                 * @return false if the primitives differ.
+                 */
+                bool append(const VertexBuffer &vb);
+
+                /**
+                 * This method transforms all vertices like TransformGroup
+                 * (cf. TransformationMatrix): Scaling first, followed by rotations
+                 * around the Z, Y, and X axis and the translation. Normals
+                 * are rotated and corrected for non-uniform scaling.
+                 *
+                 * @param translation Translation.
+                 * @param rotation Rotation in RAD around the X, Y, and Z axis.
+                 * @param scaling Scaling.
+                 */
+                void transform(const core::data::environment::Point3 &translation, const core::data::environment::Point3 &rotation, const core::data::environment::Point3 &scaling);
+
+                /**
+                 * This method computes a sphere enclosing all vertices
+                 * around the center of their axis aligned bounding box.
+                 *
+                 * @return Bounding sphere; invalid if there are no vertices.
+                 */
+                BoundingSphere getBoundingSphere() const;
+
+                /**
+                 * This method returns a coarser copy of this vertex buffer
+                 * for rendering at a distance (vertex clustering): All
+                 * vertices within the same cube of the given edge length
+                 * are merged into one vertex at their mean position with
+                 * mean normal and color and the first texture coordinate.
+                 * Triangles and lines collapsing this way are dropped.
+                 *
+                 * @param cellSize Edge length of the cubes.
+                 * @return Simplified vertex buffer.
+                 */
+                VertexBuffer simplify(const double &cellSize) const;
+
+                /**
+                 * This method removes all vertices and indices but
+                 * keeps the allocated memory.
+                 */
+                void clear();
+
+                /**
+                 * This method returns the number of vertices.
+                 *
+                 * @return Number of vertices.
+                 */
+                uint32_t getNumberOfVertices() const;
+
+                /**
+                 * This method returns the number of indices.
+                 *
+                 * @return Number of indices.
+                 */
+                uint32_t getNumberOfIndices() const;
+
+                /**
+                 * This method returns the interleaved vertex data with
+                 * FLOATS_PER_VERTEX floats per vertex.
+                 *
+                 * @return Pointer to the vertex data or NULL if empty.
+                 */
+                const float* getVertexData() const;
+
+                /**
+                 * This method returns the indices.
+                 *
+                 * @return Pointer to the indices or NULL if empty.
+                 */
+                const uint32_t* getIndexData() const;
+
+                /**
+                 * This method returns a vertex's position.
+                 *
+                 * @param index Index of the vertex.
+                 * @return Position.
+                 */
+                core::data::environment::Point3 getPosition(const uint32_t &index) const;
+
+                /**
+                 * This method returns a vertex's normal.
+                 *
+                 * @param index Index of the vertex.
+                 * @return Normal.
+                 */
+                core::data::environment::Point3 getNormal(const uint32_t &index) const;
+
+                /**
+                 * This method returns a vertex's texture coordinate.
+                 *
+                 * @param index Index of the vertex.
+                 * @return Texture coordinate.
+                 */
+                core::data::environment::Point3 getTextureCoordinate(const uint32_t &index) const;
+
+                /**
+                 * This method returns a vertex's color.
+                 *
+                 * @param index Index of the vertex.
+                 * @return Color.
+                 */
+                core::data::environment::Point3 getColor(const uint32_t &index) const;
+
+                /**
+                 * This method returns true if a normal was set for any vertex.
+                 *
+                 * @return true if a normal was set for any vertex.
+                 */
+                bool hasNormals() const;
+
+                /**
+                 * This method returns true if a texture coordinate was set for any vertex.
+                 *
+                 * @return true if a texture coordinate was set for any vertex.
+                 */
+                bool hasTextureCoordinates() const;
+
+                /**
+                 * This method returns true if a color was set for any vertex.
+                 *
+                 * @return true if a color was set for any vertex.
+                 */
+                bool hasColors() const;
+
+                /**
+                 * This method writes this vertex buffer in a compact
+                 * binary form (all values as 32 bit words in network
+                 * byte order).
+                 *
+                 * @param out Stream to write to.
+                 */
+                void write(ostream &out) const;
+
+                /**
+                 * This method replaces this vertex buffer by the one
+                 * read from the given stream (cf. write). Vertex buffers
+                 * exceeding MAXIMUM_NUMBER_OF_VERTICES or
+                 * MAXIMUM_NUMBER_OF_INDICES, truncated streams, and
+                 * indices referring to missing vertices are rejected
+                 * leaving this vertex buffer unchanged.
+                 *
+                 * @param in Stream to read from.
+                 * @return true if the vertex buffer could be read.
+                 */
+                bool read(istream &in);
+
+            private:
+                enum PRIMITIVE m_primitive;
+                float m_current[FLOATS_PER_VERTEX];
+                bool m_hasNormals;
+                bool m_hasTextureCoordinates;
+                bool m_hasColors;
+                vector<float> m_vertices;
+                vector<uint32_t> m_indices;
+
+                core::data::environment::Point3 getAttribute(const uint32_t &index, const uint32_t &offset, const uint32_t &size) const;
+        };
+
+    }
+} // hesperia::threeD
+
+#endif /*HESPERIA_CORE_THREED_VERTEXBUFFER_H_*/
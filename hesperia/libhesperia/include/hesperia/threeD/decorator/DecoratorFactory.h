@@ -27,6 +27,8 @@
 #include "hesperia/scenario/SCNXArchive.h"
 #include "hesperia/threeD/Node.h"
 #include "hesperia/threeD/NodeDescriptor.h"
+#include "hesperia/threeD/StaticGeometryBatch.h"
+#include "hesperia/threeD/TransformGroup.h"
 #include "hesperia/threeD/loaders/OBJXArchive.h"
 
 namespace hesperia {
@@ -40,6 +42,19 @@ namespace hesperia {
              */
             class OPENDAVINCI_API DecoratorFactory {
                 private:
+                    /**
+                     * Scenarios having more ground based complex models are
+                     * batched by material using batchStaticMeshes; their
+                     * individual names are not available for the rendering
+                     * configuration anymore. Models are batched per square
+                     * tile of TILE_SIZE meters to keep frustum culling and
+                     * levels of detail effective.
+                     */
+                    enum {
+                        MAXIMUM_NUMBER_OF_INDIVIDUAL_COMPLEX_MODELS = 32,
+                        TILE_SIZE = 50
+                    };
+
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
                      * already at compile time for unwanted bugs caused by any misuse
@@ -95,7 +110,46 @@ namespace hesperia {
                      */
                     Node* decorate(loaders::OBJXArchive &objxArchive, const NodeDescriptor &nd);
 
+                    /**
+                     * This method merges all meshes below the given transform
+                     * group into one mesh per material and tile with all
+                     * transformations applied to their vertices; the root's
+                     * children are assigned to the tile containing the center
+                     * of their bounding sphere. If a tile contains levels of
+                     * detail, one batch per level is created and selected by
+                     * a LevelOfDetail node. If the subtree contains any other
+                     * node than TransformGroup, LevelOfDetail, and Mesh, it
+                     * is not batched at all as these nodes would be lost.
+                     *
+                     * @param root Transform group to be batched; it is not modified.
+                     * @param nd NodeDescriptor for the resulting transform group.
+                     * @return New transform group containing one node per tile or NULL if the subtree cannot be batched.
+                     */
+                    TransformGroup* batchStaticMeshes(const TransformGroup &root, const NodeDescriptor &nd);
+
                 private:
+                    /**
+                     * This method returns true if the given subtree only
+                     * consists of TransformGroups, LevelOfDetails, and Meshes.
+                     *
+                     * @param node Root of the subtree.
+                     * @return true if all nodes can be batched.
+                     */
+                    static bool isBatchable(const Node *node);
+
+                    /**
+                     * This method collects all meshes below the given node.
+                     *
+                     * @param node Current node.
+                     * @param ancestors Transform groups from the root to node.
+                     * @param batch Batch to add the transformed meshes to.
+                     * @param level Level of detail to be collected; coarsest available level for LevelOfDetail nodes with fewer levels.
+                     * @param maximumDistance Greatest distance up to which the collected levels are drawn.
+                     * @param hasFurtherLevels Set to true if any LevelOfDetail node has more levels.
+                     * @return true if meshes outside of LevelOfDetail nodes were found.
+                     */
+                    bool collectMeshes(const Node *node, vector<const TransformGroup*> &ancestors, StaticGeometryBatch &batch, const uint32_t &level, double &maximumDistance, bool &hasFurtherLevels);
+
                     static core::base::Mutex m_singletonMutex;
                     static DecoratorFactory* m_singleton;
             };
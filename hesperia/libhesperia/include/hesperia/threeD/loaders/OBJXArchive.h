@@ -22,15 +22,15 @@
 
 #include <map>
 #include <string>
-#include <sstream>
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
+#include "core/SharedPointer.h"
 #include "core/wrapper/Image.h"
 #include "core/wrapper/StringComparator.h"
 
-#include "hesperia/threeD/Material.h"
 #include "hesperia/threeD/TransformGroup.h"
+#include "hesperia/threeD/loaders/OBJXModel.h"
 
 namespace hesperia {
     namespace threeD {
@@ -42,7 +42,9 @@ namespace hesperia {
             class OBJXArchiveFactory;
 
             /**
-             * This class represents the contents of an SCNX archive.
+             * This class represents the contents of an OBJX archive. The
+             * parsed model is shared between all archives having the
+             * same contents (cf. OBJXArchiveFactory).
              */
             class OPENDAVINCI_API OBJXArchive {
                 private:
@@ -71,8 +73,10 @@ namespace hesperia {
                 private:
                     /**
                      * Constructor.
+                     *
+                     * @param model Parsed model.
                      */
-                    OBJXArchive();
+                    OBJXArchive(const core::SharedPointer<OBJXModel> &model);
 
                 public:
                     virtual ~OBJXArchive();
@@ -87,60 +91,61 @@ namespace hesperia {
                     void addImage(const string &name, core::wrapper::Image *image);
 
                     /**
-                     * This method sets the content of the obj-file for further
-                     * processing.
-                     *
-                     * @param objContents Contents of the obj-file.
-                     */
-                    void setContentsOfObjFile(const string &objContents);
-
-                    /**
-                     * This method sets the content of the mtl-file for further
-                     * processing.
+                     * This method returns the parsed model.
                      *
-                     * @param mtlContents Contents of the mtl-file.
+                     * @return Parsed model.
                      */
-                    void setContentsOfMtlFile(const string &mtlContents);
+                    const OBJXModel& getModel() const;
 
                     /**
-                     * This method returns a reference to the contents of
-                     * the obj-file.
-                     *
-                     * @return Reference to the contents of the obj-file.
-                     */
-                    const stringstream& getContentsOfObjFile() const;
-
-                    /**
-                     * This method returns a reference to the contents of
-                     * the mtl-file.
+                     * This method creates a displayable node for the scene graph
+                     * based on the data of an instance of this class.
                      *
-                     * @return Reference to the contents of the mtl-file.
+                     * @return Displayable OpenGL node.
                      */
-                    const stringstream& getContentsOfMtlFile() const;
+                    TransformGroup* createTransformGroup(const NodeDescriptor &nd);
 
                     /**
                      * This method creates a displayable node for the scene graph
-                     * based on the data of an instance of this class.
+                     * which selects one of the model's levels of detail by
+                     * the distance to the camera; models far away from the
+                     * camera are not drawn at all.
                      *
                      * @return Displayable OpenGL node.
                      */
-                    TransformGroup* createTransformGroup(const NodeDescriptor &nd);
+                    TransformGroup* createTransformGroupWithLevelsOfDetail(const NodeDescriptor &nd);
 
                 private:
                     map<string, core::wrapper::Image*, core::wrapper::StringComparator> m_mapOfImages;
-                    map<string, Material, core::wrapper::StringComparator> m_mapOfMaterials;
-                    stringstream m_objFile;
-                    stringstream m_mtlFile;
+                    core::SharedPointer<OBJXModel> m_model;
+
+                    /**
+                     * This method registers the images at TextureManager
+                     * and returns the materials with their texture handles.
+                     *
+                     * @return Materials by name.
+                     */
+                    map<string, Material, core::wrapper::StringComparator> setUpTextures();
 
                     /**
-                     * This method creates the material's map.
+                     * This method creates one mesh per non-empty group.
+                     *
+                     * @param mapOfMaterials Materials with texture handles.
+                     * @param level Level of detail.
+                     * @return Transform group containing the meshes.
                      */
-                    void createMapOfMaterials();
+                    TransformGroup* createMeshes(const map<string, Material, core::wrapper::StringComparator> &mapOfMaterials, const uint32_t &level) const;
 
                     /**
-                     * This method registers the images at TextureManager.
+                     * This method places the given node below the transform
+                     * groups rotating Wavefront models into our coordinate
+                     * system.
+                     *
+                     * @param nd Description for the returned transform group.
+                     * @param model Model to be rotated.
+                     * @return Transform group containing the model.
                      */
-                    void setUpTextures();
+                    TransformGroup* createRotatedModel(const NodeDescriptor &nd, Node *model) const;
             };
 
         }
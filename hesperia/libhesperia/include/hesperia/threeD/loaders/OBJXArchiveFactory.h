@@ -21,13 +21,17 @@
 #define HESPERIA_CORE_THREED_LOADERS_OBJXARCHIVEFACTORY_H_
 
 #include <iostream>
+#include <map>
+#include <string>
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
 #include "core/base/Mutex.h"
+#include "core/SharedPointer.h"
 #include "core/exceptions/Exceptions.h"
 
 #include "hesperia/threeD/loaders/OBJXArchive.h"
+#include "hesperia/threeD/loaders/OBJXModel.h"
 
 namespace hesperia {
     namespace threeD {
@@ -38,6 +42,13 @@ namespace hesperia {
             /**
              * This class produces an instance for accessing the contents
              * of an OBJXArchive (.objx) from a given input stream.
+             *
+             * Parsed models are kept in memory by the checksum and length
+             * of the archive's contents; thus, all instances of the same
+             * model share one OBJXModel and the OBJ file is parsed only
+             * once. If a cache directory is set, parsed models are also
+             * stored there in their binary form and read back instead
+             * of parsing the OBJ file again.
              */
             class OPENDAVINCI_API OBJXArchiveFactory {
                 private:
@@ -86,9 +97,69 @@ namespace hesperia {
                      */
                     OBJXArchive* getOBJXArchive(istream &in) throw (core::exceptions::InvalidArgumentException);
 
+                    /**
+                     * This method sets the directory for storing parsed
+                     * models in their binary form.
+                     *
+                     * @param directory Existing directory or "" to disable the cache.
+                     */
+                    void setCacheDirectory(const string &directory);
+
                 private:
                     static core::base::Mutex m_singletonMutex;
                     static OBJXArchiveFactory* m_singleton;
+
+                    core::base::Mutex m_modelsMutex;
+                    string m_cacheDirectory;
+                    map<string, core::SharedPointer<OBJXModel> > m_mapOfModels;
+
+                    /**
+                     * This method reads the entire stream.
+                     *
+                     * @param in Input stream.
+                     * @return Contents of the stream.
+                     * @throws InvalidArgumentException if the stream is invalid.
+                     */
+                    string readContents(istream &in) throw (core::exceptions::InvalidArgumentException);
+
+                    /**
+                     * This method computes the checksum (CRC-32) of an
+                     * archive's contents.
+                     *
+                     * @param contents Contents of the archive.
+                     * @return Checksum.
+                     */
+                    static uint32_t getChecksum(const string &contents);
+
+                    /**
+                     * This method returns a previously parsed model from
+                     * memory or from the cache directory.
+                     *
+                     * @param checksum Checksum of the archive's contents.
+                     * @param length Length of the archive's contents.
+                     * @return Parsed model or an invalid pointer.
+                     */
+                    core::SharedPointer<OBJXModel> getCachedModel(const uint32_t &checksum, const uint32_t &length);
+
+                    /**
+                     * This method keeps a parsed model in memory and
+                     * stores it in the cache directory.
+                     *
+                     * @param checksum Checksum of the archive's contents.
+                     * @param length Length of the archive's contents.
+                     * @param model Parsed model.
+                     */
+                    void addModel(const uint32_t &checksum, const uint32_t &length, const core::SharedPointer<OBJXModel> &model);
+
+                    /**
+                     * This method returns the name of a model within the
+                     * cache directory.
+                     *
+                     * @param checksum Checksum of the archive's contents.
+                     * @param length Length of the archive's contents.
+                     * @return Name of the cached model.
+                     */
+                    const string getCacheFileName(const uint32_t &checksum, const uint32_t &length) const;
             };
 
         }
@@ -0,0 +1,218 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_LOADERS_OBJXMODEL_H_
+#define HESPERIA_CORE_THREED_LOADERS_OBJXMODEL_H_
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/SharedPointer.h"
+#include "core/base/Mutex.h"
+#include "core/wrapper/StringComparator.h"
+
+#include "hesperia/threeD/BoundingSphere.h"
+#include "hesperia/threeD/Material.h"
+#include "hesperia/threeD/VertexBuffer.h"
+
+namespace hesperia {
+    namespace threeD {
+        namespace loaders {
+
+            using namespace std;
+
+            /**
+             * This class contains the parsed geometry and materials of
+             * an OBJX archive. The OBJ and MTL files are tokenized
+             * directly from their buffers; every group (g) or change of
+             * material (usemtl) results in one vertex buffer. Polygons
+             * are split into triangle fans.
+             *
+             * The parsed model can be written to and read from a compact
+             * binary form consisting of a header (magic number, format
+             * version, checksum and length of the archive it was created
+             * from) followed by the materials and vertex buffers. It does
+             * not depend on OpenGL; OBJXArchive creates the scene graph
+             * nodes from it.
+             *
+             * For rendering at a distance, coarser levels of detail of
+             * every group are created by vertex clustering on first use.
+             */
+            class OPENDAVINCI_API OBJXModel {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    OBJXModel(const OBJXModel &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    OBJXModel& operator=(const OBJXModel &);
+
+                public:
+                    enum CONSTANTS {
+                        MAGIC_NUMBER = 0x4F424A43, // "OBJC"
+                        VERSION = 1,
+                        NUMBER_OF_LEVELS_OF_DETAIL = 3,
+                        MAXIMUM_STRING_LENGTH = 4096
+                    };
+
+                    OBJXModel();
+
+                    virtual ~OBJXModel();
+
+                    /**
+                     * This method parses the contents of an MTL file and
+                     * adds its materials.
+                     *
+                     * @param buffer Contents of the MTL file.
+                     * @param length Length of the contents.
+                     */
+                    void parseMTL(const char *buffer, const uint32_t &length);
+
+                    /**
+                     * This method parses the contents of an OBJ file and
+                     * adds its groups.
+                     *
+                     * @param buffer Contents of the OBJ file.
+                     * @param length Length of the contents.
+                     */
+                    void parseOBJ(const char *buffer, const uint32_t &length);
+
+                    /**
+                     * This method returns the number of groups.
+                     *
+                     * @return Number of groups.
+                     */
+                    uint32_t getNumberOfGroups() const;
+
+                    /**
+                     * This method returns the name of a group's material.
+                     *
+                     * @param index Index of the group.
+                     * @return Name of the material or "" for the default material.
+                     */
+                    const string& getMaterialName(const uint32_t &index) const;
+
+                    /**
+                     * This method returns a group's triangles.
+                     *
+                     * @param index Index of the group.
+                     * @return Vertex buffer.
+                     */
+                    const VertexBuffer& getVertexBuffer(const uint32_t &index) const;
+
+                    /**
+                     * This method returns a group's triangles at the given
+                     * level of detail. Level 0 is the original geometry;
+                     * every further level merges the vertices within cubes
+                     * of a growing fraction of the model's radius.
+                     *
+                     * @param index Index of the group.
+                     * @param level Level of detail less than NUMBER_OF_LEVELS_OF_DETAIL.
+                     * @return Vertex buffer.
+                     */
+                    const VertexBuffer& getVertexBuffer(const uint32_t &index, const uint32_t &level) const;
+
+                    /**
+                     * This method returns a group's triangles at the given
+                     * level of detail (cf. getVertexBuffer) for sharing
+                     * them with scene graph nodes; they must not be modified.
+                     *
+                     * @param index Index of the group.
+                     * @param level Level of detail less than NUMBER_OF_LEVELS_OF_DETAIL.
+                     * @return Vertex buffer.
+                     */
+                    core::SharedPointer<VertexBuffer> getSharedVertexBuffer(const uint32_t &index, const uint32_t &level) const;
+
+                    /**
+                     * This method returns the sphere enclosing all groups.
+                     *
+                     * @return Bounding sphere; invalid if there are no vertices.
+                     */
+                    BoundingSphere getBoundingSphere() const;
+
+                    /**
+                     * This method returns the materials read from the MTL file.
+                     *
+                     * @return Materials by name.
+                     */
+                    const map<string, Material, core::wrapper::StringComparator>& getMaterials() const;
+
+                    /**
+                     * This method returns true if any material refers to
+                     * a texture image.
+                     *
+                     * @return true if any material is textured.
+                     */
+                    bool hasTextures() const;
+
+                    /**
+                     * This method returns the number of triangles of all groups.
+                     *
+                     * @return Number of triangles.
+                     */
+                    uint32_t getNumberOfTriangles() const;
+
+                    /**
+                     * This method writes the binary form of this model.
+                     *
+                     * @param out Stream to write to.
+                     * @param checksum Checksum of the archive this model was parsed from.
+                     * @param length Length of the archive this model was parsed from.
+                     */
+                    void write(ostream &out, const uint32_t &checksum, const uint32_t &length) const;
+
+                    /**
+                     * This method reads the binary form of a model if it
+                     * was created from the given archive with the current
+                     * format version. Corrupt data (e.g. lengths exceeding
+                     * MAXIMUM_STRING_LENGTH or invalid vertex buffers) is
+                     * rejected leaving this model unchanged.
+                     *
+                     * @param in Stream to read from.
+                     * @param checksum Checksum of the archive to be matched.
+                     * @param length Length of the archive to be matched.
+                     * @return true if the model could be read.
+                     */
+                    bool read(istream &in, const uint32_t &checksum, const uint32_t &length);
+
+                private:
+                    map<string, Material, core::wrapper::StringComparator> m_mapOfMaterials;
+                    vector<string> m_listOfMaterialNames;
+                    vector<core::SharedPointer<VertexBuffer> > m_listOfVertexBuffers;
+
+                    mutable core::base::Mutex m_levelsOfDetailMutex;
+                    mutable vector<core::SharedPointer<VertexBuffer> > m_listOfSimplifiedVertexBuffers;
+            };
+
+        }
+    }
+} // hesperia::threeD::loaders
+
+#endif /*HESPERIA_CORE_THREED_LOADERS_OBJXMODEL_H_*/
@@ -28,6 +28,7 @@
 #include "hesperia/threeD/Node.h"
 #include "hesperia/threeD/NodeDescriptor.h"
 #include "hesperia/threeD/TransformGroup.h"
+#include "hesperia/threeD/models/Mesh.h"
 
 namespace hesperia {
     namespace threeD {
@@ -69,6 +70,12 @@ namespace hesperia {
 
                 private:
                     uint32_t m_textureHandle;
+                    Mesh m_quad;
+
+                    /**
+                     * This method creates the textured unit quad.
+                     */
+                    void init();
             };
 
             /**
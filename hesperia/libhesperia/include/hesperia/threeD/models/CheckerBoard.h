@@ -26,6 +26,7 @@
 #include "core/native.h"
 
 #include "hesperia/threeD/Node.h"
+#include "hesperia/threeD/models/Mesh.h"
 #include "core/data/environment/Point3.h"
 
 namespace hesperia {
@@ -79,6 +80,12 @@ namespace hesperia {
                     core::data::environment::Point3 m_positionA;
                     core::data::environment::Point3 m_positionB;
                     float m_height;
+                    Mesh m_squares;
+
+                    /**
+                     * This method creates the checker board's squares.
+                     */
+                    void init();
             };
 
         }
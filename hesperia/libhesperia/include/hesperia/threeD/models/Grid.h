@@ -25,6 +25,7 @@
 
 #include "hesperia/threeD/Node.h"
 #include "hesperia/threeD/NodeDescriptor.h"
+#include "hesperia/threeD/models/Mesh.h"
 
 namespace hesperia {
     namespace threeD {
@@ -66,6 +67,12 @@ namespace hesperia {
                 private:
                     uint32_t m_size;
                     float m_lineWidth;
+                    Mesh m_lines;
+
+                    /**
+                     * This method creates the grid's lines.
+                     */
+                    void init();
             };
 
         }
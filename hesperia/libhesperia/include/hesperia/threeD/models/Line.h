@@ -68,6 +68,9 @@ namespace hesperia {
 
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
+                protected:
+                    virtual BoundingSphere computeBoundingSphere() const;
+
                 private:
                     core::data::environment::Point3 m_positionA;
                     core::data::environment::Point3 m_positionB;
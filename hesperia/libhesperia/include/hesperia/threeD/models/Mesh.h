@@ -0,0 +1,189 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_MODELS_MESH_H_
+#define HESPERIA_CORE_THREED_MODELS_MESH_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/SharedPointer.h"
+#include "hesperia/threeD/Material.h"
+#include "hesperia/threeD/Node.h"
+#include "hesperia/threeD/NodeDescriptor.h"
+#include "hesperia/threeD/VertexBuffer.h"
+
+namespace hesperia {
+    namespace threeD {
+        namespace models {
+
+            using namespace std;
+
+            /**
+             * This class renders a VertexBuffer in retained mode: The
+             * geometry is uploaded once into OpenGL vertex buffer objects
+             * (or drawn from client-side vertex arrays if these are not
+             * available) and drawn with a single glDrawElements call.
+             *
+             * If a material is set, it is applied before drawing like in
+             * TriangleSet; otherwise, the current OpenGL state is used.
+             */
+            class OPENDAVINCI_API Mesh : public Node {
+                public:
+                    Mesh();
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param nodeDescriptor Description for this node.
+                     */
+                    Mesh(const NodeDescriptor &nodeDescriptor);
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param nodeDescriptor Description for this node.
+                     * @param vertexBuffer Geometry to be rendered.
+                     */
+                    Mesh(const NodeDescriptor &nodeDescriptor, const VertexBuffer &vertexBuffer);
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param nodeDescriptor Description for this node.
+                     * @param vertexBuffer Geometry to be rendered.
+                     * @param material Material to be applied.
+                     */
+                    Mesh(const NodeDescriptor &nodeDescriptor, const VertexBuffer &vertexBuffer, const Material &material);
+
+                    /**
+                     * Constructor. The geometry is shared with the caller
+                     * (e.g. with the models::Mesh nodes of other instances
+                     * of the same model) instead of being copied.
+                     *
+                     * @param nodeDescriptor Description for this node.
+                     * @param vertexBuffer Geometry to be rendered.
+                     * @param material Material to be applied.
+                     */
+                    Mesh(const NodeDescriptor &nodeDescriptor, const core::SharedPointer<VertexBuffer> &vertexBuffer, const Material &material);
+
+                    /**
+                     * Copy constructor. The copy shares the geometry but
+                     * uploads its own buffers.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    Mesh(const Mesh &obj);
+
+                    /**
+                     * Assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    Mesh& operator=(const Mesh &obj);
+
+                    virtual ~Mesh();
+
+                    virtual void render(RenderingConfiguration &renderingConfiguration);
+
+                    /**
+                     * This method sets the material for this mesh.
+                     *
+                     * @param material Material for this mesh.
+                     */
+                    void setMaterial(const Material &material);
+
+                    /**
+                     * This method returns true if a material was set.
+                     *
+                     * @return true if a material was set.
+                     */
+                    bool hasMaterial() const;
+
+                    /**
+                     * This method returns the material.
+                     *
+                     * @return Material.
+                     */
+                    const Material& getMaterial() const;
+
+                    /**
+                     * This method sets the geometry to be rendered.
+                     *
+                     * @param vertexBuffer Geometry to be rendered.
+                     */
+                    void setVertexBuffer(const VertexBuffer &vertexBuffer);
+
+                    /**
+                     * This method returns the geometry.
+                     *
+                     * @return Geometry.
+                     */
+                    const VertexBuffer& getVertexBuffer() const;
+
+                protected:
+                    virtual BoundingSphere computeBoundingSphere() const;
+
+                    /**
+                     * This method returns the geometry for modification;
+                     * it is uploaded again when rendered next time. Geometry
+                     * referenced by other meshes or models is copied first.
+                     *
+                     * @return Geometry.
+                     */
+                    VertexBuffer& getVertexBufferForModification();
+
+                private:
+                    Material m_material;
+                    bool m_hasMaterial;
+                    core::SharedPointer<VertexBuffer> m_vertexBuffer;
+                    bool m_uploaded;
+                    uint32_t m_vertexBufferObject;
+                    uint32_t m_indexBufferObject;
+
+                    /**
+                     * This method uploads the geometry into vertex buffer objects.
+                     */
+                    void upload();
+
+                    /**
+                     * This method releases the vertex buffer objects.
+                     */
+                    void release();
+
+                    /**
+                     * This method applies the material.
+                     *
+                     * @param renderingConfiguration Current rendering configuration.
+                     * @return true if a texture was enabled.
+                     */
+                    bool applyMaterial(const RenderingConfiguration &renderingConfiguration) const;
+
+                    /**
+                     * This method draws the geometry.
+                     */
+                    void draw();
+            };
+
+        }
+    }
+} // hesperia::threeD::models
+
+#endif /*HESPERIA_CORE_THREED_MODELS_MESH_H_*/
@@ -66,6 +66,9 @@ namespace hesperia {
 
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
+                protected:
+                    virtual BoundingSphere computeBoundingSphere() const;
+
                 private:
                     core::data::environment::Point3 m_position;
                     core::data::environment::Point3 m_color;
@@ -69,6 +69,9 @@ namespace hesperia {
 
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
+                protected:
+                    virtual BoundingSphere computeBoundingSphere() const;
+
                 private:
                     vector<core::data::environment::Point3> m_listOfGroundVertices;
                     core::data::environment::Point3 m_color;
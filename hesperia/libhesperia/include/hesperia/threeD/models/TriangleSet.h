@@ -25,10 +25,8 @@
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
 
-#include "core/data/environment/Point3.h"
-#include "hesperia/threeD/Material.h"
-#include "hesperia/threeD/Node.h"
 #include "hesperia/threeD/NodeDescriptor.h"
+#include "hesperia/threeD/models/Mesh.h"
 #include "hesperia/threeD/models/Triangle.h"
 
 namespace hesperia {
@@ -38,9 +36,10 @@ namespace hesperia {
             using namespace std;
 
             /**
-             * This class represents a set of triangles.
+             * This class represents a set of triangles that is rendered
+             * as a Mesh.
              */
-            class OPENDAVINCI_API TriangleSet : public Node {
+            class OPENDAVINCI_API TriangleSet : public Mesh {
                 public:
                     TriangleSet();
 
@@ -68,35 +67,12 @@ namespace hesperia {
 
                     virtual ~TriangleSet();
 
-                    virtual void render(RenderingConfiguration &renderingConfiguration);
-
                     /**
                      * This method adds a new triangle.
                      *
                      * @param triangle Triangle to be added.
                      */
                     void addTriangle(const Triangle &triangle);
-
-                    /**
-                     * This method sets the material for this triangle set.
-                     *
-                     * @param material Material for this triangle set.
-                     */
-                    void setMaterial(const Material &material);
-
-                private:
-                    mutable bool m_compiled;
-                    mutable uint32_t m_callList;
-                    Material m_material;
-                    vector<core::data::environment::Point3> m_vertices;
-                    vector<core::data::environment::Point3> m_normals;
-                    vector<core::data::environment::Point3> m_textureCoordinates;
-
-                    /**
-                     * This method compiles this triangle set using OpenGL
-                     * compile lists.
-                     */
-                    void compile() const;
             };
 
         }
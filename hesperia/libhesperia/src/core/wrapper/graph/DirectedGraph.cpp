@@ -17,11 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
 #include <sstream>
 
-#include <boost/graph/astar_search.hpp>
-
 #include "core/macros.h"
 #include "core/wrapper/graph/DirectedGraph.h"
 
@@ -29,59 +30,35 @@ namespace core {
     namespace wrapper {
         namespace graph {
 
-            // Euclidean Distances, see: http://www.cs.rpi.edu/~beevek/research/astar_bgl04.pdf
-            template<class Graph, class EdgeWeight>
-            class DistanceHeuristic : public boost::astar_heuristic<Graph, EdgeWeight> {
-                public:
-                    typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
-
-                    DistanceHeuristic(Graph &g, Vertex goal) :
-                        m_graph(g),
-                        m_goal(goal) {}
-
-                    EdgeWeight operator()(Vertex u) {
-                        EdgeWeight value = 0;
-                        if ( (m_graph[m_goal] != NULL) && (m_graph[u] != NULL) ) {
-                            value = m_graph[m_goal]->getDistanceTo(*(m_graph[u]));
-                        }
-                        cerr << "Value = " << value << endl;
-                        return value;
-                    }
-
-                private:
-                    Graph &m_graph;
-                    Vertex m_goal;
-            };
+            using namespace std;
 
-            // This class is thrown as exception if the goal was found.
-            struct found_goal {};
+            // Entry in the priority queue: Key and vertex' number.
+            typedef pair<double, uint32_t> QueueEntry;
+            typedef priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry> > Queue;
 
-            // This class is used as visitor to find the goal.
-            template <class Vertex>
-            class AStarGoalVisitor : public boost::default_astar_visitor {
-                public:
-                    AStarGoalVisitor(Vertex goal) :
-                        m_goal(goal) {}
-
-                    template <class Graph>
-                    void examine_vertex(Vertex u, Graph &/*g*/) {
-                        if (u == m_goal) {
-                            throw found_goal();
-                        }
-                    }
-
-                private:
-                    Vertex m_goal;
-            };
-
-            ////////////////////////////////////////////////////////////////////
+            const uint32_t DirectedGraph::NONE = numeric_limits<uint32_t>::max();
+            const double DirectedGraph::INFINITE = numeric_limits<double>::max();
 
             DirectedGraph::DirectedGraph() :
-                m_graph(),
-                m_weightMap(),
-                m_mapOfVertices(),
                 m_listOfVertices(),
-                m_listOfEdges() {}
+                m_listOfEdges(),
+                m_mapOfVertices(),
+                m_mapOfEdges(),
+                m_prepared(false),
+                m_forwardOffsets(),
+                m_forwardTargets(),
+                m_forwardCosts(),
+                m_backwardOffsets(),
+                m_backwardTargets(),
+                m_backwardCosts(),
+                m_numberOfLandmarks(0),
+                m_distancesFromLandmarks(),
+                m_distancesToLandmarks(),
+                m_distances(),
+                m_predecessors(),
+                m_stamps(),
+                m_settled(),
+                m_stamp(0) {}
 
             DirectedGraph::~DirectedGraph() {
                 // Delete all vertices.
@@ -101,22 +78,23 @@ namespace core {
 
             void DirectedGraph::addVertex(const Vertex *v) {
                 if ( (v != NULL) && (!hasVertex(*v)) ) {
-                    GraphDefinition::vertex_descriptor vertex = boost::add_vertex(m_graph);
-
                     // Safe newly created vertex for further usage.
-                    m_mapOfVertices[v->getIdentifier()] = vertex;
+                    m_mapOfVertices[v->getIdentifier()] = m_listOfVertices.size();
 
                     // Safe pointer for removal.
                     m_listOfVertices.push_back(v);
 
-                    // Actually add vertex to graph.
-                    m_graph[vertex] = v;
+                    m_prepared = false;
                 }
             }
 
             bool DirectedGraph::hasVertex(const Vertex &v) {
-                map<int32_t, GraphDefinition::vertex_descriptor>::iterator result = m_mapOfVertices.find(v.getIdentifier());
-                return (result != m_mapOfVertices.end());
+                return (getNumber(v) != DirectedGraph::NONE);
+            }
+
+            uint32_t DirectedGraph::getNumber(const Vertex &v) const {
+                map<int32_t, uint32_t>::const_iterator result = m_mapOfVertices.find(v.getIdentifier());
+                return ( (result != m_mapOfVertices.end()) ? result->second : DirectedGraph::NONE );
             }
 
             void DirectedGraph::updateEdge(const Vertex *v1, const Vertex *v2, const Edge *e) {
@@ -126,15 +104,24 @@ namespace core {
                     addVertex(v2);
                     m_listOfEdges.push_back(e);
 
-                    GraphDefinition::vertex_descriptor vertex1 = m_mapOfVertices[v1->getIdentifier()];
-                    GraphDefinition::vertex_descriptor vertex2 = m_mapOfVertices[v2->getIdentifier()];
+                    const uint32_t vertex1 = getNumber(*v1);
+                    const uint32_t vertex2 = getNumber(*v2);
 
-                    bool found = false;
-                    GraphDefinition::edge_descriptor edge;
-                    boost::tie(edge, found) = boost::add_edge(vertex1, vertex2, m_graph);
-                    m_weightMap[edge] = e->getCosts();
+                    // Parallel edges were all kept before; only the cheapest one can be part of a shortest path.
+                    const pair<uint32_t, uint32_t> key = make_pair(vertex1, vertex2);
+                    map<pair<uint32_t, uint32_t>, double>::iterator it = m_mapOfEdges.find(key);
+                    if ( (it == m_mapOfEdges.end()) || (e->getCosts() < it->second) ) {
+                        m_mapOfEdges[key] = e->getCosts();
+                    }
+                    m_prepared = false;
 
-                    clog << "Edge " << e->toString() << " between " << v1->toString() << " and " << v2->toString() << " added to graph." << endl;
+                    // Vertices with an identifier already contained in the graph are not needed anymore.
+                    if (m_listOfVertices[vertex1] != v1) {
+                        OPENDAVINCI_CORE_DELETE_POINTER(v1);
+                    }
+                    if ( (m_listOfVertices[vertex2] != v2) && (v2 != v1) ) {
+                        OPENDAVINCI_CORE_DELETE_POINTER(v2);
+                    }
                 }
             }
 
@@ -142,53 +129,305 @@ namespace core {
                 stringstream sstr;
 
                 sstr << "edges(g) = ";
-                boost::graph_traits<GraphDefinition>::edge_iterator ei, ei_end;
-                for(boost::tie(ei, ei_end) = boost::edges(m_graph); ei != ei_end; ei++) {
-                    sstr << "(" << m_graph[boost::source(*ei, m_graph)]->toString() << "-" << m_weightMap[*ei] << "->" << m_graph[boost::target(*ei, m_graph)]->toString() << ") ";
+                map<pair<uint32_t, uint32_t>, double>::const_iterator it = m_mapOfEdges.begin();
+                while (it != m_mapOfEdges.end()) {
+                    sstr << "(" << m_listOfVertices[it->first.first]->toString() << "-" << it->second << "->" << m_listOfVertices[it->first.second]->toString() << ") ";
+                    it++;
                 }
 
                 return sstr.str();
             }
 
-            vector<const Vertex*> DirectedGraph::getShortestPath(const Vertex &v1, const Vertex &v2) {
-                vector<const Vertex*> route;
-                if (hasVertex(v1) && hasVertex(v2)) {
-                    clog << "Getting route from " << v1.toString() << " to " << v2.toString() << endl;
-
-                    GraphDefinition::vertex_descriptor start = m_mapOfVertices[v1.getIdentifier()];
-                    GraphDefinition::vertex_descriptor end = m_mapOfVertices[v2.getIdentifier()];
-
-                    vector<GraphDefinition::vertex_descriptor> p(boost::num_vertices(m_graph));
-                    vector<double> d(boost::num_vertices(m_graph));
-
-                    try {
-                        // Call A* algorithm.
-                        boost::astar_search(m_graph, start,
-                                          DistanceHeuristic<GraphDefinition, double>(m_graph, end),
-                                          boost::predecessor_map(&p[0]).distance_map(&d[0]).visitor(AStarGoalVisitor<GraphDefinition::vertex_descriptor>(end)));
-                    }
-                    catch(found_goal &/*fg*/) {
-                        // An exception is thrown if end was found.
-                        list<GraphDefinition::vertex_descriptor> path;
-                        for (GraphDefinition::vertex_descriptor v = end; ; v = p[v]) {
-                            path.push_front(v);
-                            if (v == p[v]) {
-                                break;
-                            }
+            void DirectedGraph::prepare() {
+                if (m_prepared) {
+                    return;
+                }
+
+                const uint32_t SIZE = m_listOfVertices.size();
+                const uint32_t NUMBER_OF_EDGES = m_mapOfEdges.size();
+
+                // The map is sorted by the edges' start vertices and thus, the outgoing edges can be copied in order.
+                m_forwardOffsets.assign(SIZE + 1, 0);
+                m_forwardTargets.resize(NUMBER_OF_EDGES);
+                m_forwardCosts.resize(NUMBER_OF_EDGES);
+                m_backwardOffsets.assign(SIZE + 1, 0);
+                m_backwardTargets.resize(NUMBER_OF_EDGES);
+                m_backwardCosts.resize(NUMBER_OF_EDGES);
+
+                map<pair<uint32_t, uint32_t>, double>::const_iterator it = m_mapOfEdges.begin();
+                for (uint32_t i = 0; it != m_mapOfEdges.end(); it++, i++) {
+                    m_forwardOffsets[it->first.first + 1]++;
+                    m_backwardOffsets[it->first.second + 1]++;
+                    m_forwardTargets[i] = it->first.second;
+                    m_forwardCosts[i] = it->second;
+                }
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    m_forwardOffsets[i + 1] += m_forwardOffsets[i];
+                    m_backwardOffsets[i + 1] += m_backwardOffsets[i];
+                }
+
+                vector<uint32_t> position(m_backwardOffsets.begin(), m_backwardOffsets.end() - 1);
+                for (it = m_mapOfEdges.begin(); it != m_mapOfEdges.end(); it++) {
+                    const uint32_t i = position[it->first.second]++;
+                    m_backwardTargets[i] = it->first.first;
+                    m_backwardCosts[i] = it->second;
+                }
+
+                // Select landmarks farthest away from all previously selected ones.
+                m_numberOfLandmarks = (SIZE < static_cast<uint32_t>(DirectedGraph::NUMBER_OF_LANDMARKS)) ? SIZE : static_cast<uint32_t>(DirectedGraph::NUMBER_OF_LANDMARKS);
+                m_distancesFromLandmarks.assign(m_numberOfLandmarks * SIZE, DirectedGraph::INFINITE);
+                m_distancesToLandmarks.assign(m_numberOfLandmarks * SIZE, DirectedGraph::INFINITE);
+
+                vector<double> nearestLandmark(SIZE, DirectedGraph::INFINITE);
+                uint32_t landmark = 0;
+                for (uint32_t k = 0; k < m_numberOfLandmarks; k++) {
+                    double *from = &m_distancesFromLandmarks[k * SIZE];
+                    double *to = &m_distancesToLandmarks[k * SIZE];
+                    computeAllDistances(landmark, true, from);
+                    computeAllDistances(landmark, false, to);
+
+                    uint32_t farthest = landmark;
+                    for (uint32_t v = 0; v < SIZE; v++) {
+                        const double d = (from[v] < to[v]) ? from[v] : to[v];
+                        nearestLandmark[v] = (d < nearestLandmark[v]) ? d : nearestLandmark[v];
+                        if (nearestLandmark[v] > nearestLandmark[farthest]) {
+                            farthest = v;
                         }
+                    }
+                    landmark = farthest;
+                }
+
+                m_distances.assign(SIZE, DirectedGraph::INFINITE);
+                m_predecessors.assign(SIZE, DirectedGraph::NONE);
+                m_stamps.assign(SIZE, 0);
+                m_settled.assign(SIZE, false);
+                m_stamp = 0;
+
+                m_prepared = true;
+            }
+
+            void DirectedGraph::computeAllDistances(const uint32_t &source, const bool &forward, double *distances) const {
+                const vector<uint32_t> &offsets = (forward ? m_forwardOffsets : m_backwardOffsets);
+                const vector<uint32_t> &targets = (forward ? m_forwardTargets : m_backwardTargets);
+                const vector<double> &costs = (forward ? m_forwardCosts : m_backwardCosts);
+
+                const uint32_t SIZE = m_listOfVertices.size();
+                for (uint32_t v = 0; v < SIZE; v++) {
+                    distances[v] = DirectedGraph::INFINITE;
+                }
 
-                        list<GraphDefinition::vertex_descriptor>::iterator it = path.begin();
-                        stringstream sstr;
-                        while (it != path.end()) {
-                            route.push_back(m_graph[*it]);
-                            sstr << m_graph[*it]->toString() << " ";
-                            it++;
+                Queue queue;
+                distances[source] = 0;
+                queue.push(make_pair(0.0, source));
+                while (!queue.empty()) {
+                    const QueueEntry top = queue.top();
+                    queue.pop();
+
+                    const uint32_t u = top.second;
+                    if (top.first > distances[u]) {
+                        continue;
+                    }
+
+                    for (uint32_t i = offsets[u]; i < offsets[u + 1]; i++) {
+                        const double d = distances[u] + costs[i];
+                        if (d < distances[targets[i]]) {
+                            distances[targets[i]] = d;
+                            queue.push(make_pair(d, targets[i]));
                         }
-                        cout << "Route: " << sstr.str() << endl;
                     }
                 }
+            }
+
+            double DirectedGraph::getLowerBound(const uint32_t &v, const uint32_t &target) const {
+                const uint32_t SIZE = m_listOfVertices.size();
+
+                double bound = 0;
+                for (uint32_t k = 0; k < m_numberOfLandmarks; k++) {
+                    const double *from = &m_distancesFromLandmarks[k * SIZE];
+                    const double *to = &m_distancesToLandmarks[k * SIZE];
+
+                    // Triangle inequality: d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L).
+                    if ( (from[target] < DirectedGraph::INFINITE) && (from[v] < DirectedGraph::INFINITE) && (from[target] - from[v] > bound) ) {
+                        bound = from[target] - from[v];
+                    }
+                    if ( (to[v] < DirectedGraph::INFINITE) && (to[target] < DirectedGraph::INFINITE) && (to[v] - to[target] > bound) ) {
+                        bound = to[v] - to[target];
+                    }
+                }
+
+                return bound;
+            }
+
+            void DirectedGraph::resetSearch(const uint32_t &source) {
+                m_stamp++;
+                if (m_stamp == 0) {
+                    // Stamps wrapped around.
+                    m_stamps.assign(m_stamps.size(), 0);
+                    m_stamp = 1;
+                }
+
+                m_stamps[source] = m_stamp;
+                m_distances[source] = 0;
+                m_predecessors[source] = source;
+                m_settled[source] = false;
+            }
+
+            double DirectedGraph::getDistance(const uint32_t &v) const {
+                return ( (m_stamps[v] == m_stamp) ? m_distances[v] : DirectedGraph::INFINITE );
+            }
+
+            void DirectedGraph::search(const uint32_t &source, const uint32_t &target) {
+                resetSearch(source);
+
+                Queue queue;
+                queue.push(make_pair(getLowerBound(source, target), source));
+                while (!queue.empty()) {
+                    const uint32_t u = queue.top().second;
+                    queue.pop();
+
+                    if (m_settled[u]) {
+                        continue;
+                    }
+                    m_settled[u] = true;
+
+                    if (u == target) {
+                        break;
+                    }
+
+                    for (uint32_t i = m_forwardOffsets[u]; i < m_forwardOffsets[u + 1]; i++) {
+                        const uint32_t v = m_forwardTargets[i];
+                        const double d = m_distances[u] + m_forwardCosts[i];
+                        if (d < getDistance(v)) {
+                            m_stamps[v] = m_stamp;
+                            m_distances[v] = d;
+                            m_predecessors[v] = u;
+                            m_settled[v] = false;
+                            queue.push(make_pair(d + getLowerBound(v, target), v));
+                        }
+                    }
+                }
+            }
+
+            void DirectedGraph::search(const uint32_t &source, const vector<uint32_t> &targets) {
+                resetSearch(source);
+
+                // Sorted list of the targets not yet settled.
+                vector<uint32_t> sortedTargets(targets);
+                sort(sortedTargets.begin(), sortedTargets.end());
+                sortedTargets.erase(unique(sortedTargets.begin(), sortedTargets.end()), sortedTargets.end());
+                if (!sortedTargets.empty() && (sortedTargets.back() == DirectedGraph::NONE)) {
+                    sortedTargets.pop_back();
+                }
+                uint32_t remaining = sortedTargets.size();
+
+                Queue queue;
+                queue.push(make_pair(0.0, source));
+                while (!queue.empty() && (remaining > 0)) {
+                    const uint32_t u = queue.top().second;
+                    queue.pop();
+
+                    if (m_settled[u]) {
+                        continue;
+                    }
+                    m_settled[u] = true;
+
+                    if (binary_search(sortedTargets.begin(), sortedTargets.end(), u)) {
+                        remaining--;
+                    }
+
+                    for (uint32_t i = m_forwardOffsets[u]; i < m_forwardOffsets[u + 1]; i++) {
+                        const uint32_t v = m_forwardTargets[i];
+                        const double d = m_distances[u] + m_forwardCosts[i];
+                        if (d < getDistance(v)) {
+                            m_stamps[v] = m_stamp;
+                            m_distances[v] = d;
+                            m_predecessors[v] = u;
+                            m_settled[v] = false;
+                            queue.push(make_pair(d, v));
+                        }
+                    }
+                }
+            }
+
+            vector<const Vertex*> DirectedGraph::getPath(const uint32_t &target) const {
+                vector<const Vertex*> route;
+                if ( (target != DirectedGraph::NONE) && (getDistance(target) < DirectedGraph::INFINITE) ) {
+                    for (uint32_t v = target; ; v = m_predecessors[v]) {
+                        route.push_back(m_listOfVertices[v]);
+                        if (v == m_predecessors[v]) {
+                            break;
+                        }
+                    }
+                    reverse(route.begin(), route.end());
+                }
                 return route;
             }
+
+            vector<const Vertex*> DirectedGraph::getShortestPath(const Vertex &v1, const Vertex &v2) {
+                const uint32_t start = getNumber(v1);
+                const uint32_t end = getNumber(v2);
+
+                vector<const Vertex*> route;
+                if ( (start != DirectedGraph::NONE) && (end != DirectedGraph::NONE) ) {
+                    prepare();
+                    search(start, end);
+                    route = getPath(end);
+                }
+                return route;
+            }
+
+            vector<vector<const Vertex*> > DirectedGraph::getShortestPaths(const Vertex &v1, const vector<const Vertex*> &listOfVertices) {
+                vector<vector<const Vertex*> > routes(listOfVertices.size());
+
+                const uint32_t start = getNumber(v1);
+                if (start != DirectedGraph::NONE) {
+                    prepare();
+
+                    vector<uint32_t> targets;
+                    vector<const Vertex*>::const_iterator it = listOfVertices.begin();
+                    while (it != listOfVertices.end()) {
+                        const Vertex *v = (*it++);
+                        targets.push_back( (v != NULL) ? getNumber(*v) : DirectedGraph::NONE );
+                    }
+
+                    search(start, targets);
+
+                    for (uint32_t i = 0; i < targets.size(); i++) {
+                        routes[i] = getPath(targets[i]);
+                    }
+                }
+
+                return routes;
+            }
+
+            vector<vector<double> > DirectedGraph::getDistances(const vector<const Vertex*> &listOfStartVertices, const vector<const Vertex*> &listOfEndVertices) {
+                vector<vector<double> > distances(listOfStartVertices.size(), vector<double>(listOfEndVertices.size(), -1));
+
+                prepare();
+
+                vector<uint32_t> targets;
+                vector<const Vertex*>::const_iterator it = listOfEndVertices.begin();
+                while (it != listOfEndVertices.end()) {
+                    const Vertex *v = (*it++);
+                    targets.push_back( (v != NULL) ? getNumber(*v) : DirectedGraph::NONE );
+                }
+
+                for (uint32_t i = 0; i < listOfStartVertices.size(); i++) {
+                    const uint32_t start = (listOfStartVertices[i] != NULL) ? getNumber(*listOfStartVertices[i]) : DirectedGraph::NONE;
+                    if (start != DirectedGraph::NONE) {
+                        search(start, targets);
+
+                        for (uint32_t j = 0; j < targets.size(); j++) {
+                            if ( (targets[j] != DirectedGraph::NONE) && (getDistance(targets[j]) < DirectedGraph::INFINITE) ) {
+                                distances[i][j] = getDistance(targets[j]);
+                            }
+                        }
+                    }
+                }
+
+                return distances;
+            }
+
         }
     }
 } // core::wrapper::graph
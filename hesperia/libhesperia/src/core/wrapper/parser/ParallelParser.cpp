@@ -0,0 +1,126 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef WIN32
+    #include <unistd.h>
+#endif
+
+#include "core/macros.h"
+#include "core/base/Lock.h"
+#include "core/wrapper/parser/ParallelParser.h"
+
+namespace core {
+    namespace wrapper {
+        namespace parser {
+
+            using namespace std;
+            using namespace core::base;
+
+            ParallelParserJob::~ParallelParserJob() {}
+
+            ParallelParser::ParallelParser(const uint32_t &numberOfWorkers) :
+                m_parallelExecutor(numberOfWorkers),
+                m_jobsMutex(),
+                m_jobs(NULL) {}
+
+            ParallelParser::~ParallelParser() {}
+
+            uint32_t ParallelParser::getNumberOfProcessors() {
+#ifdef WIN32
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                const long numberOfProcessors = static_cast<long>(info.dwNumberOfProcessors);
+#else
+                const long numberOfProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+                return (numberOfProcessors > 0) ? static_cast<uint32_t>(numberOfProcessors) : 1;
+            }
+
+            void ParallelParser::getKeywords(const string &s, vector<string> &keywords, vector<uint32_t> &lineBegins) {
+                keywords.clear();
+                lineBegins.clear();
+
+                const uint32_t SIZE = s.size();
+                uint32_t begin = 0;
+                while (begin < SIZE) {
+                    const string::size_type lineBreak = s.find('\n', begin);
+                    const uint32_t end = (lineBreak == string::npos) ? SIZE : static_cast<uint32_t>(lineBreak) + 1;
+
+                    // Skip leading blanks; the keyword ends at the next blank or line break.
+                    uint32_t first = begin;
+                    while ( (first < end) && ((s[first] == ' ') || (s[first] == '\t')) ) {
+                        first++;
+                    }
+                    uint32_t last = first;
+                    while ( (last < end) && (s[last] != ' ') && (s[last] != '\t') && (s[last] != '\r') && (s[last] != '\n') ) {
+                        last++;
+                    }
+
+                    keywords.push_back(s.substr(first, last - first));
+                    lineBegins.push_back(begin);
+                    begin = end;
+                }
+                lineBegins.push_back(SIZE);
+            }
+
+            void ParallelParser::execute(const vector<ParallelParserJob*> &jobs) {
+                // Boost.Spirit's definitions must be created sequentially.
+                vector<ParallelParserJob*>::const_iterator it = jobs.begin();
+                while (it != jobs.end()) {
+                    (*it++)->prepare();
+                }
+
+                {
+                    Lock l(m_jobsMutex);
+                    m_jobs = &jobs;
+                }
+
+                if ( (jobs.size() < 2) || (m_parallelExecutor.getNumberOfWorkers() < 2) ) {
+                    for (uint32_t i = 0; i < jobs.size(); i++) {
+                        execute(i);
+                    }
+                }
+                else {
+                    m_parallelExecutor.execute(*this, jobs.size());
+                }
+
+                {
+                    Lock l(m_jobsMutex);
+                    m_jobs = NULL;
+                }
+            }
+
+            void ParallelParser::execute(const uint32_t &index) {
+                ParallelParserJob *job = NULL;
+                {
+                    Lock l(m_jobsMutex);
+                    if ( (m_jobs == NULL) || (index >= m_jobs->size()) ) {
+                        return;
+                    }
+                    job = m_jobs->at(index);
+                }
+
+                if (job != NULL) {
+                    job->execute();
+                }
+            }
+
+        }
+    }
+} // core::wrapper::parser
@@ -0,0 +1,345 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+
+#include "hesperia/data/environment/FlatPolygon.h"
+
+namespace hesperia {
+    namespace data {
+        namespace environment {
+
+            using namespace std;
+            using namespace core::data::environment;
+
+            const double FlatPolygon::EPSILON = 1e-10;
+
+            /**
+             * Returns 1 if the edge from (x0, y0) to (x1, y1) crosses the
+             * horizontal ray starting at (x, y) in positive X direction.
+             */
+            static inline uint32_t crossesRay(const double x0, const double y0, const double x1, const double y1, const double x, const double y) {
+                uint32_t retVal = 0;
+                if ( (y1 > y) != (y0 > y) ) {
+                    const double xCross = x0 + (y - y0) * (x1 - x0) / (y1 - y0);
+                    retVal = (x < xCross) ? 1 : 0;
+                }
+                return retVal;
+            }
+
+            /**
+             * Returns the parameter t of the intersection along the segment
+             * from A to A+(rx, ry) with the edge from (x0, y0) to (x1, y1)
+             * or a value greater than 1 if both do not intersect.
+             */
+            static inline double intersectEdge(const double ax, const double ay, const double rx, const double ry,
+                                               const double x0, const double y0, const double x1, const double y1, const double epsilon) {
+                double retVal = 2;
+
+                const double sx = x1 - x0;
+                const double sy = y1 - y0;
+                const double denominator = rx * sy - ry * sx;
+
+                if (fabs(denominator) > epsilon) {
+                    const double qx = x0 - ax;
+                    const double qy = y0 - ay;
+                    const double t = (qx * sy - qy * sx) / denominator;
+                    const double u = (qx * ry - qy * rx) / denominator;
+
+                    if ( (t >= 0) && (t <= 1) && (u >= 0) && (u <= 1) ) {
+                        retVal = t;
+                    }
+                }
+
+                return retVal;
+            }
+
+            /**
+             * Returns the squared distance from (x, y) to the edge from
+             * (x0, y0) to (x1, y1) and the nearest point on that edge.
+             */
+            static inline double nearestOnEdge(const double x0, const double y0, const double x1, const double y1,
+                                               const double x, const double y, double &nx, double &ny) {
+                const double dx = x1 - x0;
+                const double dy = y1 - y0;
+                const double squaredLength = dx * dx + dy * dy;
+
+                double t = 0;
+                if (squaredLength > 0) {
+                    t = ((x - x0) * dx + (y - y0) * dy) / squaredLength;
+                    t = (t < 0) ? 0 : ((t > 1) ? 1 : t);
+                }
+
+                nx = x0 + t * dx;
+                ny = y0 + t * dy;
+
+                return (nx - x) * (nx - x) + (ny - y) * (ny - y);
+            }
+
+            FlatPolygon::FlatPolygon() :
+                m_x(),
+                m_y() {}
+
+            FlatPolygon::FlatPolygon(const Polygon &polygon) :
+                m_x(),
+                m_y() {
+                const vector<Point3> &vertices = polygon.getVertices();
+                reserve(vertices.size());
+
+                vector<Point3>::const_iterator it = vertices.begin();
+                while (it != vertices.end()) {
+                    add(*it++);
+                }
+            }
+
+            FlatPolygon::FlatPolygon(const vector<Point3> &vertices) :
+                m_x(),
+                m_y() {
+                reserve(vertices.size());
+
+                vector<Point3>::const_iterator it = vertices.begin();
+                while (it != vertices.end()) {
+                    add(*it++);
+                }
+            }
+
+            FlatPolygon::FlatPolygon(const FlatPolygon &obj) :
+                m_x(obj.m_x),
+                m_y(obj.m_y) {}
+
+            FlatPolygon::~FlatPolygon() {}
+
+            FlatPolygon& FlatPolygon::operator=(const FlatPolygon &obj) {
+                m_x = obj.m_x;
+                m_y = obj.m_y;
+
+                return (*this);
+            }
+
+            void FlatPolygon::add(const double &x, const double &y) {
+                m_x.push_back(x);
+                m_y.push_back(y);
+            }
+
+            void FlatPolygon::add(const Point3 &p) {
+                add(p.getX(), p.getY());
+            }
+
+            void FlatPolygon::reserve(const uint32_t &size) {
+                m_x.reserve(size);
+                m_y.reserve(size);
+            }
+
+            void FlatPolygon::clear() {
+                m_x.clear();
+                m_y.clear();
+            }
+
+            uint32_t FlatPolygon::getSize() const {
+                return m_x.size();
+            }
+
+            const double* FlatPolygon::getX() const {
+                return (m_x.empty() ? NULL : &m_x[0]);
+            }
+
+            const double* FlatPolygon::getY() const {
+                return (m_y.empty() ? NULL : &m_y[0]);
+            }
+
+            Polygon FlatPolygon::toPolygon() const {
+                Polygon p;
+                for (uint32_t i = 0; i < getSize(); i++) {
+                    p.add(Point3(m_x[i], m_y[i], 0));
+                }
+                return p;
+            }
+
+            bool FlatPolygon::getBoundingBox(double &minX, double &minY, double &maxX, double &maxY) const {
+                const uint32_t size = getSize();
+                if (size == 0) {
+                    return false;
+                }
+
+                const double *X = &m_x[0];
+                const double *Y = &m_y[0];
+
+                double smallestX = X[0], smallestY = Y[0];
+                double greatestX = X[0], greatestY = Y[0];
+                for (uint32_t i = 1; i < size; i++) {
+                    smallestX = (X[i] < smallestX) ? X[i] : smallestX;
+                    smallestY = (Y[i] < smallestY) ? Y[i] : smallestY;
+                    greatestX = (X[i] > greatestX) ? X[i] : greatestX;
+                    greatestY = (Y[i] > greatestY) ? Y[i] : greatestY;
+                }
+
+                minX = smallestX;
+                minY = smallestY;
+                maxX = greatestX;
+                maxY = greatestY;
+
+                return true;
+            }
+
+            bool FlatPolygon::containsIgnoreZ(const double &x, const double &y) const {
+                const uint32_t size = getSize();
+                if (size < 3) {
+                    return false;
+                }
+
+                const double *X = &m_x[0];
+                const double *Y = &m_y[0];
+
+                // Closing edge first, then all consecutive edges.
+                uint32_t crossings = crossesRay(X[size - 1], Y[size - 1], X[0], Y[0], x, y);
+                for (uint32_t i = 1; i < size; i++) {
+                    crossings += crossesRay(X[i - 1], Y[i - 1], X[i], Y[i], x, y);
+                }
+
+                return ((crossings & 1) == 1);
+            }
+
+            uint32_t FlatPolygon::containsIgnoreZ(const FlatPolygon &points, vector<uint8_t> &inside) const {
+                const uint32_t numberOfPoints = points.getSize();
+                inside.resize(numberOfPoints);
+
+                uint32_t numberOfPointsInside = 0;
+                for (uint32_t i = 0; i < numberOfPoints; i++) {
+                    const bool isInside = containsIgnoreZ(points.m_x[i], points.m_y[i]);
+                    inside[i] = (isInside ? 1 : 0);
+                    numberOfPointsInside += (isInside ? 1 : 0);
+                }
+
+                return numberOfPointsInside;
+            }
+
+            bool FlatPolygon::intersectSegmentIgnoreZ(const double &ax, const double &ay, const double &bx, const double &by, double &t) const {
+                const uint32_t size = getSize();
+                if (size < 2) {
+                    return false;
+                }
+
+                const double *X = &m_x[0];
+                const double *Y = &m_y[0];
+                const double rx = bx - ax;
+                const double ry = by - ay;
+
+                double nearest = intersectEdge(ax, ay, rx, ry, X[size - 1], Y[size - 1], X[0], Y[0], FlatPolygon::EPSILON);
+                for (uint32_t i = 1; i < size; i++) {
+                    const double current = intersectEdge(ax, ay, rx, ry, X[i - 1], Y[i - 1], X[i], Y[i], FlatPolygon::EPSILON);
+                    nearest = (current < nearest) ? current : nearest;
+                }
+
+                if (nearest <= 1) {
+                    t = nearest;
+                    return true;
+                }
+                return false;
+            }
+
+            uint32_t FlatPolygon::clipIgnoreZ(const FlatPolygon &convexClip, FlatPolygon &result) const {
+                const uint32_t clipSize = convexClip.getSize();
+
+                // Copy first as result might be this instance.
+                FlatPolygon input(*this);
+                result.clear();
+
+                if ( (input.getSize() == 0) || (clipSize < 3) ) {
+                    return 0;
+                }
+
+                // Determine the orientation of the clipping polygon.
+                double area = 0;
+                for (uint32_t i = 0; i < clipSize; i++) {
+                    const uint32_t j = (i + 1) % clipSize;
+                    area += convexClip.m_x[i] * convexClip.m_y[j] - convexClip.m_x[j] * convexClip.m_y[i];
+                }
+                if (fabs(area) < FlatPolygon::EPSILON) {
+                    return 0;
+                }
+                const double orientation = (area > 0) ? 1 : -1;
+
+                for (uint32_t i = 0; (i < clipSize) && (input.getSize() > 0); i++) {
+                    const double ex0 = convexClip.m_x[i];
+                    const double ey0 = convexClip.m_y[i];
+                    const double edgeX = convexClip.m_x[(i + 1) % clipSize] - ex0;
+                    const double edgeY = convexClip.m_y[(i + 1) % clipSize] - ey0;
+
+                    result.clear();
+
+                    const uint32_t size = input.getSize();
+                    double previousX = input.m_x[size - 1];
+                    double previousY = input.m_y[size - 1];
+                    double previousSide = orientation * (edgeX * (previousY - ey0) - edgeY * (previousX - ex0));
+
+                    for (uint32_t j = 0; j < size; j++) {
+                        const double currentX = input.m_x[j];
+                        const double currentY = input.m_y[j];
+                        const double currentSide = orientation * (edgeX * (currentY - ey0) - edgeY * (currentX - ex0));
+
+                        // Add the intersection point whenever the edge changes sides.
+                        if ( (currentSide >= 0) != (previousSide >= 0) ) {
+                            const double t = previousSide / (previousSide - currentSide);
+                            result.add(previousX + t * (currentX - previousX), previousY + t * (currentY - previousY));
+                        }
+                        if (currentSide >= 0) {
+                            result.add(currentX, currentY);
+                        }
+
+                        previousX = currentX;
+                        previousY = currentY;
+                        previousSide = currentSide;
+                    }
+
+                    input.m_x.swap(result.m_x);
+                    input.m_y.swap(result.m_y);
+                }
+
+                result.m_x.swap(input.m_x);
+                result.m_y.swap(input.m_y);
+
+                return result.getSize();
+            }
+
+            double FlatPolygon::getNearestPointIgnoreZ(const double &x, const double &y, double &nearestX, double &nearestY) const {
+                const uint32_t size = getSize();
+                if (size == 0) {
+                    return -1;
+                }
+
+                const double *X = &m_x[0];
+                const double *Y = &m_y[0];
+
+                double nx = 0, ny = 0;
+                double smallest = nearestOnEdge(X[size - 1], Y[size - 1], X[0], Y[0], x, y, nearestX, nearestY);
+                for (uint32_t i = 1; i < size; i++) {
+                    const double current = nearestOnEdge(X[i - 1], Y[i - 1], X[i], Y[i], x, y, nx, ny);
+                    if (current < smallest) {
+                        smallest = current;
+                        nearestX = nx;
+                        nearestY = ny;
+                    }
+                }
+
+                return sqrt(smallest);
+            }
+
+        }
+    }
+} // hesperia::data::environment
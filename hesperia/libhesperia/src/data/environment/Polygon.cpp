@@ -69,7 +69,7 @@ namespace hesperia {
                 return m_listOfVertices.size();
             }
 
-            vector<Point3> Polygon::getVertices() const {
+            const vector<Point3>& Polygon::getVertices() const {
                 return m_listOfVertices;
             }
 
@@ -0,0 +1,249 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "core/data/control/ForceControl.h"
+#include "core/data/control/VehicleControl.h"
+#include "core/data/environment/Point3.h"
+#include "core/data/environment/Position.h"
+#include "core/data/environment/VehicleData.h"
+
+#include "hesperia/decorator/Data2Columns.h"
+#include "hesperia/data/environment/EgoState.h"
+#include "hesperia/data/environment/OtherVehicleState.h"
+#include "hesperia/data/environment/PointShapedObject.h"
+
+namespace hesperia {
+    namespace decorator {
+
+        using namespace std;
+        using namespace core::data;
+        using namespace core::data::control;
+        using namespace core::data::environment;
+        using namespace hesperia::data::environment;
+
+        static void addPoint3(vector<string> &names, const string &name) {
+            names.push_back(name + ".x");
+            names.push_back(name + ".y");
+            names.push_back(name + ".z");
+        }
+
+        static void addPoint3(vector<double> &row, const Point3 &p) {
+            row.push_back(p.getX());
+            row.push_back(p.getY());
+            row.push_back(p.getZ());
+        }
+
+        static void addPosition(vector<string> &names) {
+            addPoint3(names, "position");
+            addPoint3(names, "rotation");
+        }
+
+        static void addPosition(vector<double> &row, const Position &p) {
+            addPoint3(row, p.getPosition());
+            addPoint3(row, p.getRotation());
+        }
+
+        static void addPointShapedObject(vector<string> &names) {
+            addPosition(names);
+            addPoint3(names, "velocity");
+            addPoint3(names, "acceleration");
+        }
+
+        static void addPointShapedObject(vector<double> &row, const PointShapedObject &pso) {
+            addPosition(row, pso);
+            addPoint3(row, pso.getVelocity());
+            addPoint3(row, pso.getAcceleration());
+        }
+
+        Data2Columns::Data2Columns() {}
+
+        Data2Columns::~Data2Columns() {}
+
+        const vector<Container::DATATYPE> Data2Columns::getListOfSupportedDataTypes() {
+            vector<Container::DATATYPE> listOfDataTypes;
+            listOfDataTypes.push_back(Container::EGOSTATE);
+            listOfDataTypes.push_back(Container::FORCECONTROL);
+            listOfDataTypes.push_back(Container::OTHERVEHICLESTATE);
+            listOfDataTypes.push_back(Container::POINTSHAPEDOBJECT);
+            listOfDataTypes.push_back(Container::POSITION);
+            listOfDataTypes.push_back(Container::VEHICLECONTROL);
+            listOfDataTypes.push_back(Container::VEHICLEDATA);
+            return listOfDataTypes;
+        }
+
+        const string Data2Columns::getName(const Container::DATATYPE &dataType) {
+            switch (dataType) {
+                case Container::EGOSTATE:
+                    return "EgoState";
+                case Container::FORCECONTROL:
+                    return "ForceControl";
+                case Container::OTHERVEHICLESTATE:
+                    return "OtherVehicleState";
+                case Container::POINTSHAPEDOBJECT:
+                    return "PointShapedObject";
+                case Container::POSITION:
+                    return "Position";
+                case Container::VEHICLECONTROL:
+                    return "VehicleControl";
+                case Container::VEHICLEDATA:
+                    return "VehicleData";
+                default:
+                    return "";
+            }
+        }
+
+        const vector<string> Data2Columns::getColumnNames(const Container::DATATYPE &dataType) {
+            vector<string> names;
+            if (getName(dataType).empty()) {
+                return names;
+            }
+
+            names.push_back("sent");
+            names.push_back("received");
+
+            switch (dataType) {
+                case Container::EGOSTATE:
+                case Container::POINTSHAPEDOBJECT:
+                    addPointShapedObject(names);
+                    break;
+
+                case Container::OTHERVEHICLESTATE:
+                    names.push_back("id");
+                    addPointShapedObject(names);
+                    break;
+
+                case Container::POSITION:
+                    addPosition(names);
+                    break;
+
+                case Container::FORCECONTROL:
+                    names.push_back("accelerationForce");
+                    names.push_back("brakeForce");
+                    names.push_back("steeringForce");
+                    names.push_back("brakeLights");
+                    names.push_back("leftFlashingLights");
+                    names.push_back("rightFlashingLights");
+                    break;
+
+                case Container::VEHICLECONTROL:
+                    names.push_back("speed");
+                    names.push_back("acceleration");
+                    names.push_back("steeringWheelAngle");
+                    names.push_back("brakeLights");
+                    names.push_back("leftFlashingLights");
+                    names.push_back("rightFlashingLights");
+                    break;
+
+                case Container::VEHICLEDATA:
+                    addPoint3(names, "position");
+                    names.push_back("heading");
+                    names.push_back("absTraveledPath");
+                    names.push_back("relTraveledPath");
+                    addPoint3(names, "velocity");
+                    names.push_back("speed");
+                    names.push_back("v_log");
+                    names.push_back("v_batt");
+                    names.push_back("temp");
+                    break;
+
+                default:
+                    break;
+            }
+
+            return names;
+        }
+
+        uint32_t Data2Columns::toColumns(Container &c, vector<double> &row) {
+            if (getName(c.getDataType()).empty()) {
+                return 0;
+            }
+
+            const uint32_t size = row.size();
+            row.push_back(static_cast<double>(c.getSentTimeStamp().toMicroseconds()));
+            row.push_back(static_cast<double>(c.getReceivedTimeStamp().toMicroseconds()));
+
+            switch (c.getDataType()) {
+                case Container::EGOSTATE:
+                    addPointShapedObject(row, c.getData<EgoState>());
+                    break;
+
+                case Container::POINTSHAPEDOBJECT:
+                    addPointShapedObject(row, c.getData<PointShapedObject>());
+                    break;
+
+                case Container::OTHERVEHICLESTATE:
+                {
+                    const OtherVehicleState ovs = c.getData<OtherVehicleState>();
+                    row.push_back(ovs.getID());
+                    addPointShapedObject(row, ovs);
+                    break;
+                }
+
+                case Container::POSITION:
+                    addPosition(row, c.getData<Position>());
+                    break;
+
+                case Container::FORCECONTROL:
+                {
+                    const ForceControl fc = c.getData<ForceControl>();
+                    row.push_back(fc.getAccelerationForce());
+                    row.push_back(fc.getBrakeForce());
+                    row.push_back(fc.getSteeringForce());
+                    row.push_back(fc.getBrakeLights() ? 1 : 0);
+                    row.push_back(fc.getLeftFlashingLights() ? 1 : 0);
+                    row.push_back(fc.getRightFlashingLights() ? 1 : 0);
+                    break;
+                }
+
+                case Container::VEHICLECONTROL:
+                {
+                    const VehicleControl vc = c.getData<VehicleControl>();
+                    row.push_back(vc.getSpeed());
+                    row.push_back(vc.getAcceleration());
+                    row.push_back(vc.getSteeringWheelAngle());
+                    row.push_back(vc.getBrakeLights() ? 1 : 0);
+                    row.push_back(vc.getLeftFlashingLights() ? 1 : 0);
+                    row.push_back(vc.getRightFlashingLights() ? 1 : 0);
+                    break;
+                }
+
+                case Container::VEHICLEDATA:
+                {
+                    const VehicleData vd = c.getData<VehicleData>();
+                    addPoint3(row, vd.getPosition());
+                    row.push_back(vd.getHeading());
+                    row.push_back(vd.getAbsTraveledPath());
+                    row.push_back(vd.getRelTraveledPath());
+                    addPoint3(row, vd.getVelocity());
+                    row.push_back(vd.getSpeed());
+                    row.push_back(vd.getV_log());
+                    row.push_back(vd.getV_batt());
+                    row.push_back(vd.getTemp());
+                    break;
+                }
+
+                default:
+                    break;
+            }
+
+            return (row.size() - size);
+        }
+
+    }
+} // hesperia::decorator
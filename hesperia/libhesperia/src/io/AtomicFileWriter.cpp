@@ -0,0 +1,84 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#ifndef WIN32
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "hesperia/io/AtomicFileWriter.h"
+
+namespace hesperia {
+    namespace io {
+
+        using namespace std;
+
+        AtomicFileWriter::AtomicFileWriter() {}
+
+        AtomicFileWriter::~AtomicFileWriter() {}
+
+        bool AtomicFileWriter::write(const string &fileName, const string &contents) {
+            vector<char> tmpFileName(fileName.begin(), fileName.end());
+            const string SUFFIX = ".XXXXXX";
+            tmpFileName.insert(tmpFileName.end(), SUFFIX.begin(), SUFFIX.end());
+            tmpFileName.push_back('\0');
+#ifndef WIN32
+            const int32_t fd = mkstemp(&tmpFileName[0]);
+            if (fd < 0) {
+                return false;
+            }
+            // mkstemp creates the file readable for the owner only.
+            fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+            close(fd);
+#else
+            if (_mktemp_s(&tmpFileName[0], tmpFileName.size()) != 0) {
+                return false;
+            }
+#endif
+
+            bool retVal = false;
+            fstream fout(&tmpFileName[0], ios::binary | ios::out | ios::trunc);
+            if (fout.good()) {
+                fout.write(contents.c_str(), contents.size());
+                fout.flush();
+                retVal = fout.good();
+            }
+            fout.close();
+
+#ifdef WIN32
+            // rename does not replace existing files on Windows.
+            if (retVal) {
+                remove(fileName.c_str());
+            }
+#endif
+            retVal = retVal && (rename(&tmpFileName[0], fileName.c_str()) == 0);
+            if (!retVal) {
+                remove(&tmpFileName[0]);
+            }
+
+            return retVal;
+        }
+
+    }
+} // hesperia::io
@@ -0,0 +1,133 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include <zlib.h>
+
+#include "core/macros.h"
+#include "core/wrapper/CompressionFactory.h"
+#include "hesperia/io/AtomicFileWriter.h"
+#include "hesperia/scenario/CompiledScenario.h"
+#include "hesperia/scenario/ScenarioFactory.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+        using namespace data::scenario;
+
+        static void writeUInt32(ostream &out, const uint32_t &value) {
+            const uint32_t v = htonl(value);
+            out.write(reinterpret_cast<const char*>(&v), sizeof(uint32_t));
+        }
+
+        static uint32_t readUInt32(istream &in) {
+            uint32_t v = 0;
+            in.read(reinterpret_cast<char*>(&v), sizeof(uint32_t));
+            return ntohl(v);
+        }
+
+        CompiledScenario::CompiledScenario() {}
+
+        CompiledScenario::~CompiledScenario() {}
+
+        const string CompiledScenario::getFileName(const string &scnxFileName) {
+            return scnxFileName + ".scnc";
+        }
+
+        bool CompiledScenario::getSCN(core::wrapper::DecompressedData &data, string &scn) {
+            const char *buffer = NULL;
+            uint32_t length = 0;
+            if (!data.getBufferFor("scenario.scn", buffer, length)) {
+                return false;
+            }
+
+            scn = (buffer != NULL) ? string(buffer, length) : "";
+
+            return true;
+        }
+
+        uint32_t CompiledScenario::getChecksum(const string &scn) {
+            const uLong crc = crc32(0L, Z_NULL, 0);
+            if (scn.empty()) {
+                return crc;
+            }
+            return crc32(crc, reinterpret_cast<const Bytef*>(scn.c_str()), scn.size());
+        }
+
+        void CompiledScenario::write(ostream &out, const string &scn, const Scenario &scenario) {
+            writeUInt32(out, CompiledScenario::MAGIC_NUMBER);
+            writeUInt32(out, CompiledScenario::VERSION);
+            writeUInt32(out, getChecksum(scn));
+            writeUInt32(out, scn.size());
+
+            out << scenario;
+        }
+
+        bool CompiledScenario::read(istream &in, const string &scn, Scenario &scenario) {
+            const uint32_t magicNumber = readUInt32(in);
+            const uint32_t version = readUInt32(in);
+            const uint32_t checksum = readUInt32(in);
+            const uint32_t length = readUInt32(in);
+
+            if (!in.good()) {
+                return false;
+            }
+
+            if ( (magicNumber != CompiledScenario::MAGIC_NUMBER) || (version != CompiledScenario::VERSION) ) {
+                clog << "(hesperia::scenario::CompiledScenario) Unknown format or version " << version << "." << endl;
+                return false;
+            }
+
+            if ( (length != scn.size()) || (checksum != getChecksum(scn)) ) {
+                clog << "(hesperia::scenario::CompiledScenario) Compiled scenario does not match the SCN source." << endl;
+                return false;
+            }
+
+            in >> scenario;
+
+            return !in.fail();
+        }
+
+        bool CompiledScenario::compile(const string &scnxFileName) {
+            fstream fin(scnxFileName.c_str(), ios::binary | ios::in);
+            core::wrapper::DecompressedData *data = core::wrapper::CompressionFactory::getContents(fin);
+            fin.close();
+
+            bool retVal = false;
+            string scn;
+            if ( (data != NULL) && getSCN(*data, scn) ) {
+                const Scenario scenario = ScenarioFactory::getInstance().getScenario(scn);
+
+                const string fileName = getFileName(scnxFileName);
+
+                // Concurrent readers must never see a partially written compiled scenario.
+                stringstream out;
+                write(out, scn, scenario);
+                retVal = hesperia::io::AtomicFileWriter::write(fileName, out.str());
+            }
+            OPENDAVINCI_CORE_DELETE_POINTER(data);
+
+            return retVal;
+        }
+
+    }
+} // hesperia::scenario
@@ -68,7 +68,7 @@ namespace hesperia {
                     }
 
                     if (objxArchive != NULL) {
-                        model = objxArchive->createTransformGroup(NodeDescriptor(cm->getName()));
+                        model = objxArchive->createTransformGroupWithLevelsOfDetail(NodeDescriptor(cm->getName()));
 
                         if (model != NULL) {
                             clog << "OBJ model successfully opened." << endl;
@@ -0,0 +1,91 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "hesperia/scenario/LaneMatch.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        LaneMatch::LaneMatch() :
+            m_segment(0),
+            m_laneID(0),
+            m_distance(0),
+            m_t(0),
+            m_point(),
+            m_heading(0) {}
+
+        LaneMatch::LaneMatch(const uint32_t &segment, const uint32_t &laneID, const double &distance,
+                             const double &t, const Point3 &point, const double &heading) :
+            m_segment(segment),
+            m_laneID(laneID),
+            m_distance(distance),
+            m_t(t),
+            m_point(point),
+            m_heading(heading) {}
+
+        LaneMatch::LaneMatch(const LaneMatch &obj) :
+            m_segment(obj.m_segment),
+            m_laneID(obj.m_laneID),
+            m_distance(obj.m_distance),
+            m_t(obj.m_t),
+            m_point(obj.m_point),
+            m_heading(obj.m_heading) {}
+
+        LaneMatch::~LaneMatch() {}
+
+        LaneMatch& LaneMatch::operator=(const LaneMatch &obj) {
+            m_segment = obj.m_segment;
+            m_laneID = obj.m_laneID;
+            m_distance = obj.m_distance;
+            m_t = obj.m_t;
+            m_point = obj.m_point;
+            m_heading = obj.m_heading;
+
+            return (*this);
+        }
+
+        uint32_t LaneMatch::getSegment() const {
+            return m_segment;
+        }
+
+        uint32_t LaneMatch::getLaneID() const {
+            return m_laneID;
+        }
+
+        double LaneMatch::getDistance() const {
+            return m_distance;
+        }
+
+        double LaneMatch::getT() const {
+            return m_t;
+        }
+
+        const Point3 LaneMatch::getPoint() const {
+            return m_point;
+        }
+
+        double LaneMatch::getHeading() const {
+            return m_heading;
+        }
+
+    }
+} // hesperia::scenario
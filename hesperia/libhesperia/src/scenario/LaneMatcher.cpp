@@ -0,0 +1,336 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "hesperia/scenario/LaneMatcher.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+        using namespace core::data::environment;
+        using namespace hesperia::data::environment;
+
+        /**
+         * Orders matches by ascending distance.
+         */
+        static bool isCloser(const LaneMatch &a, const LaneMatch &b) {
+            return (a.getDistance() < b.getDistance());
+        }
+
+        /**
+         * Returns the grid coordinate for the given offset limited to
+         * a range that cannot overflow int32_t.
+         */
+        static inline int32_t getCellCoordinate(const double &offset, const double &cellSize) {
+            const double c = floor(offset / cellSize);
+            return static_cast<int32_t>( (c < -1e9) ? -1e9 : ((c > 1e9) ? 1e9 : c) );
+        }
+
+        static inline int32_t clamp(const int32_t &value, const int32_t &lower, const int32_t &upper) {
+            return (value < lower) ? lower : ((value > upper) ? upper : value);
+        }
+
+        LaneMatcher::LaneMatcher(const vector<NamedLine> &listOfLines, const double &cellSize) :
+            m_ax(),
+            m_ay(),
+            m_az(),
+            m_dx(),
+            m_dy(),
+            m_dz(),
+            m_heading(),
+            m_lane(),
+            m_laneNames(),
+            m_laneIDs(),
+            m_cellSize((cellSize > 0) ? cellSize : 1),
+            m_minX(0),
+            m_minY(0),
+            m_columns(0),
+            m_rows(0),
+            m_cellOffsets(1, 0),
+            m_cellSegments(),
+            m_cellBounds() {
+            const uint32_t SIZE = listOfLines.size();
+            if (SIZE == 0) {
+                return;
+            }
+
+            m_ax.reserve(SIZE);
+            m_ay.reserve(SIZE);
+            m_az.reserve(SIZE);
+            m_dx.reserve(SIZE);
+            m_dy.reserve(SIZE);
+            m_dz.reserve(SIZE);
+            m_heading.reserve(SIZE);
+            m_lane.reserve(SIZE);
+
+            double maxX = listOfLines.front().getA().getX();
+            double maxY = listOfLines.front().getA().getY();
+            m_minX = maxX;
+            m_minY = maxY;
+
+            vector<NamedLine>::const_iterator it = listOfLines.begin();
+            while (it != listOfLines.end()) {
+                const NamedLine &l = (*it++);
+                const Point3 A = l.getA();
+                const Point3 B = l.getB();
+
+                m_ax.push_back(A.getX());
+                m_ay.push_back(A.getY());
+                m_az.push_back(A.getZ());
+                m_dx.push_back(B.getX() - A.getX());
+                m_dy.push_back(B.getY() - A.getY());
+                m_dz.push_back(B.getZ() - A.getZ());
+                m_heading.push_back(atan2(m_dy.back(), m_dx.back()));
+
+                const string name = l.getName();
+                map<string, uint32_t>::const_iterator jt = m_laneIDs.find(name);
+                if (jt == m_laneIDs.end()) {
+                    jt = m_laneIDs.insert(make_pair(name, static_cast<uint32_t>(m_laneNames.size()))).first;
+                    m_laneNames.push_back(name);
+                }
+                m_lane.push_back(jt->second);
+
+                m_minX = min(m_minX, min(A.getX(), B.getX()));
+                m_minY = min(m_minY, min(A.getY(), B.getY()));
+                maxX = max(maxX, max(A.getX(), B.getX()));
+                maxY = max(maxY, max(A.getY(), B.getY()));
+            }
+
+            // Limit the number of cells for sparse maps.
+            const double maxCells = max(4.0 * SIZE, 1024.0);
+            while (((maxX - m_minX) / m_cellSize + 1) * ((maxY - m_minY) / m_cellSize + 1) > maxCells) {
+                m_cellSize *= 2;
+            }
+            m_columns = getCellCoordinate(maxX - m_minX, m_cellSize) + 1;
+            m_rows = getCellCoordinate(maxY - m_minY, m_cellSize) + 1;
+
+            // Every segment is added to all cells overlapped by its bounding box.
+            m_cellBounds.resize(4 * SIZE);
+            m_cellOffsets.assign(m_columns * m_rows + 1, 0);
+            for (uint32_t i = 0; i < SIZE; i++) {
+                int32_t *b = &m_cellBounds[4 * i];
+                b[0] = clamp(getCellCoordinate(min(m_ax[i], m_ax[i] + m_dx[i]) - m_minX, m_cellSize), 0, m_columns - 1);
+                b[1] = clamp(getCellCoordinate(max(m_ax[i], m_ax[i] + m_dx[i]) - m_minX, m_cellSize), 0, m_columns - 1);
+                b[2] = clamp(getCellCoordinate(min(m_ay[i], m_ay[i] + m_dy[i]) - m_minY, m_cellSize), 0, m_rows - 1);
+                b[3] = clamp(getCellCoordinate(max(m_ay[i], m_ay[i] + m_dy[i]) - m_minY, m_cellSize), 0, m_rows - 1);
+
+                for (int32_t row = b[2]; row <= b[3]; row++) {
+                    for (int32_t column = b[0]; column <= b[1]; column++) {
+                        m_cellOffsets[row * m_columns + column + 1]++;
+                    }
+                }
+            }
+
+            for (uint32_t i = 1; i < m_cellOffsets.size(); i++) {
+                m_cellOffsets[i] += m_cellOffsets[i - 1];
+            }
+
+            m_cellSegments.resize(m_cellOffsets.back());
+            vector<uint32_t> cursor(m_cellOffsets.begin(), m_cellOffsets.end() - 1);
+            for (uint32_t i = 0; i < SIZE; i++) {
+                const int32_t *b = &m_cellBounds[4 * i];
+                for (int32_t row = b[2]; row <= b[3]; row++) {
+                    for (int32_t column = b[0]; column <= b[1]; column++) {
+                        m_cellSegments[cursor[row * m_columns + column]++] = i;
+                    }
+                }
+            }
+        }
+
+        LaneMatcher::~LaneMatcher() {}
+
+        uint32_t LaneMatcher::getNumberOfSegments() const {
+            return m_lane.size();
+        }
+
+        uint32_t LaneMatcher::getNumberOfLanes() const {
+            return m_laneNames.size();
+        }
+
+        const string LaneMatcher::getLaneName(const uint32_t &laneID) const {
+            return (laneID < m_laneNames.size()) ? m_laneNames[laneID] : "";
+        }
+
+        uint32_t LaneMatcher::getLaneID(const string &laneName) const {
+            map<string, uint32_t>::const_iterator it = m_laneIDs.find(laneName);
+            return (it != m_laneIDs.end()) ? it->second : static_cast<uint32_t>(LaneMatcher::ANY_LANE);
+        }
+
+        double LaneMatcher::getCellSize() const {
+            return m_cellSize;
+        }
+
+        uint32_t LaneMatcher::findNearest(const Point3 &position, const uint32_t &k, const double &maxDistance, vector<LaneMatch> &matches) const {
+            return find(position.getX(), position.getY(), false, 0, 0, LaneMatcher::ANY_LANE, k, maxDistance, matches);
+        }
+
+        uint32_t LaneMatcher::findNearest(const Point3 &position, const double &heading, const double &headingTolerance,
+                                          const uint32_t &k, const double &maxDistance, vector<LaneMatch> &matches) const {
+            return find(position.getX(), position.getY(), (headingTolerance >= 0), heading, headingTolerance, LaneMatcher::ANY_LANE, k, maxDistance, matches);
+        }
+
+        uint32_t LaneMatcher::findWithinRadius(const Point3 &position, const double &radius, vector<LaneMatch> &matches) const {
+            return find(position.getX(), position.getY(), false, 0, 0, LaneMatcher::ANY_LANE, 0xFFFFFFFF, radius, matches);
+        }
+
+        uint32_t LaneMatcher::findWithinRadius(const Point3 &position, const double &heading, const double &headingTolerance,
+                                               const double &radius, vector<LaneMatch> &matches) const {
+            return find(position.getX(), position.getY(), (headingTolerance >= 0), heading, headingTolerance, LaneMatcher::ANY_LANE, 0xFFFFFFFF, radius, matches);
+        }
+
+        bool LaneMatcher::findNearestOnLane(const Point3 &position, const uint32_t &laneID, const double &maxDistance, LaneMatch &m) const {
+            if (laneID >= m_laneNames.size()) {
+                return false;
+            }
+
+            vector<LaneMatch> matches;
+            if (find(position.getX(), position.getY(), false, 0, 0, laneID, 1, maxDistance, matches) > 0) {
+                m = matches.front();
+                return true;
+            }
+            return false;
+        }
+
+        LaneMatch LaneMatcher::match(const uint32_t &segment, const double &x, const double &y) const {
+            const double dx = m_dx[segment];
+            const double dy = m_dy[segment];
+            const double squaredLength = dx * dx + dy * dy;
+
+            double t = 0;
+            if (squaredLength > 0) {
+                t = ((x - m_ax[segment]) * dx + (y - m_ay[segment]) * dy) / squaredLength;
+                t = (t < 0) ? 0 : ((t > 1) ? 1 : t);
+            }
+
+            const double px = m_ax[segment] + t * dx;
+            const double py = m_ay[segment] + t * dy;
+            const double distance = sqrt((px - x) * (px - x) + (py - y) * (py - y));
+
+            return LaneMatch(segment, m_lane[segment], distance, t, Point3(px, py, m_az[segment] + t * m_dz[segment]), m_heading[segment]);
+        }
+
+        bool LaneMatcher::isFirstCell(const uint32_t &segment, const int32_t &cx, const int32_t &cy, const int32_t &ring, const int32_t &column, const int32_t &row) const {
+            const int32_t *b = &m_cellBounds[4 * segment];
+
+            // The first ring overlapping the segment's cells is the ring at the Chebyshev distance to them.
+            const int32_t dx = (cx < b[0]) ? (b[0] - cx) : ((cx > b[1]) ? (cx - b[1]) : 0);
+            const int32_t dy = (cy < b[2]) ? (b[2] - cy) : ((cy > b[3]) ? (cy - b[3]) : 0);
+            if (max(dx, dy) != ring) {
+                return false;
+            }
+
+            // Within this ring, the cells are visited row by row and column by column.
+            return ( (row == max(b[2], cy - ring)) && (column == max(b[0], cx - ring)) );
+        }
+
+        uint32_t LaneMatcher::find(const double &x, const double &y, const bool &checkHeading, const double &heading, const double &headingTolerance,
+                                   const uint32_t &laneID, const uint32_t &k, const double &maxDistance, vector<LaneMatch> &matches) const {
+            matches.clear();
+            if ( (m_lane.empty()) || (k == 0) || (maxDistance < 0) ) {
+                return 0;
+            }
+
+            const int32_t cx = getCellCoordinate(x - m_minX, m_cellSize);
+            const int32_t cy = getCellCoordinate(y - m_minY, m_cellSize);
+
+            // Rings closer to the position than the grid are empty.
+            int32_t ring = max(abs(cx - clamp(cx, 0, m_columns - 1)), abs(cy - clamp(cy, 0, m_rows - 1)));
+
+            while (true) {
+                const int32_t x0 = cx - ring, x1 = cx + ring;
+                const int32_t y0 = cy - ring, y1 = cy + ring;
+
+                // Visit all cells on the ring's border which are within the grid.
+                for (int32_t row = max(y0, 0); row <= min(y1, m_rows - 1); row++) {
+                    const bool isFullRow = ( (row == y0) || (row == y1) );
+                    const int32_t step = isFullRow ? 1 : max(x1 - x0, 1);
+                    for (int32_t column = x0; column <= x1; column += step) {
+                        if ( (column < 0) || (column >= m_columns) ) {
+                            continue;
+                        }
+
+                        const uint32_t cell = row * m_columns + column;
+                        for (uint32_t i = m_cellOffsets[cell]; i < m_cellOffsets[cell + 1]; i++) {
+                            const uint32_t segment = m_cellSegments[i];
+                            if ( (laneID != LaneMatcher::ANY_LANE) && (m_lane[segment] != laneID) ) {
+                                continue;
+                            }
+                            if (checkHeading) {
+                                const double delta = heading - m_heading[segment];
+                                if (fabs(atan2(sin(delta), cos(delta))) > headingTolerance) {
+                                    continue;
+                                }
+                            }
+                            if (!isFirstCell(segment, cx, cy, ring, column, row)) {
+                                continue;
+                            }
+
+                            const LaneMatch m = match(segment, x, y);
+                            if (m.getDistance() <= maxDistance) {
+                                matches.push_back(m);
+                            }
+                        }
+                    }
+                }
+
+                if ( (x0 <= 0) && (y0 <= 0) && (x1 >= m_columns - 1) && (y1 >= m_rows - 1) ) {
+                    break;
+                }
+
+                // Smallest distance of any cell not visited so far.
+                double bound = maxDistance + 1;
+                if (x0 > 0) {
+                    bound = min(bound, x - (m_minX + x0 * m_cellSize));
+                }
+                if (x1 < m_columns - 1) {
+                    bound = min(bound, (m_minX + (x1 + 1) * m_cellSize) - x);
+                }
+                if (y0 > 0) {
+                    bound = min(bound, y - (m_minY + y0 * m_cellSize));
+                }
+                if (y1 < m_rows - 1) {
+                    bound = min(bound, (m_minY + (y1 + 1) * m_cellSize) - y);
+                }
+
+                if (bound > maxDistance) {
+                    break;
+                }
+                if (matches.size() >= k) {
+                    partial_sort(matches.begin(), matches.begin() + k, matches.end(), isCloser);
+                    if (matches[k - 1].getDistance() <= bound) {
+                        break;
+                    }
+                }
+
+                ring++;
+            }
+
+            sort(matches.begin(), matches.end(), isCloser);
+            if (matches.size() > k) {
+                matches.resize(k);
+            }
+
+            return matches.size();
+        }
+
+    }
+} // hesperia::scenario
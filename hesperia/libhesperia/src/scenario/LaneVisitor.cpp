@@ -99,7 +99,6 @@ namespace hesperia {
                     v1->setLaneID(pm->getLane()->getID());
                     v1->setWaypointID(vt1.getID());
                     v1->setPosition(vt1);
-                    cerr << "Constructed node: " << pm->getLane()->getRoad()->getLayer()->getID() << "." << pm->getLane()->getRoad()->getID() << "." << pm->getLane()->getID() << "." << vt1.getID() << endl;
 
                     WaypointVertex *v2 = new WaypointVertex();
                     v2->setLayerID(pm->getLane()->getRoad()->getLayer()->getID());
@@ -108,8 +107,6 @@ namespace hesperia {
                     v2->setWaypointID(vt2.getID());
                     v2->setPosition(vt2);
 
-                    cerr << "Constructed node: " << pm->getLane()->getRoad()->getLayer()->getID() << "." << pm->getLane()->getRoad()->getID() << "." << pm->getLane()->getID() << "." << vt2.getID() << endl;
-
                     WaypointsEdge *edge = new WaypointsEdge();
                     edge->setCosts(vt1.getXYDistanceTo(vt2));
 
@@ -123,7 +120,6 @@ namespace hesperia {
                 while (mt != listOfConnectors.end()) {
                     Connector c = (*mt++);
 
-                    cerr << "Found connector: " << c.toString() << " to add." << endl;
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
@@ -156,7 +152,6 @@ namespace hesperia {
                             edge->setCosts(startV.getXYDistanceTo(endV));
 
                             m_graph.updateEdge(v1, v2, edge);
-                            cerr << "Adding edge for connector between " << v1->toString() << " and " << v2->toString() << endl;
                         }
                     }
                     catch(...) {}
@@ -216,7 +211,6 @@ namespace hesperia {
                 v1->setLaneID(arc->getLane()->getID());
                 v1->setWaypointID(vt1.getID());
                 v1->setPosition(vt1);
-                cerr << "Constructed node: " << arc->getLane()->getRoad()->getLayer()->getID() << "." << arc->getLane()->getRoad()->getID() << "." << arc->getLane()->getID() << "." << vt1.getID() << endl;
 
                 WaypointVertex *v2 = new WaypointVertex();
                 v2->setLayerID(arc->getLane()->getRoad()->getLayer()->getID());
@@ -225,8 +219,6 @@ namespace hesperia {
                 v2->setWaypointID(vt2.getID());
                 v2->setPosition(vt2);
 
-                cerr << "Constructed node: " << arc->getLane()->getRoad()->getLayer()->getID() << "." << arc->getLane()->getRoad()->getID() << "." << arc->getLane()->getID() << "." << vt2.getID() << endl;
-
                 WaypointsEdge *edge = new WaypointsEdge();
                 edge->setCosts(vt1.getXYDistanceTo(vt2));
 
@@ -239,7 +231,6 @@ namespace hesperia {
                 while (mt != listOfConnectors.end()) {
                     Connector c = (*mt++);
 
-                    cerr << "Found connector: " << c.toString() << " to add." << endl;
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
@@ -272,7 +263,6 @@ namespace hesperia {
                             edge->setCosts(startV.getXYDistanceTo(endV));
 
                             m_graph.updateEdge(v1, v2, edge);
-                            cerr << "Adding edge for connector between " << v1->toString() << " and " << v2->toString() << endl;
                         }
                     }
                     catch(...) {}
@@ -301,7 +291,6 @@ namespace hesperia {
                 v1->setLaneID(sl->getLane()->getID());
                 v1->setWaypointID(vt1.getID());
                 v1->setPosition(vt1);
-                cerr << "Constructed node: " << sl->getLane()->getRoad()->getLayer()->getID() << "." << sl->getLane()->getRoad()->getID() << "." << sl->getLane()->getID() << "." << vt1.getID() << endl;
 
                 WaypointVertex *v2 = new WaypointVertex();
                 v2->setLayerID(sl->getLane()->getRoad()->getLayer()->getID());
@@ -310,8 +299,6 @@ namespace hesperia {
                 v2->setWaypointID(vt2.getID());
                 v2->setPosition(vt2);
 
-                cerr << "Constructed node: " << sl->getLane()->getRoad()->getLayer()->getID() << "." << sl->getLane()->getRoad()->getID() << "." << sl->getLane()->getID() << "." << vt2.getID() << endl;
-
                 WaypointsEdge *edge = new WaypointsEdge();
                 edge->setCosts(vt1.getXYDistanceTo(vt2));
 
@@ -324,7 +311,6 @@ namespace hesperia {
                 while (mt != listOfConnectors.end()) {
                     Connector c = (*mt++);
 
-                    cerr << "Found connector: " << c.toString() << " to add." << endl;
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
@@ -357,7 +343,6 @@ namespace hesperia {
                             edge->setCosts(startV.getXYDistanceTo(endV));
 
                             m_graph.updateEdge(v1, v2, edge);
-                            cerr << "Adding edge for connector between " << v1->toString() << " and " << v2->toString() << endl;
                         }
                     }
                     catch(...) {}
@@ -56,10 +56,17 @@ namespace hesperia {
             }
         }
 
+        SCNXArchive::SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd, core::wrapper::Image *aerialImage, core::wrapper::Image *heightImage) :
+                m_scenario(scenario),
+                m_decompressedData(dd),
+                m_aerialImage(aerialImage),
+                m_heightImage(heightImage) {}
+
         SCNXArchive::~SCNXArchive() {
-            OPENDAVINCI_CORE_DELETE_POINTER(m_decompressedData);
+            // Images might wrap memory owned by the decompressed data.
             OPENDAVINCI_CORE_DELETE_POINTER(m_aerialImage);
             OPENDAVINCI_CORE_DELETE_POINTER(m_heightImage);
+            OPENDAVINCI_CORE_DELETE_POINTER(m_decompressedData);
         }
 
         data::scenario::Scenario& SCNXArchive::getScenario() {
@@ -100,14 +107,11 @@ namespace hesperia {
             while (it != listOfEntries.end()) {
                 string entry = (*it++);
                 if (entry.find("situations/") != string::npos) {
-                    char c = 0;
-                    stringstream s;
-                    istream* in = m_decompressedData->getInputStreamFor(entry);
-                    if ( (in != NULL) && (in->good()) ) {
-                        while ( in->get( c ) ) {
-                            s << c;
-                        }
-                        hesperia::data::situation::Situation sit = situation::SituationFactory::getInstance().getSituation(s.str());
+                    // Parse directly from the decompressed buffer instead of copying the stream character by character.
+                    const char *buffer = NULL;
+                    uint32_t length = 0;
+                    if ( m_decompressedData->getBufferFor(entry, buffer, length) && (buffer != NULL) ) {
+                        hesperia::data::situation::Situation sit = situation::SituationFactory::getInstance().getSituation(string(buffer, length));
                         listOfSituations.push_back(sit);
                     }
                 }
@@ -25,9 +25,12 @@
 #include "core/wrapper/CompressionFactory.h"
 #include "core/wrapper/DecompressedData.h"
 #include "core/wrapper/DisposalService.h"
+#include "core/wrapper/SharedMemoryFactory.h"
 #include "core/exceptions/Exceptions.h"
+#include "hesperia/scenario/CompiledScenario.h"
 #include "hesperia/scenario/SCNXArchiveFactory.h"
 #include "hesperia/scenario/ScenarioFactory.h"
+#include "hesperia/scenario/SharedScenarioData.h"
 #include "hesperia/data/scenario/Scenario.h"
 
 namespace hesperia {
@@ -70,6 +73,22 @@ namespace hesperia {
         }
 
         SCNXArchive& SCNXArchiveFactory::getSCNXArchive(const URL &url) throw (InvalidArgumentException) {
+            return getSCNXArchive(url, false);
+        }
+
+        SCNXArchive& SCNXArchiveFactory::getSCNXArchive(const URL &url, const KeyValueConfiguration &configuration) throw (InvalidArgumentException) {
+            // All modules on this host can share one copy of the scenario.
+            bool useSharedMemory = false;
+            try {
+                useSharedMemory = configuration.getValue<bool>("global.scenario.sharedmemory");
+            }
+            catch (const ValueForKeyNotFoundException &e) {
+            }
+
+            return getSCNXArchive(url, useSharedMemory);
+        }
+
+        SCNXArchive& SCNXArchiveFactory::getSCNXArchive(const URL &url, const bool &useSharedMemory) throw (InvalidArgumentException) {
             if (!(url.isValid())) {
                 OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "URL is invalid.");
             }
@@ -86,41 +105,139 @@ namespace hesperia {
             if (scnxArchive == NULL) {
                 clog << "Creating new SCNXArchive from " << url.toString() << endl;
 
-                string fileName = url.getResource();
-                fstream fin(fileName.c_str(), ios::binary | ios::in);
-                core::wrapper::DecompressedData *data = core::wrapper::CompressionFactory::getContents(fin);
-                fin.close();
+                const string fileName = url.getResource();
+                if (useSharedMemory) {
+                    scnxArchive = getSharedSCNXArchive(fileName);
+                }
 
-                if (data != NULL) {
-                    Scenario scenario;
-                    istream *stream = data->getInputStreamFor("scenario.scn");
-                    if (stream != NULL) {
-                        stringstream s;
-                        char c;
-                        while (stream->good()) {
-                            stream->get(c);
-                            s << c;
-                        }
-
-                        // Trying to parse the input.
-                        scenario = ScenarioFactory::getInstance().getScenario(s.str());
-                    } else {
-                        OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "Archive from the given URL does not contain a valid SCN file.");
-                    }
-
-                    // Create SCNXArchive.
-                    scnxArchive = new SCNXArchive(scenario, data);
+                if (scnxArchive == NULL) {
+                    fstream fin(fileName.c_str(), ios::binary | ios::in);
+                    scnxArchive = createSCNXArchive(fin, fileName);
+                    fin.close();
 
                     // Store SCNXArchive for further usage.
                     // Somehow, there seems to be a bug because the data structure got corrupt...
 //                    m_mapOfSCNXArchives[url.toString()] = scnxArchive;
                 }
+            }
+
+            return *scnxArchive;
+        }
+
+        SCNXArchive* SCNXArchiveFactory::createSCNXArchive(istream &in, const string &fileName) throw (InvalidArgumentException) {
+            core::wrapper::DecompressedData *data = core::wrapper::CompressionFactory::getContents(in);
+            if (data == NULL) {
+                OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "URL could not be used to read input data.");
+            }
+
+            Scenario scenario;
+            string scn;
+            if (CompiledScenario::getSCN(*data, scn)) {
+                // Prefer the compiled scenario if it was created from this SCN file.
+                bool compiledScenarioUsed = false;
+                fstream fcompiled(CompiledScenario::getFileName(fileName).c_str(), ios::binary | ios::in);
+                if (fcompiled.good()) {
+                    compiledScenarioUsed = CompiledScenario::read(fcompiled, scn, scenario);
+                }
+                fcompiled.close();
+
+                if (compiledScenarioUsed) {
+                    clog << "Using compiled scenario " << CompiledScenario::getFileName(fileName) << endl;
+                }
                 else {
-                    OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "URL could not be used to read input data.");
+                    // Trying to parse the input.
+                    scenario = ScenarioFactory::getInstance().getScenario(scn);
                 }
+            } else {
+                OPENDAVINCI_CORE_DELETE_POINTER(data);
+                OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "Archive from the given URL does not contain a valid SCN file.");
             }
 
-            return *scnxArchive;
+            // Create SCNXArchive.
+            return new SCNXArchive(scenario, data);
+        }
+
+        SCNXArchive* SCNXArchiveFactory::getSharedSCNXArchive(const string &fileName) throw (InvalidArgumentException) {
+            // The checksum of the entire file identifies the shared segment.
+            stringstream contents;
+            {
+                fstream fin(fileName.c_str(), ios::binary | ios::in);
+                if (fin.good()) {
+                    contents << fin.rdbuf();
+                }
+                fin.close();
+            }
+            if (contents.str().empty()) {
+                return NULL;
+            }
+
+            const uint32_t checksum = CompiledScenario::getChecksum(contents.str());
+            const string name = SharedScenarioData::getName(checksum);
+
+            // Try to use the segment of another module first.
+            core::SharedPointer<core::wrapper::SharedMemory> sharedMemory = core::wrapper::SharedMemoryFactory::attachToSharedMemory(name);
+            if (sharedMemory.isValid() && sharedMemory->isValid()) {
+                SCNXArchive *scnxArchive = getSCNXArchive(sharedMemory, checksum);
+                if (scnxArchive != NULL) {
+                    clog << "(hesperia::scenario::SCNXArchiveFactory) Using shared memory " << name << " for " << fileName << endl;
+                    return scnxArchive;
+                }
+
+                clog << "(hesperia::scenario::SCNXArchiveFactory) Shared memory " << name << " cannot be used, loading " << fileName << " into heap." << endl;
+                return createSCNXArchive(contents, fileName);
+            }
+
+            // Load the archive once and store it for the other modules.
+            SCNXArchive *privateSCNXArchive = createSCNXArchive(contents, fileName);
+            contents.str("");
+
+            string scn;
+            CompiledScenario::getSCN(*(privateSCNXArchive->m_decompressedData), scn);
+            stringstream compiledScenario;
+            CompiledScenario::write(compiledScenario, scn, privateSCNXArchive->getScenario());
+
+            const uint32_t size = SharedScenarioData::getSize(*(privateSCNXArchive->m_decompressedData), compiledScenario.str(),
+                                                              privateSCNXArchive->getAerialImage(), privateSCNXArchive->getHeightImage());
+            sharedMemory = core::wrapper::SharedMemoryFactory::createSharedMemory(name, size);
+            if (sharedMemory.isValid() && sharedMemory->isValid()) {
+                bool written = false;
+                sharedMemory->lock();
+                {
+                    written = SharedScenarioData::write(static_cast<char*>(sharedMemory->getSharedMemory()), sharedMemory->getSize(), checksum,
+                                                        *(privateSCNXArchive->m_decompressedData), compiledScenario.str(),
+                                                        privateSCNXArchive->getAerialImage(), privateSCNXArchive->getHeightImage());
+                }
+                sharedMemory->unlock();
+
+                SCNXArchive *scnxArchive = (written ? getSCNXArchive(sharedMemory, checksum) : NULL);
+                if (scnxArchive != NULL) {
+                    clog << "(hesperia::scenario::SCNXArchiveFactory) Created shared memory " << name << " (" << size << " bytes) for " << fileName << endl;
+
+                    // Release the private copy in favor of the shared one.
+                    OPENDAVINCI_CORE_DELETE_POINTER(privateSCNXArchive);
+                    return scnxArchive;
+                }
+            }
+
+            clog << "(hesperia::scenario::SCNXArchiveFactory) Shared memory " << name << " could not be created, using heap for " << fileName << endl;
+            return privateSCNXArchive;
+        }
+
+        SCNXArchive* SCNXArchiveFactory::getSCNXArchive(core::SharedPointer<core::wrapper::SharedMemory> sharedMemory, const uint32_t &checksum) {
+            SharedScenarioData *data = NULL;
+            sharedMemory->lock();
+            {
+                data = new SharedScenarioData(static_cast<const char*>(sharedMemory->getSharedMemory()), sharedMemory->getSize(), sharedMemory);
+            }
+            sharedMemory->unlock();
+
+            Scenario scenario;
+            if ( data->isValid() && (data->getChecksum() == checksum) && data->getScenario(scenario) ) {
+                return new SCNXArchive(scenario, data, data->getAerialImage(), data->getHeightImage());
+            }
+
+            OPENDAVINCI_CORE_DELETE_POINTER(data);
+            return NULL;
         }
 
     }
@@ -45,7 +45,10 @@ namespace hesperia {
         Mutex ScenarioFactory::m_singletonMutex;
         ScenarioFactory* ScenarioFactory::m_singleton = NULL;
 
-        ScenarioFactory::ScenarioFactory() {}
+        ScenarioFactory::ScenarioFactory() :
+            m_parserMutex(),
+            m_numberOfWorkers(ParallelParser::getNumberOfProcessors()),
+            m_numberOfParts(0) {}
 
         ScenarioFactory::~ScenarioFactory() {}
 
@@ -61,13 +64,40 @@ namespace hesperia {
         }
 
         Scenario ScenarioFactory::getScenario(const string &s) throw (InvalidArgumentException) {
+            // Boost.Spirit's grammar definitions are registered in unsynchronized static data.
+            Lock l(m_parserMutex);
+
             Scenario scenario;
+            m_numberOfParts = 1;
+            if (!getScenarioInParallel(s, scenario)) {
+                // Parse sequentially to report the correct line for any error.
+                getScenarioSequentially(s, scenario);
+            }
+
+            return scenario;
+        }
+
+        void ScenarioFactory::setNumberOfWorkers(const uint32_t &numberOfWorkers) {
+            Lock l(m_parserMutex);
+            m_numberOfWorkers = numberOfWorkers;
+        }
+
+        uint32_t ScenarioFactory::getNumberOfWorkers() const {
+            Lock l(m_parserMutex);
+            return m_numberOfWorkers;
+        }
 
+        uint32_t ScenarioFactory::getNumberOfPartsOfLastScenario() const {
+            Lock l(m_parserMutex);
+            return m_numberOfParts;
+        }
+
+        void ScenarioFactory::getScenarioSequentially(const string &s, Scenario &scenario) throw (InvalidArgumentException) {
             SCNGrammarTokenListener scntl(scenario);
             SCNGrammarErrorListener scnel;
 
             SCNGrammar scnGrammar(scntl, scnel);
-            ASTNode *root = scnGrammar.getAST(s.c_str());
+            ASTNode *root = scnGrammar.getAST(s);
             if (root == NULL) {
                 errno = 0;
                 OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, scnel.getLastError());
@@ -82,8 +112,171 @@ namespace hesperia {
                 // Clean up AST since all data is now in an instance of Scenario.
                 delete root;
             }
+        }
 
-            return scenario;
+        bool ScenarioFactory::getScenarioInParallel(const string &s, Scenario &scenario) {
+            // Comments might hide keywords; leave them to the sequential parser.
+            if ( (m_numberOfWorkers == 0) || (s.find("/*") != string::npos) ) {
+                return false;
+            }
+
+            vector<string> keywords;
+            vector<uint32_t> lineBegins;
+            ParallelParser::getKeywords(s, keywords, lineBegins);
+
+            // Locate the ground's first line and all layers and roads.
+            uint32_t groundBegin = 0, groundEnd = 0;
+            vector<uint32_t> layerBegin, layerHeaderEnd, layerTailBegin, layerTailEnd;
+            vector<uint32_t> roadBegin, roadEnd, roadLayer;
+            bool insideLayer = false, insideRoad = false;
+            for (uint32_t i = 0; i < keywords.size(); i++) {
+                const string &keyword = keywords.at(i);
+                if ( (keyword == "GROUND") && (groundEnd == 0) && layerBegin.empty() ) {
+                    groundBegin = lineBegins.at(i);
+                    groundEnd = lineBegins.at(i + 1);
+                }
+                else if (keyword == "LAYER") {
+                    if (insideLayer) {
+                        return false;
+                    }
+                    insideLayer = true;
+                    layerBegin.push_back(lineBegins.at(i));
+                    layerHeaderEnd.push_back(0);
+                    layerTailBegin.push_back(0);
+                    layerTailEnd.push_back(0);
+                }
+                else if (keyword == "ROAD") {
+                    if (!insideLayer || insideRoad) {
+                        return false;
+                    }
+                    insideRoad = true;
+                    if (layerHeaderEnd.back() == 0) {
+                        layerHeaderEnd.back() = lineBegins.at(i);
+                    }
+                    roadBegin.push_back(lineBegins.at(i));
+                    roadLayer.push_back(layerBegin.size() - 1);
+                }
+                else if (keyword == "ENDROAD") {
+                    if (!insideRoad) {
+                        return false;
+                    }
+                    insideRoad = false;
+                    roadEnd.push_back(lineBegins.at(i + 1));
+                    layerTailBegin.back() = lineBegins.at(i + 1);
+                }
+                else if (keyword == "ENDLAYER") {
+                    if (!insideLayer || insideRoad || (layerHeaderEnd.back() == 0)) {
+                        return false;
+                    }
+                    insideLayer = false;
+                    layerTailEnd.back() = lineBegins.at(i);
+                }
+            }
+            if ( (groundEnd == 0) || insideLayer || (roadBegin.size() < 2) ) {
+                return false;
+            }
+
+            // Split the roads into parts of similar size without crossing layers.
+            uint32_t totalSize = 0;
+            for (uint32_t i = 0; i < roadBegin.size(); i++) {
+                totalSize += roadEnd.at(i) - roadBegin.at(i);
+            }
+            // Parsing with Boost.Spirit grows faster than linearly with the document's size; thus, limit each part's size.
+            const uint32_t MAXIMUM_SIZE = static_cast<uint32_t>(ScenarioFactory::MAXIMUM_PART_SIZE);
+            const uint32_t PART_SIZE = ( (totalSize / m_numberOfWorkers) < MAXIMUM_SIZE ) ? (totalSize / m_numberOfWorkers + 1) : MAXIMUM_SIZE;
+
+            vector<uint32_t> firstRoadOfPart, lastRoadOfPart;
+            uint32_t currentSize = 0;
+            for (uint32_t i = 0; i < roadBegin.size(); i++) {
+                if ( firstRoadOfPart.empty() ||
+                     (roadLayer.at(i) != roadLayer.at(firstRoadOfPart.back())) ||
+                     (currentSize >= PART_SIZE) ) {
+                    firstRoadOfPart.push_back(i);
+                    lastRoadOfPart.push_back(i);
+                    currentSize = 0;
+                }
+                lastRoadOfPart.back() = i;
+                currentSize += roadEnd.at(i) - roadBegin.at(i);
+            }
+            if (firstRoadOfPart.size() < 2) {
+                return false;
+            }
+
+            // Every part is a complete scenario; only the first one carries the real ground.
+            const string header = s.substr(0, groundBegin);
+            const string emptyGround = s.substr(groundBegin, groundEnd - groundBegin) + "ENDGROUND\n";
+
+            vector<ParallelParserJob*> jobs;
+            for (uint32_t i = 0; i < firstRoadOfPart.size(); i++) {
+                const uint32_t first = firstRoadOfPart.at(i);
+                const uint32_t last = lastRoadOfPart.at(i);
+                const uint32_t layer = roadLayer.at(first);
+                const bool isLastPartOfLayer = ( (last + 1 == roadBegin.size()) || (roadLayer.at(last + 1) != layer) );
+
+                stringstream document;
+                if (i == 0) {
+                    document << s.substr(0, layerBegin.at(0));
+                }
+                else {
+                    document << header << emptyGround;
+                }
+                document << s.substr(layerBegin.at(layer), layerHeaderEnd.at(layer) - layerBegin.at(layer))
+                         << s.substr(roadBegin.at(first), roadEnd.at(last) - roadBegin.at(first));
+                if (isLastPartOfLayer) {
+                    // Zones follow the layer's last road.
+                    document << s.substr(layerTailBegin.at(layer), layerTailEnd.at(layer) - layerTailBegin.at(layer));
+                }
+                document << "ENDLAYER" << endl << "ENDSCENARIO" << endl;
+
+                jobs.push_back(new SCNParserJob(document.str()));
+            }
+
+            ParallelParser parser(m_numberOfWorkers);
+            parser.execute(jobs);
+
+            bool retVal = true;
+            for (uint32_t i = 0; i < jobs.size(); i++) {
+                retVal &= dynamic_cast<SCNParserJob*>(jobs.at(i))->hasScenario();
+            }
+
+            // Merge all parts in document order.
+            if (retVal) {
+                m_numberOfParts = jobs.size();
+                const Scenario &firstPart = dynamic_cast<SCNParserJob*>(jobs.at(0))->getScenario();
+                scenario.setHeader(firstPart.getHeader());
+                scenario.setGround(firstPart.getGround());
+
+                Layer layer;
+                for (uint32_t i = 0; i < jobs.size(); i++) {
+                    const Layer &part = dynamic_cast<SCNParserJob*>(jobs.at(i))->getScenario().getListOfLayers().at(0);
+                    const bool isFirstPartOfLayer = ( (i == 0) || (roadLayer.at(firstRoadOfPart.at(i)) != roadLayer.at(firstRoadOfPart.at(i - 1))) );
+                    if (isFirstPartOfLayer) {
+                        if (i > 0) {
+                            scenario.addLayer(layer);
+                        }
+                        layer = Layer();
+                        layer.setName(part.getName());
+                        layer.setID(part.getID());
+                        layer.setHeight(part.getHeight());
+                    }
+
+                    vector<Road>::const_iterator it = part.getListOfRoads().begin();
+                    while (it != part.getListOfRoads().end()) {
+                        layer.addRoad(*it++);
+                    }
+                    vector<Zone>::const_iterator jt = part.getListOfZones().begin();
+                    while (jt != part.getListOfZones().end()) {
+                        layer.addZone(*jt++);
+                    }
+                }
+                scenario.addLayer(layer);
+            }
+
+            for (uint32_t i = 0; i < jobs.size(); i++) {
+                OPENDAVINCI_CORE_DELETE_POINTER(jobs.at(i));
+            }
+
+            return retVal;
         }
 
         ScenarioFactory::SCNGrammarTokenListener::SCNGrammarTokenListener(data::scenario::Scenario &s) :
@@ -115,5 +308,50 @@ namespace hesperia {
             return m_lastError;
         }
 
+        ScenarioFactory::SCNParserJob::SCNParserJob(const string &document) :
+                m_document(document),
+                m_scenario(),
+                m_tokenListener(m_scenario),
+                m_errorListener(),
+                m_grammar(NULL),
+                m_hasScenario(false) {}
+
+        ScenarioFactory::SCNParserJob::~SCNParserJob() {
+            OPENDAVINCI_CORE_DELETE_POINTER(m_grammar);
+        }
+
+        void ScenarioFactory::SCNParserJob::prepare() {
+            if (m_grammar == NULL) {
+                m_grammar = new SCNGrammar(m_tokenListener, m_errorListener);
+
+                // Let Boost.Spirit create the grammar's definition.
+                ASTNode *root = m_grammar->getAST("");
+                OPENDAVINCI_CORE_DELETE_POINTER(root);
+            }
+        }
+
+        void ScenarioFactory::SCNParserJob::execute() {
+            ASTNode *root = NULL;
+            try {
+                root = m_grammar->getAST(m_document);
+                if (root != NULL) {
+                    SCNScenarioVisitor scenarioVisitor(m_scenario);
+                    root->accept(scenarioVisitor);
+                    m_hasScenario = true;
+                }
+            } catch (...) {
+                m_hasScenario = false;
+            }
+            OPENDAVINCI_CORE_DELETE_POINTER(root);
+        }
+
+        bool ScenarioFactory::SCNParserJob::hasScenario() const {
+            return m_hasScenario;
+        }
+
+        const Scenario& ScenarioFactory::SCNParserJob::getScenario() const {
+            return m_scenario;
+        }
+
     }
 } // hesperia::scenario
@@ -0,0 +1,360 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+#include "core/macros.h"
+#include "core/wrapper/ImageFactory.h"
+#include "hesperia/scenario/CompiledScenario.h"
+#include "hesperia/scenario/SharedScenarioData.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        // Indices of the header fields; all fields are uint32_t.
+        static const uint32_t FIELD_MAGIC_NUMBER = 0;
+        static const uint32_t FIELD_VERSION = 1;
+        static const uint32_t FIELD_CHECKSUM = 2;
+        static const uint32_t FIELD_SIZE = 3;
+        static const uint32_t FIELD_COMPLETE = 4;
+        static const uint32_t FIELD_SCENARIO_OFFSET = 5;
+        static const uint32_t FIELD_SCENARIO_LENGTH = 6;
+        static const uint32_t FIELD_ENTRIES_OFFSET = 7;
+        static const uint32_t FIELD_NUMBER_OF_ENTRIES = 8;
+        // Each image is described by offset, width, height, format, and length.
+        static const uint32_t FIELD_AERIAL_IMAGE = 9;
+        static const uint32_t FIELD_HEIGHT_IMAGE = 14;
+        static const uint32_t NUMBER_OF_FIELDS = 19;
+
+        // Each entry is described by name offset, name length, data offset, and data length.
+        static const uint32_t FIELDS_PER_ENTRY = 4;
+
+        /**
+         * This method aligns all sections to 8 bytes.
+         */
+        static inline uint32_t align(const uint32_t &value) {
+            return ((value + 7) & ~static_cast<uint32_t>(7));
+        }
+
+        /**
+         * This method returns the number of bytes of the given
+         * image's pixels. The rows of decoded images are aligned to
+         * 4 bytes in the same way as for images wrapping a buffer.
+         */
+        static uint32_t getImageLength(const core::wrapper::Image *image) {
+            if ( (image == NULL) || (image->getRawData() == NULL) || (image->getFormat() == core::wrapper::Image::INVALID) ) {
+                return 0;
+            }
+            return ((image->getWidthStep() + 3) & ~static_cast<uint32_t>(3)) * image->getHeight();
+        }
+
+        /**
+         * This method collects all entries of the given archive.
+         */
+        static void getEntries(core::wrapper::DecompressedData &data, vector<string> &names, vector<const char*> &buffers, vector<uint32_t> &lengths) {
+            vector<string> listOfEntries = data.getListOfEntries();
+            vector<string>::const_iterator it = listOfEntries.begin();
+            while (it != listOfEntries.end()) {
+                const char *buffer = NULL;
+                uint32_t length = 0;
+                if (data.getBufferFor(*it, buffer, length)) {
+                    names.push_back(*it);
+                    buffers.push_back(buffer);
+                    lengths.push_back( (buffer != NULL) ? length : 0);
+                }
+                it++;
+            }
+        }
+
+        SharedScenarioData::Entry::Entry(const char *buffer, const uint32_t &length) :
+            MemoryStreamBuffer(buffer, length) {}
+
+        SharedScenarioData::Entry::~Entry() {}
+
+        SharedScenarioData::SharedScenarioData(const char *memory, const uint32_t &size, const core::SharedPointer<core::wrapper::SharedMemory> &sharedMemory) :
+            m_memory(memory),
+            m_size(size),
+            m_sharedMemory(sharedMemory),
+            m_valid(false),
+            m_mapOfEntries() {
+            readSegment();
+        }
+
+        SharedScenarioData::~SharedScenarioData() {
+            map<string, Entry*, core::wrapper::StringComparator>::iterator it = m_mapOfEntries.begin();
+            while (it != m_mapOfEntries.end()) {
+                Entry *entry = it->second;
+                OPENDAVINCI_CORE_DELETE_POINTER(entry);
+                it++;
+            }
+            m_mapOfEntries.clear();
+        }
+
+        const string SharedScenarioData::getName(const uint32_t &checksum) {
+            // The name must not exceed the length of a POSIX semaphore's name.
+            stringstream sstr;
+            sstr << "scnx" << hex << setw(8) << setfill('0') << checksum;
+            return sstr.str();
+        }
+
+        uint32_t SharedScenarioData::getSize(core::wrapper::DecompressedData &data, const string &compiledScenario, const core::wrapper::Image *aerialImage, const core::wrapper::Image *heightImage) {
+            vector<string> names;
+            vector<const char*> buffers;
+            vector<uint32_t> lengths;
+            getEntries(data, names, buffers, lengths);
+
+            uint32_t size = align(NUMBER_OF_FIELDS * sizeof(uint32_t));
+            size += align(compiledScenario.size());
+            size += align(names.size() * FIELDS_PER_ENTRY * sizeof(uint32_t));
+            for (uint32_t i = 0; i < names.size(); i++) {
+                size += align(names.at(i).size()) + align(lengths.at(i));
+            }
+            size += align(getImageLength(aerialImage));
+            size += align(getImageLength(heightImage));
+
+            return size;
+        }
+
+        bool SharedScenarioData::write(char *memory, const uint32_t &size, const uint32_t &checksum, core::wrapper::DecompressedData &data, const string &compiledScenario, const core::wrapper::Image *aerialImage, const core::wrapper::Image *heightImage) {
+            if ( (memory == NULL) || (size < getSize(data, compiledScenario, aerialImage, heightImage)) ) {
+                return false;
+            }
+
+            uint32_t *header = reinterpret_cast<uint32_t*>(memory);
+
+            // Never overwrite a segment containing another scenario.
+            if ( (header[FIELD_MAGIC_NUMBER] == SharedScenarioData::MAGIC_NUMBER) && (header[FIELD_COMPLETE] == 1) && (header[FIELD_CHECKSUM] != checksum) ) {
+                clog << "(hesperia::scenario::SharedScenarioData) Segment is already used by another scenario." << endl;
+                return false;
+            }
+
+            memset(header, 0, NUMBER_OF_FIELDS * sizeof(uint32_t));
+            header[FIELD_MAGIC_NUMBER] = SharedScenarioData::MAGIC_NUMBER;
+            header[FIELD_VERSION] = SharedScenarioData::VERSION;
+            header[FIELD_CHECKSUM] = checksum;
+
+            uint32_t offset = align(NUMBER_OF_FIELDS * sizeof(uint32_t));
+
+            // Compiled scenario.
+            header[FIELD_SCENARIO_OFFSET] = offset;
+            header[FIELD_SCENARIO_LENGTH] = compiledScenario.size();
+            if (!compiledScenario.empty()) {
+                memcpy(memory + offset, compiledScenario.data(), compiledScenario.size());
+            }
+            offset += align(compiledScenario.size());
+
+            // Table of entries followed by their names and contents.
+            vector<string> names;
+            vector<const char*> buffers;
+            vector<uint32_t> lengths;
+            getEntries(data, names, buffers, lengths);
+
+            uint32_t *table = reinterpret_cast<uint32_t*>(memory + offset);
+            header[FIELD_ENTRIES_OFFSET] = offset;
+            header[FIELD_NUMBER_OF_ENTRIES] = names.size();
+            offset += align(names.size() * FIELDS_PER_ENTRY * sizeof(uint32_t));
+
+            for (uint32_t i = 0; i < names.size(); i++) {
+                table[i * FIELDS_PER_ENTRY] = offset;
+                table[i * FIELDS_PER_ENTRY + 1] = names.at(i).size();
+                memcpy(memory + offset, names.at(i).data(), names.at(i).size());
+                offset += align(names.at(i).size());
+
+                table[i * FIELDS_PER_ENTRY + 2] = offset;
+                table[i * FIELDS_PER_ENTRY + 3] = lengths.at(i);
+                if (lengths.at(i) > 0) {
+                    memcpy(memory + offset, buffers.at(i), lengths.at(i));
+                }
+                offset += align(lengths.at(i));
+            }
+
+            // Decoded images.
+            const core::wrapper::Image *images[] = { aerialImage, heightImage };
+            const uint32_t fields[] = { FIELD_AERIAL_IMAGE, FIELD_HEIGHT_IMAGE };
+            for (uint32_t i = 0; i < 2; i++) {
+                const uint32_t length = getImageLength(images[i]);
+                if (length > 0) {
+                    header[fields[i]] = offset;
+                    header[fields[i] + 1] = images[i]->getWidth();
+                    header[fields[i] + 2] = images[i]->getHeight();
+                    header[fields[i] + 3] = images[i]->getFormat();
+                    header[fields[i] + 4] = length;
+                    memcpy(memory + offset, images[i]->getRawData(), length);
+                    offset += align(length);
+                }
+            }
+
+            header[FIELD_SIZE] = offset;
+
+            // Readers must not use the segment before it is written completely.
+            header[FIELD_COMPLETE] = 1;
+
+            return true;
+        }
+
+        uint32_t SharedScenarioData::getField(const uint32_t &index) const {
+            return reinterpret_cast<const uint32_t*>(m_memory)[index];
+        }
+
+        void SharedScenarioData::readSegment() {
+            if ( (m_memory == NULL) || (m_size < NUMBER_OF_FIELDS * sizeof(uint32_t)) ) {
+                return;
+            }
+
+            if ( (getField(FIELD_MAGIC_NUMBER) != SharedScenarioData::MAGIC_NUMBER) || (getField(FIELD_VERSION) != SharedScenarioData::VERSION) ) {
+                clog << "(hesperia::scenario::SharedScenarioData) Unknown format or version " << getField(FIELD_VERSION) << "." << endl;
+                return;
+            }
+
+            const uint32_t USED = getField(FIELD_SIZE);
+            if ( (getField(FIELD_COMPLETE) != 1) || (USED > m_size) ) {
+                clog << "(hesperia::scenario::SharedScenarioData) Segment is incomplete or truncated." << endl;
+                return;
+            }
+
+            // All sections must be within the used part of the segment.
+            bool valid = (getField(FIELD_SCENARIO_OFFSET) <= USED) && (getField(FIELD_SCENARIO_LENGTH) <= USED - getField(FIELD_SCENARIO_OFFSET));
+
+            const uint32_t ENTRIES_OFFSET = getField(FIELD_ENTRIES_OFFSET);
+            const uint32_t NUMBER_OF_ENTRIES = getField(FIELD_NUMBER_OF_ENTRIES);
+            valid &= (ENTRIES_OFFSET <= USED) && (NUMBER_OF_ENTRIES <= (USED - ENTRIES_OFFSET) / (FIELDS_PER_ENTRY * sizeof(uint32_t)));
+
+            const uint32_t fields[] = { FIELD_AERIAL_IMAGE, FIELD_HEIGHT_IMAGE };
+            for (uint32_t i = 0; i < 2; i++) {
+                valid &= (getField(fields[i]) <= USED) && (getField(fields[i] + 4) <= USED - getField(fields[i]));
+            }
+
+            const uint32_t *table = reinterpret_cast<const uint32_t*>(m_memory + ENTRIES_OFFSET);
+            for (uint32_t i = 0; valid && (i < NUMBER_OF_ENTRIES); i++) {
+                const uint32_t nameOffset = table[i * FIELDS_PER_ENTRY];
+                const uint32_t nameLength = table[i * FIELDS_PER_ENTRY + 1];
+                const uint32_t dataOffset = table[i * FIELDS_PER_ENTRY + 2];
+                const uint32_t dataLength = table[i * FIELDS_PER_ENTRY + 3];
+
+                valid &= (nameOffset <= USED) && (nameLength <= USED - nameOffset) && (dataOffset <= USED) && (dataLength <= USED - dataOffset);
+                if (valid) {
+                    const string name(m_memory + nameOffset, nameLength);
+                    if (m_mapOfEntries.find(name) == m_mapOfEntries.end()) {
+                        m_mapOfEntries[name] = new Entry(m_memory + dataOffset, dataLength);
+                    }
+                }
+            }
+
+            if (!valid) {
+                clog << "(hesperia::scenario::SharedScenarioData) Corrupt segment." << endl;
+            }
+            m_valid = valid;
+        }
+
+        bool SharedScenarioData::isValid() const {
+            return m_valid;
+        }
+
+        uint32_t SharedScenarioData::getChecksum() const {
+            return (m_valid ? getField(FIELD_CHECKSUM) : 0);
+        }
+
+        bool SharedScenarioData::getScenario(data::scenario::Scenario &scenario) {
+            string scn;
+            if ( !m_valid || !CompiledScenario::getSCN(*this, scn) ) {
+                return false;
+            }
+
+            // Deserialize directly from the segment.
+            Entry compiledScenario(m_memory + getField(FIELD_SCENARIO_OFFSET), getField(FIELD_SCENARIO_LENGTH));
+            istream in(&compiledScenario);
+            return CompiledScenario::read(in, scn, scenario);
+        }
+
+        core::wrapper::Image* SharedScenarioData::getImage(const uint32_t &index) const {
+            if ( !m_valid || (getField(index + 4) == 0) ) {
+                return NULL;
+            }
+
+            const uint32_t width = getField(index + 1);
+            const uint32_t height = getField(index + 2);
+            const core::wrapper::Image::FORMAT format = static_cast<core::wrapper::Image::FORMAT>(getField(index + 3));
+
+            return core::wrapper::ImageFactory::getInstance().getImage(width, height, format, const_cast<char*>(m_memory + getField(index)));
+        }
+
+        core::wrapper::Image* SharedScenarioData::getAerialImage() const {
+            return getImage(FIELD_AERIAL_IMAGE);
+        }
+
+        core::wrapper::Image* SharedScenarioData::getHeightImage() const {
+            return getImage(FIELD_HEIGHT_IMAGE);
+        }
+
+        SharedScenarioData::Entry* SharedScenarioData::getEntry(const string &entry) {
+            string key = entry;
+
+            // Transform key name to lower case for case insensitive lookups.
+            transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
+
+            map<string, Entry*, core::wrapper::StringComparator>::const_iterator it = m_mapOfEntries.find(key);
+            if (it == m_mapOfEntries.end()) {
+                return NULL;
+            }
+            return it->second;
+        }
+
+        vector<string> SharedScenarioData::getListOfEntries() {
+            vector<string> listOfEntries;
+
+            map<string, Entry*, core::wrapper::StringComparator>::const_iterator it = m_mapOfEntries.begin();
+            while (it != m_mapOfEntries.end()) {
+                listOfEntries.push_back(it->first);
+                it++;
+            }
+
+            return listOfEntries;
+        }
+
+        istream* SharedScenarioData::getInputStreamFor(const string &entry) {
+            istream *stream = NULL;
+
+            Entry *e = getEntry(entry);
+            if (e != NULL) {
+                stream = e->getInputStream();
+            }
+
+            return stream;
+        }
+
+        bool SharedScenarioData::getBufferFor(const string &entry, const char* &buffer, uint32_t &length) {
+            Entry *e = getEntry(entry);
+            if (e != NULL) {
+                buffer = e->getBuffer();
+                length = e->getLength();
+                return true;
+            }
+
+            return false;
+        }
+
+    }
+} // hesperia::scenario
@@ -0,0 +1,109 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "hesperia/scenegraph/primitives/Trace.h"
+
+namespace hesperia {
+    namespace scenegraph {
+        namespace primitives {
+
+            using namespace core::data::environment;
+
+            Trace::Trace(const SceneNodeDescriptor &sceneNodeDescriptor, const uint32_t &capacity, const double &minimumDistance, const Point3 &color, const float &width) :
+                SceneNode(sceneNodeDescriptor),
+                m_capacity((capacity > 0) ? capacity : 1),
+                m_minimumDistance(minimumDistance),
+                m_color(color),
+                m_width(width),
+                m_points(),
+                m_first(0) {
+                m_points.reserve(m_capacity);
+            }
+
+            Trace::Trace(const Trace &obj) :
+                SceneNode(obj.getSceneNodeDescriptor()),
+                m_capacity(obj.m_capacity),
+                m_minimumDistance(obj.m_minimumDistance),
+                m_color(obj.m_color),
+                m_width(obj.m_width),
+                m_points(obj.m_points),
+                m_first(obj.m_first) {}
+
+            Trace::~Trace() {}
+
+            Trace& Trace::operator=(const Trace &obj) {
+                setSceneNodeDescriptor(obj.getSceneNodeDescriptor());
+                m_capacity = obj.m_capacity;
+                m_minimumDistance = obj.m_minimumDistance;
+                m_color = obj.m_color;
+                m_width = obj.m_width;
+                m_points = obj.m_points;
+                m_first = obj.m_first;
+
+                return (*this);
+            }
+
+            bool Trace::add(const Point3 &p) {
+                if (!m_points.empty()) {
+                    const Point3 &last = getPoint(m_points.size() - 1);
+                    if (last.getXYDistanceTo(p) < m_minimumDistance) {
+                        return false;
+                    }
+                }
+
+                if (m_points.size() < m_capacity) {
+                    m_points.push_back(p);
+                }
+                else {
+                    // Overwrite the oldest point.
+                    m_points[m_first] = p;
+                    m_first = (m_first + 1) % m_capacity;
+                }
+
+                return true;
+            }
+
+            void Trace::clear() {
+                m_points.clear();
+                m_first = 0;
+            }
+
+            uint32_t Trace::getNumberOfPoints() const {
+                return m_points.size();
+            }
+
+            uint32_t Trace::getCapacity() const {
+                return m_capacity;
+            }
+
+            const Point3& Trace::getPoint(const uint32_t &i) const {
+                return m_points[(m_first + i) % m_points.size()];
+            }
+
+            const Point3& Trace::getColor() const {
+                return m_color;
+            }
+
+            float Trace::getWidth() const {
+                return m_width;
+            }
+
+        }
+    }
+} // hesperia::scenegraph::primitives
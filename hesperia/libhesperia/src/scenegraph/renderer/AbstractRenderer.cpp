@@ -53,6 +53,13 @@ namespace hesperia {
 
                             render(poly);
                         }
+
+                        Trace *t = dynamic_cast<Trace*>(sceneNode);
+                        if (!delegated && t != NULL) {
+                            delegated = true;
+
+                            render(t);
+                        }
                     }
                 }
 
@@ -45,7 +45,10 @@ namespace hesperia {
         Mutex SituationFactory::m_singletonMutex;
         SituationFactory* SituationFactory::m_singleton = NULL;
 
-        SituationFactory::SituationFactory() {}
+        SituationFactory::SituationFactory() :
+            m_parserMutex(),
+            m_numberOfWorkers(ParallelParser::getNumberOfProcessors()),
+            m_numberOfParts(0) {}
 
         SituationFactory::~SituationFactory() {}
 
@@ -61,13 +64,40 @@ namespace hesperia {
         }
 
         Situation SituationFactory::getSituation(const string &s) throw (InvalidArgumentException) {
+            // Boost.Spirit's grammar definitions are registered in unsynchronized static data.
+            Lock l(m_parserMutex);
+
             Situation situation;
+            m_numberOfParts = 1;
+            if (!getSituationInParallel(s, situation)) {
+                // Parse sequentially to report the correct line for any error.
+                getSituationSequentially(s, situation);
+            }
+
+            return situation;
+        }
+
+        void SituationFactory::setNumberOfWorkers(const uint32_t &numberOfWorkers) {
+            Lock l(m_parserMutex);
+            m_numberOfWorkers = numberOfWorkers;
+        }
 
+        uint32_t SituationFactory::getNumberOfWorkers() const {
+            Lock l(m_parserMutex);
+            return m_numberOfWorkers;
+        }
+
+        uint32_t SituationFactory::getNumberOfPartsOfLastSituation() const {
+            Lock l(m_parserMutex);
+            return m_numberOfParts;
+        }
+
+        void SituationFactory::getSituationSequentially(const string &s, Situation &situation) throw (InvalidArgumentException) {
             SITGrammarTokenListener sittl(situation);
             SITGrammarErrorListener sitel;
 
             SITGrammar sitGrammar(sittl, sitel);
-            ASTNode *root = sitGrammar.getAST(s.c_str());
+            ASTNode *root = sitGrammar.getAST(s);
             if (root == NULL) {
                 errno = 0;
                 OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, sitel.getLastError());
@@ -82,8 +112,107 @@ namespace hesperia {
                 // Clean up AST since all data is now in an instance of Situation.
                 delete root;
             }
+        }
 
-            return situation;
+        bool SituationFactory::getSituationInParallel(const string &s, Situation &situation) {
+            // Comments might hide keywords; leave them to the sequential parser.
+            if ( (m_numberOfWorkers == 0) || (s.find("/*") != string::npos) ) {
+                return false;
+            }
+
+            vector<string> keywords;
+            vector<uint32_t> lineBegins;
+            ParallelParser::getKeywords(s, keywords, lineBegins);
+
+            // Locate all objects.
+            vector<uint32_t> objectBegin, objectEnd;
+            bool insideObject = false;
+            for (uint32_t i = 0; i < keywords.size(); i++) {
+                const string &keyword = keywords.at(i);
+                if (keyword == "OBJECT") {
+                    if (insideObject) {
+                        return false;
+                    }
+                    insideObject = true;
+                    objectBegin.push_back(lineBegins.at(i));
+                }
+                else if (keyword == "ENDOBJECT") {
+                    if (!insideObject) {
+                        return false;
+                    }
+                    insideObject = false;
+                    objectEnd.push_back(lineBegins.at(i + 1));
+                }
+            }
+            if (insideObject || (objectBegin.size() < 2)) {
+                return false;
+            }
+
+            // Split the objects into parts of similar size.
+            uint32_t totalSize = 0;
+            for (uint32_t i = 0; i < objectBegin.size(); i++) {
+                totalSize += objectEnd.at(i) - objectBegin.at(i);
+            }
+            const uint32_t MAXIMUM_SIZE = static_cast<uint32_t>(SituationFactory::MAXIMUM_PART_SIZE);
+            const uint32_t PART_SIZE = ( (totalSize / m_numberOfWorkers) < MAXIMUM_SIZE ) ? (totalSize / m_numberOfWorkers + 1) : MAXIMUM_SIZE;
+
+            vector<uint32_t> firstObjectOfPart, lastObjectOfPart;
+            uint32_t currentSize = 0;
+            for (uint32_t i = 0; i < objectBegin.size(); i++) {
+                if (firstObjectOfPart.empty() || (currentSize >= PART_SIZE)) {
+                    firstObjectOfPart.push_back(i);
+                    lastObjectOfPart.push_back(i);
+                    currentSize = 0;
+                }
+                lastObjectOfPart.back() = i;
+                currentSize += objectEnd.at(i) - objectBegin.at(i);
+            }
+            if (firstObjectOfPart.size() < 2) {
+                return false;
+            }
+
+            // Every part is a complete situation with the original header.
+            const string header = s.substr(0, objectBegin.at(0));
+
+            vector<ParallelParserJob*> jobs;
+            for (uint32_t i = 0; i < firstObjectOfPart.size(); i++) {
+                const uint32_t first = firstObjectOfPart.at(i);
+                const uint32_t last = lastObjectOfPart.at(i);
+
+                stringstream document;
+                document << header
+                         << s.substr(objectBegin.at(first), objectEnd.at(last) - objectBegin.at(first))
+                         << "ENDSITUATION" << endl;
+
+                jobs.push_back(new SITParserJob(document.str()));
+            }
+
+            ParallelParser parser(m_numberOfWorkers);
+            parser.execute(jobs);
+
+            bool retVal = true;
+            for (uint32_t i = 0; i < jobs.size(); i++) {
+                retVal &= dynamic_cast<SITParserJob*>(jobs.at(i))->hasSituation();
+            }
+
+            // Merge all parts in document order.
+            if (retVal) {
+                m_numberOfParts = jobs.size();
+                situation.setHeader(dynamic_cast<SITParserJob*>(jobs.at(0))->getSituation().getHeader());
+                for (uint32_t i = 0; i < jobs.size(); i++) {
+                    const vector<Object> &listOfObjects = dynamic_cast<SITParserJob*>(jobs.at(i))->getSituation().getListOfObjects();
+                    vector<Object>::const_iterator it = listOfObjects.begin();
+                    while (it != listOfObjects.end()) {
+                        situation.addObject(*it++);
+                    }
+                }
+            }
+
+            for (uint32_t i = 0; i < jobs.size(); i++) {
+                OPENDAVINCI_CORE_DELETE_POINTER(jobs.at(i));
+            }
+
+            return retVal;
         }
 
         SituationFactory::SITGrammarTokenListener::SITGrammarTokenListener(data::situation::Situation &s) :
@@ -115,5 +244,50 @@ namespace hesperia {
             return m_lastError;
         }
 
+        SituationFactory::SITParserJob::SITParserJob(const string &document) :
+                m_document(document),
+                m_situation(),
+                m_tokenListener(m_situation),
+                m_errorListener(),
+                m_grammar(NULL),
+                m_hasSituation(false) {}
+
+        SituationFactory::SITParserJob::~SITParserJob() {
+            OPENDAVINCI_CORE_DELETE_POINTER(m_grammar);
+        }
+
+        void SituationFactory::SITParserJob::prepare() {
+            if (m_grammar == NULL) {
+                m_grammar = new SITGrammar(m_tokenListener, m_errorListener);
+
+                // Let Boost.Spirit create the grammar's definition.
+                ASTNode *root = m_grammar->getAST("");
+                OPENDAVINCI_CORE_DELETE_POINTER(root);
+            }
+        }
+
+        void SituationFactory::SITParserJob::execute() {
+            ASTNode *root = NULL;
+            try {
+                root = m_grammar->getAST(m_document);
+                if (root != NULL) {
+                    SITSituationVisitor situationVisitor(m_situation);
+                    root->accept(situationVisitor);
+                    m_hasSituation = true;
+                }
+            } catch (...) {
+                m_hasSituation = false;
+            }
+            OPENDAVINCI_CORE_DELETE_POINTER(root);
+        }
+
+        bool SituationFactory::SITParserJob::hasSituation() const {
+            return m_hasSituation;
+        }
+
+        const Situation& SituationFactory::SITParserJob::getSituation() const {
+            return m_situation;
+        }
+
     }
 } // hesperia::situation
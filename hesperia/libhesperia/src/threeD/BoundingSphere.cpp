@@ -0,0 +1,100 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "hesperia/threeD/BoundingSphere.h"
+#include "hesperia/threeD/TransformationMatrix.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        BoundingSphere::BoundingSphere() :
+                m_center(),
+                m_radius(-1) {}
+
+        BoundingSphere::BoundingSphere(const Point3 &center, const double &radius) :
+                m_center(center),
+                m_radius(radius) {}
+
+        BoundingSphere::BoundingSphere(const BoundingSphere &obj) :
+                m_center(obj.m_center),
+                m_radius(obj.m_radius) {}
+
+        BoundingSphere::~BoundingSphere() {}
+
+        BoundingSphere& BoundingSphere::operator=(const BoundingSphere &obj) {
+            m_center = obj.m_center;
+            m_radius = obj.m_radius;
+
+            return (*this);
+        }
+
+        bool BoundingSphere::isValid() const {
+            return (m_radius >= 0);
+        }
+
+        const Point3 BoundingSphere::getCenter() const {
+            return m_center;
+        }
+
+        double BoundingSphere::getRadius() const {
+            return m_radius;
+        }
+
+        void BoundingSphere::enclose(const BoundingSphere &sphere) {
+            if (!sphere.isValid()) {
+                return;
+            }
+            if (!isValid()) {
+                (*this) = sphere;
+                return;
+            }
+
+            const Point3 direction = sphere.m_center - m_center;
+            const double distance = direction.length();
+
+            if (distance + sphere.m_radius <= m_radius) {
+                // The other sphere is already enclosed.
+                return;
+            }
+            if (distance + m_radius <= sphere.m_radius) {
+                // This sphere is enclosed by the other one.
+                (*this) = sphere;
+                return;
+            }
+
+            // Move the center towards the other sphere until both are enclosed.
+            const double radius = (distance + m_radius + sphere.m_radius) / 2.0;
+            m_center = m_center + direction * ((radius - m_radius) / distance);
+            m_radius = radius;
+        }
+
+        BoundingSphere BoundingSphere::transform(const Point3 &translation, const Point3 &rotation, const Point3 &scaling) const {
+            if (!isValid()) {
+                return BoundingSphere();
+            }
+
+            const TransformationMatrix t(translation, rotation, scaling);
+            return BoundingSphere(t.transformPoint(m_center), m_radius * t.getMaximumScaling());
+        }
+
+    }
+} // hesperia::threeD
@@ -0,0 +1,181 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+
+#include "hesperia/threeD/Frustum.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        Frustum::Frustum() :
+                m_bounded(false),
+                m_planes(),
+                m_modelView() {
+            m_modelView[0] = m_modelView[5] = m_modelView[10] = m_modelView[15] = 1;
+        }
+
+        Frustum::Frustum(const double *projection, const double *modelView) :
+                m_bounded(true),
+                m_planes(),
+                m_modelView() {
+            for (uint32_t i = 0; i < 16; i++) {
+                m_modelView[i] = modelView[i];
+            }
+
+            // Clip matrix M = P * MV; M[column * 4 + row].
+            double M[16];
+            for (uint32_t column = 0; column < 4; column++) {
+                for (uint32_t row = 0; row < 4; row++) {
+                    double sum = 0;
+                    for (uint32_t k = 0; k < 4; k++) {
+                        sum += projection[k * 4 + row] * modelView[column * 4 + k];
+                    }
+                    M[column * 4 + row] = sum;
+                }
+            }
+
+            // Left, right, bottom, top, near, and far plane: 4th row +/- 1st, 2nd, and 3rd row.
+            for (uint32_t i = 0; i < NUMBER_OF_PLANES; i++) {
+                const uint32_t row = i / 2;
+                const double sign = ((i % 2) == 0) ? 1 : -1;
+
+                double length = 0;
+                for (uint32_t column = 0; column < 4; column++) {
+                    m_planes[i][column] = M[column * 4 + 3] + sign * M[column * 4 + row];
+                    if (column < 3) {
+                        length += m_planes[i][column] * m_planes[i][column];
+                    }
+                }
+
+                // Normalize the plane to measure distances.
+                length = sqrt(length);
+                if (length > 1e-12) {
+                    for (uint32_t column = 0; column < 4; column++) {
+                        m_planes[i][column] /= length;
+                    }
+                }
+            }
+        }
+
+        Frustum::Frustum(const Frustum &obj) :
+                m_bounded(obj.m_bounded),
+                m_planes(),
+                m_modelView() {
+            for (uint32_t i = 0; i < NUMBER_OF_PLANES; i++) {
+                for (uint32_t j = 0; j < 4; j++) {
+                    m_planes[i][j] = obj.m_planes[i][j];
+                }
+            }
+            for (uint32_t i = 0; i < 16; i++) {
+                m_modelView[i] = obj.m_modelView[i];
+            }
+        }
+
+        Frustum::~Frustum() {}
+
+        Frustum& Frustum::operator=(const Frustum &obj) {
+            m_bounded = obj.m_bounded;
+            for (uint32_t i = 0; i < NUMBER_OF_PLANES; i++) {
+                for (uint32_t j = 0; j < 4; j++) {
+                    m_planes[i][j] = obj.m_planes[i][j];
+                }
+            }
+            for (uint32_t i = 0; i < 16; i++) {
+                m_modelView[i] = obj.m_modelView[i];
+            }
+
+            return (*this);
+        }
+
+        Frustum Frustum::transform(const TransformationMatrix &transformation) const {
+            const double *M = transformation.getMatrix();
+            Frustum f(*this);
+
+            // The modelview matrix of the transformed coordinate system is MV * M.
+            for (uint32_t column = 0; column < 4; column++) {
+                for (uint32_t row = 0; row < 4; row++) {
+                    double sum = 0;
+                    for (uint32_t k = 0; k < 4; k++) {
+                        sum += m_modelView[k * 4 + row] * M[column * 4 + k];
+                    }
+                    f.m_modelView[column * 4 + row] = sum;
+                }
+            }
+
+            if (!m_bounded) {
+                return f;
+            }
+
+            // A plane p in the current coordinate system is p * M in the transformed one.
+            for (uint32_t i = 0; i < NUMBER_OF_PLANES; i++) {
+                double length = 0;
+                for (uint32_t column = 0; column < 4; column++) {
+                    double sum = 0;
+                    for (uint32_t row = 0; row < 4; row++) {
+                        sum += m_planes[i][row] * M[column * 4 + row];
+                    }
+                    f.m_planes[i][column] = sum;
+                    if (column < 3) {
+                        length += sum * sum;
+                    }
+                }
+
+                // Scaling changes the lengths of the normals.
+                length = sqrt(length);
+                if (length > 1e-12) {
+                    for (uint32_t column = 0; column < 4; column++) {
+                        f.m_planes[i][column] /= length;
+                    }
+                }
+            }
+
+            return f;
+        }
+
+        double Frustum::getDistanceToCamera(const Point3 &p) const {
+            double eye[3];
+            for (uint32_t i = 0; i < 3; i++) {
+                eye[i] = m_modelView[i] * p.getX() + m_modelView[4 + i] * p.getY() + m_modelView[8 + i] * p.getZ() + m_modelView[12 + i];
+            }
+            return sqrt(eye[0] * eye[0] + eye[1] * eye[1] + eye[2] * eye[2]);
+        }
+
+        bool Frustum::isVisible(const BoundingSphere &sphere) const {
+            if ( (!m_bounded) || (!sphere.isValid()) ) {
+                return true;
+            }
+
+            const Point3 c = sphere.getCenter();
+            const double radius = sphere.getRadius();
+            for (uint32_t i = 0; i < NUMBER_OF_PLANES; i++) {
+                const double distance = m_planes[i][0] * c.getX() + m_planes[i][1] * c.getY() + m_planes[i][2] * c.getZ() + m_planes[i][3];
+                if (distance < -radius) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    }
+} // hesperia::threeD
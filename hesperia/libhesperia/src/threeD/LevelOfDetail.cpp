@@ -0,0 +1,128 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+
+// The following include is necessary on Win32 platforms to set up necessary macro definitions.
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#include <GL/gl.h>
+
+#include "core/macros.h"
+#include "hesperia/threeD/LevelOfDetail.h"
+#include "hesperia/threeD/TransformGroup.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        LevelOfDetail::LevelOfDetail(const NodeDescriptor &nodeDescriptor) :
+                Node(nodeDescriptor),
+                m_listOfLevels(),
+                m_listOfMaximumDistances() {}
+
+        LevelOfDetail::~LevelOfDetail() {
+            vector<Node*>::iterator it = m_listOfLevels.begin();
+            while (it != m_listOfLevels.end()) {
+                Node *n = (*it++);
+                OPENDAVINCI_CORE_DELETE_POINTER(n);
+            }
+            m_listOfLevels.clear();
+        }
+
+        void LevelOfDetail::render(RenderingConfiguration &renderingConfiguration) {
+            // Render if unnamed or not disabled.
+            if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
+                // Transform the center (or the origin if the extent is unknown) into eye coordinates to get the distance to the camera.
+                const Point3 center = getBoundingSphere().getCenter();
+                double distance = 0;
+                const Frustum *frustum = TransformGroup::getCurrentFrustum();
+                if (frustum != NULL) {
+                    distance = frustum->getDistanceToCamera(center);
+                }
+                else {
+                    // Not rendered by a transform group; query OpenGL.
+                    GLdouble modelView[16];
+                    glGetDoublev(GL_MODELVIEW_MATRIX, modelView);
+
+                    double eye[3];
+                    for (uint32_t i = 0; i < 3; i++) {
+                        eye[i] = modelView[i] * center.getX() + modelView[4 + i] * center.getY() + modelView[8 + i] * center.getZ() + modelView[12 + i];
+                    }
+                    distance = sqrt(eye[0] * eye[0] + eye[1] * eye[1] + eye[2] * eye[2]);
+                }
+
+                const uint32_t level = selectLevel(distance);
+                if (level < m_listOfLevels.size()) {
+                    m_listOfLevels[level]->render(renderingConfiguration);
+                }
+            }
+        }
+
+        void LevelOfDetail::addLevel(Node *level, const double &maximumDistance) {
+            if (level != NULL) {
+                m_listOfLevels.push_back(level);
+                m_listOfMaximumDistances.push_back(maximumDistance);
+                level->setParent(this);
+                invalidateBoundingSphere();
+            }
+        }
+
+        uint32_t LevelOfDetail::getNumberOfLevels() const {
+            return m_listOfLevels.size();
+        }
+
+        Node* LevelOfDetail::getLevel(const uint32_t &index) const {
+            return (index < m_listOfLevels.size()) ? m_listOfLevels[index] : NULL;
+        }
+
+        double LevelOfDetail::getMaximumDistance(const uint32_t &index) const {
+            return (index < m_listOfMaximumDistances.size()) ? m_listOfMaximumDistances[index] : 0;
+        }
+
+        uint32_t LevelOfDetail::selectLevel(const double &distance) const {
+            uint32_t level = 0;
+            while ( (level < m_listOfMaximumDistances.size()) && (distance > m_listOfMaximumDistances[level]) ) {
+                level++;
+            }
+            return level;
+        }
+
+        BoundingSphere LevelOfDetail::computeBoundingSphere() const {
+            bool hasUnknownExtent = m_listOfLevels.empty();
+            BoundingSphere sphere;
+            vector<Node*>::const_iterator it = m_listOfLevels.begin();
+            while (it != m_listOfLevels.end()) {
+                const BoundingSphere level = (*it++)->getBoundingSphere();
+                hasUnknownExtent |= !level.isValid();
+                sphere.enclose(level);
+            }
+
+            if (hasUnknownExtent) {
+                return BoundingSphere();
+            }
+            return sphere;
+        }
+
+    }
+} // hesperia::threeD
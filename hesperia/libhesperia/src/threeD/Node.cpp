@@ -23,10 +23,16 @@ namespace hesperia {
     namespace threeD {
 
         Node::Node() :
-            m_nodeDescriptor() {}
+            m_nodeDescriptor(),
+            m_parent(NULL),
+            m_hasCachedBoundingSphere(false),
+            m_boundingSphere() {}
 
         Node::Node(const NodeDescriptor &nodeDescriptor) :
-            m_nodeDescriptor(nodeDescriptor) {}
+            m_nodeDescriptor(nodeDescriptor),
+            m_parent(NULL),
+            m_hasCachedBoundingSphere(false),
+            m_boundingSphere() {}
 
         Node::~Node() {}
 
@@ -37,5 +43,29 @@ namespace hesperia {
         void Node::setNodeDescriptor(const NodeDescriptor &nodeDescriptor) {
             m_nodeDescriptor = nodeDescriptor;
         }
+
+        const BoundingSphere Node::getBoundingSphere() const {
+            if (!m_hasCachedBoundingSphere) {
+                m_boundingSphere = computeBoundingSphere();
+                m_hasCachedBoundingSphere = true;
+            }
+            return m_boundingSphere;
+        }
+
+        BoundingSphere Node::computeBoundingSphere() const {
+            return BoundingSphere();
+        }
+
+        void Node::invalidateBoundingSphere() {
+            Node *n = this;
+            while (n != NULL) {
+                n->m_hasCachedBoundingSphere = false;
+                n = n->m_parent;
+            }
+        }
+
+        void Node::setParent(Node *parent) {
+            m_parent = parent;
+        }
     }
 } // hesperia::threeD
@@ -24,16 +24,19 @@ namespace hesperia {
 
         RenderingConfiguration::RenderingConfiguration() :
             m_drawTextures(true),
+            m_frustumCulling(false),
             m_nodesRenderingConfiguration() {}
 
         RenderingConfiguration::RenderingConfiguration(const RenderingConfiguration &obj) :
         	m_drawTextures(obj.m_drawTextures),
+        	m_frustumCulling(obj.m_frustumCulling),
         	m_nodesRenderingConfiguration(obj.m_nodesRenderingConfiguration) {}
 
         RenderingConfiguration::~RenderingConfiguration() {}
 
         RenderingConfiguration& RenderingConfiguration::operator=(const RenderingConfiguration &obj) {
         	m_drawTextures = obj.m_drawTextures;
+        	m_frustumCulling = obj.m_frustumCulling;
         	m_nodesRenderingConfiguration = obj.m_nodesRenderingConfiguration;
 
         	return (*this);
@@ -47,6 +50,14 @@ namespace hesperia {
             m_drawTextures = drawTextures;
         }
 
+        bool RenderingConfiguration::hasFrustumCulling() const {
+            return m_frustumCulling;
+        }
+
+        void RenderingConfiguration::setFrustumCulling(const bool &frustumCulling) {
+            m_frustumCulling = frustumCulling;
+        }
+
         const NodeRenderingConfiguration& RenderingConfiguration::getNodeRenderingConfiguration(const NodeDescriptor &nd) {
             return m_nodesRenderingConfiguration[nd];
         }
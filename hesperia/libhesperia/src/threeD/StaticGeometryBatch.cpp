@@ -0,0 +1,94 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+
+#include "hesperia/threeD/StaticGeometryBatch.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        /**
+         * Returns true if both colors differ less than what is visible.
+         */
+        static bool isEqualColor(const Point3 &a, const Point3 &b) {
+            const double EPSILON = 1e-6;
+            return (fabs(a.getX() - b.getX()) < EPSILON) &&
+                   (fabs(a.getY() - b.getY()) < EPSILON) &&
+                   (fabs(a.getZ() - b.getZ()) < EPSILON);
+        }
+
+        StaticGeometryBatch::StaticGeometryBatch() :
+                m_materials(),
+                m_vertexBuffers(),
+                m_numberOfAddedVertexBuffers(0) {}
+
+        StaticGeometryBatch::~StaticGeometryBatch() {}
+
+        bool StaticGeometryBatch::isEqual(const Material &a, const Material &b) {
+            // Textured materials are rendered using the texture only.
+            if ( (a.getTextureHandle() > 0) || (b.getTextureHandle() > 0) ) {
+                return (a.getTextureHandle() == b.getTextureHandle());
+            }
+
+            return isEqualColor(a.getAmbient(), b.getAmbient()) &&
+                   isEqualColor(a.getDiffuse(), b.getDiffuse()) &&
+                   isEqualColor(a.getSpecular(), b.getSpecular()) &&
+                   (fabs(a.getShininess() - b.getShininess()) < 1e-6);
+        }
+
+        void StaticGeometryBatch::add(const Material &material, const VertexBuffer &vertexBuffer) {
+            if (vertexBuffer.getNumberOfIndices() == 0) {
+                return;
+            }
+
+            m_numberOfAddedVertexBuffers++;
+
+            for (uint32_t i = 0; i < m_materials.size(); i++) {
+                if ( (m_vertexBuffers[i].getPrimitive() == vertexBuffer.getPrimitive()) && isEqual(m_materials[i], material) ) {
+                    m_vertexBuffers[i].append(vertexBuffer);
+                    return;
+                }
+            }
+
+            m_materials.push_back(material);
+            m_vertexBuffers.push_back(vertexBuffer);
+        }
+
+        uint32_t StaticGeometryBatch::getNumberOfBatches() const {
+            return m_vertexBuffers.size();
+        }
+
+        uint32_t StaticGeometryBatch::getNumberOfAddedVertexBuffers() const {
+            return m_numberOfAddedVertexBuffers;
+        }
+
+        const Material& StaticGeometryBatch::getMaterial(const uint32_t &index) const {
+            return m_materials.at(index);
+        }
+
+        const VertexBuffer& StaticGeometryBatch::getVertexBuffer(const uint32_t &index) const {
+            return m_vertexBuffers.at(index);
+        }
+
+    }
+} // hesperia::threeD
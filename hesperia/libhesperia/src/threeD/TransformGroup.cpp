@@ -27,11 +27,14 @@
 #include <GL/gl.h>
 
 #include "core/macros.h"
+#include "core/base/Instrumentation.h"
 #include "core/base/Lock.h"
 #include "core/base/Thread.h"
 #include "core/wrapper/DisposalService.h"
 #include "core/data/Constants.h"
+#include "hesperia/threeD/Frustum.h"
 #include "hesperia/threeD/TransformGroup.h"
+#include "hesperia/threeD/TransformationMatrix.h"
 
 namespace hesperia {
     namespace threeD {
@@ -39,6 +42,19 @@ namespace hesperia {
         using namespace core::base;
         using namespace core::data::environment;
 
+        /**
+         * View frustum in the coordinate system of the transform group
+         * currently rendering its children or NULL outside of render.
+         */
+        static OPENDAVINCI_THREAD_LOCAL const Frustum *currentFrustum = NULL;
+
+        /**
+         * Numbers of drawn and culled nodes in the current frame; they
+         * are reported once per frame by the outermost transform group.
+         */
+        static OPENDAVINCI_THREAD_LOCAL uint32_t drawnNodes = 0;
+        static OPENDAVINCI_THREAD_LOCAL uint32_t culledNodes = 0;
+
         TransformGroup::TransformGroup() :
                 Node(NodeDescriptor()),
                 m_translation(),
@@ -77,21 +93,86 @@ namespace hesperia {
                     // Scale the model.
                     glScaled(m_scaling.getX(), m_scaling.getY(), m_scaling.getZ());
 
-                    // Draw all existing children.
+                    // Only the outermost transform group queries OpenGL for the
+                    // current matrices; nested ones derive their frustum from
+                    // their parent's. LevelOfDetail uses it for the camera distance.
+                    const Frustum *parentFrustum = currentFrustum;
+                    Frustum frustum;
+                    if (parentFrustum == NULL) {
+                        GLdouble projection[16];
+                        GLdouble modelView[16];
+                        glGetDoublev(GL_PROJECTION_MATRIX, projection);
+                        glGetDoublev(GL_MODELVIEW_MATRIX, modelView);
+                        frustum = Frustum(projection, modelView);
+                    }
+                    else {
+                        frustum = parentFrustum->transform(TransformationMatrix(m_translation, m_rotation, m_scaling));
+                    }
+                    currentFrustum = &frustum;
+
+                    // Draw all existing children and skip those outside the view frustum.
+                    const bool frustumCulling = renderingConfiguration.hasFrustumCulling();
                     vector<Node*>::const_iterator it = m_listOfChildren.begin();
                     while (it != m_listOfChildren.end()) {
                         Node *n = (*it++);
                         if (n != NULL) {
+                            if (frustumCulling && !frustum.isVisible(n->getBoundingSphere())) {
+                                culledNodes++;
+                                continue;
+                            }
+
                             n->render(renderingConfiguration);
+                            drawnNodes++;
+                        }
+                    }
+
+                    currentFrustum = parentFrustum;
+
+                    // Report the totals of this frame.
+                    if (parentFrustum == NULL) {
+                        if (frustumCulling) {
+                            static const uint32_t drawnNodesCounter = Instrumentation::getInstance().getCounter("TransformGroup.drawnNodes");
+                            static const uint32_t culledNodesCounter = Instrumentation::getInstance().getCounter("TransformGroup.culledNodes");
+                            Instrumentation::getInstance().increment(drawnNodesCounter, drawnNodes);
+                            Instrumentation::getInstance().increment(culledNodesCounter, culledNodes);
                         }
+                        drawnNodes = 0;
+                        culledNodes = 0;
                     }
                 }
                 glPopMatrix();
             }
         }
 
+        const Frustum* TransformGroup::getCurrentFrustum() {
+            return currentFrustum;
+        }
+
+        BoundingSphere TransformGroup::computeBoundingSphere() const {
+            Lock l(m_listOfChildrenMutex);
+
+            // All children must be asked to keep their cached spheres consistent with this one.
+            bool hasUnknownExtent = m_listOfChildren.empty();
+            BoundingSphere sphere;
+            vector<Node*>::const_iterator it = m_listOfChildren.begin();
+            while (it != m_listOfChildren.end()) {
+                Node *n = (*it++);
+                if (n != NULL) {
+                    const BoundingSphere child = n->getBoundingSphere();
+                    hasUnknownExtent |= !child.isValid();
+                    sphere.enclose(child);
+                }
+            }
+
+            if (hasUnknownExtent) {
+                return BoundingSphere();
+            }
+            return sphere.transform(m_translation, m_rotation, m_scaling);
+        }
+
         void TransformGroup::setTranslation(const Point3 &t) {
             m_translation = t;
+            invalidateBoundingSphere();
         }
 
         Point3 TransformGroup::getTranslation() const {
@@ -100,6 +181,7 @@ namespace hesperia {
 
         void TransformGroup::setRotation(const Point3 &r) {
             m_rotation = r;
+            invalidateBoundingSphere();
         }
 
         Point3 TransformGroup::getRotation() const {
@@ -108,6 +190,7 @@ namespace hesperia {
 
         void TransformGroup::setScaling(const Point3 &s) {
             m_scaling = s;
+            invalidateBoundingSphere();
         }
 
         Point3 TransformGroup::getScaling() const {
@@ -136,6 +219,10 @@ namespace hesperia {
             Lock l(m_listOfChildrenMutex);
 
             m_listOfChildren.push_back(c);
+            if (c != NULL) {
+                c->setParent(this);
+            }
+            invalidateBoundingSphere();
         }
 
         void TransformGroup::removeChild(Node *c) {
@@ -147,10 +234,17 @@ namespace hesperia {
 //                    core::wrapper::DisposalService::getInstance().addDisposableForRegularRemoval((Disposable**)&(*result));
                     OPENDAVINCI_CORE_DELETE_POINTER(*result);
                     m_listOfChildren.erase(result);
+                    invalidateBoundingSphere();
                 }
             }
         }
 
+        vector<Node*> TransformGroup::getChildren() const {
+            Lock l(m_listOfChildrenMutex);
+
+            return m_listOfChildren;
+        }
+
         void TransformGroup::deleteAllChildren() {
             Lock lc(m_listOfChildrenMutex);
 
@@ -161,6 +255,7 @@ namespace hesperia {
                 TransformGroup *tg = dynamic_cast<TransformGroup*>(n);
                 if (tg != NULL) {
                     tg->deleteAllChildren();
+                    tg->setParent(NULL);
                 }
                 else {
                     // Child is not a TransformGroup.
@@ -173,6 +268,7 @@ namespace hesperia {
 
             // Clear regular node list.
             m_listOfChildren.clear();
+            invalidateBoundingSphere();
         }
 
     }
@@ -0,0 +1,119 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <cstring>
+
+#include "hesperia/threeD/TransformationMatrix.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        TransformationMatrix::TransformationMatrix() :
+                m_matrix(),
+                m_normalMatrix(),
+                m_maximumScaling(1) {
+            m_matrix[0] = m_matrix[5] = m_matrix[10] = m_matrix[15] = 1;
+            m_normalMatrix[0] = m_normalMatrix[4] = m_normalMatrix[8] = 1;
+        }
+
+        TransformationMatrix::TransformationMatrix(const Point3 &translation, const Point3 &rotation, const Point3 &scaling) :
+                m_matrix(),
+                m_normalMatrix(),
+                m_maximumScaling(0) {
+            const double cx = cos(rotation.getX()), sx = sin(rotation.getX());
+            const double cy = cos(rotation.getY()), sy = sin(rotation.getY());
+            const double cz = cos(rotation.getZ()), sz = sin(rotation.getZ());
+
+            // R = Rx * Ry * Rz in row-major order.
+            const double R[9] = {
+                cy * cz,                  -cy * sz,                  sy,
+                sx * sy * cz + cx * sz,   -sx * sy * sz + cx * cz,   -sx * cy,
+                -cx * sy * cz + sx * sz,  cx * sy * sz + sx * cz,    cx * cy
+            };
+
+            const double S[3] = { scaling.getX(), scaling.getY(), scaling.getZ() };
+            const double T[3] = { translation.getX(), translation.getY(), translation.getZ() };
+
+            for (uint32_t column = 0; column < 3; column++) {
+                // Normals are transformed by the inverse transpose, i.e. R * S^-1.
+                const double inverseScaling = (fabs(S[column]) > 1e-12) ? (1.0 / S[column]) : 1.0;
+
+                for (uint32_t row = 0; row < 3; row++) {
+                    m_matrix[column * 4 + row] = R[row * 3 + column] * S[column];
+                    m_normalMatrix[column * 3 + row] = R[row * 3 + column] * inverseScaling;
+                }
+                m_matrix[12 + column] = T[column];
+
+                m_maximumScaling = (fabs(S[column]) > m_maximumScaling) ? fabs(S[column]) : m_maximumScaling;
+            }
+            m_matrix[15] = 1;
+        }
+
+        TransformationMatrix::TransformationMatrix(const TransformationMatrix &obj) :
+                m_matrix(),
+                m_normalMatrix(),
+                m_maximumScaling(obj.m_maximumScaling) {
+            memcpy(m_matrix, obj.m_matrix, sizeof(m_matrix));
+            memcpy(m_normalMatrix, obj.m_normalMatrix, sizeof(m_normalMatrix));
+        }
+
+        TransformationMatrix::~TransformationMatrix() {}
+
+        TransformationMatrix& TransformationMatrix::operator=(const TransformationMatrix &obj) {
+            memcpy(m_matrix, obj.m_matrix, sizeof(m_matrix));
+            memcpy(m_normalMatrix, obj.m_normalMatrix, sizeof(m_normalMatrix));
+            m_maximumScaling = obj.m_maximumScaling;
+
+            return (*this);
+        }
+
+        const double* TransformationMatrix::getMatrix() const {
+            return m_matrix;
+        }
+
+        Point3 TransformationMatrix::transformPoint(const Point3 &p) const {
+            const double *M = m_matrix;
+            return Point3(M[0] * p.getX() + M[4] * p.getY() + M[8] * p.getZ() + M[12],
+                          M[1] * p.getX() + M[5] * p.getY() + M[9] * p.getZ() + M[13],
+                          M[2] * p.getX() + M[6] * p.getY() + M[10] * p.getZ() + M[14]);
+        }
+
+        Point3 TransformationMatrix::transformNormal(const Point3 &n) const {
+            const double *N = m_normalMatrix;
+            Point3 normal(N[0] * n.getX() + N[3] * n.getY() + N[6] * n.getZ(),
+                          N[1] * n.getX() + N[4] * n.getY() + N[7] * n.getZ(),
+                          N[2] * n.getX() + N[5] * n.getY() + N[8] * n.getZ());
+
+            const double length = normal.length();
+            if (length > 1e-12) {
+                normal = normal * (1.0 / length);
+            }
+            return normal;
+        }
+
+        double TransformationMatrix::getMaximumScaling() const {
+            return m_maximumScaling;
+        }
+
+    }
+} // hesperia::threeD
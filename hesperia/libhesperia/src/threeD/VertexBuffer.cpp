@@ -0,0 +1,445 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <utility>
+
+#include "hesperia/threeD/TransformationMatrix.h"
+#include "hesperia/threeD/VertexBuffer.h"
+
+namespace hesperia {
+    namespace threeD {
+
+        using namespace std;
+        using namespace core::data::environment;
+
+        static void writeWords(ostream &out, const uint32_t *words, const uint32_t &size) {
+            vector<uint32_t> buffer(words, words + size);
+            for (uint32_t i = 0; i < size; i++) {
+                buffer[i] = htonl(buffer[i]);
+            }
+            if (size > 0) {
+                out.write(reinterpret_cast<const char*>(&buffer[0]), size * sizeof(uint32_t));
+            }
+        }
+
+        static bool readWords(istream &in, vector<uint32_t> &words, const uint32_t &size) {
+            // Grow the buffer only by the words actually read so that a
+            // corrupt size cannot allocate more memory than the stream holds.
+            const uint32_t WORDS_PER_CHUNK = 65536;
+            words.clear();
+            while ( in.good() && (words.size() < size) ) {
+                const uint32_t offset = words.size();
+                const uint32_t chunk = ((size - offset) < WORDS_PER_CHUNK) ? (size - offset) : WORDS_PER_CHUNK;
+                words.resize(offset + chunk);
+                in.read(reinterpret_cast<char*>(&words[offset]), chunk * sizeof(uint32_t));
+            }
+            if (!in.good()) {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < size; i++) {
+                words[i] = ntohl(words[i]);
+            }
+            return true;
+        }
+
+        VertexBuffer::VertexBuffer() :
+                m_primitive(VertexBuffer::TRIANGLES),
+                m_current(),
+                m_hasNormals(false),
+                m_hasTextureCoordinates(false),
+                m_hasColors(false),
+                m_vertices(),
+                m_indices() {
+            // Same defaults as OpenGL.
+            m_current[NORMAL + 2] = 1;
+            m_current[COLOR] = m_current[COLOR + 1] = m_current[COLOR + 2] = 1;
+        }
+
+        VertexBuffer::VertexBuffer(const enum PRIMITIVE &primitive) :
+                m_primitive(primitive),
+                m_current(),
+                m_hasNormals(false),
+                m_hasTextureCoordinates(false),
+                m_hasColors(false),
+                m_vertices(),
+                m_indices() {
+            // Same defaults as OpenGL.
+            m_current[NORMAL + 2] = 1;
+            m_current[COLOR] = m_current[COLOR + 1] = m_current[COLOR + 2] = 1;
+        }
+
+        VertexBuffer::VertexBuffer(const VertexBuffer &obj) :
+                m_primitive(obj.m_primitive),
+                m_current(),
+                m_hasNormals(obj.m_hasNormals),
+                m_hasTextureCoordinates(obj.m_hasTextureCoordinates),
+                m_hasColors(obj.m_hasColors),
+                m_vertices(obj.m_vertices),
+                m_indices(obj.m_indices) {
+            for (uint32_t i = 0; i < FLOATS_PER_VERTEX; i++) {
+                m_current[i] = obj.m_current[i];
+            }
+        }
+
+        VertexBuffer::~VertexBuffer() {}
+
+        VertexBuffer& VertexBuffer::operator=(const VertexBuffer &obj) {
+            m_primitive = obj.m_primitive;
+            for (uint32_t i = 0; i < FLOATS_PER_VERTEX; i++) {
+                m_current[i] = obj.m_current[i];
+            }
+            m_hasNormals = obj.m_hasNormals;
+            m_hasTextureCoordinates = obj.m_hasTextureCoordinates;
+            m_hasColors = obj.m_hasColors;
+            m_vertices = obj.m_vertices;
+            m_indices = obj.m_indices;
+
+            return (*this);
+        }
+
+        enum VertexBuffer::PRIMITIVE VertexBuffer::getPrimitive() const {
+            return m_primitive;
+        }
+
+        void VertexBuffer::setNormal(const Point3 &normal) {
+            m_current[NORMAL] = static_cast<float>(normal.getX());
+            m_current[NORMAL + 1] = static_cast<float>(normal.getY());
+            m_current[NORMAL + 2] = static_cast<float>(normal.getZ());
+            m_hasNormals = true;
+        }
+
+        void VertexBuffer::setTextureCoordinate(const Point3 &textureCoordinate) {
+            m_current[TEXTURECOORDINATE] = static_cast<float>(textureCoordinate.getX());
+            m_current[TEXTURECOORDINATE + 1] = static_cast<float>(textureCoordinate.getY());
+            m_hasTextureCoordinates = true;
+        }
+
+        void VertexBuffer::setColor(const Point3 &color) {
+            m_current[COLOR] = static_cast<float>(color.getX());
+            m_current[COLOR + 1] = static_cast<float>(color.getY());
+            m_current[COLOR + 2] = static_cast<float>(color.getZ());
+            m_hasColors = true;
+        }
+
+        uint32_t VertexBuffer::addVertex(const Point3 &position) {
+            m_current[POSITION] = static_cast<float>(position.getX());
+            m_current[POSITION + 1] = static_cast<float>(position.getY());
+            m_current[POSITION + 2] = static_cast<float>(position.getZ());
+
+            m_vertices.insert(m_vertices.end(), m_current, m_current + FLOATS_PER_VERTEX);
+
+            return (m_vertices.size() / FLOATS_PER_VERTEX) - 1;
+        }
+
+        void VertexBuffer::addIndex(const uint32_t &index) {
+            m_indices.push_back(index);
+        }
+
+        void VertexBuffer::addLine(const uint32_t &a, const uint32_t &b) {
+            m_indices.push_back(a);
+            m_indices.push_back(b);
+        }
+
+        void VertexBuffer::addTriangle(const uint32_t &a, const uint32_t &b, const uint32_t &c) {
+            m_indices.push_back(a);
+            m_indices.push_back(b);
+            m_indices.push_back(c);
+        }
+
+        void VertexBuffer::addQuad(const uint32_t &a, const uint32_t &b, const uint32_t &c, const uint32_t &d) {
+            addTriangle(a, b, c);
+            addTriangle(a, c, d);
+        }
+
+        bool VertexBuffer::append(const VertexBuffer &vb) {
+            if (vb.m_primitive != m_primitive) {
+                return false;
+            }
+
+            const uint32_t offset = getNumberOfVertices();
+            m_vertices.insert(m_vertices.end(), vb.m_vertices.begin(), vb.m_vertices.end());
+
+            m_indices.reserve(m_indices.size() + vb.m_indices.size());
+            vector<uint32_t>::const_iterator it = vb.m_indices.begin();
+            while (it != vb.m_indices.end()) {
+                m_indices.push_back(offset + (*it++));
+            }
+
+            m_hasNormals |= vb.m_hasNormals;
+            m_hasTextureCoordinates |= vb.m_hasTextureCoordinates;
+            m_hasColors |= vb.m_hasColors;
+
+            return true;
+        }
+
+        void VertexBuffer::transform(const Point3 &translation, const Point3 &rotation, const Point3 &scaling) {
+            const TransformationMatrix t(translation, rotation, scaling);
+
+            const uint32_t numberOfVertices = getNumberOfVertices();
+            for (uint32_t v = 0; v < numberOfVertices; v++) {
+                float *vertex = &m_vertices[v * FLOATS_PER_VERTEX];
+
+                const Point3 p = t.transformPoint(Point3(vertex[POSITION], vertex[POSITION + 1], vertex[POSITION + 2]));
+                vertex[POSITION] = static_cast<float>(p.getX());
+                vertex[POSITION + 1] = static_cast<float>(p.getY());
+                vertex[POSITION + 2] = static_cast<float>(p.getZ());
+
+                const Point3 n = t.transformNormal(Point3(vertex[NORMAL], vertex[NORMAL + 1], vertex[NORMAL + 2]));
+                vertex[NORMAL] = static_cast<float>(n.getX());
+                vertex[NORMAL + 1] = static_cast<float>(n.getY());
+                vertex[NORMAL + 2] = static_cast<float>(n.getZ());
+            }
+        }
+
+        BoundingSphere VertexBuffer::getBoundingSphere() const {
+            const uint32_t numberOfVertices = getNumberOfVertices();
+            if (numberOfVertices == 0) {
+                return BoundingSphere();
+            }
+
+            double minimum[3], maximum[3];
+            for (uint32_t i = 0; i < 3; i++) {
+                minimum[i] = maximum[i] = m_vertices[POSITION + i];
+            }
+            for (uint32_t v = 1; v < numberOfVertices; v++) {
+                const float *vertex = &m_vertices[v * FLOATS_PER_VERTEX];
+                for (uint32_t i = 0; i < 3; i++) {
+                    minimum[i] = (vertex[POSITION + i] < minimum[i]) ? vertex[POSITION + i] : minimum[i];
+                    maximum[i] = (vertex[POSITION + i] > maximum[i]) ? vertex[POSITION + i] : maximum[i];
+                }
+            }
+
+            const double center[3] = { (minimum[0] + maximum[0]) / 2.0, (minimum[1] + maximum[1]) / 2.0, (minimum[2] + maximum[2]) / 2.0 };
+            double squaredRadius = 0;
+            for (uint32_t v = 0; v < numberOfVertices; v++) {
+                const float *vertex = &m_vertices[v * FLOATS_PER_VERTEX];
+                double squaredDistance = 0;
+                for (uint32_t i = 0; i < 3; i++) {
+                    squaredDistance += (vertex[POSITION + i] - center[i]) * (vertex[POSITION + i] - center[i]);
+                }
+                squaredRadius = (squaredDistance > squaredRadius) ? squaredDistance : squaredRadius;
+            }
+
+            return BoundingSphere(Point3(center[0], center[1], center[2]), sqrt(squaredRadius));
+        }
+
+        VertexBuffer VertexBuffer::simplify(const double &cellSize) const {
+            VertexBuffer simplified(m_primitive);
+            simplified.m_hasNormals = m_hasNormals;
+            simplified.m_hasTextureCoordinates = m_hasTextureCoordinates;
+            simplified.m_hasColors = m_hasColors;
+
+            if (!(cellSize > 0)) {
+                simplified.m_vertices = m_vertices;
+                simplified.m_indices = m_indices;
+                return simplified;
+            }
+
+            // Map every vertex to the representative of its cell.
+            typedef pair<int64_t, pair<int64_t, int64_t> > Cell;
+            map<Cell, uint32_t> mapOfCells;
+            vector<uint32_t> representative(getNumberOfVertices());
+            vector<uint32_t> numberOfMergedVertices;
+
+            const uint32_t numberOfVertices = getNumberOfVertices();
+            for (uint32_t v = 0; v < numberOfVertices; v++) {
+                const float *vertex = &m_vertices[v * FLOATS_PER_VERTEX];
+                const Cell cell(static_cast<int64_t>(floor(vertex[POSITION] / cellSize)),
+                                make_pair(static_cast<int64_t>(floor(vertex[POSITION + 1] / cellSize)),
+                                          static_cast<int64_t>(floor(vertex[POSITION + 2] / cellSize))));
+
+                map<Cell, uint32_t>::iterator it = mapOfCells.find(cell);
+                if (it == mapOfCells.end()) {
+                    const uint32_t index = numberOfMergedVertices.size();
+                    mapOfCells[cell] = index;
+                    representative[v] = index;
+                    numberOfMergedVertices.push_back(1);
+                    simplified.m_vertices.insert(simplified.m_vertices.end(), vertex, vertex + FLOATS_PER_VERTEX);
+                }
+                else {
+                    // Accumulate position, normal, and color; keep the first texture coordinate.
+                    const uint32_t index = it->second;
+                    representative[v] = index;
+                    numberOfMergedVertices[index]++;
+                    float *merged = &simplified.m_vertices[index * FLOATS_PER_VERTEX];
+                    for (uint32_t i = 0; i < 3; i++) {
+                        merged[POSITION + i] += vertex[POSITION + i];
+                        merged[NORMAL + i] += vertex[NORMAL + i];
+                        merged[COLOR + i] += vertex[COLOR + i];
+                    }
+                }
+            }
+
+            for (uint32_t v = 0; v < numberOfMergedVertices.size(); v++) {
+                float *merged = &simplified.m_vertices[v * FLOATS_PER_VERTEX];
+                const float n = static_cast<float>(numberOfMergedVertices[v]);
+                for (uint32_t i = 0; i < 3; i++) {
+                    merged[POSITION + i] /= n;
+                    merged[COLOR + i] /= n;
+                }
+
+                const double length = sqrt(merged[NORMAL] * merged[NORMAL] + merged[NORMAL + 1] * merged[NORMAL + 1] + merged[NORMAL + 2] * merged[NORMAL + 2]);
+                if (length > 1e-12) {
+                    for (uint32_t i = 0; i < 3; i++) {
+                        merged[NORMAL + i] = static_cast<float>(merged[NORMAL + i] / length);
+                    }
+                }
+            }
+
+            // Keep all primitives whose vertices are still distinct.
+            const uint32_t verticesPerPrimitive = (m_primitive == LINES) ? 2 : 3;
+            for (uint32_t i = 0; i + verticesPerPrimitive <= m_indices.size(); i += verticesPerPrimitive) {
+                const uint32_t a = representative[m_indices[i]];
+                const uint32_t b = representative[m_indices[i + 1]];
+                if (verticesPerPrimitive == 2) {
+                    if (a != b) {
+                        simplified.addLine(a, b);
+                    }
+                }
+                else {
+                    const uint32_t c = representative[m_indices[i + 2]];
+                    if ( (a != b) && (b != c) && (a != c) ) {
+                        simplified.addTriangle(a, b, c);
+                    }
+                }
+            }
+
+            return simplified;
+        }
+
+        void VertexBuffer::clear() {
+            m_vertices.clear();
+            m_indices.clear();
+        }
+
+        uint32_t VertexBuffer::getNumberOfVertices() const {
+            return m_vertices.size() / FLOATS_PER_VERTEX;
+        }
+
+        uint32_t VertexBuffer::getNumberOfIndices() const {
+            return m_indices.size();
+        }
+
+        const float* VertexBuffer::getVertexData() const {
+            return (m_vertices.empty() ? NULL : &m_vertices[0]);
+        }
+
+        const uint32_t* VertexBuffer::getIndexData() const {
+            return (m_indices.empty() ? NULL : &m_indices[0]);
+        }
+
+        Point3 VertexBuffer::getAttribute(const uint32_t &index, const uint32_t &offset, const uint32_t &size) const {
+            Point3 p;
+            if (index < getNumberOfVertices()) {
+                const float *vertex = &m_vertices[index * FLOATS_PER_VERTEX + offset];
+                p.setX(vertex[0]);
+                p.setY(vertex[1]);
+                if (size > 2) {
+                    p.setZ(vertex[2]);
+                }
+            }
+            return p;
+        }
+
+        Point3 VertexBuffer::getPosition(const uint32_t &index) const {
+            return getAttribute(index, POSITION, 3);
+        }
+
+        Point3 VertexBuffer::getNormal(const uint32_t &index) const {
+            return getAttribute(index, NORMAL, 3);
+        }
+
+        Point3 VertexBuffer::getTextureCoordinate(const uint32_t &index) const {
+            return getAttribute(index, TEXTURECOORDINATE, 2);
+        }
+
+        Point3 VertexBuffer::getColor(const uint32_t &index) const {
+            return getAttribute(index, COLOR, 3);
+        }
+
+        bool VertexBuffer::hasNormals() const {
+            return m_hasNormals;
+        }
+
+        bool VertexBuffer::hasTextureCoordinates() const {
+            return m_hasTextureCoordinates;
+        }
+
+        bool VertexBuffer::hasColors() const {
+            return m_hasColors;
+        }
+
+        void VertexBuffer::write(ostream &out) const {
+            const uint32_t header[6] = { static_cast<uint32_t>(m_primitive),
+                                         (m_hasNormals ? 1u : 0u),
+                                         (m_hasTextureCoordinates ? 1u : 0u),
+                                         (m_hasColors ? 1u : 0u),
+                                         getNumberOfVertices(),
+                                         getNumberOfIndices() };
+            writeWords(out, header, 6);
+
+            // Floats are written by their bit pattern.
+            vector<uint32_t> words(m_vertices.size());
+            if (!words.empty()) {
+                memcpy(&words[0], &m_vertices[0], words.size() * sizeof(uint32_t));
+            }
+            writeWords(out, (words.empty() ? NULL : &words[0]), words.size());
+            writeWords(out, (m_indices.empty() ? NULL : &m_indices[0]), m_indices.size());
+        }
+
+        bool VertexBuffer::read(istream &in) {
+            vector<uint32_t> header;
+            if ( !readWords(in, header, 6) || (header[0] > static_cast<uint32_t>(VertexBuffer::TRIANGLES)) ||
+                 (header[4] > VertexBuffer::MAXIMUM_NUMBER_OF_VERTICES) || (header[5] > VertexBuffer::MAXIMUM_NUMBER_OF_INDICES) ) {
+                return false;
+            }
+
+            vector<uint32_t> words;
+            vector<uint32_t> indices;
+            if ( !readWords(in, words, header[4] * FLOATS_PER_VERTEX) || !readWords(in, indices, header[5]) ) {
+                return false;
+            }
+
+            // Indices must refer to the vertices read.
+            for (uint32_t i = 0; i < indices.size(); i++) {
+                if (indices[i] >= header[4]) {
+                    return false;
+                }
+            }
+
+            clear();
+            m_primitive = static_cast<enum PRIMITIVE>(header[0]);
+            m_hasNormals = (header[1] == 1);
+            m_hasTextureCoordinates = (header[2] == 1);
+            m_hasColors = (header[3] == 1);
+            m_vertices.resize(words.size());
+            if (!words.empty()) {
+                memcpy(&m_vertices[0], &words[0], words.size() * sizeof(uint32_t));
+            }
+            m_indices.swap(indices);
+
+            return true;
+        }
+
+    }
+} // hesperia::threeD
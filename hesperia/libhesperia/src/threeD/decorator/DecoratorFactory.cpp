@@ -17,16 +17,23 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <cmath>
+#include <limits>
+#include <map>
+#include <utility>
+
 #include "core/macros.h"
 #include "core/base/Lock.h"
 
 #include "hesperia/scenario/GroundBasedComplexModelLoader.h"
 #include "hesperia/scenario/ScenarioOpenGLSceneTransformation.h"
+#include "hesperia/threeD/LevelOfDetail.h"
 #include "hesperia/threeD/NodeDescriptor.h"
 #include "hesperia/threeD/TransformGroup.h"
 #include "hesperia/threeD/decorator/DecoratorFactory.h"
 #include "hesperia/threeD/models/AerialImage.h"
 #include "hesperia/threeD/models/HeightGrid.h"
+#include "hesperia/threeD/models/Mesh.h"
 
 namespace hesperia {
     namespace threeD {
@@ -104,6 +111,21 @@ namespace hesperia {
                 GroundBasedComplexModelLoader gbcml;
                 TransformGroup *complexModels = gbcml.getGroundBasedComplexModels(scnxArchive);
                 if (complexModels != NULL) {
+                    const uint32_t numberOfComplexModels = complexModels->getChildren().size();
+                    if (numberOfComplexModels > MAXIMUM_NUMBER_OF_INDIVIDUAL_COMPLEX_MODELS) {
+                        // Draw static models with one call per material.
+                        TransformGroup *batchedComplexModels = batchStaticMeshes(*complexModels, NodeDescriptor("ComplexModels"));
+                        if (batchedComplexModels != NULL) {
+                            OPENDAVINCI_CORE_DELETE_POINTER(complexModels);
+                            complexModels = batchedComplexModels;
+
+                            clog << "Batched " << numberOfComplexModels << " complex models into " << complexModels->getChildren().size() << " tiles." << endl;
+                        }
+                        else {
+                            clog << "Complex models contain nodes which cannot be batched; drawing " << numberOfComplexModels << " models individually." << endl;
+                        }
+                    }
+
                     tg->addChild(complexModels);
                 }
 
@@ -113,6 +135,158 @@ namespace hesperia {
             Node* DecoratorFactory::decorate(loaders::OBJXArchive &objxArchive, const NodeDescriptor &nd) {
                 return objxArchive.createTransformGroup(nd);
             }
+
+            TransformGroup* DecoratorFactory::batchStaticMeshes(const TransformGroup &root, const NodeDescriptor &nd) {
+                if (!isBatchable(&root)) {
+                    return NULL;
+                }
+
+                // Assign the root's children to tiles.
+                typedef pair<int32_t, int32_t> Tile;
+                map<Tile, vector<const Node*> > mapOfTiles;
+
+                const vector<Node*> children = root.getChildren();
+                vector<Node*>::const_iterator it = children.begin();
+                while (it != children.end()) {
+                    const Node *child = (*it++);
+                    if (child != NULL) {
+                        const Point3 center = child->getBoundingSphere().getCenter();
+                        const Tile tile(static_cast<int32_t>(floor(center.getX() / TILE_SIZE)), static_cast<int32_t>(floor(center.getY() / TILE_SIZE)));
+                        mapOfTiles[tile].push_back(child);
+                    }
+                }
+
+                TransformGroup *tg = new TransformGroup(nd);
+
+                map<Tile, vector<const Node*> >::const_iterator jt = mapOfTiles.begin();
+                while (jt != mapOfTiles.end()) {
+                    const vector<const Node*> &nodes = (jt++)->second;
+
+                    vector<TransformGroup*> levels;
+                    vector<double> maximumDistances;
+                    bool hasFurtherLevels = true;
+                    bool hasMeshesWithoutLevels = false;
+                    for (uint32_t level = 0; hasFurtherLevels; level++) {
+                        StaticGeometryBatch batch;
+                        double maximumDistance = 0;
+                        hasFurtherLevels = false;
+
+                        vector<const Node*>::const_iterator kt = nodes.begin();
+                        while (kt != nodes.end()) {
+                            vector<const TransformGroup*> ancestors;
+                            ancestors.push_back(&root);
+                            hasMeshesWithoutLevels |= collectMeshes(*kt++, ancestors, batch, level, maximumDistance, hasFurtherLevels);
+                        }
+
+                        TransformGroup *meshes = new TransformGroup();
+                        for (uint32_t i = 0; i < batch.getNumberOfBatches(); i++) {
+                            meshes->addChild(new Mesh(NodeDescriptor(), batch.getVertexBuffer(i), batch.getMaterial(i)));
+                        }
+                        levels.push_back(meshes);
+                        maximumDistances.push_back(maximumDistance);
+                    }
+
+                    if ( (levels.size() == 1) && (maximumDistances.front() <= 0) ) {
+                        // No levels of detail in this tile.
+                        tg->addChild(levels.front());
+                    }
+                    else {
+                        // Distances of the models are measured from their own centers.
+                        const BoundingSphere sphere = levels.front()->getBoundingSphere();
+                        const double radius = sphere.isValid() ? sphere.getRadius() : 0;
+                        if (hasMeshesWithoutLevels) {
+                            maximumDistances.back() = numeric_limits<double>::max();
+                        }
+
+                        LevelOfDetail *lod = new LevelOfDetail(NodeDescriptor());
+                        for (uint32_t i = 0; i < levels.size(); i++) {
+                            lod->addLevel(levels[i], maximumDistances[i] + radius);
+                        }
+                        tg->addChild(lod);
+                    }
+                }
+
+                return tg;
+            }
+
+            bool DecoratorFactory::isBatchable(const Node *node) {
+                if ( (node == NULL) || (dynamic_cast<const Mesh*>(node) != NULL) ) {
+                    return true;
+                }
+
+                const TransformGroup *tg = dynamic_cast<const TransformGroup*>(node);
+                if (tg != NULL) {
+                    const vector<Node*> children = tg->getChildren();
+                    vector<Node*>::const_iterator it = children.begin();
+                    while (it != children.end()) {
+                        if (!isBatchable(*it++)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                const LevelOfDetail *lod = dynamic_cast<const LevelOfDetail*>(node);
+                if (lod != NULL) {
+                    for (uint32_t i = 0; i < lod->getNumberOfLevels(); i++) {
+                        if (!isBatchable(lod->getLevel(i))) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                // Any other node would be lost when replacing the subtree by its meshes.
+                return false;
+            }
+
+            bool DecoratorFactory::collectMeshes(const Node *node, vector<const TransformGroup*> &ancestors, StaticGeometryBatch &batch, const uint32_t &level, double &maximumDistance, bool &hasFurtherLevels) {
+                bool hasMeshesWithoutLevels = false;
+
+                const TransformGroup *tg = dynamic_cast<const TransformGroup*>(node);
+                if (tg != NULL) {
+                    ancestors.push_back(tg);
+
+                    const vector<Node*> children = tg->getChildren();
+                    vector<Node*>::const_iterator it = children.begin();
+                    while (it != children.end()) {
+                        hasMeshesWithoutLevels |= collectMeshes(*it++, ancestors, batch, level, maximumDistance, hasFurtherLevels);
+                    }
+
+                    ancestors.pop_back();
+                    return hasMeshesWithoutLevels;
+                }
+
+                const LevelOfDetail *lod = dynamic_cast<const LevelOfDetail*>(node);
+                if ( (lod != NULL) && (lod->getNumberOfLevels() > 0) ) {
+                    const uint32_t selectedLevel = (level < lod->getNumberOfLevels()) ? level : (lod->getNumberOfLevels() - 1);
+                    maximumDistance = (lod->getMaximumDistance(selectedLevel) > maximumDistance) ? lod->getMaximumDistance(selectedLevel) : maximumDistance;
+                    hasFurtherLevels |= ((level + 1) < lod->getNumberOfLevels());
+
+                    // Nested levels of detail are collected at their most detailed level.
+                    double unusedMaximumDistance = 0;
+                    bool unusedFurtherLevels = false;
+                    collectMeshes(lod->getLevel(selectedLevel), ancestors, batch, 0, unusedMaximumDistance, unusedFurtherLevels);
+                    return false;
+                }
+
+                const Mesh *mesh = dynamic_cast<const Mesh*>(node);
+                if (mesh != NULL) {
+                    VertexBuffer vb = mesh->getVertexBuffer();
+
+                    // Apply the transformations from the innermost to the outermost transform group.
+                    vector<const TransformGroup*>::const_reverse_iterator it = ancestors.rbegin();
+                    while (it != ancestors.rend()) {
+                        const TransformGroup *ancestor = (*it++);
+                        vb.transform(ancestor->getTranslation(), ancestor->getRotation(), ancestor->getScaling());
+                    }
+
+                    batch.add(mesh->hasMaterial() ? mesh->getMaterial() : Material(), vb);
+                    hasMeshesWithoutLevels = true;
+                }
+
+                return hasMeshesWithoutLevels;
+            }
         }
     }
 } // hesperia::threeD::decorator
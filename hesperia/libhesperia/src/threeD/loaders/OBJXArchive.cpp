@@ -17,19 +17,17 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <algorithm>
 #include <iostream>
 #include <string>
-#include <vector>
 
 #include "core/macros.h"
 
 #include "core/data/Constants.h"
 #include "core/data/environment/Point3.h"
+#include "hesperia/threeD/LevelOfDetail.h"
 #include "hesperia/threeD/NodeDescriptor.h"
 #include "hesperia/threeD/TextureManager.h"
-#include "hesperia/threeD/models/Triangle.h"
-#include "hesperia/threeD/models/TriangleSet.h"
+#include "hesperia/threeD/models/Mesh.h"
 #include "hesperia/threeD/loaders/OBJXArchive.h"
 
 namespace hesperia {
@@ -40,11 +38,15 @@ namespace hesperia {
             using namespace core::data::environment;
             using namespace threeD::models;
 
-            OBJXArchive::OBJXArchive():
+            /**
+             * Distance to the camera relative to the model's radius up to
+             * which a level of detail is drawn.
+             */
+            static const double DISTANCE_PER_RADIUS[OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL] = { 15, 60, 300 };
+
+            OBJXArchive::OBJXArchive(const SharedPointer<OBJXModel> &model):
                     m_mapOfImages(),
-                    m_mapOfMaterials(),
-                    m_objFile(),
-                    m_mtlFile() {}
+                    m_model(model) {}
 
             OBJXArchive::~OBJXArchive() {
                 map<string, wrapper::Image*, wrapper::StringComparator>::iterator it = m_mapOfImages.begin();
@@ -57,362 +59,100 @@ namespace hesperia {
                 }
             }
 
-            void OBJXArchive::setContentsOfObjFile(const string &objContents) {
-                m_objFile.str(objContents);
-            }
-
-            void OBJXArchive::setContentsOfMtlFile(const string &mtlContents) {
-                m_mtlFile.str(mtlContents);
+            const OBJXModel& OBJXArchive::getModel() const {
+                return *m_model;
             }
 
-            const stringstream& OBJXArchive::getContentsOfObjFile() const {
-                return m_objFile;
-            }
+            map<string, Material, wrapper::StringComparator> OBJXArchive::setUpTextures() {
+                map<string, Material, wrapper::StringComparator> mapOfMaterials = m_model->getMaterials();
 
-            const stringstream& OBJXArchive::getContentsOfMtlFile() const {
-                return m_mtlFile;
-            }
+                if (mapOfMaterials.size() > 0) {
+                    TextureManager &tm = TextureManager::getInstance();
 
-            void OBJXArchive::createMapOfMaterials() {
-                m_mapOfMaterials.clear();
-
-                if (m_mtlFile.str().length() > 0) {
-                    m_mtlFile.seekg(ios::beg);
-                    string line = "";
-                    Material m;
-                    while (getline(m_mtlFile, line)) {
-                        if ( (line.find("newmtl ") != string::npos) && (line.length() > 8) ) {
-                            // Store old material description.
-                            if (m.getName() != "Undefined") {
-                                m_mapOfMaterials[m.getName()] = m;
+                    map<string, Material, wrapper::StringComparator>::iterator it = mapOfMaterials.begin();
+                    while (it != mapOfMaterials.end()) {
+                        if (it->second.getTextureName().length() > 0) {
+                            map<string, wrapper::Image*, wrapper::StringComparator>::const_iterator image = m_mapOfImages.find(it->second.getTextureName());
+                            if (image != m_mapOfImages.end()) {
+                                tm.addImage(it->first, image->second);
                             }
 
-                            // Start next material description.
-                            m = Material(line.substr(7));
-                        }
-
-                        if ( (line.find("Ns ") != string::npos) && (line.length() > 4) ) {
-                            stringstream shininess(line.substr(3));
-                            double s;
-                            shininess >> s;
-                            m.setShininess(s);
-                        }
-
-                        if ( (line.find("Ka ") != string::npos) && (line.length() > 4) ) {
-                            stringstream ambient(line.substr(3));
-                            double x;
-                            double y;
-                            double z;
-                            ambient >> x;
-                            ambient >> y;
-                            ambient >> z;
-                            m.setAmbient(Point3(x, y, z));
-                        }
-
-                        if ( (line.find("Kd ") != string::npos) && (line.length() > 4) ) {
-                            stringstream diffuse(line.substr(3));
-                            double x;
-                            double y;
-                            double z;
-                            diffuse >> x;
-                            diffuse >> y;
-                            diffuse >> z;
-                            m.setDiffuse(Point3(x, y, z));
-                        }
-
-                        if ( (line.find("Ks ") != string::npos) && (line.length() > 4) ) {
-                            stringstream specular(line.substr(3));
-                            double x;
-                            double y;
-                            double z;
-                            specular >> x;
-                            specular >> y;
-                            specular >> z;
-                            m.setSpecular(Point3(x, y, z));
+                            // Set material's texture handle; archives sharing the model share the texture, too.
+                            if (tm.hasTexture(it->first)) {
+                                it->second.setTextureHandle(tm.getTexture(it->first));
+                            }
                         }
 
-                        if ( (line.find("map_Kd ") != string::npos) && (line.length() > 8) ) {
-                            m.setTextureName(line.substr(7));
-                        }
+                        // Iterate.
+                        it++;
                     }
                 }
-            }
 
-            void OBJXArchive::setUpTextures() {
-                if (m_mapOfMaterials.size() > 0) {
-                    TextureManager &tm = TextureManager::getInstance();
+                return mapOfMaterials;
+            }
 
-                    map<string, Material, wrapper::StringComparator>::iterator it = m_mapOfMaterials.begin();
-                    while (it != m_mapOfMaterials.end()) {
-                        wrapper::Image *image = m_mapOfImages[it->second.getTextureName()];
+            TransformGroup* OBJXArchive::createTransformGroup(const NodeDescriptor &nd) {
+                TransformGroup *returnableModel = NULL;
 
-                        if (image != NULL) {
-                            tm.addImage(it->first, image);
+                if (m_model->getNumberOfGroups() > 0) {
+                    returnableModel = createRotatedModel(nd, createMeshes(setUpTextures(), 0));
+                }
 
-                            // Set material's texture handle.
-                            it->second.setTextureHandle(tm.getTexture(it->first));
-                        }
+                clog << "Model contains " << m_model->getNumberOfTriangles() << " triangles." << endl;
 
-                        // Iterate.
-                        it++;
-                    }
-                }
+                return returnableModel;
             }
 
-            TransformGroup* OBJXArchive::createTransformGroup(const NodeDescriptor &nd) {
-                TransformGroup *returnableModel = NULL;
-                TransformGroup *rotatedModel = NULL;
-                uint32_t triangleCounter = 0;
-
-                // Read materials.
-                createMapOfMaterials();
-
-                // Set up textures.
-                setUpTextures();
-
-                if (m_objFile.str().length() > 0) {
-                    TransformGroup *model = new TransformGroup();
-
-                    // TODO: Why the heck are Wavefront objs rotated around the x axis?
-                    rotatedModel = new TransformGroup();
-                    rotatedModel->setRotation(Point3(data::Constants::PI/2.0, 0, 0));
-                    rotatedModel->addChild(model);
-                    returnableModel = new TransformGroup(nd);
-                    returnableModel->addChild(rotatedModel);
-
-                    // Parse all available vertices.
-                    vector<Point3> listOfVertices;
-                    vector<Point3> listOfNormals;
-                    vector<Point3> listOfTextureCoordinates;
-
-                    m_objFile.seekg(ios::beg);
-                    string line = "";
-                    while (getline(m_objFile, line)) {
-                        // Vertices.
-                        if (line.find("v ") != string::npos) {
-                            stringstream xyz(line.substr(2));
-                            double x;
-                            double y;
-                            double z;
-                            xyz >> x;
-                            xyz >> y;
-                            xyz >> z;
-                            listOfVertices.push_back(Point3(x, y, z));
-                        }
+            TransformGroup* OBJXArchive::createTransformGroupWithLevelsOfDetail(const NodeDescriptor &nd) {
+                const BoundingSphere sphere = m_model->getBoundingSphere();
+                if (!sphere.isValid()) {
+                    return createTransformGroup(nd);
+                }
 
-                        // Normals.
-                        if (line.find("vn") != string::npos) {
-                            stringstream xyz(line.substr(3));
-                            double x;
-                            double y;
-                            double z;
-                            xyz >> x;
-                            xyz >> y;
-                            xyz >> z;
-                            listOfNormals.push_back(Point3(x, y, z));
-                        }
+                const map<string, Material, wrapper::StringComparator> mapOfMaterials = setUpTextures();
 
-                        // TextureCoordinates.
-                        if (line.find("vt") != string::npos) {
-                            stringstream xy(line.substr(3));
-                            double x;
-                            double y;
-                            xy >> x;
-                            xy >> y;
-                            listOfTextureCoordinates.push_back(Point3(x, y, 0));
-                        }
-                    }
+                // Small models must not vanish too early.
+                const double radius = (sphere.getRadius() > 1) ? sphere.getRadius() : 1;
 
-                    // Rewind file to parse faces.
-                    m_objFile.clear();
-                    m_objFile.seekg(ios::beg);
-                    line = "";
-                    // Add root triangle set if no groups are defined.
-                    TriangleSet *triangleSet = new TriangleSet();
-                    model->addChild(triangleSet);
-                    bool has_g = false;
-                    while (getline(m_objFile, line)) {
-                        if (line.find("g ") != string::npos) {
-                            // Add new group.
-                            triangleSet = new TriangleSet(NodeDescriptor());
-                            model->addChild(triangleSet);
-                            has_g = true;
-                        }
+                LevelOfDetail *lod = new LevelOfDetail(NodeDescriptor());
+                for (uint32_t i = 0; i < OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL; i++) {
+                    lod->addLevel(createMeshes(mapOfMaterials, i), radius * DISTANCE_PER_RADIUS[i]);
+                }
 
-                        if ( (line.find("usemtl ") != string::npos) && (line.length() > 8) ) {
-                            // Add new group.
-                            if (!has_g) {
-                                triangleSet = new TriangleSet(NodeDescriptor());
-                                model->addChild(triangleSet);
-                            }
+                clog << "Model contains " << m_model->getNumberOfTriangles() << " triangles." << endl;
 
-                            Material m = m_mapOfMaterials[line.substr(7)];
-                            triangleSet->setMaterial(m);
-                        }
+                return createRotatedModel(nd, lod);
+            }
 
-                        if (line.find("f ") != string::npos) {
-                            vector<Point3> vertices;
-                            vector<Point3> textureCoordinates;
-                            vector<Point3> normals;
-                            uint32_t numberOfVertices = 0;
-                            stringstream unknownFormat(line.substr(2));
-                            if (line.find("//") != string::npos) {
-                                // Format is v//n.
-                                stringstream vnStream(line.substr(2));
-                                while (vnStream.good() && (numberOfVertices < 3)) {
-                                    string triangle;
-                                    vnStream >> triangle;
-
-                                    replace(triangle.begin(), triangle.end(), '/', ' ');
-                                    stringstream triangleStream(triangle);
-                                    numberOfVertices++;
-
-                                    uint32_t v;
-                                    uint32_t n;
-
-                                    triangleStream >> v;
-                                    triangleStream >> n;
-
-                                    if ( (v > 0) && (n > 0) ) {
-                                        if ( (v - 1) < listOfVertices.size() ) {
-                                            vertices.push_back(listOfVertices[(v-1)]);
-                                        }
-                                        if ( (n - 1) < listOfNormals.size() ) {
-                                            normals.push_back(listOfNormals[(n-1)]);
-                                        }
-                                    }
-                                }
-
-                                // Add the result.
-                                if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
-                                    Triangle t;
-                                    t.setVertices(vertices[0], vertices[1], vertices[2]);
-                                    if (!normals.empty()) {
-                                        t.setNormal(normals[0]);
-                                    }
-                                    triangleSet->addTriangle(t);
-                                    triangleCounter++;
-                                }
-                            } else if (line.find("/") == string::npos) {
-                                // Format is v.
-                                stringstream vStream(line.substr(2));
-                                while (vStream.good() && (numberOfVertices < 3)) {
-                                    uint32_t v;
-                                    vStream >> v;
-                                    numberOfVertices++;
-
-                                    if (v > 0) {
-                                        if ( (v - 1) < listOfVertices.size() ) {
-                                            vertices.push_back(listOfVertices[(v-1)]);
-                                        }
-                                    }
-                                }
-
-                                // Add the result.
-                                if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
-                                    Triangle t;
-                                    t.setVertices(vertices[0], vertices[1], vertices[2]);
-                                    triangleSet->addTriangle(t);
-                                    triangleCounter++;
-                                }
-                            } else {
-                                // Format could be v/t/n or v/t.
-                                string s;
-                                unknownFormat >> s;
-
-                                uint32_t numberOfSlashes = count(s.begin(), s.end(), '/');
-                                if (numberOfSlashes == 2) {
-                                    // Format is v/t/n.
-                                    stringstream vtnStream(line.substr(2));
-                                    while (vtnStream.good() && (numberOfVertices < 3)) {
-                                        string triangle;
-                                        vtnStream >> triangle;
-
-                                        replace(triangle.begin(), triangle.end(), '/', ' ');
-                                        stringstream triangleStream(triangle);
-                                        numberOfVertices++;
-
-                                        uint32_t v;
-                                        uint32_t t;
-                                        uint32_t n;
-
-                                        triangleStream >> v;
-                                        triangleStream >> t;
-                                        triangleStream >> n;
-
-                                        if ( (v > 0) && (t > 0) && (n > 0) ) {
-                                            if ( (v - 1) < listOfVertices.size() ) {
-                                                vertices.push_back(listOfVertices[(v-1)]);
-                                            }
-                                            if ( (t - 1) < listOfTextureCoordinates.size() ) {
-                                                textureCoordinates.push_back(listOfTextureCoordinates[(t-1)]);
-                                            }
-                                            if ( (n - 1) < listOfNormals.size() ) {
-                                                normals.push_back(listOfNormals[(n-1)]);
-                                            }
-                                        }
-                                    }
-
-                                    // Add the result.
-                                    if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
-                                        Triangle t;
-                                        t.setVertices(vertices[0], vertices[1], vertices[2]);
-                                        if (!normals.empty()) {
-                                            t.setNormal(normals[0]);
-                                        }
-                                        if (textureCoordinates.size() == 3) {
-                                            t.setTextureCoordinates(textureCoordinates[0], textureCoordinates[1], textureCoordinates[2]);
-                                        }
-                                        triangleSet->addTriangle(t);
-                                        triangleCounter++;
-                                    }
-                                } else if (numberOfSlashes == 1) {
-                                    // Format is v/t.
-                                    stringstream vtStream(line.substr(2));
-                                    while (vtStream.good() && (numberOfVertices < 3)) {
-                                        string triangle;
-                                        vtStream >> triangle;
-
-                                        replace(triangle.begin(), triangle.end(), '/', ' ');
-                                        stringstream triangleStream(triangle);
-                                        numberOfVertices++;
-
-                                        uint32_t v;
-                                        uint32_t t;
-
-                                        triangleStream >> v;
-                                        triangleStream >> t;
-
-                                        if ( (v > 0) && (t > 0) ) {
-                                            if ( (v - 1) < listOfVertices.size() ) {
-                                                vertices.push_back(listOfVertices[(v-1)]);
-                                            }
-                                            if ( (t - 1) < listOfTextureCoordinates.size() ) {
-                                                textureCoordinates.push_back(listOfTextureCoordinates[(t-1)]);
-                                            }
-                                        }
-                                    }
-
-                                    // Add the result.
-                                    if ( (vertices.size() == 3) && (triangleSet != NULL) ) {
-                                        Triangle t;
-                                        t.setVertices(vertices[0], vertices[1], vertices[2]);
-                                        if (textureCoordinates.size() == 3) {
-                                            t.setTextureCoordinates(textureCoordinates[0], textureCoordinates[1], textureCoordinates[2]);
-                                        }
-                                        triangleSet->addTriangle(t);
-                                        triangleCounter++;
-                                    }
-                                } else {
-                                    clog << "Unknown format." << endl;
-                                }
-                            }
+            TransformGroup* OBJXArchive::createMeshes(const map<string, Material, wrapper::StringComparator> &mapOfMaterials, const uint32_t &level) const {
+                TransformGroup *model = new TransformGroup();
+
+                for (uint32_t i = 0; i < m_model->getNumberOfGroups(); i++) {
+                    const SharedPointer<VertexBuffer> vb = m_model->getSharedVertexBuffer(i, level);
+                    if (vb->getNumberOfIndices() > 0) {
+                        // Unknown materials are replaced by the default one.
+                        Material m;
+                        map<string, Material, wrapper::StringComparator>::const_iterator it = mapOfMaterials.find(m_model->getMaterialName(i));
+                        if (it != mapOfMaterials.end()) {
+                            m = it->second;
                         }
 
+                        // All instances of this model share the geometry.
+                        model->addChild(new Mesh(NodeDescriptor(), vb, m));
                     }
                 }
 
-                clog << "Model contains " << triangleCounter << " triangles." << endl;
+                return model;
+            }
+
+            TransformGroup* OBJXArchive::createRotatedModel(const NodeDescriptor &nd, Node *model) const {
+                // TODO: Why the heck are Wavefront objs rotated around the x axis?
+                TransformGroup *rotatedModel = new TransformGroup();
+                rotatedModel->setRotation(Point3(data::Constants::PI/2.0, 0, 0));
+                rotatedModel->addChild(model);
+
+                TransformGroup *returnableModel = new TransformGroup(nd);
+                returnableModel->addChild(rotatedModel);
 
                 return returnableModel;
             }
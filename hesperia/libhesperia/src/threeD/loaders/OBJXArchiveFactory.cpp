@@ -17,8 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <fstream>
+#include <sstream>
 #include <vector>
 
+#include <zlib.h>
+
 #include "core/macros.h"
 #include "core/base/Lock.h"
 #include "core/exceptions/Exceptions.h"
@@ -28,6 +32,7 @@
 #include "core/wrapper/ImageFactory.h"
 
 #include "core/data/Constants.h"
+#include "hesperia/io/AtomicFileWriter.h"
 #include "hesperia/threeD/loaders/OBJXArchiveFactory.h"
 
 namespace hesperia {
@@ -35,6 +40,7 @@ namespace hesperia {
         namespace loaders {
 
             using namespace std;
+            using namespace core;
             using namespace core::base;
             using namespace core::data;
             using namespace core::exceptions;
@@ -43,7 +49,10 @@ namespace hesperia {
             Mutex OBJXArchiveFactory::m_singletonMutex;
             OBJXArchiveFactory* OBJXArchiveFactory::m_singleton = NULL;
 
-            OBJXArchiveFactory::OBJXArchiveFactory() {}
+            OBJXArchiveFactory::OBJXArchiveFactory() :
+                m_modelsMutex(),
+                m_cacheDirectory(),
+                m_mapOfModels() {}
 
             OBJXArchiveFactory::~OBJXArchiveFactory() {}
 
@@ -58,7 +67,12 @@ namespace hesperia {
                 return (*OBJXArchiveFactory::m_singleton);
             }
 
-            OBJXArchive* OBJXArchiveFactory::getOBJXArchiveFromPlainOBJFile(istream &in) throw (InvalidArgumentException) {
+            void OBJXArchiveFactory::setCacheDirectory(const string &directory) {
+                Lock l(m_modelsMutex);
+                m_cacheDirectory = directory;
+            }
+
+            string OBJXArchiveFactory::readContents(istream &in) throw (InvalidArgumentException) {
                 if (!(in.good())) {
                     // Try to rewind the stream.
                     clog << "Trying to rewind the stream." << endl;
@@ -70,69 +84,141 @@ namespace hesperia {
                     }
                 }
 
-                OBJXArchive *objxArchive = new OBJXArchive();
+                stringstream s;
+                s << in.rdbuf();
+                return s.str();
+            }
+
+            uint32_t OBJXArchiveFactory::getChecksum(const string &contents) {
+                return crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(contents.c_str()), contents.size());
+            }
 
-                char c;
+            const string OBJXArchiveFactory::getCacheFileName(const uint32_t &checksum, const uint32_t &length) const {
                 stringstream s;
-                while (in.good()) {
-                    in.get(c);
-                    s << c;
+                s << m_cacheDirectory << "/" << hex << checksum << dec << "_" << length << ".objc";
+                return s.str();
+            }
+
+            SharedPointer<OBJXModel> OBJXArchiveFactory::getCachedModel(const uint32_t &checksum, const uint32_t &length) {
+                Lock l(m_modelsMutex);
+
+                stringstream key;
+                key << checksum << "_" << length;
+
+                map<string, SharedPointer<OBJXModel> >::iterator it = m_mapOfModels.find(key.str());
+                if (it != m_mapOfModels.end()) {
+                    return it->second;
                 }
-                objxArchive->setContentsOfObjFile(s.str());
 
-                return objxArchive;
+                SharedPointer<OBJXModel> model;
+                if (m_cacheDirectory.length() > 0) {
+                    const string fileName = getCacheFileName(checksum, length);
+                    fstream fin(fileName.c_str(), ios::binary | ios::in);
+                    if (fin.good()) {
+                        SharedPointer<OBJXModel> cachedModel(new OBJXModel());
+                        if (cachedModel->read(fin, checksum, length)) {
+                            clog << "Using cached model " << fileName << "." << endl;
+                            model = cachedModel;
+                            m_mapOfModels[key.str()] = model;
+                        }
+                        else {
+                            clog << "Ignoring invalid cached model " << fileName << "." << endl;
+                        }
+                    }
+                    fin.close();
+                }
+
+                return model;
             }
 
-            OBJXArchive* OBJXArchiveFactory::getOBJXArchive(istream &in) throw (InvalidArgumentException) {
-                if (!(in.good())) {
-                    // Try to rewind the stream.
-                    clog << "Trying to rewind the stream." << endl;
-                    in.clear();
-                    in.seekg(ios::beg);
+            void OBJXArchiveFactory::addModel(const uint32_t &checksum, const uint32_t &length, const SharedPointer<OBJXModel> &model) {
+                Lock l(m_modelsMutex);
 
-                    if (!(in.good())) {
-                        OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "Given inputstream is invalid.");
+                stringstream key;
+                key << checksum << "_" << length;
+                m_mapOfModels[key.str()] = model;
+
+                if (m_cacheDirectory.length() > 0) {
+                    // Other processes may read the cache concurrently.
+                    const string fileName = getCacheFileName(checksum, length);
+                    stringstream out;
+                    model->write(out, checksum, length);
+                    if (!hesperia::io::AtomicFileWriter::write(fileName, out.str())) {
+                        clog << "Could not write cached model " << fileName << "." << endl;
                     }
                 }
+            }
+
+            OBJXArchive* OBJXArchiveFactory::getOBJXArchiveFromPlainOBJFile(istream &in) throw (InvalidArgumentException) {
+                const string contents = readContents(in);
+                const uint32_t checksum = getChecksum(contents);
+
+                SharedPointer<OBJXModel> model = getCachedModel(checksum, contents.size());
+                if (!model.isValid()) {
+                    model = SharedPointer<OBJXModel>(new OBJXModel());
+                    model->parseOBJ(contents.c_str(), contents.size());
+                    addModel(checksum, contents.size(), model);
+                }
+
+                return new OBJXArchive(model);
+            }
+
+            OBJXArchive* OBJXArchiveFactory::getOBJXArchive(istream &in) throw (InvalidArgumentException) {
+                const string contents = readContents(in);
+                const uint32_t checksum = getChecksum(contents);
 
-                OBJXArchive *objxArchive = NULL;
+                SharedPointer<OBJXModel> model = getCachedModel(checksum, contents.size());
 
-                // Use CompressionFactory to read the contents of the OBJXArchive.
-                core::wrapper::DecompressedData *data = core::wrapper::CompressionFactory::getContents(in);
+                // The archive needs to be decompressed for parsing or for loading textures.
+                core::wrapper::DecompressedData *data = NULL;
+                if (!model.isValid() || model->hasTextures()) {
+                    stringstream archive(contents);
+                    data = core::wrapper::CompressionFactory::getContents(archive);
 
+                    if (data == NULL) {
+                        return NULL;
+                    }
+                }
+
+                vector<string> listOfEntries;
                 if (data != NULL) {
-                    // Create OBJXArchive.
-                    objxArchive = new OBJXArchive();
+                    listOfEntries = data->getListOfEntries();
+                }
 
-                    vector<string> listOfEntries = data->getListOfEntries();
-                    vector<string>::iterator it = listOfEntries.begin();
+                if (!model.isValid()) {
+                    model = SharedPointer<OBJXModel>(new OBJXModel());
 
+                    vector<string>::iterator it = listOfEntries.begin();
                     while (it != listOfEntries.end()) {
-                        string entry = (*it++);
+                        const string entry = (*it++);
 
+                        const char *buffer = NULL;
+                        uint32_t length = 0;
                         if (entry.find(".obj") != string::npos) {
-                            // Set object file.
-                            istream *stream = data->getInputStreamFor(entry);
-
-                            char c;
-                            stringstream s;
-                            while (stream->good()) {
-                                stream->get(c);
-                                s << c;
+                            // Parse object file.
+                            if (data->getBufferFor(entry, buffer, length)) {
+                                model->parseOBJ(buffer, length);
                             }
-                            objxArchive->setContentsOfObjFile(s.str());
                         } else if (entry.find(".mtl") != string::npos) {
-                            // Set material file.
-                            istream *stream = data->getInputStreamFor(entry);
-
-                            char c;
-                            stringstream s;
-                            while (stream->good()) {
-                                stream->get(c);
-                                s << c;
+                            // Parse material file.
+                            if (data->getBufferFor(entry, buffer, length)) {
+                                model->parseMTL(buffer, length);
                             }
-                            objxArchive->setContentsOfMtlFile(s.str());
-                        } else {
+                        }
+                    }
+
+                    addModel(checksum, contents.size(), model);
+                }
+
+                // Create OBJXArchive.
+                OBJXArchive *objxArchive = new OBJXArchive(model);
+
+                if (model->hasTextures()) {
+                    vector<string>::iterator it = listOfEntries.begin();
+                    while (it != listOfEntries.end()) {
+                        const string entry = (*it++);
+
+                        if ( (entry.find(".obj") == string::npos) && (entry.find(".mtl") == string::npos) ) {
                             // Try to load an image.
                             istream *stream = data->getInputStreamFor(entry);
 
@@ -153,10 +239,11 @@ namespace hesperia {
                                 }
                             }
                         }
-
                     }
                 }
 
+                OPENDAVINCI_CORE_DELETE_POINTER(data);
+
                 return objxArchive;
             }
 
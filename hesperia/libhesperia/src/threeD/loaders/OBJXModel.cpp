@@ -0,0 +1,569 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <cstring>
+
+#include "core/base/Lock.h"
+#include "core/data/environment/Point3.h"
+#include "hesperia/threeD/loaders/OBJXModel.h"
+
+namespace hesperia {
+    namespace threeD {
+        namespace loaders {
+
+            using namespace std;
+            using namespace core;
+            using namespace core::base;
+            using namespace core::data::environment;
+
+            /**
+             * Edge length of the cubes used for vertex clustering per
+             * level of detail relative to the model's radius.
+             */
+            static const double CELL_SIZE_PER_RADIUS[OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL] = { 0, 1.0/32.0, 1.0/8.0 };
+
+            static inline bool isSpace(const char &c) {
+                return ( (c == ' ') || (c == '\t') || (c == '\r') );
+            }
+
+            static inline void skipSpaces(const char* &p, const char *end) {
+                while ( (p < end) && isSpace(*p) ) {
+                    p++;
+                }
+            }
+
+            static inline void skipLine(const char* &p, const char *end) {
+                while ( (p < end) && (*p != '\n') ) {
+                    p++;
+                }
+                if (p < end) {
+                    p++;
+                }
+            }
+
+            /**
+             * This method returns true if the token equals the given keyword.
+             */
+            static inline bool isKeyword(const char *token, const uint32_t &length, const char *keyword) {
+                return ( (strlen(keyword) == length) && (strncmp(token, keyword, length) == 0) );
+            }
+
+            static inline uint32_t readToken(const char* &p, const char *end, const char* &token) {
+                skipSpaces(p, end);
+                token = p;
+                while ( (p < end) && (*p != '\n') && !isSpace(*p) ) {
+                    p++;
+                }
+                return static_cast<uint32_t>(p - token);
+            }
+
+            static string readRestOfLine(const char* &p, const char *end) {
+                skipSpaces(p, end);
+                const char *begin = p;
+                while ( (p < end) && (*p != '\n') ) {
+                    p++;
+                }
+                const char *last = p;
+                while ( (last > begin) && isSpace(*(last - 1)) ) {
+                    last--;
+                }
+                return string(begin, last);
+            }
+
+            static inline bool readInteger(const char* &p, const char *end, int32_t &value) {
+                skipSpaces(p, end);
+
+                bool negative = false;
+                if ( (p < end) && ( (*p == '-') || (*p == '+') ) ) {
+                    negative = (*p == '-');
+                    p++;
+                }
+
+                const char *begin = p;
+                int32_t v = 0;
+                while ( (p < end) && (*p >= '0') && (*p <= '9') ) {
+                    v = v * 10 + (*p++ - '0');
+                }
+
+                value = (negative ? -v : v);
+                return (p > begin);
+            }
+
+            static inline bool readDouble(const char* &p, const char *end, double &value) {
+                skipSpaces(p, end);
+
+                bool negative = false;
+                if ( (p < end) && ( (*p == '-') || (*p == '+') ) ) {
+                    negative = (*p == '-');
+                    p++;
+                }
+
+                const char *begin = p;
+                double v = 0;
+                while ( (p < end) && (*p >= '0') && (*p <= '9') ) {
+                    v = v * 10 + (*p++ - '0');
+                }
+
+                if ( (p < end) && (*p == '.') ) {
+                    p++;
+                    double fraction = 0;
+                    double scale = 1;
+                    while ( (p < end) && (*p >= '0') && (*p <= '9') ) {
+                        fraction = fraction * 10 + (*p++ - '0');
+                        scale *= 10;
+                    }
+                    v += fraction / scale;
+                }
+
+                if (p == begin) {
+                    return false;
+                }
+
+                if ( (p < end) && ( (*p == 'e') || (*p == 'E') ) ) {
+                    p++;
+                    int32_t exponent = 0;
+                    readInteger(p, end, exponent);
+                    v *= pow(10.0, exponent);
+                }
+
+                value = (negative ? -v : v);
+                return true;
+            }
+
+            static inline Point3 readPoint3(const char* &p, const char *end, const uint32_t &numberOfCoordinates) {
+                double xyz[3] = { 0, 0, 0 };
+                for (uint32_t i = 0; i < numberOfCoordinates; i++) {
+                    readDouble(p, end, xyz[i]);
+                }
+                return Point3(xyz[0], xyz[1], xyz[2]);
+            }
+
+            /**
+             * This method resolves an OBJ index (1-based or negative
+             * relative to the end) into an index of a list of the
+             * given size.
+             */
+            static inline bool resolveIndex(const int32_t &objIndex, const uint32_t &size, uint32_t &index) {
+                if ( (objIndex > 0) && (static_cast<uint32_t>(objIndex) <= size) ) {
+                    index = objIndex - 1;
+                    return true;
+                }
+                if ( (objIndex < 0) && (static_cast<uint32_t>(-objIndex) <= size) ) {
+                    index = size + objIndex;
+                    return true;
+                }
+                return false;
+            }
+
+            static void writeUInt32(ostream &out, const uint32_t &value) {
+                const uint32_t v = htonl(value);
+                out.write(reinterpret_cast<const char*>(&v), sizeof(uint32_t));
+            }
+
+            static uint32_t readUInt32(istream &in) {
+                uint32_t v = 0;
+                in.read(reinterpret_cast<char*>(&v), sizeof(uint32_t));
+                return ntohl(v);
+            }
+
+            static void writeFloat(ostream &out, const double &value) {
+                const float f = static_cast<float>(value);
+                uint32_t v = 0;
+                memcpy(&v, &f, sizeof(uint32_t));
+                writeUInt32(out, v);
+            }
+
+            static double readFloat(istream &in) {
+                const uint32_t v = readUInt32(in);
+                float f = 0;
+                memcpy(&f, &v, sizeof(uint32_t));
+                return f;
+            }
+
+            static void writePoint3(ostream &out, const Point3 &p) {
+                writeFloat(out, p.getX());
+                writeFloat(out, p.getY());
+                writeFloat(out, p.getZ());
+            }
+
+            static Point3 readPoint3(istream &in) {
+                const double x = readFloat(in);
+                const double y = readFloat(in);
+                const double z = readFloat(in);
+                return Point3(x, y, z);
+            }
+
+            static void writeString(ostream &out, const string &s) {
+                writeUInt32(out, s.size());
+                out.write(s.c_str(), s.size());
+            }
+
+            static string readString(istream &in) {
+                const uint32_t length = readUInt32(in);
+                string s;
+                if (length > OBJXModel::MAXIMUM_STRING_LENGTH) {
+                    // Invalidate the stream to reject corrupt lengths.
+                    in.setstate(ios::failbit);
+                }
+                else if ( in.good() && (length > 0) ) {
+                    vector<char> buffer(length);
+                    in.read(&buffer[0], length);
+                    s = string(buffer.begin(), buffer.end());
+                }
+                return s;
+            }
+
+            OBJXModel::OBJXModel() :
+                m_mapOfMaterials(),
+                m_listOfMaterialNames(),
+                m_listOfVertexBuffers(),
+                m_levelsOfDetailMutex(),
+                m_listOfSimplifiedVertexBuffers() {}
+
+            OBJXModel::~OBJXModel() {}
+
+            void OBJXModel::parseMTL(const char *buffer, const uint32_t &length) {
+                const char *p = buffer;
+                const char *end = buffer + length;
+
+                Material m;
+                bool hasMaterial = false;
+                while (p < end) {
+                    const char *token = NULL;
+                    const uint32_t tokenLength = readToken(p, end, token);
+
+                    if (isKeyword(token, tokenLength, "newmtl")) {
+                        // Store previous material description.
+                        if (hasMaterial) {
+                            m_mapOfMaterials[m.getName()] = m;
+                        }
+
+                        // Start next material description.
+                        m = Material(readRestOfLine(p, end));
+                        hasMaterial = true;
+                    }
+                    else if (isKeyword(token, tokenLength, "Ns")) {
+                        double s = 0;
+                        readDouble(p, end, s);
+                        m.setShininess(s);
+                    }
+                    else if (isKeyword(token, tokenLength, "Ka")) {
+                        m.setAmbient(readPoint3(p, end, 3));
+                    }
+                    else if (isKeyword(token, tokenLength, "Kd")) {
+                        m.setDiffuse(readPoint3(p, end, 3));
+                    }
+                    else if (isKeyword(token, tokenLength, "Ks")) {
+                        m.setSpecular(readPoint3(p, end, 3));
+                    }
+                    else if (isKeyword(token, tokenLength, "map_Kd")) {
+                        m.setTextureName(readRestOfLine(p, end));
+                    }
+
+                    skipLine(p, end);
+                }
+
+                if (hasMaterial) {
+                    m_mapOfMaterials[m.getName()] = m;
+                }
+            }
+
+            void OBJXModel::parseOBJ(const char *buffer, const uint32_t &length) {
+                const char *p = buffer;
+                const char *end = buffer + length;
+
+                vector<Point3> listOfVertices;
+                vector<Point3> listOfNormals;
+                vector<Point3> listOfTextureCoordinates;
+
+                // References of the current face's vertices.
+                vector<uint32_t> v;
+                vector<uint32_t> t;
+                vector<uint32_t> n;
+
+                {
+                    Lock l(m_levelsOfDetailMutex);
+                    m_listOfSimplifiedVertexBuffers.clear();
+                }
+
+                // Root group using the default material if no groups are defined.
+                m_listOfMaterialNames.push_back("");
+                m_listOfVertexBuffers.push_back(SharedPointer<VertexBuffer>(new VertexBuffer(VertexBuffer::TRIANGLES)));
+
+                while (p < end) {
+                    const char *token = NULL;
+                    const uint32_t tokenLength = readToken(p, end, token);
+
+                    if (isKeyword(token, tokenLength, "v")) {
+                        listOfVertices.push_back(readPoint3(p, end, 3));
+                    }
+                    else if (isKeyword(token, tokenLength, "vn")) {
+                        listOfNormals.push_back(readPoint3(p, end, 3));
+                    }
+                    else if (isKeyword(token, tokenLength, "vt")) {
+                        listOfTextureCoordinates.push_back(readPoint3(p, end, 2));
+                    }
+                    else if ( isKeyword(token, tokenLength, "g") || isKeyword(token, tokenLength, "usemtl") ) {
+                        const string materialName = isKeyword(token, tokenLength, "g") ? "" : readRestOfLine(p, end);
+
+                        // Reuse the current group if it does not contain any triangles yet.
+                        if (m_listOfVertexBuffers.back()->getNumberOfIndices() > 0) {
+                            m_listOfMaterialNames.push_back(materialName);
+                            m_listOfVertexBuffers.push_back(SharedPointer<VertexBuffer>(new VertexBuffer(VertexBuffer::TRIANGLES)));
+                        }
+                        else {
+                            m_listOfMaterialNames.back() = materialName;
+                        }
+                    }
+                    else if (isKeyword(token, tokenLength, "f")) {
+                        v.clear();
+                        t.clear();
+                        n.clear();
+
+                        bool valid = true;
+                        bool hasTextureCoordinates = true;
+                        skipSpaces(p, end);
+                        while ( (p < end) && (*p != '\n') ) {
+                            // Format is v, v/t, v//n, or v/t/n.
+                            int32_t vertex = 0;
+                            int32_t textureCoordinate = 0;
+                            int32_t normal = 0;
+                            readInteger(p, end, vertex);
+                            if ( (p < end) && (*p == '/') ) {
+                                p++;
+                                readInteger(p, end, textureCoordinate);
+                                if ( (p < end) && (*p == '/') ) {
+                                    p++;
+                                    readInteger(p, end, normal);
+                                }
+                            }
+
+                            uint32_t index = 0;
+                            valid &= resolveIndex(vertex, listOfVertices.size(), index);
+                            v.push_back(index);
+
+                            hasTextureCoordinates &= resolveIndex(textureCoordinate, listOfTextureCoordinates.size(), index);
+                            t.push_back(index);
+
+                            n.push_back(resolveIndex(normal, listOfNormals.size(), index) ? index : listOfNormals.size());
+
+                            // Skip any unknown characters of this vertex.
+                            while ( (p < end) && (*p != '\n') && !isSpace(*p) ) {
+                                p++;
+                            }
+                            skipSpaces(p, end);
+                        }
+
+                        if (valid && (v.size() >= 3)) {
+                            VertexBuffer &vb = *m_listOfVertexBuffers.back();
+
+                            // The face uses the first vertex's normal or the polygon's normal (Newell's method).
+                            if (n[0] < listOfNormals.size()) {
+                                vb.setNormal(listOfNormals[n[0]]);
+                            }
+                            else {
+                                Point3 normal;
+                                for (uint32_t i = 0; i < v.size(); i++) {
+                                    const Point3 &a = listOfVertices[v[i]];
+                                    const Point3 &b = listOfVertices[v[(i + 1) % v.size()]];
+                                    normal += Point3((a.getY() - b.getY()) * (a.getZ() + b.getZ()),
+                                                     (a.getZ() - b.getZ()) * (a.getX() + b.getX()),
+                                                     (a.getX() - b.getX()) * (a.getY() + b.getY()));
+                                }
+                                if (normal.length() > 0) {
+                                    normal.normalize();
+                                }
+                                vb.setNormal(normal);
+                            }
+
+                            const uint32_t first = vb.getNumberOfVertices();
+                            for (uint32_t i = 0; i < v.size(); i++) {
+                                if (hasTextureCoordinates) {
+                                    vb.setTextureCoordinate(listOfTextureCoordinates[t[i]]);
+                                }
+                                vb.addVertex(listOfVertices[v[i]]);
+                            }
+
+                            // Split polygons into triangle fans.
+                            for (uint32_t i = 1; (i + 1) < v.size(); i++) {
+                                vb.addTriangle(first, first + i, first + i + 1);
+                            }
+                        }
+                    }
+
+                    skipLine(p, end);
+                }
+            }
+
+            uint32_t OBJXModel::getNumberOfGroups() const {
+                return m_listOfVertexBuffers.size();
+            }
+
+            const string& OBJXModel::getMaterialName(const uint32_t &index) const {
+                return m_listOfMaterialNames.at(index);
+            }
+
+            const VertexBuffer& OBJXModel::getVertexBuffer(const uint32_t &index) const {
+                return *m_listOfVertexBuffers.at(index);
+            }
+
+            const VertexBuffer& OBJXModel::getVertexBuffer(const uint32_t &index, const uint32_t &level) const {
+                return *getSharedVertexBuffer(index, level);
+            }
+
+            SharedPointer<VertexBuffer> OBJXModel::getSharedVertexBuffer(const uint32_t &index, const uint32_t &level) const {
+                if ( (level == 0) || (level >= OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL) ) {
+                    return m_listOfVertexBuffers.at(index);
+                }
+
+                Lock l(m_levelsOfDetailMutex);
+                if (m_listOfSimplifiedVertexBuffers.empty()) {
+                    // Create all levels at once.
+                    const double radius = getBoundingSphere().getRadius();
+                    m_listOfSimplifiedVertexBuffers.reserve((OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL - 1) * m_listOfVertexBuffers.size());
+                    for (uint32_t i = 1; i < OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL; i++) {
+                        for (uint32_t j = 0; j < m_listOfVertexBuffers.size(); j++) {
+                            m_listOfSimplifiedVertexBuffers.push_back(SharedPointer<VertexBuffer>(new VertexBuffer(m_listOfVertexBuffers[j]->simplify(radius * CELL_SIZE_PER_RADIUS[i]))));
+                        }
+                    }
+                }
+
+                return m_listOfSimplifiedVertexBuffers.at((level - 1) * m_listOfVertexBuffers.size() + index);
+            }
+
+            BoundingSphere OBJXModel::getBoundingSphere() const {
+                BoundingSphere sphere;
+                vector<SharedPointer<VertexBuffer> >::const_iterator it = m_listOfVertexBuffers.begin();
+                while (it != m_listOfVertexBuffers.end()) {
+                    sphere.enclose((*it++)->getBoundingSphere());
+                }
+                return sphere;
+            }
+
+            const map<string, Material, core::wrapper::StringComparator>& OBJXModel::getMaterials() const {
+                return m_mapOfMaterials;
+            }
+
+            bool OBJXModel::hasTextures() const {
+                bool retVal = false;
+                map<string, Material, core::wrapper::StringComparator>::const_iterator it = m_mapOfMaterials.begin();
+                while ( (it != m_mapOfMaterials.end()) && !retVal ) {
+                    retVal = (it->second.getTextureName().length() > 0);
+                    it++;
+                }
+                return retVal;
+            }
+
+            uint32_t OBJXModel::getNumberOfTriangles() const {
+                uint32_t numberOfTriangles = 0;
+                vector<SharedPointer<VertexBuffer> >::const_iterator it = m_listOfVertexBuffers.begin();
+                while (it != m_listOfVertexBuffers.end()) {
+                    numberOfTriangles += (*it++)->getNumberOfIndices() / 3;
+                }
+                return numberOfTriangles;
+            }
+
+            void OBJXModel::write(ostream &out, const uint32_t &checksum, const uint32_t &length) const {
+                writeUInt32(out, OBJXModel::MAGIC_NUMBER);
+                writeUInt32(out, OBJXModel::VERSION);
+                writeUInt32(out, checksum);
+                writeUInt32(out, length);
+
+                writeUInt32(out, m_mapOfMaterials.size());
+                map<string, Material, core::wrapper::StringComparator>::const_iterator it = m_mapOfMaterials.begin();
+                while (it != m_mapOfMaterials.end()) {
+                    const Material &m = (it++)->second;
+                    writeString(out, m.getName());
+                    writeString(out, m.getTextureName());
+                    writeFloat(out, m.getShininess());
+                    writePoint3(out, m.getAmbient());
+                    writePoint3(out, m.getDiffuse());
+                    writePoint3(out, m.getSpecular());
+                }
+
+                writeUInt32(out, m_listOfVertexBuffers.size());
+                for (uint32_t i = 0; i < m_listOfVertexBuffers.size(); i++) {
+                    writeString(out, m_listOfMaterialNames[i]);
+                    m_listOfVertexBuffers[i]->write(out);
+                }
+            }
+
+            bool OBJXModel::read(istream &in, const uint32_t &checksum, const uint32_t &length) {
+                const uint32_t magicNumber = readUInt32(in);
+                const uint32_t version = readUInt32(in);
+                const uint32_t checksumOfArchive = readUInt32(in);
+                const uint32_t lengthOfArchive = readUInt32(in);
+
+                if (!in.good()) {
+                    return false;
+                }
+
+                if ( (magicNumber != OBJXModel::MAGIC_NUMBER) || (version != OBJXModel::VERSION) ) {
+                    clog << "(hesperia::threeD::loaders::OBJXModel) Unknown format or version " << version << "." << endl;
+                    return false;
+                }
+
+                if ( (lengthOfArchive != length) || (checksumOfArchive != checksum) ) {
+                    clog << "(hesperia::threeD::loaders::OBJXModel) Cached model does not match the archive." << endl;
+                    return false;
+                }
+
+                map<string, Material, core::wrapper::StringComparator> mapOfMaterials;
+                const uint32_t numberOfMaterials = readUInt32(in);
+                for (uint32_t i = 0; (i < numberOfMaterials) && in.good(); i++) {
+                    Material m(readString(in));
+                    m.setTextureName(readString(in));
+                    m.setShininess(readFloat(in));
+                    m.setAmbient(readPoint3(in));
+                    m.setDiffuse(readPoint3(in));
+                    m.setSpecular(readPoint3(in));
+                    mapOfMaterials[m.getName()] = m;
+                }
+
+                vector<string> listOfMaterialNames;
+                vector<SharedPointer<VertexBuffer> > listOfVertexBuffers;
+                const uint32_t numberOfGroups = readUInt32(in);
+                for (uint32_t i = 0; (i < numberOfGroups) && in.good(); i++) {
+                    listOfMaterialNames.push_back(readString(in));
+                    listOfVertexBuffers.push_back(SharedPointer<VertexBuffer>(new VertexBuffer()));
+                    if ( in.fail() || !listOfVertexBuffers.back()->read(in) ) {
+                        return false;
+                    }
+                }
+
+                if (in.fail()) {
+                    return false;
+                }
+
+                m_mapOfMaterials.swap(mapOfMaterials);
+                m_listOfMaterialNames.swap(listOfMaterialNames);
+                m_listOfVertexBuffers.swap(listOfVertexBuffers);
+
+                {
+                    Lock l(m_levelsOfDetailMutex);
+                    m_listOfSimplifiedVertexBuffers.clear();
+                }
+
+                return true;
+            }
+
+        }
+    }
+} // hesperia::threeD::loaders
@@ -37,20 +37,45 @@ namespace hesperia {
 
             AerialImageRenderer::AerialImageRenderer(const NodeDescriptor &nodeDescriptor, const uint32_t &textureHandle) :
                     Node(nodeDescriptor),
-                    m_textureHandle(textureHandle) {}
+                    m_textureHandle(textureHandle),
+                    m_quad() {
+                init();
+            }
 
             AerialImageRenderer::AerialImageRenderer(const AerialImageRenderer &obj) :
                     Node(obj.getNodeDescriptor()),
-                    m_textureHandle(obj.m_textureHandle) {}
+                    m_textureHandle(obj.m_textureHandle),
+                    m_quad(obj.m_quad) {}
 
             AerialImageRenderer& AerialImageRenderer::operator=(const AerialImageRenderer &obj) {
                 setNodeDescriptor(obj.getNodeDescriptor());
                 m_textureHandle = obj.m_textureHandle;
+                m_quad = obj.m_quad;
                 return (*this);
             }
 
             AerialImageRenderer::~AerialImageRenderer() {}
 
+            void AerialImageRenderer::init() {
+                VertexBuffer vb(VertexBuffer::TRIANGLES);
+
+                vb.setTextureCoordinate(Point3(0, 0, 0));
+                const uint32_t a = vb.addVertex(Point3(0, 0, 0));
+
+                vb.setTextureCoordinate(Point3(0, 1, 0));
+                const uint32_t b = vb.addVertex(Point3(0, 1, 0));
+
+                vb.setTextureCoordinate(Point3(1, 1, 0));
+                const uint32_t c = vb.addVertex(Point3(1, 1, 0));
+
+                vb.setTextureCoordinate(Point3(1, 0, 0));
+                const uint32_t d = vb.addVertex(Point3(1, 0, 0));
+
+                vb.addQuad(a, b, c, d);
+
+                m_quad.setVertexBuffer(vb);
+            }
+
             void AerialImageRenderer::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
                     glPushMatrix();
@@ -61,19 +86,7 @@ namespace hesperia {
                             glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
                         }
 
-                        glBegin(GL_QUADS);
-                        glTexCoord2f(0, 0);
-                        glVertex3f(0, 0, 0);
-
-                        glTexCoord2f(0, 1);
-                        glVertex3f(0, 1, 0);
-
-                        glTexCoord2f(1, 1);
-                        glVertex3f(1, 1, 0);
-
-                        glTexCoord2f(1, 0);
-                        glVertex3f(1, 0, 0);
-                        glEnd();
+                        m_quad.render(renderingConfiguration);
 
                         if (renderingConfiguration.hasDrawTextures()) {
                             glDisable(GL_TEXTURE_2D);
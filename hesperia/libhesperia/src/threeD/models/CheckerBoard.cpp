@@ -37,19 +37,26 @@ namespace hesperia {
                     Node(nodeDescriptor),
                     m_positionA(Point3(-0.5, 0, 0)),
                     m_positionB(Point3(0.5, 0, 0)),
-                    m_height(0.7) {}
+                    m_height(0.7),
+                    m_squares() {
+                init();
+            }
 
             CheckerBoard::CheckerBoard(const NodeDescriptor &nodeDescriptor, const Point3 &positionA, const Point3 &positionB, const float &height) :
                     Node(nodeDescriptor),
                     m_positionA(positionA),
                     m_positionB(positionB),
-                    m_height(height) {}
+                    m_height(height),
+                    m_squares() {
+                init();
+            }
 
             CheckerBoard::CheckerBoard(const CheckerBoard &obj) :
                     Node(obj.getNodeDescriptor()),
                     m_positionA(obj.m_positionA),
                     m_positionB(obj.m_positionB),
-                    m_height(obj.m_height) {}
+                    m_height(obj.m_height),
+                    m_squares(obj.m_squares) {}
 
             CheckerBoard::~CheckerBoard() {}
 
@@ -58,45 +65,52 @@ namespace hesperia {
                 m_positionA = obj.m_positionA;
                 m_positionB = obj.m_positionB;
                 m_height = obj.m_height;
+                m_squares = obj.m_squares;
                 return (*this);
             }
 
+            void CheckerBoard::init() {
+                VertexBuffer vb(VertexBuffer::TRIANGLES);
+
+                bool color = false;
+                uint32_t squares = 0;
+                double height = 0;
+                while (height < m_height) {
+                    Point3 p = m_positionA;
+                    double d = p.getDistanceTo(m_positionB);
+                    squares = 0;
+                    while (d > 0.1) {
+                        if (color) {
+                            vb.setColor(Point3(1, 1, 1));
+                        } else {
+                            vb.setColor(Point3(0.1, 0.1, 0.1));
+                        }
+
+                        const uint32_t a = vb.addVertex(Point3(p.getX(), p.getY(), height));
+                        const uint32_t b = vb.addVertex(Point3(p.getX(), p.getY(), height + 0.1));
+                        p += Point3(0.1, 0, 0);
+                        const uint32_t c = vb.addVertex(Point3(p.getX(), p.getY(), height + 0.1));
+                        const uint32_t e = vb.addVertex(Point3(p.getX(), p.getY(), height));
+                        vb.addQuad(a, b, c, e);
+
+                        color = !color;
+                        d = p.getDistanceTo(m_positionB);
+                        squares++;
+                    }
+                    if ((squares % 2) == 0) {
+                        color = !color;
+                    }
+                    height += 0.1;
+                }
+
+                m_squares.setVertexBuffer(vb);
+            }
+
             void CheckerBoard::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
                     glPushMatrix();
                     {
-                        bool color = false;
-                        uint32_t squares = 0;
-                        double height = 0;
-                        while (height < m_height) {
-                            Point3 p = m_positionA;
-                            double d = p.getDistanceTo(m_positionB);
-                            squares = 0;
-                            while (d > 0.1) {
-                                if (color) {
-                                    glColor3d(1, 1, 1);
-                                } else {
-                                    glColor3d(0.1, 0.1, 0.1);
-                                }
-
-                                glBegin(GL_QUADS);
-                                {
-                                    glVertex3d(p.getX(), p.getY(), height);
-                                    glVertex3d(p.getX(), p.getY(), height + 0.1);
-                                    p += Point3(0.1, 0, 0);
-                                    glVertex3d(p.getX(), p.getY(), height + 0.1);
-                                    glVertex3d(p.getX(), p.getY(), height);
-                                }
-                                glEnd();
-                                color = !color;
-                                d = p.getDistanceTo(m_positionB);
-                                squares++;
-                            }
-                            if ((squares % 2) == 0) {
-                                color = !color;
-                            }
-                            height += 0.1;
-                        }
+                        m_squares.render(renderingConfiguration);
                     }
 
                     glPopMatrix();
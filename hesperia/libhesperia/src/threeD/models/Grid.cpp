@@ -30,15 +30,21 @@ namespace hesperia {
     namespace threeD {
         namespace models {
 
+            using namespace core::data::environment;
+
             Grid::Grid(const NodeDescriptor &nodeDescriptor, const uint32_t &size, const float &lineWidth) :
                     Node(nodeDescriptor),
                     m_size(size),
-                    m_lineWidth(lineWidth) {}
+                    m_lineWidth(lineWidth),
+                    m_lines() {
+                init();
+            }
 
             Grid::Grid(const Grid &obj) :
                     Node(obj.getNodeDescriptor()),
                     m_size(obj.m_size),
-                    m_lineWidth(obj.m_lineWidth) {}
+                    m_lineWidth(obj.m_lineWidth),
+                    m_lines(obj.m_lines) {}
 
             Grid::~Grid() {}
 
@@ -46,9 +52,29 @@ namespace hesperia {
                 setNodeDescriptor(obj.getNodeDescriptor()),
                 m_size = obj.m_size;
                 m_lineWidth = obj.m_lineWidth;
+                m_lines = obj.m_lines;
                 return (*this);
             }
 
+            void Grid::init() {
+                VertexBuffer vb(VertexBuffer::LINES);
+
+                const double size = m_size;
+                for (int32_t i = -static_cast<int32_t>(m_size); i <= static_cast<int32_t>(m_size); i++) {
+                    // Line parallel to the X-axis.
+                    const uint32_t a = vb.addVertex(Point3(-size, i, 0));
+                    const uint32_t b = vb.addVertex(Point3(size, i, 0));
+                    vb.addLine(a, b);
+
+                    // Line parallel to the Y-axis.
+                    const uint32_t c = vb.addVertex(Point3(i, -size, 0));
+                    const uint32_t d = vb.addVertex(Point3(i, size, 0));
+                    vb.addLine(c, d);
+                }
+
+                m_lines.setVertexBuffer(vb);
+            }
+
             void Grid::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
                     glPushMatrix();
@@ -56,20 +82,7 @@ namespace hesperia {
                         glLineWidth(m_lineWidth);
                         glColor3f(1, 1, 1);
 
-                        glBegin(GL_LINES);
-                        int32_t size = m_size;
-                        for (int32_t y = -size; y <= size; y++) {
-                            for (int32_t x = -size; x <= size; x++) {
-                                // X-axis.
-                                glVertex3f(0, static_cast<float>(y), 0);
-                                glVertex3f(static_cast<float>(x), static_cast<float>(y), 0);
-
-                                // Y-axis.
-                                glVertex3f(static_cast<float>(x), 0, 0);
-                                glVertex3f(static_cast<float>(x), static_cast<float>(y), 0);
-                            }
-                        }
-                        glEnd();
+                        m_lines.render(renderingConfiguration);
 
                         glLineWidth(1);
                     }
@@ -54,10 +54,15 @@ namespace hesperia {
                 m_positionB = obj.m_positionB;
                 m_color = obj.m_color;
                 m_width = obj.m_width;
+                invalidateBoundingSphere();
 
                 return (*this);
             }
 
+            BoundingSphere Line::computeBoundingSphere() const {
+                return BoundingSphere((m_positionA + m_positionB) * 0.5, (m_positionB - m_positionA).length() / 2.0);
+            }
+
             void Line::render(RenderingConfiguration &renderingConfiguration) {
                 // Render if unnamed or not disabled.
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
@@ -0,0 +1,329 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <sstream>
+#include <string>
+
+// The following include is necessary on Win32 platforms to set up necessary macro definitions.
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+// Declare the OpenGL 1.5 buffer object functions.
+#ifndef WIN32
+#define GL_GLEXT_PROTOTYPES
+#endif
+#include <GL/gl.h>
+#ifndef WIN32
+#include <GL/glext.h>
+#endif
+
+#include "hesperia/threeD/models/Mesh.h"
+
+namespace hesperia {
+    namespace threeD {
+        namespace models {
+
+            using namespace std;
+            using namespace core::data::environment;
+
+            /**
+             * Returns true if the current OpenGL context supports vertex
+             * buffer objects (OpenGL 1.5 or GL_ARB_vertex_buffer_object).
+             */
+            static bool hasVertexBufferObjects() {
+#ifdef WIN32
+                // opengl32.dll only exports OpenGL 1.1; use client-side vertex arrays.
+                return false;
+#else
+                const char *version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+                const char *extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+                if (version == NULL) {
+                    return false;
+                }
+
+                uint32_t major = 0;
+                uint32_t minor = 0;
+                char dot = 0;
+                stringstream sstr(version);
+                sstr >> major >> dot >> minor;
+
+                return ( (major > 1) || ( (major == 1) && (minor >= 5) ) ) ||
+                       ( (extensions != NULL) && (string(extensions).find("GL_ARB_vertex_buffer_object") != string::npos) );
+#endif
+            }
+
+            Mesh::Mesh() :
+                    Node(),
+                    m_material(),
+                    m_hasMaterial(false),
+                    m_vertexBuffer(new VertexBuffer()),
+                    m_uploaded(false),
+                    m_vertexBufferObject(0),
+                    m_indexBufferObject(0) {}
+
+            Mesh::Mesh(const NodeDescriptor &nodeDescriptor) :
+                    Node(nodeDescriptor),
+                    m_material(),
+                    m_hasMaterial(false),
+                    m_vertexBuffer(new VertexBuffer()),
+                    m_uploaded(false),
+                    m_vertexBufferObject(0),
+                    m_indexBufferObject(0) {}
+
+            Mesh::Mesh(const NodeDescriptor &nodeDescriptor, const VertexBuffer &vertexBuffer) :
+                    Node(nodeDescriptor),
+                    m_material(),
+                    m_hasMaterial(false),
+                    m_vertexBuffer(new VertexBuffer(vertexBuffer)),
+                    m_uploaded(false),
+                    m_vertexBufferObject(0),
+                    m_indexBufferObject(0) {}
+
+            Mesh::Mesh(const NodeDescriptor &nodeDescriptor, const VertexBuffer &vertexBuffer, const Material &material) :
+                    Node(nodeDescriptor),
+                    m_material(material),
+                    m_hasMaterial(true),
+                    m_vertexBuffer(new VertexBuffer(vertexBuffer)),
+                    m_uploaded(false),
+                    m_vertexBufferObject(0),
+                    m_indexBufferObject(0) {}
+
+            Mesh::Mesh(const NodeDescriptor &nodeDescriptor, const core::SharedPointer<VertexBuffer> &vertexBuffer, const Material &material) :
+                    Node(nodeDescriptor),
+                    m_material(material),
+                    m_hasMaterial(true),
+                    m_vertexBuffer(vertexBuffer),
+                    m_uploaded(false),
+                    m_vertexBufferObject(0),
+                    m_indexBufferObject(0) {}
+
+            Mesh::Mesh(const Mesh &obj) :
+                    Node(obj.getNodeDescriptor()),
+                    m_material(obj.m_material),
+                    m_hasMaterial(obj.m_hasMaterial),
+                    m_vertexBuffer(obj.m_vertexBuffer),
+                    m_uploaded(false),
+                    m_vertexBufferObject(0),
+                    m_indexBufferObject(0) {}
+
+            Mesh::~Mesh() {
+                release();
+            }
+
+            Mesh& Mesh::operator=(const Mesh &obj) {
+                setNodeDescriptor(obj.getNodeDescriptor());
+                m_material = obj.m_material;
+                m_hasMaterial = obj.m_hasMaterial;
+                m_vertexBuffer = obj.m_vertexBuffer;
+                release();
+                invalidateBoundingSphere();
+
+                return (*this);
+            }
+
+            void Mesh::setMaterial(const Material &material) {
+                m_material = material;
+                m_hasMaterial = true;
+            }
+
+            bool Mesh::hasMaterial() const {
+                return m_hasMaterial;
+            }
+
+            const Material& Mesh::getMaterial() const {
+                return m_material;
+            }
+
+            void Mesh::setVertexBuffer(const VertexBuffer &vertexBuffer) {
+                m_vertexBuffer = core::SharedPointer<VertexBuffer>(new VertexBuffer(vertexBuffer));
+                release();
+                invalidateBoundingSphere();
+            }
+
+            const VertexBuffer& Mesh::getVertexBuffer() const {
+                return *m_vertexBuffer;
+            }
+
+            VertexBuffer& Mesh::getVertexBufferForModification() {
+                release();
+                invalidateBoundingSphere();
+                if (m_vertexBuffer.getReferenceCount() > 1) {
+                    // Copy on write: other meshes or the model cache still use this geometry.
+                    m_vertexBuffer = core::SharedPointer<VertexBuffer>(new VertexBuffer(*m_vertexBuffer));
+                }
+                return *m_vertexBuffer;
+            }
+
+            BoundingSphere Mesh::computeBoundingSphere() const {
+                return m_vertexBuffer->getBoundingSphere();
+            }
+
+            void Mesh::upload() {
+                m_uploaded = true;
+
+#ifndef WIN32
+                if ( (m_vertexBuffer->getNumberOfIndices() > 0) && hasVertexBufferObjects() ) {
+                    glGenBuffers(1, &m_vertexBufferObject);
+                    glBindBuffer(GL_ARRAY_BUFFER, m_vertexBufferObject);
+                    glBufferData(GL_ARRAY_BUFFER, m_vertexBuffer->getNumberOfVertices() * VertexBuffer::FLOATS_PER_VERTEX * sizeof(float), m_vertexBuffer->getVertexData(), GL_STATIC_DRAW);
+
+                    glGenBuffers(1, &m_indexBufferObject);
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBufferObject);
+                    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_vertexBuffer->getNumberOfIndices() * sizeof(uint32_t), m_vertexBuffer->getIndexData(), GL_STATIC_DRAW);
+
+                    glBindBuffer(GL_ARRAY_BUFFER, 0);
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                }
+#endif
+            }
+
+            void Mesh::release() {
+#ifndef WIN32
+                if (m_vertexBufferObject != 0) {
+                    glDeleteBuffers(1, &m_vertexBufferObject);
+                }
+                if (m_indexBufferObject != 0) {
+                    glDeleteBuffers(1, &m_indexBufferObject);
+                }
+#endif
+                m_vertexBufferObject = 0;
+                m_indexBufferObject = 0;
+                m_uploaded = false;
+            }
+
+            bool Mesh::applyMaterial(const RenderingConfiguration &renderingConfiguration) const {
+                bool textureEnabled = false;
+
+                // Try to load an apropriate texture.
+                const int32_t textureHandle = m_material.getTextureHandle();
+                if (textureHandle > 0) {
+                    if (renderingConfiguration.hasDrawTextures()) {
+                        glEnable(GL_TEXTURE_2D);
+                        glBindTexture(GL_TEXTURE_2D, static_cast<uint32_t>(textureHandle));
+                        glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
+                        textureEnabled = true;
+                    }
+                }
+                else {
+                    glEnable(GL_COLOR_MATERIAL);
+                    glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+                    float ambient[] = { static_cast<float>(m_material.getAmbient().getX()),
+                                        static_cast<float>(m_material.getAmbient().getY()),
+                                        static_cast<float>(m_material.getAmbient().getZ()) };
+
+                    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ambient);
+
+                    float diffuse[] = { static_cast<float>(m_material.getDiffuse().getX()),
+                                        static_cast<float>(m_material.getDiffuse().getY()),
+                                        static_cast<float>(m_material.getDiffuse().getZ()) };
+
+                    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse);
+
+                    float specular[] = { static_cast<float>(m_material.getSpecular().getX()),
+                                         static_cast<float>(m_material.getSpecular().getY()),
+                                         static_cast<float>(m_material.getSpecular().getZ()) };
+
+                    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular);
+
+                    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, static_cast<float>(m_material.getShininess()));
+
+                    glColor3d(m_material.getDiffuse().getX(), m_material.getDiffuse().getY(), m_material.getDiffuse().getZ());
+                }
+
+                return textureEnabled;
+            }
+
+            void Mesh::draw() {
+                if (m_vertexBuffer->getNumberOfIndices() == 0) {
+                    return;
+                }
+
+                if (!m_uploaded) {
+                    upload();
+                }
+
+                // Offsets are relative to the bound buffer object or to the client-side data.
+                const char *vertices = reinterpret_cast<const char*>(m_vertexBuffer->getVertexData());
+                const char *indices = reinterpret_cast<const char*>(m_vertexBuffer->getIndexData());
+#ifndef WIN32
+                if (m_vertexBufferObject != 0) {
+                    glBindBuffer(GL_ARRAY_BUFFER, m_vertexBufferObject);
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBufferObject);
+                    vertices = NULL;
+                    indices = NULL;
+                }
+#endif
+
+                const int32_t stride = VertexBuffer::FLOATS_PER_VERTEX * sizeof(float);
+
+                glEnableClientState(GL_VERTEX_ARRAY);
+                glVertexPointer(3, GL_FLOAT, stride, vertices + VertexBuffer::POSITION * sizeof(float));
+
+                if (m_vertexBuffer->hasNormals()) {
+                    glEnableClientState(GL_NORMAL_ARRAY);
+                    glNormalPointer(GL_FLOAT, stride, vertices + VertexBuffer::NORMAL * sizeof(float));
+                }
+                if (m_vertexBuffer->hasTextureCoordinates()) {
+                    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+                    glTexCoordPointer(2, GL_FLOAT, stride, vertices + VertexBuffer::TEXTURECOORDINATE * sizeof(float));
+                }
+                if (m_vertexBuffer->hasColors()) {
+                    glEnableClientState(GL_COLOR_ARRAY);
+                    glColorPointer(3, GL_FLOAT, stride, vertices + VertexBuffer::COLOR * sizeof(float));
+                }
+
+                const GLenum mode = (m_vertexBuffer->getPrimitive() == VertexBuffer::LINES) ? GL_LINES : GL_TRIANGLES;
+                glDrawElements(mode, m_vertexBuffer->getNumberOfIndices(), GL_UNSIGNED_INT, indices);
+
+                glDisableClientState(GL_COLOR_ARRAY);
+                glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+                glDisableClientState(GL_NORMAL_ARRAY);
+                glDisableClientState(GL_VERTEX_ARRAY);
+
+#ifndef WIN32
+                if (m_vertexBufferObject != 0) {
+                    glBindBuffer(GL_ARRAY_BUFFER, 0);
+                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                }
+#endif
+            }
+
+            void Mesh::render(RenderingConfiguration &renderingConfiguration) {
+                if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
+                    glPushMatrix();
+                    {
+                        bool textureEnabled = false;
+                        if (m_hasMaterial) {
+                            textureEnabled = applyMaterial(renderingConfiguration);
+                        }
+
+                        draw();
+
+                        if (textureEnabled) {
+                            glDisable(GL_TEXTURE_2D);
+                        }
+                    }
+                    glPopMatrix();
+                }
+            }
+
+        }
+    }
+} // hesperia::threeD::models
@@ -51,10 +51,15 @@ namespace hesperia {
                 m_position = obj.m_position;
                 m_color = obj.m_color;
                 m_width = obj.m_width;
+                invalidateBoundingSphere();
 
                 return (*this);
             }
 
+            BoundingSphere Point::computeBoundingSphere() const {
+                return BoundingSphere(m_position, 0);
+            }
+
             void Point::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
                     glPushMatrix();
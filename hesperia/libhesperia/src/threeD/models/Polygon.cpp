@@ -58,9 +58,34 @@ namespace hesperia {
                 m_listOfGroundVertices = obj.m_listOfGroundVertices;
                 m_color = obj.m_color;
                 m_height = obj.m_height;
+                invalidateBoundingSphere();
                 return (*this);
             }
 
+            BoundingSphere Polygon::computeBoundingSphere() const {
+                if (m_listOfGroundVertices.empty()) {
+                    return BoundingSphere();
+                }
+
+                // Walls are drawn from the ground up to m_height.
+                double minX = m_listOfGroundVertices[0].getX(), maxX = minX;
+                double minY = m_listOfGroundVertices[0].getY(), maxY = minY;
+                vector<Point3>::const_iterator it = m_listOfGroundVertices.begin();
+                while (it != m_listOfGroundVertices.end()) {
+                    const Point3 &p = (*it++);
+                    minX = (p.getX() < minX) ? p.getX() : minX;
+                    maxX = (p.getX() > maxX) ? p.getX() : maxX;
+                    minY = (p.getY() < minY) ? p.getY() : minY;
+                    maxY = (p.getY() > maxY) ? p.getY() : maxY;
+                }
+                const double minZ = (m_height < 0) ? m_height : 0;
+                const double maxZ = (m_height > 0) ? m_height : 0;
+
+                const Point3 minimum(minX, minY, minZ);
+                const Point3 maximum(maxX, maxY, maxZ);
+                return BoundingSphere((minimum + maximum) * 0.5, (maximum - minimum).length() / 2.0);
+            }
+
             void Polygon::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
                     glPushMatrix();
@@ -17,13 +17,6 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-// The following include is necessary on Win32 platforms to set up necessary macro definitions.
-#ifdef WIN32
-#include <windows.h>
-#endif
-
-#include <GL/gl.h>
-
 #include "hesperia/threeD/models/TriangleSet.h"
 
 namespace hesperia {
@@ -33,147 +26,43 @@ namespace hesperia {
             using namespace core::data::environment;
 
             TriangleSet::TriangleSet() :
-                    Node(),
-                    m_compiled(false),
-                    m_callList(0),
-                    m_material(),
-                    m_vertices(),
-                    m_normals(),
-                    m_textureCoordinates() {}
+                    Mesh(NodeDescriptor(), VertexBuffer(VertexBuffer::TRIANGLES), Material()) {}
 
             TriangleSet::TriangleSet(const NodeDescriptor &nodeDescriptor) :
-                    Node(nodeDescriptor),
-                    m_compiled(false),
-                    m_callList(0),
-                    m_material(),
-                    m_vertices(),
-                    m_normals(),
-                    m_textureCoordinates() {}
+                    Mesh(nodeDescriptor, VertexBuffer(VertexBuffer::TRIANGLES), Material()) {}
 
             TriangleSet::TriangleSet(const TriangleSet &obj) :
-                    Node(obj.getNodeDescriptor()),
-                    m_compiled(obj.m_compiled),
-                    m_callList(obj.m_callList),
-                    m_material(obj.m_material),
-                    m_vertices(obj.m_vertices),
-                    m_normals(obj.m_normals),
-                    m_textureCoordinates(obj.m_textureCoordinates) {}
+                    Mesh(obj) {}
 
             TriangleSet::~TriangleSet() {}
 
             TriangleSet& TriangleSet::operator=(const TriangleSet &obj) {
-                setNodeDescriptor(obj.getNodeDescriptor());
-                m_compiled = obj.m_compiled;
-                m_callList = obj.m_callList;
-                m_material = obj.m_material;
-                m_vertices = obj.m_vertices;
-                m_normals = obj.m_normals;
-                m_textureCoordinates = obj.m_textureCoordinates;
+                Mesh::operator=(obj);
 
                 return (*this);
             }
 
             void TriangleSet::addTriangle(const Triangle &triangle) {
-                vector<Point3> vertices = triangle.getVertices();
-                m_vertices.insert(m_vertices.end(), vertices.begin(), vertices.end());
-
-                m_normals.push_back(triangle.getNormal());
+                VertexBuffer &vb = getVertexBufferForModification();
 
-                vector<Point3> textureCoordinates = triangle.getTextureCoordinates();
-                m_textureCoordinates.insert(m_textureCoordinates.end(), textureCoordinates.begin(), textureCoordinates.end());
-            }
-
-            void TriangleSet::setMaterial(const Material &material) {
-                m_material = material;
-            }
+                const vector<Point3> vertices = triangle.getVertices();
+                const vector<Point3> textureCoordinates = triangle.getTextureCoordinates();
 
-            void TriangleSet::compile() const {
-                m_callList = glGenLists(1);
-                glNewList(m_callList, GL_COMPILE);
+                vb.setNormal(triangle.getNormal());
 
-                uint32_t normalIndexCounter = 0;
-                glBegin(GL_TRIANGLES);
-                for (uint32_t i = 0; i < m_vertices.size(); i++) {
-                    if (i < m_textureCoordinates.size()) {
-                        glTexCoord2d(m_textureCoordinates[i].getX(), m_textureCoordinates[i].getY());
+                uint32_t indices[3] = { 0, 0, 0 };
+                for (uint32_t i = 0; (i < vertices.size()) && (i < 3); i++) {
+                    if (i < textureCoordinates.size()) {
+                        vb.setTextureCoordinate(textureCoordinates[i]);
                     }
-                    if ((i % 3) == 0) {
-                        if (normalIndexCounter < m_normals.size()) {
-                            glNormal3d(m_normals[normalIndexCounter].getX(), m_normals[normalIndexCounter].getY(), m_normals[normalIndexCounter].getZ());
-                        }
-                        normalIndexCounter++;
-                    }
-                    glVertex3d(m_vertices[i].getX(), m_vertices[i].getY(), m_vertices[i].getZ());
+                    indices[i] = vb.addVertex(vertices[i]);
                 }
-                glEnd();
-
-
-                glEndList();
-                m_compiled = true;
-            }
-
-
-            void TriangleSet::render(RenderingConfiguration &renderingConfiguration) {
-                if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        // Try to load an apropriate texture.
-                        int32_t textureHandle = m_material.getTextureHandle();
 
-                        if (textureHandle > 0) {
-                            if (renderingConfiguration.hasDrawTextures()) {
-                                glEnable(GL_TEXTURE_2D);
-                                glBindTexture(GL_TEXTURE_2D, static_cast<uint32_t>(textureHandle));
-                                glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
-                            }
-                        }
-                        else {
-                            glEnable(GL_COLOR_MATERIAL);
-                            glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
-                            float ambient[] = { static_cast<float>(m_material.getAmbient().getX()),
-                                                static_cast<float>(m_material.getAmbient().getY()),
-                                                static_cast<float>(m_material.getAmbient().getZ()) };
-//                            float ambient[] = { 0,
-//                                                0,
-//                                                0
-//                                              };
-
-                            glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ambient);
-
-                            float diffuse[] = { static_cast<float>(m_material.getDiffuse().getX()),
-                                                static_cast<float>(m_material.getDiffuse().getY()),
-                                                static_cast<float>(m_material.getDiffuse().getZ())
-                                              };
-
-                            glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse);
-
-                            float specular[] = { static_cast<float>(m_material.getSpecular().getX()),
-                                                static_cast<float>(m_material.getSpecular().getY()),
-                                                static_cast<float>(m_material.getSpecular().getZ()) };
-
-                            glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular);
-
-                            glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, static_cast<float>(m_material.getShininess()));
-
-                            glColor3d(m_material.getDiffuse().getX(), m_material.getDiffuse().getY(), m_material.getDiffuse().getZ());
-                        }
-
-                        // Use compiled lists.
-                        if (!m_compiled) {
-                            compile();
-                        }
-
-                        glCallList(m_callList);
-
-                        if (textureHandle) {
-                            if (renderingConfiguration.hasDrawTextures()) {
-                                glDisable(GL_TEXTURE_2D);
-                            }
-                        }
-                    }
-                    glPopMatrix();
+                if (vertices.size() >= 3) {
+                    vb.addTriangle(indices[0], indices[1], indices[2]);
                 }
             }
+
         }
     }
 } // hesperia::threeD::models
@@ -0,0 +1,223 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_DIRECTEDGRAPHTESTSUITE_H_
+#define HESPERIA_DIRECTEDGRAPHTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "core/data/environment/Point3.h"
+#include "core/wrapper/TimeFactory.h"
+#include "core/wrapper/graph/DirectedGraph.h"
+#include "hesperia/data/graph/WaypointVertex.h"
+#include "hesperia/data/graph/WaypointsEdge.h"
+
+using namespace std;
+using namespace core::data::environment;
+using namespace core::wrapper::graph;
+using namespace hesperia::data::graph;
+
+class DirectedGraphTest : public CxxTest::TestSuite {
+    public:
+        enum {
+            SIZE = 15
+        };
+
+        WaypointVertex* createVertex(const uint32_t &row, const uint32_t &column) {
+            WaypointVertex *v = new WaypointVertex();
+            v->setLayerID(row);
+            v->setWaypointID(column);
+            v->setPosition(Point3(column * 10, row * 10, 0));
+            return v;
+        }
+
+        void addEdge(DirectedGraph &g, vector<vector<double> > &costs, const uint32_t &r1, const uint32_t &c1, const uint32_t &r2, const uint32_t &c2, const double &c) {
+            WaypointsEdge *edge = new WaypointsEdge();
+            edge->setCosts(c);
+            g.updateEdge(createVertex(r1, c1), createVertex(r2, c2), edge);
+            costs[r1 * SIZE + c1][r2 * SIZE + c2] = c;
+        }
+
+        // Creates a grid with one-way rows and costs varying between the edges.
+        void createGrid(DirectedGraph &g, vector<vector<double> > &costs) {
+            costs.assign(SIZE * SIZE, vector<double>(SIZE * SIZE, -1));
+            for (uint32_t r = 0; r < SIZE; r++) {
+                for (uint32_t c = 0; c < SIZE; c++) {
+                    const double weight = 10 + ((r * 7 + c * 13) % 11);
+                    if (c + 1 < SIZE) {
+                        addEdge(g, costs, r, c, r, c + 1, weight);
+                        if (r % 3 != 1) {
+                            addEdge(g, costs, r, c + 1, r, c, weight + 2);
+                        }
+                    }
+                    if (r + 1 < SIZE) {
+                        addEdge(g, costs, r, c, r + 1, c, weight + 1);
+                        addEdge(g, costs, r + 1, c, r, c, weight + 3);
+                    }
+                }
+            }
+        }
+
+        // Bellman-Ford on the adjacency matrix as reference.
+        vector<double> getReferenceDistances(const vector<vector<double> > &costs, const uint32_t &source) {
+            const double INF = numeric_limits<double>::max();
+            vector<double> d(costs.size(), INF);
+            d[source] = 0;
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (uint32_t u = 0; u < costs.size(); u++) {
+                    for (uint32_t v = 0; (d[u] < INF) && (v < costs.size()); v++) {
+                        if ( (costs[u][v] >= 0) && (d[u] + costs[u][v] < d[v] - 1e-9) ) {
+                            d[v] = d[u] + costs[u][v];
+                            changed = true;
+                        }
+                    }
+                }
+            }
+            return d;
+        }
+
+        double getCosts(const vector<vector<double> > &costs, const vector<const Vertex*> &route) {
+            double sum = 0;
+            for (uint32_t i = 1; i < route.size(); i++) {
+                const uint32_t u = route[i - 1]->getIdentifier() / 100000 * SIZE + route[i - 1]->getIdentifier() % 100000;
+                const uint32_t v = route[i]->getIdentifier() / 100000 * SIZE + route[i]->getIdentifier() % 100000;
+                if (costs[u][v] < 0) {
+                    return -1;
+                }
+                sum += costs[u][v];
+            }
+            return sum;
+        }
+
+        void testShortestPath() {
+            DirectedGraph g;
+            vector<vector<double> > costs;
+            createGrid(g, costs);
+
+            WaypointVertex *start = createVertex(0, 0);
+            WaypointVertex *end = createVertex(SIZE - 1, SIZE - 1);
+
+            vector<const Vertex*> route = g.getShortestPath(*start, *end);
+            TS_ASSERT(route.size() > 1);
+            TS_ASSERT(route.front()->getIdentifier() == start->getIdentifier());
+            TS_ASSERT(route.back()->getIdentifier() == end->getIdentifier());
+
+            const vector<double> reference = getReferenceDistances(costs, 0);
+            TS_ASSERT_DELTA(getCosts(costs, route), reference[SIZE * SIZE - 1], 1e-6);
+
+            // Route to itself.
+            route = g.getShortestPath(*start, *start);
+            TS_ASSERT(route.size() == 1);
+
+            // Unknown vertex.
+            WaypointVertex *unknown = createVertex(SIZE + 1, 0);
+            TS_ASSERT(g.getShortestPath(*start, *unknown).empty());
+
+            // Unreachable vertex.
+            WaypointsEdge *edge = new WaypointsEdge();
+            edge->setCosts(1);
+            g.updateEdge(createVertex(SIZE + 2, 0), createVertex(SIZE + 3, 0), edge);
+            WaypointVertex *isolated = createVertex(SIZE + 2, 0);
+            TS_ASSERT(g.getShortestPath(*start, *isolated).empty());
+
+            delete start;
+            delete end;
+            delete unknown;
+            delete isolated;
+        }
+
+        void testParallelEdges() {
+            DirectedGraph g;
+            const double COSTS[3] = { 20, 5, 30 };
+            for (uint32_t i = 0; i < 3; i++) {
+                WaypointsEdge *edge = new WaypointsEdge();
+                edge->setCosts(COSTS[i]);
+                g.updateEdge(createVertex(0, 0), createVertex(0, 1), edge);
+            }
+
+            // Only the cheapest of several edges between the same vertices is used.
+            vector<const Vertex*> vertices;
+            vertices.push_back(createVertex(0, 0));
+            vertices.push_back(createVertex(0, 1));
+            const vector<vector<double> > distances = g.getDistances(vertices, vertices);
+            TS_ASSERT_DELTA(distances[0][1], 5, 1e-9);
+
+            vector<const Vertex*>::iterator it = vertices.begin();
+            while (it != vertices.end()) {
+                delete (*it++);
+            }
+        }
+
+        void testShortestPathsAndDistances() {
+            DirectedGraph g;
+            vector<vector<double> > costs;
+            createGrid(g, costs);
+
+            vector<const Vertex*> vertices;
+            for (uint32_t i = 0; i < SIZE * SIZE; i += 7) {
+                vertices.push_back(createVertex(i / SIZE, i % SIZE));
+            }
+
+            const vector<vector<double> > distances = g.getDistances(vertices, vertices);
+            TS_ASSERT(distances.size() == vertices.size());
+
+            bool correct = true;
+            for (uint32_t i = 0; i < vertices.size(); i++) {
+                const vector<double> reference = getReferenceDistances(costs, i * 7);
+                const vector<vector<const Vertex*> > routes = g.getShortestPaths(*vertices[i], vertices);
+
+                for (uint32_t j = 0; j < vertices.size(); j++) {
+                    correct &= (fabs(distances[i][j] - reference[j * 7]) < 1e-6);
+                    correct &= (fabs(getCosts(costs, routes[j]) - reference[j * 7]) < 1e-6);
+
+                    // A* must find a path as short as Dijkstra.
+                    const vector<const Vertex*> route = g.getShortestPath(*vertices[i], *vertices[j]);
+                    correct &= (fabs(getCosts(costs, route) - reference[j * 7]) < 1e-6);
+                }
+            }
+            TS_ASSERT(correct);
+
+            core::wrapper::TimeFactory &tf = core::wrapper::TimeFactory::getInstance();
+            const int64_t start = tf.getMonotonicNanoseconds();
+            uint32_t numberOfQueries = 0;
+            for (uint32_t i = 0; i < vertices.size(); i++) {
+                for (uint32_t j = 0; j < vertices.size(); j++) {
+                    g.getShortestPath(*vertices[i], *vertices[j]);
+                    numberOfQueries++;
+                }
+            }
+            const int64_t duration = tf.getMonotonicNanoseconds() - start;
+            clog << "[DirectedGraphTest] " << numberOfQueries << " queries on " << SIZE * SIZE << " vertices in " << duration/1000 << " us." << endl;
+
+            vector<const Vertex*>::iterator it = vertices.begin();
+            while (it != vertices.end()) {
+                delete (*it++);
+            }
+        }
+};
+
+#endif /*HESPERIA_DIRECTEDGRAPHTESTSUITE_H_*/
@@ -0,0 +1,241 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_FLATPOLYGONTESTSUITE_H_
+#define HESPERIA_FLATPOLYGONTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "core/data/Constants.h"
+#include "core/data/environment/Point3.h"
+#include "core/wrapper/TimeFactory.h"
+#include "hesperia/data/environment/FlatPolygon.h"
+#include "hesperia/data/environment/Polygon.h"
+
+using namespace std;
+using namespace core::data;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+
+class FlatPolygonTest : public CxxTest::TestSuite {
+    public:
+        Polygon createCircle(const double &radius, const uint32_t &numberOfVertices) {
+            Polygon p;
+            for (uint32_t i = 0; i < numberOfVertices; i++) {
+                const double angle = (2 * Constants::PI * i) / numberOfVertices;
+                p.add(Point3(radius * cos(angle), radius * sin(angle), 0));
+            }
+            return p;
+        }
+
+        void testConversion() {
+            Polygon p;
+            p.add(Point3(0, 0, 1));
+            p.add(Point3(2, 0, 2));
+            p.add(Point3(2, 3, 3));
+
+            FlatPolygon fp(p);
+            TS_ASSERT(fp.getSize() == 3);
+            TS_ASSERT_DELTA(fp.getX()[1], 2, 1e-9);
+            TS_ASSERT_DELTA(fp.getY()[2], 3, 1e-9);
+
+            double minX = 0, minY = 0, maxX = 0, maxY = 0;
+            TS_ASSERT(fp.getBoundingBox(minX, minY, maxX, maxY));
+            TS_ASSERT_DELTA(maxX, 2, 1e-9);
+            TS_ASSERT_DELTA(maxY, 3, 1e-9);
+
+            Polygon p2 = fp.toPolygon();
+            TS_ASSERT(p2.getSize() == 3);
+
+            FlatPolygon empty;
+            TS_ASSERT(empty.getX() == NULL);
+            TS_ASSERT(!empty.getBoundingBox(minX, minY, maxX, maxY));
+        }
+
+        void testContains() {
+            FlatPolygon square;
+            square.add(0, 0);
+            square.add(4, 0);
+            square.add(4, 4);
+            square.add(0, 4);
+
+            TS_ASSERT(square.containsIgnoreZ(2, 2));
+            TS_ASSERT(square.containsIgnoreZ(0.1, 3.9));
+            TS_ASSERT(!square.containsIgnoreZ(5, 2));
+            TS_ASSERT(!square.containsIgnoreZ(-1, -1));
+
+            FlatPolygon points;
+            points.add(1, 1);
+            points.add(10, 1);
+            points.add(3, 3);
+
+            vector<uint8_t> inside;
+            TS_ASSERT(square.containsIgnoreZ(points, inside) == 2);
+            TS_ASSERT(inside.size() == 3);
+            TS_ASSERT(inside.at(0) == 1);
+            TS_ASSERT(inside.at(1) == 0);
+            TS_ASSERT(inside.at(2) == 1);
+        }
+
+        void testIntersectSegment() {
+            FlatPolygon square;
+            square.add(2, -1);
+            square.add(4, -1);
+            square.add(4, 1);
+            square.add(2, 1);
+
+            double t = 0;
+            TS_ASSERT(square.intersectSegmentIgnoreZ(0, 0, 10, 0, t));
+            TS_ASSERT_DELTA(t, 0.2, 1e-9);
+
+            TS_ASSERT(!square.intersectSegmentIgnoreZ(0, 0, 1, 0, t));
+            TS_ASSERT(!square.intersectSegmentIgnoreZ(0, 5, 10, 5, t));
+        }
+
+        void testClip() {
+            FlatPolygon a;
+            a.add(0, 0);
+            a.add(4, 0);
+            a.add(4, 4);
+            a.add(0, 4);
+
+            // Clockwise clipping polygon.
+            FlatPolygon b;
+            b.add(2, 2);
+            b.add(2, 6);
+            b.add(6, 6);
+            b.add(6, 2);
+
+            FlatPolygon result;
+            TS_ASSERT(a.clipIgnoreZ(b, result) == 4);
+
+            double minX = 0, minY = 0, maxX = 0, maxY = 0;
+            TS_ASSERT(result.getBoundingBox(minX, minY, maxX, maxY));
+            TS_ASSERT_DELTA(minX, 2, 1e-9);
+            TS_ASSERT_DELTA(minY, 2, 1e-9);
+            TS_ASSERT_DELTA(maxX, 4, 1e-9);
+            TS_ASSERT_DELTA(maxY, 4, 1e-9);
+
+            // Disjoint polygons.
+            FlatPolygon c;
+            c.add(10, 10);
+            c.add(11, 10);
+            c.add(11, 11);
+            TS_ASSERT(a.clipIgnoreZ(c, result) == 0);
+
+            // Clipping in place.
+            TS_ASSERT(a.clipIgnoreZ(b, a) == 4);
+        }
+
+        void testNearestPoint() {
+            FlatPolygon square;
+            square.add(0, 0);
+            square.add(4, 0);
+            square.add(4, 4);
+            square.add(0, 4);
+
+            double nx = 0, ny = 0;
+            TS_ASSERT_DELTA(square.getNearestPointIgnoreZ(2, -3, nx, ny), 3, 1e-9);
+            TS_ASSERT_DELTA(nx, 2, 1e-9);
+            TS_ASSERT_DELTA(ny, 0, 1e-9);
+
+            TS_ASSERT_DELTA(square.getNearestPointIgnoreZ(1, 2, nx, ny), 1, 1e-9);
+            TS_ASSERT_DELTA(nx, 0, 1e-9);
+
+            TS_ASSERT_DELTA(square.getNearestPointIgnoreZ(7, 8, nx, ny), 5, 1e-9);
+
+            FlatPolygon empty;
+            TS_ASSERT(empty.getNearestPointIgnoreZ(1, 2, nx, ny) < 0);
+        }
+
+        void testBenchmarkAgainstPolygon() {
+            const Polygon circle = createCircle(10, 64);
+            const FlatPolygon flatCircle(circle);
+
+            // Grid of sample points not lying on the outline.
+            FlatPolygon points;
+            vector<Point3> listOfPoints;
+            for (uint32_t i = 0; i < 100; i++) {
+                for (uint32_t j = 0; j < 100; j++) {
+                    const double x = -15.0137 + 0.3 * i;
+                    const double y = -15.0071 + 0.3 * j;
+                    points.add(x, y);
+                    listOfPoints.push_back(Point3(x, y, 0));
+                }
+            }
+
+            core::wrapper::TimeFactory &tf = core::wrapper::TimeFactory::getInstance();
+
+            int64_t start = tf.getMonotonicNanoseconds();
+            uint32_t insidePolygon = 0;
+            vector<bool> resultPolygon(listOfPoints.size());
+            for (uint32_t i = 0; i < listOfPoints.size(); i++) {
+                resultPolygon[i] = circle.containsIgnoreZ(listOfPoints[i]);
+                insidePolygon += (resultPolygon[i] ? 1 : 0);
+            }
+            const int64_t durationPolygon = tf.getMonotonicNanoseconds() - start;
+
+            start = tf.getMonotonicNanoseconds();
+            vector<uint8_t> resultFlatPolygon;
+            const uint32_t insideFlatPolygon = flatCircle.containsIgnoreZ(points, resultFlatPolygon);
+            const int64_t durationFlatPolygon = tf.getMonotonicNanoseconds() - start;
+
+            TS_ASSERT(insidePolygon == insideFlatPolygon);
+            TS_ASSERT(insidePolygon > 0);
+            bool sameResults = true;
+            for (uint32_t i = 0; i < listOfPoints.size(); i++) {
+                sameResults &= (resultPolygon[i] == (resultFlatPolygon[i] == 1));
+            }
+            TS_ASSERT(sameResults);
+
+            // Intersection of a square with the circle.
+            FlatPolygon square;
+            square.add(-2, -2);
+            square.add(2, -2);
+            square.add(2, 2);
+            square.add(-2, 2);
+            const Polygon squarePolygon = square.toPolygon();
+
+            start = tf.getMonotonicNanoseconds();
+            uint32_t verticesPolygon = 0;
+            for (uint32_t i = 0; i < 1000; i++) {
+                verticesPolygon += circle.intersectIgnoreZ(squarePolygon).getSize();
+            }
+            const int64_t durationIntersectPolygon = tf.getMonotonicNanoseconds() - start;
+
+            start = tf.getMonotonicNanoseconds();
+            FlatPolygon clipped;
+            uint32_t verticesFlatPolygon = 0;
+            for (uint32_t i = 0; i < 1000; i++) {
+                verticesFlatPolygon += square.clipIgnoreZ(flatCircle, clipped);
+            }
+            const int64_t durationClipFlatPolygon = tf.getMonotonicNanoseconds() - start;
+
+            TS_ASSERT(verticesPolygon == verticesFlatPolygon);
+
+            clog << "[FlatPolygonTest] containsIgnoreZ for " << listOfPoints.size() << " points: Polygon " << durationPolygon/1000 << " us, FlatPolygon " << durationFlatPolygon/1000 << " us." << endl;
+            clog << "[FlatPolygonTest] 1000 intersections: Polygon::intersectIgnoreZ " << durationIntersectPolygon/1000 << " us, FlatPolygon::clipIgnoreZ " << durationClipFlatPolygon/1000 << " us." << endl;
+        }
+};
+
+#endif /*HESPERIA_FLATPOLYGONTESTSUITE_H_*/
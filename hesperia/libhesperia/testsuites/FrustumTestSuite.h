@@ -0,0 +1,169 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_FRUSTUMTESTSUITE_H_
+#define HESPERIA_FRUSTUMTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+
+#include "core/data/Constants.h"
+#include "core/data/environment/Point3.h"
+#include "hesperia/threeD/BoundingSphere.h"
+#include "hesperia/threeD/Frustum.h"
+#include "hesperia/threeD/TransformationMatrix.h"
+
+using namespace std;
+using namespace core::data;
+using namespace core::data::environment;
+using namespace hesperia::threeD;
+
+class FrustumTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * Column-major matrix like gluPerspective(fovy, aspect, zNear, zFar).
+         */
+        void createPerspective(const double &fovy, const double &aspect, const double &zNear, const double &zFar, double *m) {
+            const double f = 1.0 / tan(fovy * Constants::DEG2RAD / 2.0);
+            for (uint32_t i = 0; i < 16; i++) {
+                m[i] = 0;
+            }
+            m[0] = f / aspect;
+            m[5] = f;
+            m[10] = (zFar + zNear) / (zNear - zFar);
+            m[11] = -1;
+            m[14] = (2 * zFar * zNear) / (zNear - zFar);
+        }
+
+        void createTranslation(const double &x, const double &y, const double &z, double *m) {
+            for (uint32_t i = 0; i < 16; i++) {
+                m[i] = ((i % 5) == 0) ? 1 : 0;
+            }
+            m[12] = x;
+            m[13] = y;
+            m[14] = z;
+        }
+
+        void testEnclose() {
+            BoundingSphere s;
+            TS_ASSERT(!s.isValid());
+
+            s.enclose(BoundingSphere(Point3(0, 0, 0), 1));
+            TS_ASSERT(s.isValid());
+            TS_ASSERT_DELTA(s.getRadius(), 1, 1e-9);
+
+            // Enclosed spheres and invalid spheres do not change the result.
+            s.enclose(BoundingSphere(Point3(0.5, 0, 0), 0.25));
+            s.enclose(BoundingSphere());
+            TS_ASSERT_DELTA(s.getRadius(), 1, 1e-9);
+            TS_ASSERT_DELTA(s.getCenter().getX(), 0, 1e-9);
+
+            s.enclose(BoundingSphere(Point3(4, 0, 0), 1));
+            TS_ASSERT_DELTA(s.getRadius(), 3, 1e-9);
+            TS_ASSERT_DELTA(s.getCenter().getX(), 2, 1e-9);
+
+            // An enclosing sphere replaces the smaller one.
+            s.enclose(BoundingSphere(Point3(0, 0, 0), 10));
+            TS_ASSERT_DELTA(s.getRadius(), 10, 1e-9);
+            TS_ASSERT_DELTA(s.getCenter().getX(), 0, 1e-9);
+        }
+
+        void testTransform() {
+            const BoundingSphere s(Point3(1, 0, 0), 1);
+
+            // Scaling first, then rotation and translation like TransformGroup.
+            const BoundingSphere t = s.transform(Point3(0, 0, 5), Point3(0, 0, Constants::PI / 2.0), Point3(2, 3, 1));
+            TS_ASSERT_DELTA(t.getCenter().getX(), 0, 1e-9);
+            TS_ASSERT_DELTA(t.getCenter().getY(), 2, 1e-9);
+            TS_ASSERT_DELTA(t.getCenter().getZ(), 5, 1e-9);
+            TS_ASSERT_DELTA(t.getRadius(), 3, 1e-9);
+
+            TS_ASSERT(!BoundingSphere().transform(Point3(), Point3(), Point3(1, 1, 1)).isValid());
+        }
+
+        void testVisibility() {
+            double projection[16];
+            double modelView[16];
+            createPerspective(90, 1, 1, 100, projection);
+            createTranslation(0, 0, 0, modelView);
+
+            // The camera looks along the negative Z axis.
+            const Frustum f(projection, modelView);
+            TS_ASSERT(f.isVisible(BoundingSphere(Point3(0, 0, -10), 1)));
+            TS_ASSERT(!f.isVisible(BoundingSphere(Point3(0, 0, 10), 1)));
+            TS_ASSERT(!f.isVisible(BoundingSphere(Point3(50, 0, -10), 1)));
+            TS_ASSERT(!f.isVisible(BoundingSphere(Point3(0, -50, -10), 1)));
+            TS_ASSERT(!f.isVisible(BoundingSphere(Point3(0, 0, -200), 1)));
+
+            // Partly visible spheres are kept.
+            TS_ASSERT(f.isVisible(BoundingSphere(Point3(11, 0, -10), 2)));
+            TS_ASSERT(f.isVisible(BoundingSphere(Point3(0, 0, -101), 2)));
+
+            // Spheres of unknown extent are never culled.
+            TS_ASSERT(f.isVisible(BoundingSphere()));
+            TS_ASSERT(Frustum().isVisible(BoundingSphere(Point3(0, 0, 10), 1)));
+
+            // Moving the camera to Z = 20.
+            createTranslation(0, 0, -20, modelView);
+            const Frustum g(projection, modelView);
+            TS_ASSERT(g.isVisible(BoundingSphere(Point3(0, 0, 0), 1)));
+            TS_ASSERT(!g.isVisible(BoundingSphere(Point3(0, 0, 25), 1)));
+        }
+
+        void testRotatedNodeWithinFrustum() {
+            double projection[16];
+            double modelView[16];
+            createPerspective(90, 1, 1, 100, projection);
+            createTranslation(0, 0, 0, modelView);
+            const Frustum f(projection, modelView);
+
+            // glRotated(90, 0, 1, 0) maps the X axis onto the negative Z axis, i.e. in front of the camera.
+            const Point3 rotation(0, Constants::PI / 2.0, 0);
+            const BoundingSphere inFront = BoundingSphere(Point3(10, 0, 0), 1).transform(Point3(), rotation, Point3(1, 1, 1));
+            TS_ASSERT_DELTA(inFront.getCenter().getX(), 0, 1e-6);
+            TS_ASSERT_DELTA(inFront.getCenter().getZ(), -10, 1e-6);
+            TS_ASSERT(f.isVisible(inFront));
+            TS_ASSERT(!f.isVisible(BoundingSphere(Point3(-10, 0, 0), 1).transform(Point3(), rotation, Point3(1, 1, 1))));
+
+            // Nested transform groups test their children against the transformed frustum.
+            const Frustum local = f.transform(TransformationMatrix(Point3(0, 5, 0), rotation, Point3(2, 2, 2)));
+            TS_ASSERT(local.isVisible(BoundingSphere(Point3(5, 0, 0), 1)));
+            TS_ASSERT(!local.isVisible(BoundingSphere(Point3(-5, 0, 0), 1)));
+            TS_ASSERT(!local.isVisible(BoundingSphere(Point3(5, 0, 60), 1)));
+            TS_ASSERT(Frustum().transform(TransformationMatrix()).isVisible(BoundingSphere(Point3(0, 0, 10), 1)));
+        }
+
+        void testDistanceToCamera() {
+            double projection[16];
+            double modelView[16];
+            createPerspective(90, 1, 1, 100, projection);
+            createTranslation(0, 0, -20, modelView);
+            const Frustum f(projection, modelView);
+            TS_ASSERT_DELTA(f.getDistanceToCamera(Point3(0, 0, 0)), 20, 1e-9);
+            TS_ASSERT_DELTA(f.getDistanceToCamera(Point3(0, 0, 20)), 0, 1e-9);
+
+            // Nested transform groups measure the distance in eye coordinates like glGetDoublev(GL_MODELVIEW_MATRIX, ...).
+            const Frustum local = f.transform(TransformationMatrix(Point3(0, 0, 10), Point3(0, Constants::PI / 2.0, 0), Point3(2, 2, 2)));
+            TS_ASSERT_DELTA(local.getDistanceToCamera(Point3(0, 0, 0)), 10, 1e-6);
+            TS_ASSERT_DELTA(local.getDistanceToCamera(Point3(1, 0, 0)), 12, 1e-6);
+        }
+};
+
+#endif /*HESPERIA_FRUSTUMTESTSUITE_H_*/
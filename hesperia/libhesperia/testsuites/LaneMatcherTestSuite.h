@@ -0,0 +1,276 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_LANEMATCHERTESTSUITE_H_
+#define HESPERIA_LANEMATCHERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "core/data/Constants.h"
+#include "core/data/environment/Point3.h"
+#include "core/wrapper/TimeFactory.h"
+#include "hesperia/data/environment/NamedLine.h"
+#include "hesperia/scenario/LaneMatch.h"
+#include "hesperia/scenario/LaneMatcher.h"
+
+using namespace std;
+using namespace core::data;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+using namespace hesperia::scenario;
+
+class LaneMatcherTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * Creates numberOfLanes polylines of 10 m segments with a
+         * random walk each.
+         */
+        vector<NamedLine> createLanes(const uint32_t &numberOfLanes, const uint32_t &segmentsPerLane) {
+            vector<NamedLine> listOfLines;
+            srand(42);
+            for (uint32_t lane = 0; lane < numberOfLanes; lane++) {
+                stringstream name;
+                name << "1." << (lane / 2 + 1) << "." << (lane % 2 + 1);
+
+                Point3 A(rand() % 2000 - 1000, rand() % 2000 - 1000, 0);
+                double heading = (rand() % 628) / 100.0;
+                for (uint32_t i = 0; i < segmentsPerLane; i++) {
+                    heading += ((rand() % 100) - 50) / 500.0;
+                    const Point3 B(A.getX() + 10 * cos(heading), A.getY() + 10 * sin(heading), i * 0.1);
+                    listOfLines.push_back(NamedLine(name.str(), A, B));
+                    A = B;
+                }
+            }
+            return listOfLines;
+        }
+
+        /**
+         * Returns the distance between p and the segment l.
+         */
+        double getDistance(const NamedLine &l, const Point3 &p) {
+            const Point3 d = l.getB() - l.getA();
+            const double squaredLength = d.getX() * d.getX() + d.getY() * d.getY();
+            double t = 0;
+            if (squaredLength > 0) {
+                t = ((p.getX() - l.getA().getX()) * d.getX() + (p.getY() - l.getA().getY()) * d.getY()) / squaredLength;
+                t = (t < 0) ? 0 : ((t > 1) ? 1 : t);
+            }
+            const double nx = l.getA().getX() + t * d.getX() - p.getX();
+            const double ny = l.getA().getY() + t * d.getY() - p.getY();
+            return sqrt(nx * nx + ny * ny);
+        }
+
+        void testMatchSingleSegment() {
+            vector<NamedLine> listOfLines;
+            listOfLines.push_back(NamedLine("1.1.1", Point3(0, 0, 0), Point3(10, 0, 1)));
+            listOfLines.push_back(NamedLine("1.1.2", Point3(10, 5, 0), Point3(0, 5, 0)));
+
+            LaneMatcher matcher(listOfLines);
+            TS_ASSERT(matcher.getNumberOfSegments() == 2);
+            TS_ASSERT(matcher.getNumberOfLanes() == 2);
+            TS_ASSERT(matcher.getLaneName(1) == "1.1.2");
+            TS_ASSERT(matcher.getLaneID("1.1.1") == 0);
+            TS_ASSERT(matcher.getLaneID("9.9.9") == static_cast<uint32_t>(LaneMatcher::ANY_LANE));
+
+            vector<LaneMatch> matches;
+            TS_ASSERT(matcher.findNearest(Point3(4, 1, 0), 1, 100, matches) == 1);
+            TS_ASSERT(matches.front().getSegment() == 0);
+            TS_ASSERT(matches.front().getLaneID() == 0);
+            TS_ASSERT_DELTA(matches.front().getDistance(), 1, 1e-9);
+            TS_ASSERT_DELTA(matches.front().getT(), 0.4, 1e-9);
+            TS_ASSERT_DELTA(matches.front().getPoint().getX(), 4, 1e-9);
+            TS_ASSERT_DELTA(matches.front().getPoint().getZ(), 0.4, 1e-9);
+            TS_ASSERT_DELTA(matches.front().getHeading(), 0, 1e-9);
+
+            // Beyond the end of the segment.
+            TS_ASSERT(matcher.findNearest(Point3(13, -4, 0), 1, 100, matches) == 1);
+            TS_ASSERT_DELTA(matches.front().getDistance(), 5, 1e-9);
+
+            // Heading selects the opposite lane.
+            TS_ASSERT(matcher.findNearest(Point3(4, 1, 0), Constants::PI, 0.5, 1, 100, matches) == 1);
+            TS_ASSERT(matches.front().getSegment() == 1);
+            TS_ASSERT_DELTA(matches.front().getDistance(), 4, 1e-9);
+
+            // Heading -PI equals PI.
+            TS_ASSERT(matcher.findNearest(Point3(4, 1, 0), -Constants::PI + 0.1, 0.5, 1, 100, matches) == 1);
+            TS_ASSERT(matches.front().getSegment() == 1);
+
+            LaneMatch m;
+            TS_ASSERT(matcher.findNearestOnLane(Point3(4, 1, 0), 1, 100, m));
+            TS_ASSERT(m.getSegment() == 1);
+            TS_ASSERT(!matcher.findNearestOnLane(Point3(4, 1, 0), 1, 3, m));
+            TS_ASSERT(!matcher.findNearestOnLane(Point3(4, 1, 0), 5, 100, m));
+
+            TS_ASSERT(matcher.findWithinRadius(Point3(4, 1, 0), 4.5, matches) == 2);
+            TS_ASSERT(matches.at(0).getSegment() == 0);
+            TS_ASSERT(matches.at(1).getSegment() == 1);
+            TS_ASSERT(matcher.findWithinRadius(Point3(4, 1, 0), 0.5, matches) == 0);
+
+            // Far away from the map.
+            TS_ASSERT(matcher.findNearest(Point3(1e12, -1e12, 0), 1, 1e13, matches) == 1);
+            TS_ASSERT(matcher.findNearest(Point3(1e12, -1e12, 0), 1, 100, matches) == 0);
+
+            vector<NamedLine> empty;
+            LaneMatcher emptyMatcher(empty);
+            TS_ASSERT(emptyMatcher.findNearest(Point3(0, 0, 0), 1, 100, matches) == 0);
+            TS_ASSERT(emptyMatcher.findWithinRadius(Point3(0, 0, 0), 100, matches) == 0);
+        }
+
+        void testAgainstLinearScan() {
+            const vector<NamedLine> listOfLines = createLanes(40, 500);
+            LaneMatcher matcher(listOfLines);
+            TS_ASSERT(matcher.getNumberOfSegments() == listOfLines.size());
+            TS_ASSERT(matcher.getNumberOfLanes() == 40);
+
+            bool nearestIsCorrect = true;
+            bool radiusIsCorrect = true;
+            bool headingIsCorrect = true;
+            bool laneIsCorrect = true;
+            vector<LaneMatch> matches;
+            for (uint32_t i = 0; i < 200; i++) {
+                const Point3 p(rand() % 4000 - 2000 + 0.37, rand() % 4000 - 2000 + 0.61, 0);
+                const double heading = (rand() % 628) / 100.0 - Constants::PI;
+
+                vector<double> distances;
+                double nearest = 1e300, nearestInDirection = 1e300, nearestOnLane = 1e300;
+                uint32_t withinRadius = 0;
+                for (uint32_t j = 0; j < listOfLines.size(); j++) {
+                    const double d = getDistance(listOfLines[j], p);
+                    distances.push_back(d);
+                    nearest = min(nearest, d);
+                    withinRadius += (d <= 50) ? 1 : 0;
+
+                    const Point3 direction = listOfLines[j].getB() - listOfLines[j].getA();
+                    const double delta = heading - atan2(direction.getY(), direction.getX());
+                    if (fabs(atan2(sin(delta), cos(delta))) <= 0.3) {
+                        nearestInDirection = min(nearestInDirection, d);
+                    }
+                    if (listOfLines[j].getName() == "1.3.2") {
+                        nearestOnLane = min(nearestOnLane, d);
+                    }
+                }
+                sort(distances.begin(), distances.end());
+
+                matcher.findNearest(p, 5, 1e6, matches);
+                nearestIsCorrect &= (matches.size() == 5);
+                for (uint32_t j = 0; (j < matches.size()) && (j < 5); j++) {
+                    nearestIsCorrect &= (fabs(matches[j].getDistance() - distances[j]) < 1e-9);
+                }
+
+                matcher.findWithinRadius(p, 50, matches);
+                radiusIsCorrect &= (matches.size() == withinRadius);
+
+                matcher.findNearest(p, heading, 0.3, 1, 1e6, matches);
+                headingIsCorrect &= (matches.size() == 1) && (fabs(matches.front().getDistance() - nearestInDirection) < 1e-9);
+
+                LaneMatch m;
+                laneIsCorrect &= matcher.findNearestOnLane(p, matcher.getLaneID("1.3.2"), 1e6, m);
+                laneIsCorrect &= (fabs(m.getDistance() - nearestOnLane) < 1e-9) && (matcher.getLaneName(m.getLaneID()) == "1.3.2");
+            }
+            TS_ASSERT(nearestIsCorrect);
+            TS_ASSERT(radiusIsCorrect);
+            TS_ASSERT(headingIsCorrect);
+            TS_ASSERT(laneIsCorrect);
+        }
+
+        void testSegmentsSpanningManyCellsAreMatchedOnce() {
+            // Long segments crossing each other in a fine grid.
+            vector<NamedLine> listOfLines;
+            for (int32_t i = 0; i < 20; i++) {
+                listOfLines.push_back(NamedLine("1.1.1", Point3(-100, i * 10 - 100, 0), Point3(100, 100 - i * 10, 0)));
+                listOfLines.push_back(NamedLine("1.1.2", Point3(i * 10 - 100, -100, 0), Point3(i * 5, 100, 0)));
+            }
+            LaneMatcher matcher(listOfLines, 2);
+
+            bool isCorrect = true;
+            vector<LaneMatch> matches;
+            srand(7);
+            for (uint32_t i = 0; i < 100; i++) {
+                const Point3 p(rand() % 300 - 150 + 0.3, rand() % 300 - 150 + 0.7, 0);
+
+                uint32_t withinRadius = 0;
+                for (uint32_t j = 0; j < listOfLines.size(); j++) {
+                    withinRadius += (getDistance(listOfLines[j], p) <= 40) ? 1 : 0;
+                }
+
+                matcher.findWithinRadius(p, 40, matches);
+                isCorrect &= (matches.size() == withinRadius);
+
+                vector<bool> found(listOfLines.size(), false);
+                for (uint32_t j = 0; j < matches.size(); j++) {
+                    isCorrect &= !found[matches[j].getSegment()];
+                    found[matches[j].getSegment()] = true;
+                }
+
+                matcher.findNearest(p, listOfLines.size(), 1e6, matches);
+                isCorrect &= (matches.size() == listOfLines.size());
+            }
+            TS_ASSERT(isCorrect);
+        }
+
+        void testBenchmarkAgainstLinearScan() {
+            const vector<NamedLine> listOfLines = createLanes(400, 500);
+            LaneMatcher matcher(listOfLines);
+
+            vector<Point3> positions;
+            for (uint32_t i = 0; i < 50; i++) {
+                const NamedLine &l = listOfLines[(i * 3989) % listOfLines.size()];
+                positions.push_back(l.getA() + Point3(1.5, -0.5, 0));
+            }
+
+            core::wrapper::TimeFactory &tf = core::wrapper::TimeFactory::getInstance();
+
+            int64_t start = tf.getMonotonicNanoseconds();
+            vector<double> resultLinearScan;
+            for (uint32_t i = 0; i < positions.size(); i++) {
+                double nearest = 1e300;
+                for (uint32_t j = 0; j < listOfLines.size(); j++) {
+                    nearest = min(nearest, getDistance(listOfLines[j], positions[i]));
+                }
+                resultLinearScan.push_back(nearest);
+            }
+            const int64_t durationLinearScan = tf.getMonotonicNanoseconds() - start;
+
+            start = tf.getMonotonicNanoseconds();
+            vector<double> resultLaneMatcher;
+            vector<LaneMatch> matches;
+            for (uint32_t i = 0; i < positions.size(); i++) {
+                matcher.findNearest(positions[i], 1, 1e6, matches);
+                resultLaneMatcher.push_back(matches.empty() ? -1 : matches.front().getDistance());
+            }
+            const int64_t durationLaneMatcher = tf.getMonotonicNanoseconds() - start;
+
+            bool sameResults = true;
+            for (uint32_t i = 0; i < positions.size(); i++) {
+                sameResults &= (fabs(resultLinearScan[i] - resultLaneMatcher[i]) < 1e-9);
+            }
+            TS_ASSERT(sameResults);
+
+            clog << "[LaneMatcherTest] " << positions.size() << " queries against " << listOfLines.size() << " segments: linear scan " << durationLinearScan/1000 << " us, LaneMatcher " << durationLaneMatcher/1000 << " us." << endl;
+        }
+};
+
+#endif /*HESPERIA_LANEMATCHERTESTSUITE_H_*/
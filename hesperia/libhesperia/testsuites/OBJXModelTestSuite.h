@@ -0,0 +1,327 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_OBJXMODELTESTSUITE_H_
+#define HESPERIA_OBJXMODELTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/macros.h"
+#include "core/data/environment/Point3.h"
+#include "core/wrapper/TimeFactory.h"
+#include "hesperia/decorator/models/OBJXArchive.h"
+#include "hesperia/decorator/models/OBJXArchiveFactory.h"
+#include "hesperia/threeD/VertexBuffer.h"
+#include "hesperia/threeD/loaders/OBJXModel.h"
+#include "hesperia/threeD/models/Triangle.h"
+#include "hesperia/threeD/models/TriangleSet.h"
+
+using namespace std;
+using namespace core::data::environment;
+using namespace hesperia::threeD;
+using namespace hesperia::threeD::loaders;
+
+class OBJXModelTest : public CxxTest::TestSuite {
+    public:
+        string createMTL() {
+            stringstream mtl;
+            mtl << "# Two materials" << endl
+                << "newmtl Red" << endl
+                << "Ns 96.5" << endl
+                << "Kd 1.000000 0.000000 0.000000\r" << endl
+                << "newmtl Textured" << endl
+                << "Kd 0.5 0.5 0.5" << endl
+                << "map_Kd wall.png" << endl;
+            return mtl.str();
+        }
+
+        string createOBJ() {
+            stringstream obj;
+            obj << "mtllib model.mtl" << endl
+                << "v 0 0 0" << endl
+                << "v 1 0 0" << endl
+                << "v 1 1 0" << endl
+                << "v 0 1 0" << endl
+                << "vn 0 0 1" << endl
+                << "vt 0 0" << endl
+                << "vt 1 0" << endl
+                << "vt 1 1" << endl
+                << "vt 0 1" << endl
+                << "f 1 2 3" << endl
+                << "usemtl Red" << endl
+                << "f 1//1 2//1 3//1 4//1" << endl
+                << "g wall" << endl
+                << "usemtl Textured" << endl
+                << "f -4/1/1 -3/2/1 -2/3/1 -1/4/1" << endl
+                << "f 1 2 9" << endl;
+            return obj.str();
+        }
+
+        void testParse() {
+            const string mtl = createMTL();
+            const string obj = createOBJ();
+
+            OBJXModel model;
+            model.parseMTL(mtl.c_str(), mtl.size());
+            model.parseOBJ(obj.c_str(), obj.size());
+
+            TS_ASSERT(model.getMaterials().size() == 2);
+            TS_ASSERT_DELTA(model.getMaterials().find("Red")->second.getShininess(), 96.5, 1e-9);
+            TS_ASSERT_DELTA(model.getMaterials().find("Red")->second.getDiffuse().getX(), 1, 1e-9);
+            TS_ASSERT(model.getMaterials().find("Textured")->second.getTextureName() == "wall.png");
+            TS_ASSERT(model.hasTextures());
+
+            // Default material, Red, and Textured; the face with an unknown vertex is skipped.
+            TS_ASSERT(model.getNumberOfGroups() == 3);
+            TS_ASSERT(model.getMaterialName(0) == "");
+            TS_ASSERT(model.getMaterialName(1) == "Red");
+            TS_ASSERT(model.getMaterialName(2) == "Textured");
+            TS_ASSERT(model.getNumberOfTriangles() == 5);
+
+            // Quads are split into triangle fans.
+            const VertexBuffer &red = model.getVertexBuffer(1);
+            TS_ASSERT(red.getNumberOfIndices() == 6);
+            TS_ASSERT(red.getNumberOfVertices() == 4);
+            TS_ASSERT(red.getIndexData()[5] == 3);
+            TS_ASSERT_DELTA(red.getPosition(3).getY(), 1, 1e-6);
+            TS_ASSERT_DELTA(red.getNormal(0).getZ(), 1, 1e-6);
+            TS_ASSERT(!red.hasTextureCoordinates());
+
+            const VertexBuffer &textured = model.getVertexBuffer(2);
+            TS_ASSERT(textured.hasTextureCoordinates());
+            TS_ASSERT_DELTA(textured.getTextureCoordinate(2).getX(), 1, 1e-6);
+            TS_ASSERT_DELTA(textured.getTextureCoordinate(2).getY(), 1, 1e-6);
+
+            // Face normals are computed if the OBJ file does not provide any.
+            TS_ASSERT_DELTA(model.getVertexBuffer(0).getNormal(0).getZ(), 1, 1e-6);
+        }
+
+        void testBinaryForm() {
+            const string mtl = createMTL();
+            const string obj = createOBJ();
+
+            OBJXModel model;
+            model.parseMTL(mtl.c_str(), mtl.size());
+            model.parseOBJ(obj.c_str(), obj.size());
+
+            stringstream binary;
+            model.write(binary, 0x1234, 42);
+
+            OBJXModel cachedModel;
+            TS_ASSERT(cachedModel.read(binary, 0x1234, 42));
+            TS_ASSERT(cachedModel.getNumberOfGroups() == model.getNumberOfGroups());
+            TS_ASSERT(cachedModel.getNumberOfTriangles() == model.getNumberOfTriangles());
+            TS_ASSERT(cachedModel.getMaterialName(2) == "Textured");
+            TS_ASSERT(cachedModel.getMaterials().find("Textured")->second.getTextureName() == "wall.png");
+            TS_ASSERT_DELTA(cachedModel.getMaterials().find("Red")->second.getShininess(), 96.5, 1e-5);
+            TS_ASSERT(cachedModel.getVertexBuffer(2).hasTextureCoordinates());
+            TS_ASSERT_DELTA(cachedModel.getVertexBuffer(1).getPosition(3).getY(), 1, 1e-6);
+
+            // Cached models of other archives are not used.
+            binary.clear();
+            binary.seekg(0);
+            OBJXModel otherModel;
+            TS_ASSERT(!otherModel.read(binary, 0x1235, 42));
+            TS_ASSERT(otherModel.getNumberOfGroups() == 0);
+        }
+
+        void testCorruptBinaryForm() {
+            const string mtl = createMTL();
+            const string obj = createOBJ();
+
+            OBJXModel model;
+            model.parseMTL(mtl.c_str(), mtl.size());
+            model.parseOBJ(obj.c_str(), obj.size());
+
+            stringstream binary;
+            model.write(binary, 0x1234, 42);
+            const string valid = binary.str();
+
+            // Truncated data.
+            stringstream truncated(valid.substr(0, valid.size() - 1));
+            OBJXModel truncatedModel;
+            TS_ASSERT(!truncatedModel.read(truncated, 0x1234, 42));
+            TS_ASSERT(truncatedModel.getNumberOfGroups() == 0);
+
+            // Length of the first material's name (following header and number of materials).
+            string corrupt = valid;
+            corrupt[20] = '\x7F';
+            stringstream longString(corrupt);
+            OBJXModel longStringModel;
+            TS_ASSERT(!longStringModel.read(longString, 0x1234, 42));
+            TS_ASSERT(longStringModel.getMaterials().empty());
+
+            // Vertex buffer claiming more vertices than available.
+            stringstream manyVertices;
+            const uint32_t header[6] = { htonl(VertexBuffer::TRIANGLES), 0, 0, 0, htonl(VertexBuffer::MAXIMUM_NUMBER_OF_VERTICES), 0 };
+            manyVertices.write(reinterpret_cast<const char*>(header), sizeof(header));
+            VertexBuffer manyVerticesBuffer;
+            TS_ASSERT(!manyVerticesBuffer.read(manyVertices));
+
+            stringstream tooManyVertices;
+            const uint32_t tooManyHeader[6] = { htonl(VertexBuffer::TRIANGLES), 0, 0, 0, htonl(VertexBuffer::MAXIMUM_NUMBER_OF_VERTICES + 1), 0 };
+            tooManyVertices.write(reinterpret_cast<const char*>(tooManyHeader), sizeof(tooManyHeader));
+            TS_ASSERT(!manyVerticesBuffer.read(tooManyVertices));
+
+            // Indices referring to missing vertices.
+            VertexBuffer vb(VertexBuffer::TRIANGLES);
+            vb.addVertex(Point3(0, 0, 0));
+            vb.addVertex(Point3(1, 0, 0));
+            vb.addTriangle(0, 1, 2);
+            stringstream invalidIndex;
+            vb.write(invalidIndex);
+
+            VertexBuffer invalidIndexBuffer;
+            invalidIndexBuffer.addVertex(Point3(1, 2, 3));
+            TS_ASSERT(!invalidIndexBuffer.read(invalidIndex));
+            TS_ASSERT(invalidIndexBuffer.getNumberOfVertices() == 1);
+        }
+
+        void testLevelsOfDetail() {
+            // Flat grid of 64x64 quads with 0.1 m edges.
+            const uint32_t SIZE = 64;
+            stringstream sstr;
+            for (uint32_t i = 0; i <= SIZE; i++) {
+                for (uint32_t j = 0; j <= SIZE; j++) {
+                    sstr << "v " << 0.1 * i << " " << 0.1 * j << " 0" << endl;
+                }
+            }
+            for (uint32_t i = 0; i < SIZE; i++) {
+                for (uint32_t j = 0; j < SIZE; j++) {
+                    const uint32_t a = i * (SIZE + 1) + j + 1;
+                    const uint32_t b = a + SIZE + 1;
+                    sstr << "f " << a << " " << b << " " << (b + 1) << " " << (a + 1) << endl;
+                }
+            }
+            const string obj = sstr.str();
+
+            OBJXModel model;
+            model.parseOBJ(obj.c_str(), obj.size());
+            TS_ASSERT(model.getNumberOfTriangles() == 2 * SIZE * SIZE);
+
+            const BoundingSphere sphere = model.getBoundingSphere();
+            TS_ASSERT(sphere.isValid());
+            TS_ASSERT_DELTA(sphere.getCenter().getX(), 3.2, 1e-6);
+            TS_ASSERT_DELTA(sphere.getRadius(), 3.2 * sqrt(2.0), 1e-6);
+
+            // Level 0 is the original geometry; coarser levels have fewer triangles.
+            TS_ASSERT(&model.getVertexBuffer(0, 0) == &model.getVertexBuffer(0));
+            uint32_t previousNumberOfIndices = model.getVertexBuffer(0).getNumberOfIndices();
+            for (uint32_t level = 1; level < OBJXModel::NUMBER_OF_LEVELS_OF_DETAIL; level++) {
+                const VertexBuffer &vb = model.getVertexBuffer(0, level);
+                TS_ASSERT(vb.getNumberOfIndices() > 0);
+                TS_ASSERT(vb.getNumberOfIndices() < previousNumberOfIndices);
+                previousNumberOfIndices = vb.getNumberOfIndices();
+            }
+        }
+
+        void testCopyOnWriteOfSharedGeometry() {
+            hesperia::threeD::models::Triangle triangle;
+            triangle.setVertices(Point3(0, 0, 0), Point3(1, 0, 0), Point3(1, 1, 0));
+
+            hesperia::threeD::models::TriangleSet original;
+            original.addTriangle(triangle);
+            TS_ASSERT(original.getVertexBuffer().getNumberOfIndices() == 3);
+
+            // Copies share the geometry until either side is modified.
+            hesperia::threeD::models::TriangleSet copy(original);
+            TS_ASSERT(&copy.getVertexBuffer() == &original.getVertexBuffer());
+
+            original.addTriangle(triangle);
+            TS_ASSERT(original.getVertexBuffer().getNumberOfIndices() == 6);
+            TS_ASSERT(copy.getVertexBuffer().getNumberOfIndices() == 3);
+
+            copy.addTriangle(triangle);
+            copy.addTriangle(triangle);
+            TS_ASSERT(copy.getVertexBuffer().getNumberOfIndices() == 9);
+            TS_ASSERT(original.getVertexBuffer().getNumberOfIndices() == 6);
+        }
+
+        void testBenchmarkAgainstLineParser() {
+            // Grid of textured triangles.
+            const uint32_t SIZE = 100;
+            stringstream sstr;
+            sstr << "vn 0 0 1" << endl;
+            for (uint32_t i = 0; i <= SIZE; i++) {
+                for (uint32_t j = 0; j <= SIZE; j++) {
+                    sstr << "v " << 0.5 * i << " " << 0.5 * j << " " << 0.01 * (i + j) << endl;
+                    sstr << "vt " << i / static_cast<double>(SIZE) << " " << j / static_cast<double>(SIZE) << endl;
+                }
+            }
+            for (uint32_t i = 0; i < SIZE; i++) {
+                for (uint32_t j = 0; j < SIZE; j++) {
+                    const uint32_t a = i * (SIZE + 1) + j + 1;
+                    const uint32_t b = a + SIZE + 1;
+                    sstr << "f " << a << "/" << a << "/1 " << b << "/" << b << "/1 " << (b + 1) << "/" << (b + 1) << "/1" << endl;
+                    sstr << "f " << a << "/" << a << "/1 " << (b + 1) << "/" << (b + 1) << "/1 " << (a + 1) << "/" << (a + 1) << "/1" << endl;
+                }
+            }
+            // The line based parser stores a group when the next one starts.
+            sstr << "g end" << endl;
+            const string obj = sstr.str();
+
+            core::wrapper::TimeFactory &tf = core::wrapper::TimeFactory::getInstance();
+
+            int64_t start = tf.getMonotonicNanoseconds();
+            stringstream in(obj);
+            hesperia::decorator::models::OBJXArchive *objxArchive = hesperia::decorator::models::OBJXArchiveFactory::getInstance().getOBJXArchiveFromPlainOBJFile(in);
+            const vector<hesperia::decorator::models::TriangleSet> listOfTriangleSets = objxArchive->getListOfTriangleSets();
+            const int64_t durationLineParser = tf.getMonotonicNanoseconds() - start;
+
+            uint32_t trianglesLineParser = 0;
+            for (uint32_t i = 0; i < listOfTriangleSets.size(); i++) {
+                trianglesLineParser += listOfTriangleSets[i].m_vertices.size() / 3;
+            }
+            OPENDAVINCI_CORE_DELETE_POINTER(objxArchive);
+
+            start = tf.getMonotonicNanoseconds();
+            OBJXModel model;
+            model.parseOBJ(obj.c_str(), obj.size());
+            const int64_t durationOBJXModel = tf.getMonotonicNanoseconds() - start;
+
+            stringstream binary;
+            model.write(binary, 1, obj.size());
+            start = tf.getMonotonicNanoseconds();
+            OBJXModel cachedModel;
+            TS_ASSERT(cachedModel.read(binary, 1, obj.size()));
+            const int64_t durationCachedModel = tf.getMonotonicNanoseconds() - start;
+
+            TS_ASSERT(model.getNumberOfTriangles() == 2 * SIZE * SIZE);
+            TS_ASSERT(trianglesLineParser == model.getNumberOfTriangles());
+            TS_ASSERT(cachedModel.getNumberOfTriangles() == model.getNumberOfTriangles());
+
+            // Same vertices as the line based parser.
+            const VertexBuffer &vb = model.getVertexBuffer(0);
+            bool sameVertices = (listOfTriangleSets.size() == 1) && (listOfTriangleSets[0].m_vertices.size() == vb.getNumberOfVertices());
+            for (uint32_t i = 0; sameVertices && (i < vb.getNumberOfVertices()); i++) {
+                sameVertices &= ((vb.getPosition(i) - listOfTriangleSets[0].m_vertices[i]).length() < 1e-5);
+            }
+            TS_ASSERT(sameVertices);
+
+            clog << "[OBJXModelTest] " << model.getNumberOfTriangles() << " triangles: line parser " << durationLineParser/1000 << " us, OBJXModel::parseOBJ " << durationOBJXModel/1000 << " us, OBJXModel::read " << durationCachedModel/1000 << " us." << endl;
+        }
+};
+
+#endif /*HESPERIA_OBJXMODELTESTSUITE_H_*/
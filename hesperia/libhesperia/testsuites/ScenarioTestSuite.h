@@ -20,11 +20,15 @@
 #ifndef HESPERIA_SCENARIOTESTSUITE_H_
 #define HESPERIA_SCENARIOTESTSUITE_H_
 
+#include <cstring>
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "core/exceptions/Exceptions.h"
+#include "core/wrapper/TimeFactory.h"
 #include "hesperia/data/scenario/Arc.h"
 #include "hesperia/data/scenario/BoundingBox.h"
 #include "hesperia/data/scenario/Clothoid.h"
@@ -46,8 +50,10 @@
 #include "hesperia/data/scenario/TrafficSign.h"
 #include "hesperia/data/scenario/Vertex3.h"
 #include "hesperia/data/scenario/Zone.h"
+#include "hesperia/scenario/CompiledScenario.h"
 #include "hesperia/scenario/ScenarioFactory.h"
 #include "hesperia/scenario/ScenarioPrettyPrinter.h"
+#include "hesperia/scenario/SharedScenarioData.h"
 
 using namespace std;
 using namespace hesperia::data::scenario;
@@ -55,6 +61,45 @@ using namespace core::exceptions;
 using namespace hesperia::scenario;
 using namespace core::wrapper::parser;
 
+/**
+ * Decompressed data from a map of entries.
+ */
+class MemoryDecompressedData : public core::wrapper::DecompressedData {
+    public:
+        MemoryDecompressedData() :
+            m_mapOfEntries() {}
+
+        void add(const string &entry, const string &contents) {
+            m_mapOfEntries[entry] = contents;
+        }
+
+        virtual vector<string> getListOfEntries() {
+            vector<string> listOfEntries;
+            map<string, string>::const_iterator it = m_mapOfEntries.begin();
+            while (it != m_mapOfEntries.end()) {
+                listOfEntries.push_back((it++)->first);
+            }
+            return listOfEntries;
+        }
+
+        virtual istream* getInputStreamFor(const string &) {
+            return NULL;
+        }
+
+        virtual bool getBufferFor(const string &entry, const char* &buffer, uint32_t &length) {
+            map<string, string>::const_iterator it = m_mapOfEntries.find(entry);
+            if (it == m_mapOfEntries.end()) {
+                return false;
+            }
+            buffer = it->second.empty() ? NULL : it->second.data();
+            length = it->second.size();
+            return true;
+        }
+
+    private:
+        map<string, string> m_mapOfEntries;
+};
+
 class ScenarioTest : public CxxTest::TestSuite {
     public:
         void testIDVertex3() {
@@ -409,6 +454,24 @@ class ScenarioTest : public CxxTest::TestSuite {
                 clog << "Third check." << endl;
                 checkData(scn3);
 
+                // Test compiled scenario.
+                stringstream compiled;
+                CompiledScenario::write(compiled, s.str(), scn);
+                Scenario scn4;
+                TS_ASSERT(CompiledScenario::read(compiled, s.str(), scn4));
+                clog << "Fourth check." << endl;
+                checkData(scn4);
+
+                // Compiled scenario must not be used for a modified SCN file.
+                compiled.clear();
+                compiled.seekg(0);
+                Scenario scn5;
+                TS_ASSERT(!CompiledScenario::read(compiled, s.str() + "\n", scn5));
+
+                // The checksum is the standard CRC-32.
+                TS_ASSERT(CompiledScenario::getChecksum("") == 0);
+                TS_ASSERT(CompiledScenario::getChecksum("123456789") == 0xCBF43926);
+
                 // Do some visiting.
                 ScenarioPrettyPrinter scnpp;
                 scn3.accept(scnpp);
@@ -420,6 +483,210 @@ class ScenarioTest : public CxxTest::TestSuite {
             TS_ASSERT(!failed);
         }
 
+        string createLargeScenario(const uint32_t &numberOfRoads) {
+            stringstream s;
+            s << "SCENARIO Large-Scenario" << endl
+            << "VERSION v1.0" << endl
+            << "DATE July-15-2008" << endl
+            << "ORIGINCOORDINATESYSTEM" << endl
+            << "WGS84" << endl
+            << "ORIGIN" << endl
+            << "VERTEX2" << endl
+            << "X 52.247041" << endl
+            << "Y 10.575832" << endl
+            << "ROTATION 0" << endl
+            << "GROUND Groundlayer" << endl
+            << "ENDGROUND" << endl
+            << "LAYER FirstLayer" << endl
+            << "LAYERID 1" << endl
+            << "HEIGHT 0.1" << endl;
+
+            for (uint32_t i = 1; i <= numberOfRoads; i++) {
+                s << "ROAD" << endl
+                << "ROADID " << i << endl
+                << "ROADNAME Road" << i << endl;
+                for (uint32_t j = 1; j <= 2; j++) {
+                    s << "LANE" << endl
+                    << "LANEID " << j << endl
+                    << "LANEWIDTH 3.5" << endl
+                    << "LEFTLANEMARKING broken_white" << endl
+                    << "RIGHTLANEMARKING solid_white" << endl
+                    << "(1." << i << "." << j << ".2) -> (1." << (i % numberOfRoads + 1) << "." << j << ".1)" << endl
+                    << "POINTMODEL" << endl;
+                    for (uint32_t k = 1; k <= 20; k++) {
+                        s << "ID " << k << endl
+                        << "VERTEX2" << endl
+                        << "X " << (10.0 * i + 0.5 * k) << endl
+                        << "Y " << (-3.5 * j) << endl;
+                    }
+                    s << "ENDPOINTMODEL" << endl
+                    << "ENDLANE" << endl;
+                }
+                s << "ENDROAD" << endl;
+            }
+
+            s << "ZONE" << endl
+            << "ZONEID 1" << endl
+            << "ZONENAME Zone1" << endl
+            << "PERIMETER" << endl
+            << "ID 1" << endl
+            << "VERTEX2" << endl
+            << "X 33.1" << endl
+            << "Y -33.5" << endl
+            << "ID 2" << endl
+            << "VERTEX2" << endl
+            << "X 55.1" << endl
+            << "Y -55.5" << endl
+            << "ID 3" << endl
+            << "VERTEX2" << endl
+            << "X 66.1" << endl
+            << "Y -66.5" << endl
+            << "ENDPERIMETER" << endl
+            << "ENDZONE" << endl
+            << "ENDLAYER" << endl
+            << "ENDSCENARIO" << endl;
+
+            return s.str();
+        }
+
+        void testParallelParsingSCNGrammar() {
+            const uint32_t NUMBER_OF_ROADS = 200;
+            const string s = createLargeScenario(NUMBER_OF_ROADS);
+
+            ScenarioFactory &sf = ScenarioFactory::getInstance();
+            const uint32_t numberOfWorkers = sf.getNumberOfWorkers();
+            core::wrapper::TimeFactory &tf = core::wrapper::TimeFactory::getInstance();
+
+            sf.setNumberOfWorkers(0);
+            int64_t start = tf.getMonotonicNanoseconds();
+            Scenario sequential = sf.getScenario(s);
+            const int64_t durationSequential = tf.getMonotonicNanoseconds() - start;
+            TS_ASSERT(sf.getNumberOfPartsOfLastScenario() == 1);
+
+            sf.setNumberOfWorkers(1);
+            start = tf.getMonotonicNanoseconds();
+            Scenario split = sf.getScenario(s);
+            const int64_t durationSplit = tf.getMonotonicNanoseconds() - start;
+            TS_ASSERT(sf.getNumberOfPartsOfLastScenario() > 1);
+
+            sf.setNumberOfWorkers(4);
+            start = tf.getMonotonicNanoseconds();
+            Scenario parallel = sf.getScenario(s);
+            const int64_t durationParallel = tf.getMonotonicNanoseconds() - start;
+            TS_ASSERT(sf.getNumberOfPartsOfLastScenario() >= 4);
+
+            TS_ASSERT(parallel.getListOfLayers().size() == 1);
+            const vector<Road> &listOfRoads = parallel.getListOfLayers().at(0).getListOfRoads();
+            TS_ASSERT(listOfRoads.size() == NUMBER_OF_ROADS);
+            bool inOrder = true;
+            for (uint32_t i = 0; i < listOfRoads.size(); i++) {
+                inOrder &= (listOfRoads.at(i).getID() == i + 1);
+            }
+            TS_ASSERT(inOrder);
+            TS_ASSERT(parallel.getListOfLayers().at(0).getListOfZones().size() == 1);
+
+            // All results must be identical.
+            stringstream sstrSequential;
+            sstrSequential << sequential;
+            stringstream sstrSplit;
+            sstrSplit << split;
+            TS_ASSERT(sstrSequential.str() == sstrSplit.str());
+            stringstream sstrParallel;
+            sstrParallel << parallel;
+            TS_ASSERT(sstrSequential.str() == sstrParallel.str());
+
+            // Errors are reported for the complete document.
+            const string corrupt = s.substr(0, s.rfind("ENDROAD")) + "ENDROADX\n" + s.substr(s.rfind("ENDROAD") + 8);
+            bool failed = false;
+            try {
+                sf.getScenario(corrupt);
+            } catch (InvalidArgumentException &) {
+                failed = true;
+            }
+            TS_ASSERT(failed);
+            TS_ASSERT(sf.getNumberOfPartsOfLastScenario() == 1);
+
+            sf.setNumberOfWorkers(numberOfWorkers);
+
+            clog << "[ScenarioTest] Parsing " << NUMBER_OF_ROADS << " roads (" << s.size() << " bytes): entire document " << durationSequential/1000 << " us, split into parts " << durationSplit/1000 << " us, 4 workers " << durationParallel/1000 << " us." << endl;
+        }
+
+        void testSharedScenarioData() {
+            const string scn = createLargeScenario(5);
+            const Scenario scenario = ScenarioFactory::getInstance().getScenario(scn);
+
+            MemoryDecompressedData data;
+            data.add("scenario.scn", scn);
+            data.add("models/empty.objx", "");
+            data.add("models/model.objx", "Model");
+
+            stringstream compiledScenario;
+            CompiledScenario::write(compiledScenario, scn, scenario);
+
+            const uint32_t checksum = 0x1234abcd;
+            TS_ASSERT(SharedScenarioData::getName(checksum) == "scnx1234abcd");
+
+            const uint32_t SIZE = SharedScenarioData::getSize(data, compiledScenario.str(), NULL, NULL);
+            vector<uint64_t> segment(SIZE / sizeof(uint64_t) + 1, 0);
+            char *memory = reinterpret_cast<char*>(&segment[0]);
+
+            // Contents must fit into the segment.
+            TS_ASSERT(!SharedScenarioData::write(memory, SIZE - 1, checksum, data, compiledScenario.str(), NULL, NULL));
+            TS_ASSERT(SharedScenarioData::write(memory, SIZE, checksum, data, compiledScenario.str(), NULL, NULL));
+
+            {
+                SharedScenarioData shared(memory, SIZE, core::SharedPointer<core::wrapper::SharedMemory>());
+                TS_ASSERT(shared.isValid());
+                TS_ASSERT(shared.getChecksum() == checksum);
+                TS_ASSERT(shared.getListOfEntries().size() == 3);
+                TS_ASSERT(shared.getAerialImage() == NULL);
+                TS_ASSERT(shared.getHeightImage() == NULL);
+
+                // Entries are read from the segment without copying.
+                const char *buffer = NULL;
+                uint32_t length = 0;
+                TS_ASSERT(shared.getBufferFor("Models/Model.objx", buffer, length));
+                TS_ASSERT( (buffer >= memory) && (buffer < memory + SIZE) );
+                TS_ASSERT(string(buffer, length) == "Model");
+                TS_ASSERT(shared.getBufferFor("models/empty.objx", buffer, length));
+                TS_ASSERT( (buffer == NULL) && (length == 0) );
+                TS_ASSERT(!shared.getBufferFor("models/missing.objx", buffer, length));
+
+                istream *in = shared.getInputStreamFor("models/model.objx");
+                TS_ASSERT(in != NULL);
+                string contents;
+                (*in) >> contents;
+                TS_ASSERT(contents == "Model");
+
+                Scenario sharedScenario;
+                TS_ASSERT(shared.getScenario(sharedScenario));
+                stringstream sstrScenario;
+                sstrScenario << scenario;
+                stringstream sstrSharedScenario;
+                sstrSharedScenario << sharedScenario;
+                TS_ASSERT(sstrScenario.str() == sstrSharedScenario.str());
+            }
+
+            // Another scenario must not overwrite the segment.
+            TS_ASSERT(!SharedScenarioData::write(memory, SIZE, checksum + 1, data, compiledScenario.str(), NULL, NULL));
+
+            // Truncated segments must not be used.
+            SharedScenarioData truncated(memory, SIZE / 2, core::SharedPointer<core::wrapper::SharedMemory>());
+            TS_ASSERT(!truncated.isValid());
+
+            // Incomplete segments must not be used.
+            reinterpret_cast<uint32_t*>(memory)[4] = 0;
+            SharedScenarioData incomplete(memory, SIZE, core::SharedPointer<core::wrapper::SharedMemory>());
+            TS_ASSERT(!incomplete.isValid());
+            Scenario invalidScenario;
+            TS_ASSERT(!incomplete.getScenario(invalidScenario));
+
+            // Unknown formats must not be used.
+            memset(memory, 0, SIZE);
+            SharedScenarioData unknown(memory, SIZE, core::SharedPointer<core::wrapper::SharedMemory>());
+            TS_ASSERT(!unknown.isValid());
+        }
+
         void checkData(const Scenario &scn) {
             TS_ASSERT(scn.getHeader().getName() == "Test-Scenario");
             TS_ASSERT(scn.getHeader().getVersion() == "v1.0");
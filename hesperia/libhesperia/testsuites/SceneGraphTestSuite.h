@@ -27,8 +27,10 @@
 #include "hesperia/scenegraph/SceneNode.h"
 #include "hesperia/scenegraph/SceneNodeDescriptor.h"
 #include "hesperia/scenegraph/SceneNodeVisitor.h"
+#include "hesperia/scenegraph/primitives/Trace.h"
 
 using namespace std;
+using namespace core::data::environment;
 using namespace hesperia::scenegraph;
 
 class SceneNodePrettyPrinter : public SceneNodeVisitor {
@@ -164,6 +166,40 @@ class SceneGraphTest : public CxxTest::TestSuite {
             TS_ASSERT(snpp2.m_value.str() == "Root->Child 1->");
         }
 
+        void testTrace() {
+            hesperia::scenegraph::primitives::Trace trace(SceneNodeDescriptor("Trace"), 4, 1, Point3(1, 0, 0), 2);
+            TS_ASSERT(trace.getNumberOfPoints() == 0);
+            TS_ASSERT(trace.getCapacity() == 4);
+
+            TS_ASSERT(trace.add(Point3(0, 0, 0)));
+            // Too close to the previous point.
+            TS_ASSERT(!trace.add(Point3(0.5, 0, 0)));
+            TS_ASSERT(trace.add(Point3(1, 0, 0)));
+            TS_ASSERT(trace.add(Point3(2, 0, 0)));
+            TS_ASSERT(trace.add(Point3(3, 0, 0)));
+            TS_ASSERT(trace.getNumberOfPoints() == 4);
+            TS_ASSERT_DELTA(trace.getPoint(0).getX(), 0, 1e-9);
+
+            // The oldest points are overwritten.
+            TS_ASSERT(trace.add(Point3(4, 0, 0)));
+            TS_ASSERT(trace.add(Point3(5, 0, 0)));
+            TS_ASSERT(trace.getNumberOfPoints() == 4);
+            for (uint32_t i = 0; i < trace.getNumberOfPoints(); i++) {
+                TS_ASSERT_DELTA(trace.getPoint(i).getX(), i + 2, 1e-9);
+            }
+
+            // Rendering visits the trace as one node.
+            SceneNode root(SceneNodeDescriptor("Root"));
+            root.addChild(new hesperia::scenegraph::primitives::Trace(trace));
+            SceneNodePrettyPrinter snpp;
+            root.accept(snpp);
+            TS_ASSERT(snpp.m_value.str() == "Root->Trace->");
+
+            trace.clear();
+            TS_ASSERT(trace.getNumberOfPoints() == 0);
+            TS_ASSERT(trace.add(Point3(5, 0, 0)));
+        }
+
 };
 
 #endif /*HESPERIA_SCENEGRAPHTESTSUITE_H_*/
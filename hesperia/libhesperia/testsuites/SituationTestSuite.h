@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "core/exceptions/Exceptions.h"
+#include "core/wrapper/TimeFactory.h"
 #include "hesperia/data/situation/ComplexModel.h"
 #include "hesperia/data/situation/Immediately.h"
 #include "hesperia/data/situation/Object.h"
@@ -253,6 +254,82 @@ class SituationTest : public CxxTest::TestSuite {
             TS_ASSERT(!failed);
         }
 
+        void testParallelParsingSITGrammar() {
+            const uint32_t NUMBER_OF_OBJECTS = 300;
+
+            stringstream s;
+            s << "SITUATION" << " " << "Large-Situation" << endl
+            << "VERSION"  << " " << "v1.0" << endl
+            << "DATE"     << " " << "July-15-2008" << endl
+            << "SCENARIO"     << " " << "Test-Szenario" << endl;
+            for (uint32_t i = 1; i <= NUMBER_OF_OBJECTS; i++) {
+                s << "OBJECT" << " " << "Object" << i << endl
+                << "OBJECTID" << " " << i << endl
+                << "SHAPENAME" << " " << "Rectangle" << i << endl
+                << "RECTANGLE" << endl
+                << "HEIGHT" << " " << "1.5" << endl
+                << "COLOR" << endl
+                << "VERTEX3" << endl
+                << "X" << " " << "0.5" << endl
+                << "Y" << " " << "0.6" << endl
+                << "Z" << " " << "0.7" << endl
+                << "VERTEX2" << endl
+                << "X" << " " << (5.0 * i) << endl
+                << "Y" << " " << "12.2" << endl
+                << "LENGTH" << " " << "4.2" << endl
+                << "WIDTH" << " " << "1.8" << endl
+                << "ROTZ" << " " << "0" << endl
+                << "BEHAVIOR" << endl
+                << "POINTIDDRIVER" << endl
+                << "STARTTYPE" << endl
+                << "IMMEDIATELY" << endl
+                << "STOPTYPE" << endl
+                << "STOP" << endl
+                << "CONSTANTVELOCITY" << endl
+                << "V" << " " << "2.5" << endl
+                << "(1.1.1." << i << ")" << endl
+                << "(1.1.2." << i << ")" << endl
+                << "ENDOBJECT" << endl;
+            }
+            s << "ENDSITUATION" << endl;
+
+            SituationFactory &sf = SituationFactory::getInstance();
+            const uint32_t numberOfWorkers = sf.getNumberOfWorkers();
+            core::wrapper::TimeFactory &tf = core::wrapper::TimeFactory::getInstance();
+
+            sf.setNumberOfWorkers(0);
+            int64_t start = tf.getMonotonicNanoseconds();
+            Situation sequential = sf.getSituation(s.str());
+            const int64_t durationSequential = tf.getMonotonicNanoseconds() - start;
+            TS_ASSERT(sf.getNumberOfPartsOfLastSituation() == 1);
+
+            sf.setNumberOfWorkers(4);
+            start = tf.getMonotonicNanoseconds();
+            Situation parallel = sf.getSituation(s.str());
+            const int64_t durationParallel = tf.getMonotonicNanoseconds() - start;
+            TS_ASSERT(sf.getNumberOfPartsOfLastSituation() >= 4);
+
+            sf.setNumberOfWorkers(numberOfWorkers);
+
+            TS_ASSERT(parallel.getHeader().getName() == "Large-Situation");
+            const vector<Object> &listOfObjects = parallel.getListOfObjects();
+            TS_ASSERT(listOfObjects.size() == NUMBER_OF_OBJECTS);
+            bool inOrder = true;
+            for (uint32_t i = 0; i < listOfObjects.size(); i++) {
+                inOrder &= (listOfObjects.at(i).getID() == i + 1);
+            }
+            TS_ASSERT(inOrder);
+
+            // Both results must be identical.
+            stringstream sstrSequential;
+            sstrSequential << sequential;
+            stringstream sstrParallel;
+            sstrParallel << parallel;
+            TS_ASSERT(sstrSequential.str() == sstrParallel.str());
+
+            clog << "[SituationTest] Parsing " << NUMBER_OF_OBJECTS << " objects (" << s.str().size() << " bytes): entire document " << durationSequential/1000 << " us, 4 workers " << durationParallel/1000 << " us." << endl;
+        }
+
         void checkData(const Situation &sit) {
             TS_ASSERT(sit.getHeader().getName() == "Test-Situation");
             TS_ASSERT(sit.getHeader().getVersion() == "v1.0");
@@ -0,0 +1,230 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_VERTEXBUFFERTESTSUITE_H_
+#define HESPERIA_VERTEXBUFFERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+
+#include "core/data/Constants.h"
+#include "core/data/environment/Point3.h"
+#include "hesperia/threeD/Material.h"
+#include "hesperia/threeD/StaticGeometryBatch.h"
+#include "hesperia/threeD/TransformationMatrix.h"
+#include "hesperia/threeD/VertexBuffer.h"
+
+using namespace std;
+using namespace core::data;
+using namespace core::data::environment;
+using namespace hesperia::threeD;
+
+class VertexBufferTest : public CxxTest::TestSuite {
+    public:
+        VertexBuffer createQuad(const double &offset) {
+            VertexBuffer vb(VertexBuffer::TRIANGLES);
+            vb.setNormal(Point3(0, 0, 1));
+            const uint32_t a = vb.addVertex(Point3(offset, 0, 0));
+            const uint32_t b = vb.addVertex(Point3(offset + 1, 0, 0));
+            const uint32_t c = vb.addVertex(Point3(offset + 1, 1, 0));
+            const uint32_t d = vb.addVertex(Point3(offset, 1, 0));
+            vb.addQuad(a, b, c, d);
+            return vb;
+        }
+
+        void testQuadAsTriangles() {
+            VertexBuffer vb = createQuad(0);
+            TS_ASSERT(vb.getNumberOfVertices() == 4);
+            TS_ASSERT(vb.getNumberOfIndices() == 6);
+            TS_ASSERT(vb.hasNormals());
+            TS_ASSERT(!vb.hasTextureCoordinates());
+            TS_ASSERT(!vb.hasColors());
+
+            const uint32_t *indices = vb.getIndexData();
+            TS_ASSERT(indices[0] == 0);
+            TS_ASSERT(indices[1] == 1);
+            TS_ASSERT(indices[2] == 2);
+            TS_ASSERT(indices[3] == 0);
+            TS_ASSERT(indices[4] == 2);
+            TS_ASSERT(indices[5] == 3);
+
+            TS_ASSERT_DELTA(vb.getPosition(2).getX(), 1, 1e-6);
+            TS_ASSERT_DELTA(vb.getPosition(2).getY(), 1, 1e-6);
+            TS_ASSERT_DELTA(vb.getVertexData()[2 * VertexBuffer::FLOATS_PER_VERTEX + VertexBuffer::POSITION + 1], 1, 1e-6);
+            TS_ASSERT_DELTA(vb.getColor(0).getX(), 1, 1e-6);
+
+            vb.clear();
+            TS_ASSERT(vb.getNumberOfVertices() == 0);
+            TS_ASSERT(vb.getIndexData() == NULL);
+        }
+
+        void testAppend() {
+            VertexBuffer vb = createQuad(0);
+            TS_ASSERT(vb.append(createQuad(5)));
+            TS_ASSERT(vb.getNumberOfVertices() == 8);
+            TS_ASSERT(vb.getNumberOfIndices() == 12);
+            TS_ASSERT(vb.getIndexData()[6] == 4);
+            TS_ASSERT(vb.getIndexData()[11] == 7);
+            TS_ASSERT_DELTA(vb.getPosition(vb.getIndexData()[11]).getX(), 5, 1e-6);
+
+            VertexBuffer lines(VertexBuffer::LINES);
+            TS_ASSERT(!vb.append(lines));
+        }
+
+        void testTransformation() {
+            // glTranslated(10, 20, 30); glRotated(90, 1, 0, 0); glRotated(90, 0, 1, 0); glScaled(2, 3, 4);
+            const TransformationMatrix t(Point3(10, 20, 30), Point3(Constants::PI / 2.0, Constants::PI / 2.0, 0), Point3(2, 3, 4));
+
+            // Rx(90) * Ry(90) = [0 0 1; 1 0 0; 0 1 0], scaled by columns and in column-major order.
+            const double expected[16] = { 0, 2, 0, 0,
+                                          0, 0, 3, 0,
+                                          4, 0, 0, 0,
+                                          10, 20, 30, 1 };
+            const double *M = t.getMatrix();
+            for (uint32_t i = 0; i < 16; i++) {
+                TS_ASSERT_DELTA(M[i], expected[i], 1e-9);
+            }
+
+            // glRotated turns the X axis towards -Z around the Y axis.
+            const Point3 x = TransformationMatrix(Point3(), Point3(0, 0.3, 0), Point3(1, 1, 1)).transformPoint(Point3(1, 0, 0));
+            TS_ASSERT_DELTA(x.getX(), cos(0.3), 1e-9);
+            TS_ASSERT_DELTA(x.getY(), 0, 1e-9);
+            TS_ASSERT_DELTA(x.getZ(), -sin(0.3), 1e-9);
+
+            // ... and the Y axis towards +Z around the X axis and towards -X around the Z axis.
+            const Point3 y = TransformationMatrix(Point3(), Point3(0.3, 0, 0), Point3(1, 1, 1)).transformPoint(Point3(0, 1, 0));
+            TS_ASSERT_DELTA(y.getY(), cos(0.3), 1e-9);
+            TS_ASSERT_DELTA(y.getZ(), sin(0.3), 1e-9);
+            const Point3 y2 = TransformationMatrix(Point3(), Point3(0, 0, 0.3), Point3(1, 1, 1)).transformPoint(Point3(0, 1, 0));
+            TS_ASSERT_DELTA(y2.getX(), -sin(0.3), 1e-9);
+            TS_ASSERT_DELTA(y2.getY(), cos(0.3), 1e-9);
+
+            // Normals are corrected for non-uniform scaling.
+            const Point3 n = TransformationMatrix(Point3(), Point3(), Point3(1, 4, 1)).transformNormal(Point3(1, 1, 0));
+            TS_ASSERT_DELTA(n.getX(), 4 / sqrt(17.0), 1e-9);
+            TS_ASSERT_DELTA(n.getY(), 1 / sqrt(17.0), 1e-9);
+            TS_ASSERT_DELTA(n.getZ(), 0, 1e-9);
+            TS_ASSERT_DELTA(t.getMaximumScaling(), 4, 1e-9);
+        }
+
+        void testTransform() {
+            VertexBuffer vb(VertexBuffer::TRIANGLES);
+            vb.setNormal(Point3(1, 0, 0));
+            vb.addVertex(Point3(1, 2, 3));
+
+            vb.transform(Point3(10, 20, 30), Point3(Constants::PI / 2.0, Constants::PI / 2.0, 0), Point3(2, 3, 4));
+
+            // Scaled to (2, 6, 12), rotated to (12, 6, -2) around Y and to (12, 2, 6) around X, and translated.
+            const Point3 p = vb.getPosition(0);
+            TS_ASSERT_DELTA(p.getX(), 22, 1e-4);
+            TS_ASSERT_DELTA(p.getY(), 22, 1e-4);
+            TS_ASSERT_DELTA(p.getZ(), 36, 1e-4);
+
+            // The normal along X is rotated like the X axis, i.e. to Y.
+            const Point3 n = vb.getNormal(0);
+            TS_ASSERT_DELTA(n.getX(), 0, 1e-4);
+            TS_ASSERT_DELTA(n.getY(), 1, 1e-4);
+            TS_ASSERT_DELTA(n.getZ(), 0, 1e-4);
+        }
+
+        void testStaticGeometryBatch() {
+            Material red("red");
+            red.setDiffuse(Point3(1, 0, 0));
+            Material green("green");
+            green.setDiffuse(Point3(0, 1, 0));
+            Material otherRed("otherRed");
+            otherRed.setDiffuse(Point3(1, 0, 0));
+
+            TS_ASSERT(StaticGeometryBatch::isEqual(red, otherRed));
+            TS_ASSERT(!StaticGeometryBatch::isEqual(red, green));
+
+            StaticGeometryBatch batch;
+            for (uint32_t i = 0; i < 100; i++) {
+                batch.add(((i % 2) == 0) ? red : otherRed, createQuad(i));
+                batch.add(green, createQuad(-1.0 * i));
+            }
+            VertexBuffer lines(VertexBuffer::LINES);
+            const uint32_t a = lines.addVertex(Point3(0, 0, 0));
+            const uint32_t b = lines.addVertex(Point3(1, 0, 0));
+            lines.addLine(a, b);
+            batch.add(red, lines);
+
+            TS_ASSERT(batch.getNumberOfAddedVertexBuffers() == 201);
+            TS_ASSERT(batch.getNumberOfBatches() == 3);
+            TS_ASSERT(batch.getVertexBuffer(0).getNumberOfVertices() == 400);
+            TS_ASSERT(batch.getVertexBuffer(0).getNumberOfIndices() == 600);
+            TS_ASSERT(batch.getVertexBuffer(1).getNumberOfVertices() == 400);
+            TS_ASSERT(batch.getVertexBuffer(2).getPrimitive() == VertexBuffer::LINES);
+            TS_ASSERT_DELTA(batch.getMaterial(1).getDiffuse().getY(), 1, 1e-6);
+        }
+
+        void testBoundingSphere() {
+            TS_ASSERT(!VertexBuffer().getBoundingSphere().isValid());
+
+            VertexBuffer vb = createQuad(2);
+            const BoundingSphere s = vb.getBoundingSphere();
+            TS_ASSERT(s.isValid());
+            TS_ASSERT_DELTA(s.getCenter().getX(), 2.5, 1e-6);
+            TS_ASSERT_DELTA(s.getCenter().getY(), 0.5, 1e-6);
+            TS_ASSERT_DELTA(s.getRadius(), sqrt(0.5), 1e-6);
+        }
+
+        void testSimplify() {
+            // Grid of 10x10 quads covering [0, 1] x [0, 1].
+            VertexBuffer grid(VertexBuffer::TRIANGLES);
+            grid.setNormal(Point3(0, 0, 1));
+            for (uint32_t y = 0; y <= 10; y++) {
+                for (uint32_t x = 0; x <= 10; x++) {
+                    grid.addVertex(Point3(x / 10.0, y / 10.0, 0));
+                }
+            }
+            for (uint32_t y = 0; y < 10; y++) {
+                for (uint32_t x = 0; x < 10; x++) {
+                    grid.addQuad(y * 11 + x, y * 11 + x + 1, (y + 1) * 11 + x + 1, (y + 1) * 11 + x);
+                }
+            }
+            TS_ASSERT(grid.getNumberOfIndices() == 600);
+
+            // Cubes of 0.5 m result in 3x3 vertices.
+            const VertexBuffer simplified = grid.simplify(0.5);
+            TS_ASSERT(simplified.getNumberOfVertices() == 9);
+            TS_ASSERT(simplified.getNumberOfIndices() > 0);
+            TS_ASSERT(simplified.getNumberOfIndices() < 600);
+            TS_ASSERT((simplified.getNumberOfIndices() % 3) == 0);
+            TS_ASSERT(simplified.hasNormals());
+
+            bool noDegeneratedTriangles = true;
+            const uint32_t *indices = simplified.getIndexData();
+            for (uint32_t i = 0; i < simplified.getNumberOfIndices(); i += 3) {
+                noDegeneratedTriangles &= (indices[i] != indices[i + 1]) && (indices[i + 1] != indices[i + 2]) && (indices[i] != indices[i + 2]);
+            }
+            TS_ASSERT(noDegeneratedTriangles);
+
+            // Merged vertices are placed at the mean position of their cell.
+            TS_ASSERT_DELTA(simplified.getPosition(0).getX(), 0.2, 1e-6);
+            TS_ASSERT_DELTA(simplified.getPosition(0).getY(), 0.2, 1e-6);
+            TS_ASSERT_DELTA(simplified.getNormal(0).getZ(), 1, 1e-6);
+
+            // Without cubes, the geometry is kept.
+            TS_ASSERT(grid.simplify(0).getNumberOfIndices() == 600);
+        }
+};
+
+#endif /*HESPERIA_VERTEXBUFFERTESTSUITE_H_*/
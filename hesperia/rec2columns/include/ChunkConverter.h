@@ -0,0 +1,107 @@
+/**
+ * rec2columns - Tool for exporting recordings into columnar files (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef CHUNKCONVERTER_H_
+#define CHUNKCONVERTER_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "core/platform.h"
+#include "core/base/Condition.h"
+#include "core/base/Service.h"
+
+namespace rec2columns {
+
+    using namespace std;
+
+    /**
+     * This class converts a chunk of serialized containers into
+     * rows of columns (cf. hesperia::decorator::Data2Columns) in its
+     * own thread.
+     */
+    class ChunkConverter : public core::base::Service {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             */
+            ChunkConverter(const ChunkConverter &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             */
+            ChunkConverter& operator=(const ChunkConverter &/*obj*/);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param selectedDataTypes Data types to be converted.
+             * @param start Smallest sent time stamp in microseconds to be converted.
+             * @param end Greatest sent time stamp in microseconds to be converted.
+             */
+            ChunkConverter(const set<uint32_t> &selectedDataTypes, const double &start, const double &end);
+
+            virtual ~ChunkConverter();
+
+            /**
+             * This method starts the conversion of the given chunk.
+             *
+             * @param records Serialized containers; the list is swapped with an empty list.
+             */
+            void convert(vector<string> &records);
+
+            /**
+             * This method waits until the chunk passed to convert was
+             * converted.
+             *
+             * @return Rows (consecutive values) for every data type.
+             */
+            const map<uint32_t, vector<double> >& waitForRows();
+
+        protected:
+            virtual void beforeStop();
+
+            virtual void run();
+
+        private:
+            void convertRecords();
+
+        private:
+            const set<uint32_t> m_selectedDataTypes;
+            const double m_start;
+            const double m_end;
+
+            core::base::Condition m_condition;
+            bool m_hasRecords;
+            bool m_isConverted;
+            vector<string> m_records;
+            map<uint32_t, vector<double> > m_rows;
+    };
+
+} // rec2columns
+
+#endif /*CHUNKCONVERTER_H_*/
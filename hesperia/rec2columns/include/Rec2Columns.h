@@ -0,0 +1,99 @@
+/**
+ * rec2columns - Tool for exporting recordings into columnar files (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef REC2COLUMNS_H_
+#define REC2COLUMNS_H_
+
+#include <iostream>
+#include <string>
+
+#include "core/platform.h"
+
+namespace rec2columns {
+
+    using namespace std;
+
+    /**
+     * This class exports a recording into one pair of files per
+     * DATATYPE for offline analysis:
+     *
+     * <output>.<DataType>.columns lists the names of the columns (one per line),
+     * <output>.<DataType>.f64 contains all rows as consecutive doubles in host byte order.
+     *
+     * The first two columns are the sent and received time stamps in
+     * microseconds (cf. hesperia::decorator::Data2Columns). Chunks of
+     * containers are deserialized in parallel and written in the
+     * order of the recording.
+     *
+     * Usage: rec2columns --rec=file.rec [--output=prefix] [--types=EgoState,VehicleData,...]
+     *                    [--start=seconds] [--end=seconds] [--threads=n]
+     *
+     * start and end are relative to the sent time stamp of the first
+     * container in the recording.
+     */
+    class Rec2Columns {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             */
+            Rec2Columns(const Rec2Columns &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             */
+            Rec2Columns& operator=(const Rec2Columns &/*obj*/);
+
+        public:
+            enum CONSTANTS {
+                CONTAINERS_PER_CHUNK = 4096,
+                DEFAULT_NUMBER_OF_THREADS = 4
+            };
+
+            Rec2Columns();
+
+            virtual ~Rec2Columns();
+
+            /**
+             * This method exports the recording given on command line.
+             *
+             * @param argc Number of command line arguments.
+             * @param argv Command line arguments.
+             * @return 0 if the recording could be exported.
+             */
+            int32_t run(const int32_t &argc, char **argv);
+
+            /**
+             * This method reads the next serialized container without
+             * deserializing it.
+             *
+             * @param in Stream to read from.
+             * @param record Serialized container.
+             * @return true if a complete container was read.
+             */
+            static bool readRecord(istream &in, string &record);
+    };
+
+} // rec2columns
+
+#endif /*REC2COLUMNS_H_*/
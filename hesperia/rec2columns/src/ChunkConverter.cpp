@@ -0,0 +1,119 @@
+/**
+ * rec2columns - Tool for exporting recordings into columnar files (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <sstream>
+
+#include "core/base/Lock.h"
+#include "core/data/Container.h"
+
+#include "hesperia/decorator/Data2Columns.h"
+
+#include "ChunkConverter.h"
+
+namespace rec2columns {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data;
+    using namespace hesperia::decorator;
+
+    ChunkConverter::ChunkConverter(const set<uint32_t> &selectedDataTypes, const double &start, const double &end) :
+        m_selectedDataTypes(selectedDataTypes),
+        m_start(start),
+        m_end(end),
+        m_condition(),
+        m_hasRecords(false),
+        m_isConverted(false),
+        m_records(),
+        m_rows() {}
+
+    ChunkConverter::~ChunkConverter() {}
+
+    void ChunkConverter::convert(vector<string> &records) {
+        Lock l(m_condition);
+        m_records.clear();
+        m_records.swap(records);
+        m_hasRecords = true;
+        m_isConverted = false;
+        m_condition.wakeAll();
+    }
+
+    const map<uint32_t, vector<double> >& ChunkConverter::waitForRows() {
+        Lock l(m_condition);
+        while (!m_isConverted) {
+            m_condition.waitOnSignal();
+        }
+        return m_rows;
+    }
+
+    void ChunkConverter::beforeStop() {
+        Lock l(m_condition);
+        m_condition.wakeAll();
+    }
+
+    void ChunkConverter::run() {
+        serviceReady();
+
+        while (true) {
+            {
+                Lock l(m_condition);
+                while (!m_hasRecords && isRunning()) {
+                    m_condition.waitOnSignal();
+                }
+                if (!m_hasRecords) {
+                    break;
+                }
+            }
+
+            // The records are not touched by convert() until they are converted.
+            convertRecords();
+
+            {
+                Lock l(m_condition);
+                m_hasRecords = false;
+                m_isConverted = true;
+                m_condition.wakeAll();
+            }
+        }
+    }
+
+    void ChunkConverter::convertRecords() {
+        m_rows.clear();
+
+        Container c;
+        vector<string>::const_iterator it = m_records.begin();
+        while (it != m_records.end()) {
+            stringstream record(*it++);
+            record >> c;
+
+            if (m_selectedDataTypes.count(c.getDataType()) == 0) {
+                continue;
+            }
+
+            const double sent = static_cast<double>(c.getSentTimeStamp().toMicroseconds());
+            if ( (sent < m_start) || (sent > m_end) ) {
+                continue;
+            }
+
+            Data2Columns::toColumns(c, m_rows[c.getDataType()]);
+        }
+    }
+
+} // rec2columns
@@ -0,0 +1,258 @@
+/**
+ * rec2columns - Tool for exporting recordings into columnar files (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "core/macros.h"
+#include "core/StringToolbox.h"
+#include "core/base/CommandLineParser.h"
+#include "core/data/Container.h"
+
+#include "hesperia/decorator/Data2Columns.h"
+
+#include "ChunkConverter.h"
+#include "Rec2Columns.h"
+
+namespace rec2columns {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data;
+    using namespace hesperia::decorator;
+
+    Rec2Columns::Rec2Columns() {}
+
+    Rec2Columns::~Rec2Columns() {}
+
+    bool Rec2Columns::readRecord(istream &in, string &record) {
+        // Serialized containers consist of magic number, length, payload, and a trailing ','.
+        const uint32_t HEADER_SIZE = sizeof(uint16_t) + sizeof(uint32_t);
+
+        char header[HEADER_SIZE];
+        in.read(header, HEADER_SIZE);
+        if (static_cast<uint32_t>(in.gcount()) != HEADER_SIZE) {
+            return false;
+        }
+
+        uint16_t magicNumber = 0;
+        memcpy(&magicNumber, header, sizeof(uint16_t));
+        if (ntohs(magicNumber) != 0xAACF) {
+            cerr << "(rec2columns) Stream corrupt: magic number not found." << endl;
+            return false;
+        }
+
+        uint32_t length = 0;
+        memcpy(&length, header + sizeof(uint16_t), sizeof(uint32_t));
+        length = ntohl(length);
+
+        record.resize(HEADER_SIZE + length + 1);
+        memcpy(&record[0], header, HEADER_SIZE);
+        in.read(&record[HEADER_SIZE], length + 1);
+
+        return (static_cast<uint32_t>(in.gcount()) == (length + 1));
+    }
+
+    int32_t Rec2Columns::run(const int32_t &argc, char **argv) {
+        CommandLineParser cmdParser;
+        cmdParser.addCommandLineArgument("rec");
+        cmdParser.addCommandLineArgument("output");
+        cmdParser.addCommandLineArgument("types");
+        cmdParser.addCommandLineArgument("start");
+        cmdParser.addCommandLineArgument("end");
+        cmdParser.addCommandLineArgument("threads");
+
+        cmdParser.parse(argc, argv);
+
+        CommandLineArgument cmdArgumentREC = cmdParser.getCommandLineArgument("rec");
+        CommandLineArgument cmdArgumentOUTPUT = cmdParser.getCommandLineArgument("output");
+        CommandLineArgument cmdArgumentTYPES = cmdParser.getCommandLineArgument("types");
+        CommandLineArgument cmdArgumentSTART = cmdParser.getCommandLineArgument("start");
+        CommandLineArgument cmdArgumentEND = cmdParser.getCommandLineArgument("end");
+        CommandLineArgument cmdArgumentTHREADS = cmdParser.getCommandLineArgument("threads");
+
+        if (!cmdArgumentREC.isSet()) {
+            cerr << "Usage: " << argv[0] << " --rec=file.rec [--output=prefix] [--types=EgoState,VehicleData,...] [--start=seconds] [--end=seconds] [--threads=n]" << endl;
+            return 1;
+        }
+
+        string recFileName = cmdArgumentREC.getValue<string>();
+        core::StringToolbox::trim(recFileName);
+
+        string output = recFileName;
+        if (cmdArgumentOUTPUT.isSet()) {
+            output = cmdArgumentOUTPUT.getValue<string>();
+            core::StringToolbox::trim(output);
+        }
+
+        // Select data types to be exported.
+        const vector<Container::DATATYPE> listOfSupportedDataTypes = Data2Columns::getListOfSupportedDataTypes();
+        set<uint32_t> selectedDataTypes;
+        if (cmdArgumentTYPES.isSet()) {
+            const string types = cmdArgumentTYPES.getValue<string>();
+            vector<string> listOfTypes = core::StringToolbox::split(types, ',');
+            if (listOfTypes.empty()) {
+                // split returns no token for a string without delimiter.
+                listOfTypes.push_back(types);
+            }
+            vector<string>::iterator it = listOfTypes.begin();
+            while (it != listOfTypes.end()) {
+                string type = (*it++);
+                core::StringToolbox::trim(type);
+
+                bool found = false;
+                for (uint32_t i = 0; i < listOfSupportedDataTypes.size(); i++) {
+                    if (Data2Columns::getName(listOfSupportedDataTypes[i]) == type) {
+                        selectedDataTypes.insert(listOfSupportedDataTypes[i]);
+                        found = true;
+                    }
+                }
+                if (!found) {
+                    cerr << "(rec2columns) Unsupported type '" << type << "'." << endl;
+                    return 1;
+                }
+            }
+        }
+        else {
+            selectedDataTypes.insert(listOfSupportedDataTypes.begin(), listOfSupportedDataTypes.end());
+        }
+
+        uint32_t numberOfThreads = Rec2Columns::DEFAULT_NUMBER_OF_THREADS;
+        if (cmdArgumentTHREADS.isSet()) {
+            numberOfThreads = max(cmdArgumentTHREADS.getValue<uint32_t>(), static_cast<uint32_t>(1));
+        }
+
+        ifstream in(recFileName.c_str(), ios::in | ios::binary);
+        if (!in.good()) {
+            cerr << "(rec2columns) Could not open " << recFileName << "." << endl;
+            return 1;
+        }
+
+        // The time range is relative to the first container.
+        string firstRecord;
+        if (!readRecord(in, firstRecord)) {
+            cerr << "(rec2columns) " << recFileName << " does not contain any container." << endl;
+            return 1;
+        }
+        Container first;
+        {
+            stringstream sstr(firstRecord);
+            sstr >> first;
+        }
+        const double firstSent = static_cast<double>(first.getSentTimeStamp().toMicroseconds());
+        const double start = firstSent + (cmdArgumentSTART.isSet() ? cmdArgumentSTART.getValue<double>() * 1000 * 1000 : 0);
+        const double end = cmdArgumentEND.isSet() ? (firstSent + cmdArgumentEND.getValue<double>() * 1000 * 1000) : numeric_limits<double>::max();
+
+        vector<ChunkConverter*> listOfConverters;
+        for (uint32_t i = 0; i < numberOfThreads; i++) {
+            listOfConverters.push_back(new ChunkConverter(selectedDataTypes, start, end));
+            listOfConverters.back()->start();
+        }
+
+        map<uint32_t, ofstream*> outputs;
+        map<uint32_t, uint32_t> numberOfRows;
+
+        vector<string> chunk;
+        chunk.push_back(firstRecord);
+        bool hasMoreRecords = true;
+        while (hasMoreRecords) {
+            // Read one chunk per converter; conversion starts while the next chunk is read.
+            uint32_t numberOfChunks = 0;
+            for (uint32_t i = 0; (i < listOfConverters.size()) && hasMoreRecords; i++) {
+                string record;
+                while (chunk.size() < Rec2Columns::CONTAINERS_PER_CHUNK) {
+                    if (!readRecord(in, record)) {
+                        hasMoreRecords = false;
+                        break;
+                    }
+                    chunk.push_back(string());
+                    chunk.back().swap(record);
+                }
+
+                if (!chunk.empty()) {
+                    listOfConverters[i]->convert(chunk);
+                    numberOfChunks++;
+                }
+            }
+
+            // Write the converted chunks in order.
+            for (uint32_t i = 0; i < numberOfChunks; i++) {
+                const map<uint32_t, vector<double> > &rows = listOfConverters[i]->waitForRows();
+
+                map<uint32_t, vector<double> >::const_iterator it = rows.begin();
+                while (it != rows.end()) {
+                    const uint32_t dataType = it->first;
+                    const vector<double> &values = it->second;
+                    ++it;
+
+                    if (values.empty()) {
+                        continue;
+                    }
+
+                    const string name = Data2Columns::getName(static_cast<Container::DATATYPE>(dataType));
+                    if (outputs.count(dataType) == 0) {
+                        // Write the names of the columns.
+                        const string columnsFileName = output + "." + name + ".columns";
+                        ofstream columns(columnsFileName.c_str(), ios::out | ios::trunc);
+                        const vector<string> columnNames = Data2Columns::getColumnNames(static_cast<Container::DATATYPE>(dataType));
+                        for (uint32_t j = 0; j < columnNames.size(); j++) {
+                            columns << columnNames[j] << "\n";
+                        }
+
+                        const string dataFileName = output + "." + name + ".f64";
+                        outputs[dataType] = new ofstream(dataFileName.c_str(), ios::out | ios::binary | ios::trunc);
+                        numberOfRows[dataType] = 0;
+                    }
+
+                    outputs[dataType]->write(reinterpret_cast<const char*>(&values[0]), values.size() * sizeof(double));
+                    numberOfRows[dataType] += values.size() / Data2Columns::getColumnNames(static_cast<Container::DATATYPE>(dataType)).size();
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < listOfConverters.size(); i++) {
+            listOfConverters[i]->stop();
+            OPENDAVINCI_CORE_DELETE_POINTER(listOfConverters[i]);
+        }
+
+        int32_t retVal = 0;
+        map<uint32_t, ofstream*>::iterator it = outputs.begin();
+        while (it != outputs.end()) {
+            it->second->flush();
+            if (!it->second->good()) {
+                cerr << "(rec2columns) Could not write " << Data2Columns::getName(static_cast<Container::DATATYPE>(it->first)) << "." << endl;
+                retVal = 1;
+            }
+            clog << "(rec2columns) Exported " << numberOfRows[it->first] << " rows of " << Data2Columns::getName(static_cast<Container::DATATYPE>(it->first))
+                 << " to " << output << "." << Data2Columns::getName(static_cast<Container::DATATYPE>(it->first)) << ".f64." << endl;
+            OPENDAVINCI_CORE_DELETE_POINTER(it->second);
+            ++it;
+        }
+
+        return retVal;
+    }
+
+} // rec2columns
@@ -0,0 +1,233 @@
+/**
+ * rec2columns - Tool for exporting recordings into columnar files (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef REC2COLUMNSTESTSUITE_H_
+#define REC2COLUMNSTESTSUITE_H_
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cxxtest/TestSuite.h"
+
+#include "core/platform.h"
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+#include "core/data/control/VehicleControl.h"
+#include "core/data/environment/Point3.h"
+
+#include "hesperia/data/environment/EgoState.h"
+#include "hesperia/decorator/Data2Columns.h"
+
+// Include local header files.
+#include "../include/ChunkConverter.h"
+#include "../include/Rec2Columns.h"
+
+using namespace std;
+using namespace core::data;
+using namespace core::data::control;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+using namespace hesperia::decorator;
+using namespace rec2columns;
+
+/**
+ * The actual testsuite starts here.
+ */
+class Rec2ColumnsTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * Returns the i-th EgoState container of the test data.
+         */
+        Container createEgoState(const uint32_t &i) {
+            EgoState es(Point3(i, 2 * i, 0), Point3(0, 0, 0.5), Point3(1, 0, 0), Point3(0, 0, 0));
+            Container c(Container::EGOSTATE, es);
+            c.setSentTimeStamp(TimeStamp(i, 0));
+            c.setReceivedTimeStamp(TimeStamp(i, 500));
+            return c;
+        }
+
+        /**
+         * Returns the i-th VehicleControl container of the test data.
+         */
+        Container createVehicleControl(const uint32_t &i) {
+            VehicleControl vc;
+            vc.setSpeed(i / 10.0);
+            vc.setBrakeLights(i % 2 == 0);
+            Container c(Container::VEHICLECONTROL, vc);
+            c.setSentTimeStamp(TimeStamp(i, 100));
+            c.setReceivedTimeStamp(TimeStamp(i, 600));
+            return c;
+        }
+
+        /**
+         * Returns the contents of a file.
+         */
+        string readFile(const string &fileName) {
+            ifstream in(fileName.c_str(), ios::in | ios::binary);
+            stringstream sstr;
+            sstr << in.rdbuf();
+            return sstr.str();
+        }
+
+        void testReadRecord() {
+            stringstream sstr;
+            sstr << createEgoState(1) << createVehicleControl(2) << createEgoState(3);
+
+            vector<string> records;
+            string record;
+            while (Rec2Columns::readRecord(sstr, record)) {
+                records.push_back(record);
+            }
+            TS_ASSERT(records.size() == 3);
+
+            // Every record contains exactly one serialized container.
+            for (uint32_t i = 0; i < records.size(); i++) {
+                stringstream in(records.at(i));
+                Container c;
+                in >> c;
+                TS_ASSERT(c.getSentTimeStamp().getSeconds() == static_cast<int32_t>(i + 1));
+                TS_ASSERT(c.getDataType() == ((i == 1) ? Container::VEHICLECONTROL : Container::EGOSTATE));
+                TS_ASSERT(in.peek() == EOF);
+            }
+
+            // A truncated record is not returned.
+            stringstream truncated(records.at(0) + records.at(1).substr(0, records.at(1).size() - 1));
+            TS_ASSERT(Rec2Columns::readRecord(truncated, record));
+            TS_ASSERT(record == records.at(0));
+            TS_ASSERT(!Rec2Columns::readRecord(truncated, record));
+
+            // A record without magic number is rejected.
+            stringstream corrupt("XXXXXXXXXX");
+            TS_ASSERT(!Rec2Columns::readRecord(corrupt, record));
+        }
+
+        void testChunkConverter() {
+            set<uint32_t> selectedDataTypes;
+            selectedDataTypes.insert(Container::VEHICLECONTROL);
+
+            // Only containers sent between 2s and 4s are converted.
+            ChunkConverter cc(selectedDataTypes, 2 * 1000 * 1000, 4 * 1000 * 1000 + 100);
+            cc.start();
+
+            for (uint32_t chunk = 0; chunk < 2; chunk++) {
+                vector<string> records;
+                for (uint32_t i = 0; i < 6; i++) {
+                    stringstream sstr;
+                    sstr << createEgoState(i) << createVehicleControl(i + chunk);
+                    string record;
+                    while (Rec2Columns::readRecord(sstr, record)) {
+                        records.push_back(record);
+                    }
+                }
+                TS_ASSERT(records.size() == 12);
+
+                // The records are handed over to the converter without copying.
+                cc.convert(records);
+                TS_ASSERT(records.empty());
+
+                const map<uint32_t, vector<double> > &rows = cc.waitForRows();
+                TS_ASSERT(rows.size() == 1);
+                TS_ASSERT(rows.count(Container::VEHICLECONTROL) == 1);
+
+                const vector<double> &values = rows.find(Container::VEHICLECONTROL)->second;
+                const uint32_t COLUMNS = Data2Columns::getColumnNames(Container::VEHICLECONTROL).size();
+                TS_ASSERT(COLUMNS == 8);
+                TS_ASSERT(values.size() == 3 * COLUMNS);
+
+                for (uint32_t row = 0; (row < 3) && (values.size() == 3 * COLUMNS); row++) {
+                    const uint32_t i = 2 + row;
+                    TS_ASSERT_DELTA(values.at(row * COLUMNS + 0), i * 1000 * 1000 + 100, 1e-3);
+                    TS_ASSERT_DELTA(values.at(row * COLUMNS + 1), i * 1000 * 1000 + 600, 1e-3);
+                    TS_ASSERT_DELTA(values.at(row * COLUMNS + 2), i / 10.0, 1e-9);
+                    TS_ASSERT_DELTA(values.at(row * COLUMNS + 5), (i % 2 == 0) ? 1 : 0, 1e-9);
+                }
+            }
+
+            cc.stop();
+        }
+
+        void testExportAcrossChunks() {
+            // More containers than fit into two chunks; thus, two converters are used twice.
+            const uint32_t NUMBER_OF_EGOSTATES = 2 * Rec2Columns::CONTAINERS_PER_CHUNK + 10;
+            {
+                ofstream out("Rec2ColumnsTest.rec", ios::out | ios::binary | ios::trunc);
+                for (uint32_t i = 0; i < NUMBER_OF_EGOSTATES; i++) {
+                    out << createEgoState(i);
+                    if (i % 1000 == 0) {
+                        out << createVehicleControl(i);
+                    }
+                }
+            }
+
+            string argv0("rec2columns");
+            string argv1("--rec=Rec2ColumnsTest.rec");
+            string argv2("--output=Rec2ColumnsTest");
+            string argv3("--threads=2");
+            int32_t argc = 4;
+            char **argv;
+            argv = new char*[4];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+            argv[3] = const_cast<char*>(argv3.c_str());
+
+            Rec2Columns r2c;
+            TS_ASSERT(r2c.run(argc, argv) == 0);
+            delete [] argv;
+
+            const vector<string> columnNames = Data2Columns::getColumnNames(Container::EGOSTATE);
+            stringstream expectedColumns;
+            for (uint32_t i = 0; i < columnNames.size(); i++) {
+                expectedColumns << columnNames.at(i) << "\n";
+            }
+            TS_ASSERT(readFile("Rec2ColumnsTest.EgoState.columns") == expectedColumns.str());
+
+            // All rows are written in the order of the recording.
+            const string egoStates = readFile("Rec2ColumnsTest.EgoState.f64");
+            const uint32_t COLUMNS = columnNames.size();
+            TS_ASSERT(egoStates.size() == NUMBER_OF_EGOSTATES * COLUMNS * sizeof(double));
+            if (egoStates.size() == NUMBER_OF_EGOSTATES * COLUMNS * sizeof(double)) {
+                const double *values = reinterpret_cast<const double*>(egoStates.data());
+                bool isCorrect = true;
+                for (uint32_t i = 0; i < NUMBER_OF_EGOSTATES; i++) {
+                    const double *row = values + i * COLUMNS;
+                    isCorrect &= (fabs(row[0] - i * 1000.0 * 1000.0) < 1e-3);
+                    isCorrect &= (fabs(row[1] - (i * 1000.0 * 1000.0 + 500)) < 1e-3);
+                    isCorrect &= (fabs(row[2] - i) < 1e-9);
+                    isCorrect &= (fabs(row[3] - 2.0 * i) < 1e-9);
+                    isCorrect &= (fabs(row[7] - 0.5) < 1e-9);
+                }
+                TS_ASSERT(isCorrect);
+            }
+
+            const string vehicleControls = readFile("Rec2ColumnsTest.VehicleControl.f64");
+            TS_ASSERT(vehicleControls.size() == 9 * Data2Columns::getColumnNames(Container::VEHICLECONTROL).size() * sizeof(double));
+
+            UNLINK("Rec2ColumnsTest.rec");
+            UNLINK("Rec2ColumnsTest.EgoState.columns");
+            UNLINK("Rec2ColumnsTest.EgoState.f64");
+            UNLINK("Rec2ColumnsTest.VehicleControl.columns");
+            UNLINK("Rec2ColumnsTest.VehicleControl.f64");
+        }
+};
+
+#endif /*REC2COLUMNSTESTSUITE_H_*/
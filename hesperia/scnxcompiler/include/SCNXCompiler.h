@@ -0,0 +1,69 @@
+/**
+ * scnxcompiler - Tool for precompiling SCNX archives (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SCNXCOMPILER_H_
+#define SCNXCOMPILER_H_
+
+#include "core/platform.h"
+
+namespace scnxcompiler {
+
+    using namespace std;
+
+    /**
+     * This class parses the scenario.scn of the given SCNX archives
+     * and stores the compiled scenarios next to them so that
+     * SCNXArchiveFactory does not need to parse them again.
+     *
+     * Usage: scnxcompiler --scnx=file1.scnx[,file2.scnx,...]
+     */
+    class SCNXCompiler {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             */
+            SCNXCompiler(const SCNXCompiler &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             */
+            SCNXCompiler& operator=(const SCNXCompiler &/*obj*/);
+
+        public:
+            SCNXCompiler();
+
+            virtual ~SCNXCompiler();
+
+            /**
+             * This method compiles all SCNX archives given on command line.
+             *
+             * @param argc Number of command line arguments.
+             * @param argv Command line arguments.
+             * @return 0 if all archives could be compiled.
+             */
+            int32_t run(const int32_t &argc, char **argv);
+    };
+
+} // scnxcompiler
+
+#endif /*SCNXCOMPILER_H_*/
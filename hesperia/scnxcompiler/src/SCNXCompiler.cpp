@@ -0,0 +1,80 @@
+/**
+ * scnxcompiler - Tool for precompiling SCNX archives (part of simulation environment)
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/StringToolbox.h"
+#include "core/base/CommandLineParser.h"
+#include "core/exceptions/Exceptions.h"
+#include "hesperia/scenario/CompiledScenario.h"
+
+#include "SCNXCompiler.h"
+
+namespace scnxcompiler {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::exceptions;
+    using namespace hesperia::scenario;
+
+    SCNXCompiler::SCNXCompiler() {}
+
+    SCNXCompiler::~SCNXCompiler() {}
+
+    int32_t SCNXCompiler::run(const int32_t &argc, char **argv) {
+        CommandLineParser cmdParser;
+        cmdParser.addCommandLineArgument("scnx");
+
+        cmdParser.parse(argc, argv);
+
+        CommandLineArgument cmdArgumentSCNX = cmdParser.getCommandLineArgument("scnx");
+
+        if (!cmdArgumentSCNX.isSet()) {
+            cerr << "Usage: " << argv[0] << " --scnx=file1.scnx[,file2.scnx,...]" << endl;
+            return 1;
+        }
+
+        int32_t retVal = 0;
+        vector<string> listOfSCNXFiles = core::StringToolbox::split(cmdArgumentSCNX.getValue<string>(), ',');
+        vector<string>::iterator it = listOfSCNXFiles.begin();
+        while (it != listOfSCNXFiles.end()) {
+            string scnxFileName = (*it++);
+            core::StringToolbox::trim(scnxFileName);
+
+            try {
+                if (CompiledScenario::compile(scnxFileName)) {
+                    clog << "(scnxcompiler) Compiled " << scnxFileName << " to " << CompiledScenario::getFileName(scnxFileName) << "." << endl;
+                }
+                else {
+                    cerr << "(scnxcompiler) Could not compile " << scnxFileName << "." << endl;
+                    retVal = 1;
+                }
+            }
+            catch (InvalidArgumentException &iae) {
+                cerr << "(scnxcompiler) Could not parse " << scnxFileName << ": " << iae.toString() << endl;
+                retVal = 1;
+            }
+        }
+
+        return retVal;
+    }
+
+} // scnxcompiler
@@ -0,0 +1,122 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_BATCHJOB_H_
+#define CONTEXT_BASE_BATCHJOB_H_
+
+#include <string>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/base/KeyValueConfiguration.h"
+#include "context/base/RuntimeControlInterface.h"
+#include "context/base/SimulationSnapshot.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class describes one simulation to be executed by the
+         * BatchRunner. It is also used as RuntimeControlInterface for
+         * the simulation; batch simulations are not verbose and run
+         * without supercomponent.
+         */
+        class OPENDAVINCI_API BatchJob : public RuntimeControlInterface {
+            public:
+                BatchJob();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param name Name of this job.
+                 * @param maxRunningTimeInSeconds Maximum simulated time.
+                 * @param configuration Configuration data for this job.
+                 */
+                BatchJob(const string &name, const uint32_t &maxRunningTimeInSeconds, const core::base::KeyValueConfiguration &configuration);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                BatchJob(const BatchJob &obj);
+
+                virtual ~BatchJob();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                BatchJob& operator=(const BatchJob &obj);
+
+                /**
+                 * This method returns the name of this job.
+                 *
+                 * @return Name.
+                 */
+                const string getName() const;
+
+                /**
+                 * This method returns the maximum simulated time.
+                 *
+                 * @return Maximum simulated time in seconds.
+                 */
+                uint32_t getMaxRunningTimeInSeconds() const;
+
+                /**
+                 * This method sets a snapshot to continue from instead of
+                 * simulating from the beginning. Several jobs with
+                 * different configurations can share the same snapshot.
+                 *
+                 * @param snapshot Snapshot to continue from.
+                 */
+                void setSnapshot(const SimulationSnapshot &snapshot);
+
+                /**
+                 * This method returns the snapshot to continue from.
+                 *
+                 * @return Snapshot; invalid if the job starts at 0.
+                 */
+                const SimulationSnapshot getSnapshot() const;
+
+                virtual const core::base::KeyValueConfiguration getConfiguration() const;
+
+                virtual const string getMulticastGroup() const;
+
+                virtual uint32_t getCID() const;
+
+                virtual bool isVerbose() const;
+
+                virtual bool isSupercomponent() const;
+
+            private:
+                string m_name;
+                uint32_t m_maxRunningTimeInSeconds;
+                core::base::KeyValueConfiguration m_configuration;
+                SimulationSnapshot m_snapshot;
+        };
+
+    }
+} // context::base
+
+#endif /*CONTEXT_BASE_BATCHJOB_H_*/
@@ -0,0 +1,104 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_BATCHRESULT_H_
+#define CONTEXT_BASE_BATCHRESULT_H_
+
+#include <string>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "context/base/RuntimeControl.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class contains the result of one BatchJob.
+         */
+        class OPENDAVINCI_API BatchResult {
+            public:
+                BatchResult();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param name Name of the job.
+                 * @param errorCode Result from RuntimeControl.
+                 * @param correctlyWorked Aggregated result from all SystemReportingComponents.
+                 * @param durationInSeconds Consumed wall time.
+                 */
+                BatchResult(const string &name, const enum RuntimeControl::ERRORCODES &errorCode, const bool &correctlyWorked, const double &durationInSeconds);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                BatchResult(const BatchResult &obj);
+
+                virtual ~BatchResult();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                BatchResult& operator=(const BatchResult &obj);
+
+                const string getName() const;
+
+                enum RuntimeControl::ERRORCODES getErrorCode() const;
+
+                /**
+                 * This method returns true if all SystemReportingComponents
+                 * reported correct situations.
+                 *
+                 * @return true if all reports were correct.
+                 */
+                bool hasCorrectlyWorked() const;
+
+                double getDurationInSeconds() const;
+
+                /**
+                 * This method returns true if the simulation ended regularly
+                 * (all applications finished or the simulated time ran out)
+                 * and all SystemReportingComponents reported correct
+                 * situations.
+                 *
+                 * @return true if this job passed.
+                 */
+                bool hasPassed() const;
+
+                const string toString() const;
+
+            private:
+                string m_name;
+                enum RuntimeControl::ERRORCODES m_errorCode;
+                bool m_correctlyWorked;
+                double m_durationInSeconds;
+        };
+
+    }
+} // context::base
+
+#endif /*CONTEXT_BASE_BATCHRESULT_H_*/
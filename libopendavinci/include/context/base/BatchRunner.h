@@ -0,0 +1,147 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_BATCHRUNNER_H_
+#define CONTEXT_BASE_BATCHRUNNER_H_
+
+#include <iostream>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/base/KeyValueConfiguration.h"
+#include "core/base/Mutex.h"
+#include "core/base/ParallelTask.h"
+#include "core/base/ParallelExecutor.h"
+#include "context/base/BatchJob.h"
+#include "context/base/BatchResult.h"
+#include "context/base/BatchSimulationFactory.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class executes many independent simulations concurrently
+         * within one process. Every worker thread runs one job at a time
+         * using a RuntimeControl with TAKE_CONTROL_FOR_CURRENT_THREAD so
+         * that every simulation has its own controlled time and its own
+         * ContainerConferenceFactory.
+         *
+         * @code
+         * MySimulationFactory factory;
+         * BatchRunner runner(factory, 8);
+         *
+         * ifstream jobFile("nightly.jobs");
+         * vector<BatchJob> jobs = BatchRunner::readJobs(jobFile, baseConfiguration);
+         * vector<BatchResult> results = runner.run(jobs);
+         * BatchRunner::writeSummary(cout, results);
+         * @endcode
+         */
+        class OPENDAVINCI_API BatchRunner : public core::base::ParallelTask {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                BatchRunner(const BatchRunner&);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                BatchRunner& operator=(const BatchRunner&);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param factory Factory to create the simulation for every job.
+                 * @param numberOfWorkers Number of concurrently executed jobs.
+                 */
+                BatchRunner(BatchSimulationFactory &factory, const uint32_t &numberOfWorkers);
+
+                virtual ~BatchRunner();
+
+                /**
+                 * This method reads a job file. Every line describes one
+                 * job consisting of its name, the maximum simulated time
+                 * in seconds, and optional key=value pairs overriding the
+                 * base configuration:
+                 *
+                 * @code
+                 * # name maxRunningTimeInSeconds [key=value ...]
+                 * straight 30 global.scenario=file://straight.scnx
+                 * curve-fast 30 global.scenario=file://curve.scnx vehiclecontext.simplifiedbicyclemodel.maxspeed=20
+                 * @endcode
+                 *
+                 * Empty lines and lines starting with # are ignored;
+                 * invalid lines are reported and skipped.
+                 *
+                 * @param in Stream to read the jobs from.
+                 * @param baseConfiguration Configuration shared by all jobs.
+                 * @return List of jobs.
+                 */
+                static vector<BatchJob> readJobs(istream &in, const core::base::KeyValueConfiguration &baseConfiguration);
+
+                /**
+                 * This method executes all jobs and waits for their
+                 * completion.
+                 *
+                 * @param jobs Jobs to be executed.
+                 * @return Results in the same order as jobs.
+                 */
+                vector<BatchResult> run(const vector<BatchJob> &jobs);
+
+                /**
+                 * This method writes all results followed by the
+                 * aggregated numbers of passed and failed jobs.
+                 *
+                 * @param out Stream to write to.
+                 * @param results Results to summarize.
+                 */
+                static void writeSummary(ostream &out, const vector<BatchResult> &results);
+
+                virtual void execute(const uint32_t &index);
+
+            private:
+                /**
+                 * This method executes one job in the calling thread.
+                 *
+                 * @param job Job to execute.
+                 * @return Result.
+                 */
+                BatchResult runJob(const BatchJob &job);
+
+            private:
+                BatchSimulationFactory &m_factory;
+                core::base::ParallelExecutor m_parallelExecutor;
+
+                core::base::Mutex m_jobsMutex;
+                const vector<BatchJob> *m_jobs;
+                vector<BatchResult> m_results;
+        };
+
+    }
+} // context::base
+
+#endif /*CONTEXT_BASE_BATCHRUNNER_H_*/
@@ -0,0 +1,85 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_BATCHSIMULATION_H_
+#define CONTEXT_BASE_BATCHSIMULATION_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "context/base/RuntimeEnvironment.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This interface describes one simulation instance executed
+         * by the BatchRunner. An instance creates and owns all its
+         * SystemFeedbackComponents, SystemReportingComponents, and
+         * ConferenceClientModules. Both methods are called from the
+         * worker thread which runs the instance with its own
+         * ControlledTimeFactory and ControlledContainerConferenceFactory;
+         * thus, instances must not share any mutable state.
+         */
+        class OPENDAVINCI_API BatchSimulation {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                BatchSimulation(const BatchSimulation&);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                BatchSimulation& operator=(const BatchSimulation&);
+
+            protected:
+                /**
+                 * Protected constructor to enforce subclasses.
+                 */
+                BatchSimulation();
+
+            public:
+                virtual ~BatchSimulation();
+
+                /**
+                 * This method creates all components of this simulation
+                 * and adds them to the given RuntimeEnvironment.
+                 *
+                 * @param rte RuntimeEnvironment to be executed.
+                 */
+                virtual void setUp(RuntimeEnvironment &rte) = 0;
+
+                /**
+                 * This method destroys all components of this simulation.
+                 * It is also called if setUp(...) failed. An exception
+                 * thrown by this method fails the job.
+                 */
+                virtual void tearDown() = 0;
+        };
+
+    }
+} // context::base
+
+#endif /*CONTEXT_BASE_BATCHSIMULATION_H_*/
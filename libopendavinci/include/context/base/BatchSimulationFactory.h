@@ -0,0 +1,54 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_BATCHSIMULATIONFACTORY_H_
+#define CONTEXT_BASE_BATCHSIMULATIONFACTORY_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "context/base/BatchJob.h"
+#include "context/base/BatchSimulation.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This interface creates the simulation instances for BatchJobs.
+         */
+        class OPENDAVINCI_API BatchSimulationFactory {
+            public:
+                virtual ~BatchSimulationFactory();
+
+                /**
+                 * This method creates a new simulation for the given job.
+                 * It is called concurrently from all worker threads of
+                 * the BatchRunner which destroys the returned instance.
+                 *
+                 * @param job Job to be simulated.
+                 * @return Simulation or NULL.
+                 */
+                virtual BatchSimulation* createSimulation(const BatchJob &job) = 0;
+        };
+
+    }
+} // context::base
+
+#endif /*CONTEXT_BASE_BATCHSIMULATIONFACTORY_H_*/
@@ -27,6 +27,8 @@
 #include "core/wrapper/Time.h"
 #include "core/base/ConferenceClientModule.h"
 #include "context/base/BlockableContainerListener.h"
+#include "context/base/ControlledContainerConferenceFactory.h"
+#include "context/base/ControlledTimeFactory.h"
 #include "context/base/RunModuleBreakpoint.h"
 #include "context/base/Runner.h"
 
@@ -77,6 +79,17 @@ namespace context {
 
                 virtual bool hasFinished() const;
 
+                /**
+                 * This method sets the factories which are attached to
+                 * the thread executing the ConferenceClientModule. It is
+                 * used when the RuntimeControl only controls its own
+                 * thread instead of the whole process.
+                 *
+                 * @param ctf ControlledTimeFactory to be used by the module.
+                 * @param cccf ControlledContainerConferenceFactory to be used by the module.
+                 */
+                void setThreadScopedFactories(ControlledTimeFactory *ctf, ControlledContainerConferenceFactory *cccf);
+
             protected:
                 virtual void beforeStop();
 
@@ -94,6 +107,9 @@ namespace context {
                 core::base::ConferenceClientModule &m_conferenceClientModule;
                 BlockableContainerListener &m_blockableContainerListener;
                 RunModuleBreakpoint m_runModuleBreakpoint;
+
+                ControlledTimeFactory *m_controlledTimeFactory;
+                ControlledContainerConferenceFactory *m_controlledContainerConferenceFactory;
         };
 
     }
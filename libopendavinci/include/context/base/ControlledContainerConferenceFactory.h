@@ -60,10 +60,27 @@ namespace context {
                 ControlledContainerConferenceFactory& operator=(const ControlledContainerConferenceFactory &);
 
             public:
-                ControlledContainerConferenceFactory();
+                /**
+                 * Constructor.
+                 *
+                 * @param processWide If true, this factory replaces the process-wide ContainerConferenceFactory; otherwise, it is only used by threads calling attachToCurrentThread().
+                 */
+                ControlledContainerConferenceFactory(const bool &processWide = true);
 
                 virtual ~ControlledContainerConferenceFactory();
 
+                /**
+                 * This method installs this factory as ContainerConferenceFactory
+                 * for the calling thread only.
+                 */
+                void attachToCurrentThread();
+
+                /**
+                 * This method removes any ContainerConferenceFactory
+                 * installed for the calling thread.
+                 */
+                static void detachFromCurrentThread();
+
                 /**
                  * This method returns a new ContainerConference.
                  *
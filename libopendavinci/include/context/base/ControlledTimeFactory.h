@@ -53,10 +53,27 @@ namespace context {
                 ControlledTimeFactory& operator=(const ControlledTimeFactory &);
 
             public:
-                ControlledTimeFactory();
+                /**
+                 * Constructor.
+                 *
+                 * @param processWide If true, this factory replaces the process-wide TimeFactory; otherwise, it is only used by threads calling attachToCurrentThread().
+                 */
+                ControlledTimeFactory(const bool &processWide = true);
 
                 virtual ~ControlledTimeFactory();
 
+                /**
+                 * This method installs this factory as TimeFactory
+                 * for the calling thread only.
+                 */
+                void attachToCurrentThread();
+
+                /**
+                 * This method removes any TimeFactory installed for
+                 * the calling thread.
+                 */
+                static void detachFromCurrentThread();
+
                 virtual core::wrapper::Time* now();
 
                 /**
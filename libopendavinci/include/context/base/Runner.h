@@ -66,6 +66,17 @@ namespace context {
                  */
                 bool needsExecution(const core::wrapper::Time &t) const;
 
+                /**
+                 * This method returns the next point in time strictly after
+                 * t at which needsExecution would return true not
+                 * considering hasFinished. It is used to skip all time
+                 * steps without any module to be executed.
+                 *
+                 * @param t Time.
+                 * @return Next execution in milliseconds since 0 or 0 if this runner is never executed.
+                 */
+                uint64_t getNextExecution(const core::wrapper::Time &t) const;
+
                 /**
                  * This method should be overridden in subclasses to add an additional
                  * condition to the time needsExecution indicating whether an
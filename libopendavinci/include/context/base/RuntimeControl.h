@@ -20,6 +20,9 @@
 #ifndef CONTEXT_BASE_RUNTIMECONTROL_H_
 #define CONTEXT_BASE_RUNTIMECONTROL_H_
 
+#include <functional>
+#include <queue>
+#include <utility>
 #include <vector>
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
@@ -36,6 +39,7 @@
 #include "context/base/SuperComponent.h"
 #include "context/base/RuntimeControlInterface.h"
 #include "context/base/RuntimeEnvironment.h"
+#include "context/base/SimulationSnapshot.h"
 
 namespace context {
     namespace base {
@@ -47,10 +51,20 @@ namespace context {
          */
         class OPENDAVINCI_API RuntimeControl : public core::base::AbstractModule {
             public:
+                /**
+                 * TAKE_CONTROL replaces the process-wide TimeFactory and
+                 * ContainerConferenceFactory. TAKE_CONTROL_FOR_CURRENT_THREAD
+                 * installs them only for the thread calling setup(...) and
+                 * for the threads of the executed ConferenceClientModules;
+                 * thus, several RuntimeControls can run concurrently within
+                 * one process. In this mode, setup(...), run(...), tearDown()
+                 * and the destructor must be called from the same thread.
+                 */
                 enum RUNTIMECONTROL {
                     UNSPECIFIED,
                     DONT_TAKE_CONTROL,
                     TAKE_CONTROL,
+                    TAKE_CONTROL_FOR_CURRENT_THREAD,
                 };
 
                 enum ERRORCODES {
@@ -118,6 +132,40 @@ namespace context {
                  */
                 enum ERRORCODES run(RuntimeEnvironment &rte, const uint32_t &maxRunningTimeInSeconds);
 
+                /**
+                 * This method continues a simulation from the given
+                 * snapshot. After setting up all components, their states
+                 * are restored from the snapshot in the order of the
+                 * RuntimeEnvironment's lists of SystemFeedbackComponents
+                 * and SystemReportingComponents; thus, the components
+                 * must be added in the same order as for the run which
+                 * created the snapshot but may use different parameters.
+                 * ConferenceClientModules are started from scratch at
+                 * the snapshot's time.
+                 *
+                 * @param rte RuntimeEnvironment.
+                 * @param maxRunningTimeInSeconds Maximum running time in seconds measured from the beginning of the original simulation.
+                 * @param snapshot Snapshot to continue from; an invalid snapshot starts at 0.
+                 * @return Any errorcode.
+                 */
+                enum ERRORCODES run(RuntimeEnvironment &rte, const uint32_t &maxRunningTimeInSeconds, const SimulationSnapshot &snapshot);
+
+                /**
+                 * This method returns the states of all components at the
+                 * end of the last call to run(...) to continue from there.
+                 *
+                 * @return Snapshot; invalid if no run has finished regularly.
+                 */
+                const SimulationSnapshot getSnapshot() const;
+
+                /**
+                 * This method returns the throughput of the last call to
+                 * run(rte, maxRunningTimeInSeconds).
+                 *
+                 * @return Simulated seconds per elapsed wall clock second or 0 if not available.
+                 */
+                double getSimulatedSecondsPerSecond() const;
+
                 /**
                  * This method must be called to tear down the system's context.
                  */
@@ -205,6 +253,43 @@ namespace context {
                  */
                 void doReporting(RuntimeEnvironment &rte, const core::wrapper::Time &time);
 
+                /**
+                 * This method stores the states of all components.
+                 *
+                 * @param rte RuntimeEnvironment.
+                 * @param time Current time.
+                 * @return Snapshot.
+                 */
+                SimulationSnapshot createSnapshot(RuntimeEnvironment &rte, const ControlledTime &time);
+
+                /**
+                 * This method restores the states of all components.
+                 *
+                 * @param rte RuntimeEnvironment.
+                 * @param snapshot Snapshot to restore.
+                 * @throws string if the snapshot does not match the RuntimeEnvironment.
+                 */
+                void restoreSnapshot(RuntimeEnvironment &rte, const SimulationSnapshot &snapshot);
+
+                /**
+                 * Next execution in milliseconds and index of the module.
+                 */
+                typedef pair<uint64_t, uint32_t> ScheduledExecution;
+
+                /**
+                 * This method adds the next execution of the given module
+                 * to the scheduler. Modules without any further execution
+                 * are not added.
+                 *
+                 * @param scheduler Queue of scheduled executions.
+                 * @param runner Module to be scheduled.
+                 * @param index Index of the module.
+                 * @param time Current time.
+                 * @param includeCurrentTime If true, the module is scheduled for the current time when it needs to be executed now.
+                 */
+                void schedule(priority_queue<ScheduledExecution, vector<ScheduledExecution>, greater<ScheduledExecution> > &scheduler,
+                              const Runner *runner, const uint32_t &index, const core::wrapper::Time &time, const bool &includeCurrentTime);
+
             public:
                 /**
                  * This class is used to disable to TimeFactory.
@@ -224,6 +309,8 @@ namespace context {
                 SuperComponent *m_superComponent;
                 ControlledContainerConferenceFactory *m_controlledContainerConferenceFactory;
                 ControlledTimeFactory *m_controlledTimeFactory;
+                double m_simulatedSecondsPerSecond;
+                SimulationSnapshot m_snapshot;
         };
 
     }
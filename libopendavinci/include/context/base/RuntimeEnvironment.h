@@ -125,8 +125,10 @@ namespace context {
                 void beginExecution();
 
                 /**
-                 * This method returns true, if the lists of ConferenceClientModules
-                 * and SystemContexts contain at least one entry, respectively.
+                 * This method returns true, if the list of SystemFeedbackComponents
+                 * contains at least one entry. ConferenceClientModules are optional
+                 * to allow closed-loop simulations consisting only of
+                 * SystemContextComponents.
                  *
                  * @return true or false (see above).
                  */
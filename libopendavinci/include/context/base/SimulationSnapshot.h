@@ -0,0 +1,123 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_SIMULATIONSNAPSHOT_H_
+#define CONTEXT_BASE_SIMULATIONSNAPSHOT_H_
+
+#include <string>
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "context/base/ControlledTime.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class contains the state of all SystemFeedbackComponents
+         * and SystemReportingComponents of a RuntimeEnvironment at a
+         * given point in the simulation time. It is created by
+         * RuntimeControl at the end of every run and can be used to
+         * continue several runs with differently parameterized
+         * components from this point in time (cf. RuntimeControl::run).
+         */
+        class OPENDAVINCI_API SimulationSnapshot {
+            public:
+                /**
+                 * Constructor for an empty (invalid) snapshot.
+                 */
+                SimulationSnapshot();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param time Simulation time of this snapshot.
+                 */
+                SimulationSnapshot(const ControlledTime &time);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                SimulationSnapshot(const SimulationSnapshot &obj);
+
+                virtual ~SimulationSnapshot();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                SimulationSnapshot& operator=(const SimulationSnapshot &obj);
+
+                /**
+                 * This method returns true if this snapshot was
+                 * taken from a simulation.
+                 *
+                 * @return true if this snapshot is valid.
+                 */
+                bool isValid() const;
+
+                /**
+                 * This method returns the simulation time of this snapshot.
+                 *
+                 * @return Simulation time.
+                 */
+                const ControlledTime getTime() const;
+
+                /**
+                 * This method adds the serialized state of the next
+                 * component.
+                 *
+                 * @param state Serialized state.
+                 */
+                void addState(const string &state);
+
+                /**
+                 * This method returns the number of stored states.
+                 *
+                 * @return Number of states.
+                 */
+                uint32_t getNumberOfStates() const;
+
+                /**
+                 * This method returns the serialized state of the
+                 * component with the given index.
+                 *
+                 * @param index Index of the component.
+                 * @return Serialized state.
+                 * @throws string if the index is invalid.
+                 */
+                const string getState(const uint32_t &index) const;
+
+            private:
+                bool m_valid;
+                ControlledTime m_time;
+                vector<string> m_listOfStates;
+        };
+
+    }
+} // context::base
+
+#endif /*CONTEXT_BASE_SIMULATIONSNAPSHOT_H_*/
@@ -95,6 +95,9 @@ namespace context {
                 virtual void handleRuntimeStatistics(const core::data::dmcp::ModuleDescriptor& md,
                                                      const core::data::RuntimeStatistic& rs);
 
+                virtual void handleInstrumentationStatistic(const core::data::dmcp::ModuleDescriptor& md,
+                                                            const core::data::InstrumentationStatistic& is);
+
                 virtual void handleConnectionLost(const core::data::dmcp::ModuleDescriptor& md);
 
                 virtual void handleUnkownContainer(const core::data::dmcp::ModuleDescriptor& md,
@@ -20,6 +20,8 @@
 #ifndef CONTEXT_BASE_SYSTEMCONTEXTCOMPONENT_H_
 #define CONTEXT_BASE_SYSTEMCONTEXTCOMPONENT_H_
 
+#include <iostream>
+
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
 #include "core/SharedPointer.h"
@@ -88,6 +90,43 @@ namespace context {
                  */
                 core::base::KeyValueDataStore& getKeyValueDataStore();
 
+                /**
+                 * This method stores all pending containers and the
+                 * state of this component (cf. storeState) for taking
+                 * a SimulationSnapshot.
+                 *
+                 * @param out Stream to write to.
+                 */
+                void store(ostream &out);
+
+                /**
+                 * This method restores the pending containers and the
+                 * state of this component after setup() was called.
+                 *
+                 * @param in Stream to read from.
+                 */
+                void restore(istream &in);
+
+            protected:
+                /**
+                 * This method is called to store the dynamic state of
+                 * this component. Parameters read from the configuration
+                 * should not be stored so that a restored simulation can
+                 * be continued with different parameters. This
+                 * implementation stores nothing.
+                 *
+                 * @param out Stream to write to.
+                 */
+                virtual void storeState(ostream &out) const;
+
+                /**
+                 * This method is called to restore the state written
+                 * by storeState. This implementation does nothing.
+                 *
+                 * @param in Stream to read from.
+                 */
+                virtual void restoreState(istream &in);
+
             private:
                 core::base::FIFOQueue m_fifo;
                 core::SharedPointer<core::base::KeyValueDataStore> m_keyValueDataStore;
@@ -66,6 +66,15 @@ namespace context {
                  */
                 virtual void report(const core::wrapper::Time &t) = 0;
 
+                /**
+                 * This method returns whether all situations validated
+                 * so far were correct. It is used to aggregate the
+                 * results of batch simulations.
+                 *
+                 * @return true if no violation was detected (default).
+                 */
+                virtual bool hasCorrectlyWorked() const;
+
             private:
                 /**
                  * This method returns the fixed frequency of 0 since
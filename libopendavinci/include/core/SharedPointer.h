@@ -69,6 +69,16 @@ namespace core {
                 return ( (m_countablePointer != NULL) && (m_countablePointer->m_pointer != NULL) );
             }
 
+            /**
+             * This method returns the number of shared pointers
+             * referring to the contained pointer.
+             *
+             * @return Number of references or 0 if invalid.
+             */
+            uint32_t getReferenceCount() const {
+                return ( (m_countablePointer != NULL) ? m_countablePointer->m_counter : 0);
+            }
+
             /**
              * Copy constructor. If this instance gets copied the counter
              * will be incremented.
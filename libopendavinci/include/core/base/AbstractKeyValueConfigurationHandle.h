@@ -0,0 +1,108 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_ABSTRACTKEYVALUECONFIGURATIONHANDLE_H_
+#define OPENDAVINCI_CORE_BASE_ABSTRACTKEYVALUECONFIGURATIONHANDLE_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/base/KeyValueConfiguration.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class is the abstract superclass for all handles to a
+         * value from a KeyValueConfiguration. A handle resolves its key
+         * only once when a (new) configuration is available and stores
+         * the parsed value so that reading the value does not need any
+         * lookup or parsing.
+         *
+         * @See KeyValueConfigurationHandle
+         */
+        class OPENDAVINCI_API AbstractKeyValueConfigurationHandle {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                AbstractKeyValueConfigurationHandle(const AbstractKeyValueConfigurationHandle &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                AbstractKeyValueConfigurationHandle& operator=(const AbstractKeyValueConfigurationHandle &);
+
+            protected:
+                /**
+                 * Constructor.
+                 *
+                 * @param key Key to be resolved.
+                 */
+                AbstractKeyValueConfigurationHandle(const string &key);
+
+            public:
+                virtual ~AbstractKeyValueConfigurationHandle();
+
+                /**
+                 * This method returns the key.
+                 *
+                 * @return Key.
+                 */
+                const string getKey() const;
+
+                /**
+                 * This method returns true if the key was found in the
+                 * last configuration. Otherwise, the handle provides
+                 * its default value.
+                 *
+                 * @return true if the key was found.
+                 */
+                bool isAvailable() const;
+
+                /**
+                 * This method resolves the key in the given configuration.
+                 *
+                 * @param kvc Configuration.
+                 */
+                virtual void update(const KeyValueConfiguration &kvc) = 0;
+
+            protected:
+                /**
+                 * This method sets the availability of the key.
+                 *
+                 * @param available true if the key was found.
+                 */
+                void setAvailable(const bool &available);
+
+            private:
+                string m_key;
+                bool m_available;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_ABSTRACTKEYVALUECONFIGURATIONHANDLE_H_*/
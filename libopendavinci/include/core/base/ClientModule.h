@@ -23,8 +23,11 @@
 // core/platform.h must be included to setup platform-dependent header files and configurations.
 #include "core/platform.h"
 
+#include <vector>
+
 #include "core/base/AbstractCIDModule.h"
 #include "core/base/KeyValueConfiguration.h"
+#include "core/base/KeyValueConfigurationHandle.h"
 #include "core/exceptions/Exceptions.h"
 
 #include "core/dmcp/ServerInformation.h"
@@ -111,6 +114,40 @@ namespace core {
                  */
                 const core::base::KeyValueConfiguration getKeyValueConfiguration() const;
 
+                /**
+                 * This method returns a handle to a typed value from the
+                 * key/value-configuration. The value is parsed once and
+                 * re-parsed only when a new configuration was received
+                 * from supercomponent; thus, reading the handle inside
+                 * body() is as cheap as reading a member variable. The
+                 * handle is owned by this client module.
+                 *
+                 * @param key Key to be resolved.
+                 * @param defaultValue Value to be used if the key is not available.
+                 * @return Handle to the value.
+                 */
+                template<class T>
+                const KeyValueConfigurationHandle<T>& getKeyValueConfigurationHandle(const string &key, const T &defaultValue = T()) {
+                    KeyValueConfigurationHandle<T> *handle = new KeyValueConfigurationHandle<T>(key, defaultValue);
+                    handle->update(m_keyValueConfiguration);
+                    m_listOfKeyValueConfigurationHandles.push_back(handle);
+                    return *handle;
+                }
+
+                /**
+                 * This method is called from getModuleState() whenever
+                 * a new key/value-configuration was received and all
+                 * handles were updated.
+                 */
+                virtual void handleKeyValueConfigurationChange();
+
+                /**
+                 * This method applies a key/value-configuration that was
+                 * pushed by supercomponent after the initial one and
+                 * reaches a breakpoint if one is set.
+                 */
+                virtual void calledGetModuleState();
+
                 /**
                  * This method returns the SharedPointer for the
                  * DMCP connection.
@@ -145,6 +182,14 @@ namespace core {
                 core::base::KeyValueConfiguration m_keyValueConfiguration;
                 core::dmcp::ServerInformation m_serverInformation;
                 core::SharedPointer<core::dmcp::connection::Client> m_dmcpClient;
+                uint32_t m_keyValueConfigurationVersion;
+                vector<AbstractKeyValueConfigurationHandle*> m_listOfKeyValueConfigurationHandles;
+
+                /**
+                 * This method updates all handles using the current
+                 * key/value-configuration.
+                 */
+                void updateKeyValueConfigurationHandles();
         };
 
     }
@@ -144,11 +144,25 @@ namespace core {
             private:
                 void setupContainerConference();
 
+                /**
+                 * This method returns the histogram for the queue depths
+                 * of all data stores for the container's data type. The
+                 * caller must hold m_dataStoresMutex.
+                 *
+                 * @param c Container.
+                 * @return Identifier of the histogram.
+                 */
+                uint32_t getQueueDepthHistogram(const core::data::Container &c);
+
                 // Distribute input data using thread-safe data stores.
                 core::base::Mutex m_dataStoresMutex;
                 vector<core::base::AbstractDataStore*> m_listOfDataStores;
                 map<core::data::Container::DATATYPE, vector<core::base::AbstractDataStore*> > m_mapOfListOfDataStores;
 
+                // Instrumentation of the delivery of received containers.
+                uint32_t m_receiveToDispatchHistogram;
+                map<core::data::Container::DATATYPE, uint32_t> m_mapOfQueueDepthHistograms;
+
                 // Store all received data using Container::DATATYPE as key.
                 core::SharedPointer<core::base::KeyValueDataStore> m_keyValueDataStore;
         };
@@ -0,0 +1,145 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_HISTOGRAM_H_
+#define OPENDAVINCI_CORE_BASE_HISTOGRAM_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class is a histogram with logarithmic buckets that are
+         * linearly subdivided (like HdrHistogram): Every power of two
+         * is split into 16 sub-buckets; thus, every recorded value is
+         * represented with a relative error below 6.25% while the
+         * histogram has a fixed size and adding a value does neither
+         * allocate memory nor depend on the recorded range. Values
+         * greater than 2^40 are counted in the last bucket. Minimum,
+         * maximum, and sum are tracked exactly.
+         *
+         * This class is not thread-safe; use Instrumentation for
+         * recording from several threads.
+         *
+         * @code
+         * Histogram h;
+         * h.add(1500);
+         * h.add(23000);
+         * const uint64_t p99 = h.getValueAtPercentile(99);
+         * @endcode
+         */
+        class OPENDAVINCI_API Histogram {
+            public:
+                enum BUCKETS {
+                    SUB_BUCKET_BITS = 4,
+                    SUB_BUCKETS = 16,
+                    MAGNITUDES = 36,
+                    NUMBER_OF_BUCKETS = SUB_BUCKETS + MAGNITUDES * SUB_BUCKETS
+                };
+
+            public:
+                Histogram();
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                Histogram(const Histogram &obj);
+
+                virtual ~Histogram();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                Histogram& operator=(const Histogram &obj);
+
+                /**
+                 * This method adds a value.
+                 *
+                 * @param value Value to be added.
+                 */
+                void add(const uint64_t &value);
+
+                /**
+                 * This method adds all values from the given histogram.
+                 *
+                 * @param h Histogram to be merged into this one.
+                 */
+                void merge(const Histogram &h);
+
+                /**
+                 * This method removes all values.
+                 */
+                void reset();
+
+                uint64_t getCount() const;
+
+                uint64_t getSum() const;
+
+                uint64_t getMinimum() const;
+
+                uint64_t getMaximum() const;
+
+                double getMean() const;
+
+                /**
+                 * This method returns the value below or equal to which
+                 * the given percentage of all values falls.
+                 *
+                 * @param percentile Percentile in [0, 100].
+                 * @return Upper bound of the corresponding bucket (limited to getMaximum()) or 0 if empty.
+                 */
+                uint64_t getValueAtPercentile(const double &percentile) const;
+
+                /**
+                 * This method returns the bucket for a value.
+                 *
+                 * @param value Value.
+                 * @return Bucket.
+                 */
+                static uint32_t getBucket(const uint64_t &value);
+
+                /**
+                 * This method returns the greatest value within a bucket.
+                 *
+                 * @param bucket Bucket.
+                 * @return Greatest value within this bucket.
+                 */
+                static uint64_t getBucketUpperBound(const uint32_t &bucket);
+
+            private:
+                uint64_t m_count;
+                uint64_t m_sum;
+                uint64_t m_minimum;
+                uint64_t m_maximum;
+                uint32_t m_buckets[NUMBER_OF_BUCKETS];
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_HISTOGRAM_H_*/
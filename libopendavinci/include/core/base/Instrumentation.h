@@ -0,0 +1,258 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_INSTRUMENTATION_H_
+#define OPENDAVINCI_CORE_BASE_INSTRUMENTATION_H_
+
+#include <map>
+#include <vector>
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/base/Histogram.h"
+#include "core/base/Mutex.h"
+#include "core/data/InstrumentationStatistic.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        class InstrumentationThreadStorage;
+
+        /**
+         * This class provides process-wide counters and histograms
+         * for finding hot spots and tail latencies in a running
+         * system. Metrics are registered once by name; the returned
+         * identifier is then used on the hot path:
+         *
+         * @code
+         * Instrumentation &instr = Instrumentation::getInstance();
+         * const uint32_t timer = instr.getHistogram("MyModule.filter");
+         * const uint32_t drops = instr.getCounter("MyModule.drops");
+         * ...
+         * {
+         *     ScopedTimer st(timer);
+         *     // Code to be measured.
+         * }
+         * instr.increment(drops);
+         * @endcode
+         *
+         * Every recording thread writes to its own storage. The storage
+         * is guarded by its own mutex, which the recording thread takes
+         * for every record; it is only shared with setEnabled() and
+         * getInstrumentationStatistic(), so threads do not contend
+         * with each other. The storage of a terminating
+         * thread is merged into the next statistic and freed.
+         * ClientModule sends the collected data periodically as
+         * InstrumentationStatistic to supercomponent.
+         *
+         * Instrumentation is disabled by default; recording is a no-op
+         * until it is enabled by setEnabled() or by the configuration
+         * key global.instrumentation = 1 for all ClientModules.
+         */
+        class OPENDAVINCI_API Instrumentation {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                Instrumentation(const Instrumentation &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                Instrumentation& operator=(const Instrumentation &);
+
+            private:
+                Instrumentation();
+
+            public:
+                virtual ~Instrumentation();
+
+                /**
+                 * This method returns the process-wide instance.
+                 *
+                 * @return Instance of Instrumentation.
+                 */
+                static Instrumentation& getInstance();
+
+                /**
+                 * This method enables or disables the recording of
+                 * all metrics for all threads. It is meant to be called
+                 * once during the setup of a module but it may be called
+                 * while other threads are recording.
+                 *
+                 * @param enabled True if metrics shall be recorded.
+                 */
+                static void setEnabled(const bool &enabled);
+
+                /**
+                 * This method returns true if metrics are recorded.
+                 * Callers should check it before measuring anything.
+                 *
+                 * @return True if instrumentation is enabled.
+                 */
+                static bool isEnabled();
+
+                /**
+                 * This method registers a counter. Registering an
+                 * existing name returns the existing identifier.
+                 *
+                 * @param name Name of the counter.
+                 * @return Identifier to be used for increment().
+                 */
+                uint32_t getCounter(const string &name);
+
+                /**
+                 * This method registers a histogram. Registering an
+                 * existing name returns the existing identifier.
+                 *
+                 * @param name Name of the histogram.
+                 * @return Identifier to be used for add() or ScopedTimer.
+                 */
+                uint32_t getHistogram(const string &name);
+
+                /**
+                 * This method looks up a histogram that was registered
+                 * for one out of many keys, e.g. a data type, by the
+                 * calling thread. No lock is taken.
+                 *
+                 * @param family Statically allocated name of the family of histograms.
+                 * @param key Key within the family.
+                 * @param histogram Identifier of the histogram, if found.
+                 * @return true if the histogram was found.
+                 */
+                bool findHistogram(const char *family, const uint32_t &key, uint32_t &histogram);
+
+                /**
+                 * This method registers a histogram and caches it for
+                 * the calling thread to be found by findHistogram().
+                 *
+                 * @param name Name of the histogram.
+                 * @param family Statically allocated name of the family of histograms.
+                 * @param key Key within the family.
+                 * @return Identifier to be used for add().
+                 */
+                uint32_t getHistogram(const string &name, const char *family, const uint32_t &key);
+
+                /**
+                 * This method increments a counter.
+                 *
+                 * @param counter Identifier of the counter.
+                 * @param delta Value to be added.
+                 */
+                void increment(const uint32_t &counter, const uint64_t &delta = 1);
+
+                /**
+                 * This method adds a value to a histogram.
+                 *
+                 * @param histogram Identifier of the histogram.
+                 * @param value Value to be added (durations in nanoseconds).
+                 */
+                void add(const uint32_t &histogram, const uint64_t &value);
+
+                /**
+                 * This method merges the data from all threads for all
+                 * metrics which were recorded since the last reset.
+                 *
+                 * @param reset If true, all metrics are reset afterwards.
+                 * @return InstrumentationStatistic.
+                 */
+                core::data::InstrumentationStatistic getInstrumentationStatistic(const bool &reset);
+
+                /**
+                 * This method returns the current time of the monotonic
+                 * system clock regardless of any controlled time.
+                 *
+                 * @return Nanoseconds.
+                 */
+                static int64_t getMonotonicNanoseconds();
+
+            private:
+                /**
+                 * This method registers a metric.
+                 *
+                 * @param name Name of the metric.
+                 * @param type Type of the metric.
+                 * @return Identifier.
+                 */
+                uint32_t getMetric(const string &name, const core::data::InstrumentationMetric::METRICTYPE &type);
+
+                /**
+                 * This method returns the storage of the calling thread.
+                 *
+                 * @return Storage of the calling thread.
+                 */
+                InstrumentationThreadStorage& getThreadStorage();
+
+                /**
+                 * This method merges the data of a terminating thread
+                 * and frees its storage.
+                 *
+                 * @param its Storage of the terminating thread.
+                 */
+                void removeThreadStorage(InstrumentationThreadStorage *its);
+
+                /**
+                 * This method adds the data of a thread's storage to
+                 * the given counters and histograms. The caller must
+                 * hold the thread storage's mutex.
+                 *
+                 * @param its Storage of a thread.
+                 * @param counters Counters to add to.
+                 * @param histograms Histograms to add to.
+                 * @param reset If true, the thread's storage is reset afterwards.
+                 */
+                static void collect(InstrumentationThreadStorage &its, vector<uint64_t> &counters, vector<Histogram> &histograms, const bool &reset);
+
+                /**
+                 * This method is called when a thread which has recorded
+                 * metrics terminates.
+                 *
+                 * @param its Storage of the terminating thread.
+                 */
+                static void threadTerminated(void *its);
+
+            private:
+                static Mutex m_singletonMutex;
+                static Instrumentation* m_singleton;
+
+                // Initial state for new thread storages; guarded by m_metricsMutex.
+                static bool m_enabled;
+
+                Mutex m_metricsMutex;
+                map<string, uint32_t> m_mapOfMetrics;
+                vector<string> m_listOfNames;
+                vector<core::data::InstrumentationMetric::METRICTYPE> m_listOfTypes;
+                vector<InstrumentationThreadStorage*> m_listOfThreadStorages;
+
+                // Data of already terminated threads.
+                vector<uint64_t> m_listOfRetiredCounters;
+                vector<Histogram> m_listOfRetiredHistograms;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_INSTRUMENTATION_H_*/
@@ -74,7 +74,13 @@ namespace core {
                  */
                 virtual ModuleState::MODULE_EXITCODE runModule() = 0;
 
-            private:
+            protected:
+                /**
+                 * This method reaches the breakpoint if one is set. It is
+                 * protected instead of private so that subclasses like
+                 * ClientModule can extend it; overriding methods must
+                 * call this implementation to not bypass breakpoints.
+                 */
                 virtual void calledGetModuleState();
 
             private:
@@ -0,0 +1,118 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_KEYVALUECONFIGURATIONHANDLE_H_
+#define OPENDAVINCI_CORE_BASE_KEYVALUECONFIGURATIONHANDLE_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/base/AbstractKeyValueConfigurationHandle.h"
+#include "core/base/KeyValueConfiguration.h"
+#include "core/exceptions/Exceptions.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class provides typed access to one value from a
+         * KeyValueConfiguration. Create handles once (for example
+         * in setUp() using ClientModule::getKeyValueConfigurationHandle)
+         * and read the pre-parsed value in the module's loop:
+         *
+         * @code
+         * const KeyValueConfigurationHandle<double> *gain;
+         * ...
+         * gain = &getKeyValueConfigurationHandle<double>("Controller.gain", 1.0);
+         * ...
+         * while (getModuleState() == ModuleState::RUNNING) {
+         *     const double u = **gain * error;
+         * }
+         * @endcode
+         */
+        template<class T>
+        class KeyValueConfigurationHandle : public AbstractKeyValueConfigurationHandle {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                KeyValueConfigurationHandle(const KeyValueConfigurationHandle &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                KeyValueConfigurationHandle& operator=(const KeyValueConfigurationHandle &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param key Key to be resolved.
+                 * @param defaultValue Value to be used if the key is not available.
+                 */
+                KeyValueConfigurationHandle(const string &key, const T &defaultValue) :
+                    AbstractKeyValueConfigurationHandle(key),
+                    m_defaultValue(defaultValue),
+                    m_value(defaultValue) {}
+
+                virtual ~KeyValueConfigurationHandle() {}
+
+                /**
+                 * This method returns the value.
+                 *
+                 * @return Value.
+                 */
+                inline const T& getValue() const {
+                    return m_value;
+                }
+
+                inline const T& operator*() const {
+                    return m_value;
+                }
+
+                inline const T* operator->() const {
+                    return &m_value;
+                }
+
+                virtual void update(const KeyValueConfiguration &kvc) {
+                    try {
+                        m_value = kvc.getValue<T>(getKey());
+                        setAvailable(true);
+                    }
+                    catch (core::exceptions::ValueForKeyNotFoundException &/*e*/) {
+                        m_value = m_defaultValue;
+                        setAvailable(false);
+                    }
+                }
+
+            private:
+                T m_defaultValue;
+                T m_value;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_KEYVALUECONFIGURATIONHANDLE_H_*/
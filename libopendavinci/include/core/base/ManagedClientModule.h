@@ -26,9 +26,11 @@
 #include "core/base/Breakpoint.h"
 #include "core/base/ClientModule.h"
 #include "core/base/ManagedClientModuleContainerConference.h"
+#include "core/data/RuntimeStatistic.h"
 #include "core/data/TimeStamp.h"
 #include "core/exceptions/Exceptions.h"
 #include "core/io/ContainerConference.h"
+#include "core/wrapper/PeriodicScheduler.h"
 
 #include "context/base/Clock.h"
 #include "context/base/ControlledTimeFactory.h"
@@ -118,6 +120,13 @@ namespace core {
                 core::base::ModuleState::MODULE_EXITCODE runModuleImplementation_ManagedLevel_None();
                 void wait_ManagedLevel_None();
 
+                /**
+                 * This method configures the realtime priority (SCHED_FIFO) and
+                 * the CPU affinity of the module's thread as specified by the
+                 * keys "<name>.realtime.priority" and "<name>.realtime.cpu".
+                 */
+                void configureRealtimeScheduling();
+
                 core::base::ModuleState::MODULE_EXITCODE runModuleImplementation_ManagedLevel_Pulse();
                 void wait_ManagedLevel_Pulse();
                 void reached_ManagedLevel_Pulse();
@@ -181,8 +190,13 @@ namespace core {
                 core::data::TimeStamp m_startOfCurrentCycle;
                 core::data::TimeStamp m_startOfLastCycle;
                 core::data::TimeStamp m_lastCycle;
+                int64_t m_lastCycleMonotonic;
                 long m_lastWaitTime;
                 int32_t m_cycleCounter;
+                core::wrapper::PeriodicScheduler m_periodicScheduler;
+                core::data::RuntimeStatistic m_runtimeStatistic;
+                uint32_t m_timeConsumptionHistogram;
+                uint32_t m_overrunsCounter;
                 ofstream *m_profilingFile;
 
                 bool m_firstCallToBreakpoint_ManagedLevel_Pulse;
@@ -0,0 +1,139 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_PARALLELEXECUTOR_H_
+#define OPENDAVINCI_CORE_BASE_PARALLELEXECUTOR_H_
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/base/Mutex.h"
+#include "core/base/ParallelTask.h"
+#include "core/base/Service.h"
+
+namespace core {
+    namespace base {
+
+        /**
+         * This class executes the units of work of a ParallelTask on
+         * a set of worker threads. Every worker fetches the next
+         * pending index until none are left; execute() returns after
+         * all units of work have been executed. The worker threads
+         * are started by each call of execute() and joined before it
+         * returns; no threads are kept in between. Thus, it suits a
+         * few coarse-grained batches like whole simulations or
+         * parsing jobs rather than many short tasks.
+         *
+         * @code
+         * class MyTask : public ParallelTask {
+         *     public:
+         *         virtual void execute(const uint32_t &index) {
+         *             ...
+         *         }
+         * };
+         *
+         * MyTask task;
+         * ParallelExecutor executor(4);
+         * executor.execute(task, 100);
+         * @endcode
+         */
+        class OPENDAVINCI_API ParallelExecutor {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                ParallelExecutor(const ParallelExecutor&);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                ParallelExecutor& operator=(const ParallelExecutor&);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param numberOfWorkers Maximum number of worker threads (at least 1).
+                 */
+                ParallelExecutor(const uint32_t &numberOfWorkers);
+
+                virtual ~ParallelExecutor();
+
+                /**
+                 * This method returns the maximum number of worker threads.
+                 *
+                 * @return Maximum number of worker threads.
+                 */
+                uint32_t getNumberOfWorkers() const;
+
+                /**
+                 * This method executes all units of work of the given
+                 * task using at most one worker thread per unit of work
+                 * and waits for their completion. The calling thread
+                 * does not execute any unit of work itself.
+                 *
+                 * @param task Task to be executed.
+                 * @param numberOfUnits Number of units of work.
+                 */
+                void execute(ParallelTask &task, const uint32_t &numberOfUnits);
+
+            private:
+                /**
+                 * This method executes units of work until none are left.
+                 */
+                void work();
+
+                /**
+                 * This class runs ParallelExecutor::work() in its own thread.
+                 */
+                class Worker : public Service {
+                    private:
+                        Worker(const Worker&);
+                        Worker& operator=(const Worker&);
+
+                    public:
+                        Worker(ParallelExecutor &executor);
+
+                        virtual ~Worker();
+
+                    protected:
+                        virtual void beforeStop();
+
+                        virtual void run();
+
+                    private:
+                        ParallelExecutor &m_executor;
+                };
+
+            private:
+                uint32_t m_numberOfWorkers;
+
+                Mutex m_taskMutex;
+                ParallelTask *m_task;
+                uint32_t m_numberOfUnits;
+                uint32_t m_nextUnit;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_PARALLELEXECUTOR_H_*/
@@ -0,0 +1,52 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_PARALLELTASK_H_
+#define OPENDAVINCI_CORE_BASE_PARALLELTASK_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+namespace core {
+    namespace base {
+
+        /**
+         * This interface describes a set of independent units of work
+         * which are executed concurrently by ParallelExecutor.
+         *
+         * @See ParallelExecutor
+         */
+        class OPENDAVINCI_API ParallelTask {
+            public:
+                virtual ~ParallelTask();
+
+                /**
+                 * This method executes one unit of work. It is called
+                 * from the worker threads exactly once per index and
+                 * must not throw.
+                 *
+                 * @param index Index of the unit of work.
+                 */
+                virtual void execute(const uint32_t &index) = 0;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_PARALLELTASK_H_*/
@@ -0,0 +1,77 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_SCOPEDTIMER_H_
+#define OPENDAVINCI_CORE_BASE_SCOPEDTIMER_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class measures the time between its construction and
+         * its destruction on the monotonic clock and adds it in
+         * nanoseconds to a histogram from Instrumentation.
+         *
+         * @code
+         * {
+         *     ScopedTimer st(Instrumentation::getInstance().getHistogram("MyModule.step"));
+         *     // Code to be measured.
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API ScopedTimer {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                ScopedTimer(const ScopedTimer &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                ScopedTimer& operator=(const ScopedTimer &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param histogram Identifier of the histogram from Instrumentation::getHistogram().
+                 */
+                ScopedTimer(const uint32_t &histogram);
+
+                virtual ~ScopedTimer();
+
+            private:
+                uint32_t m_histogram;
+                int64_t m_start;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_SCOPEDTIMER_H_*/
@@ -53,6 +53,7 @@ namespace core {
                     SHARED_DATA                  = 13,
                     SHARED_IMAGE                 = 14,
                     POSITION                     = 15,
+                    INSTRUMENTATIONSTATISTIC     = 16,
 
                     CONTOUREDOBJECT              = 30,
                     CONTOUREDOBJECTS             = 31,
@@ -135,10 +136,14 @@ namespace core {
                  */
                 template<class T>
                 inline T getData() {
+                    const int64_t start = getSerializationStart();
+
                     T containerData;
                     // Read from beginning.
                     m_serializedData.seekg(ios::beg);
                     m_serializedData >> containerData;
+
+                    addSerializationDuration(false, start);
                     return containerData;
                 };
 
@@ -181,6 +186,25 @@ namespace core {
                  */
                 const string toString() const;
 
+            private:
+                /**
+                 * This method returns the time when (de-)serializing
+                 * starts if instrumentation is enabled.
+                 *
+                 * @return Monotonic time in nanoseconds or 0 if instrumentation is disabled.
+                 */
+                static int64_t getSerializationStart();
+
+                /**
+                 * This method adds the time spent for (de-)serializing
+                 * the contained data to the histogram for this container's
+                 * data type.
+                 *
+                 * @param isSerialization true for serialization, false for deserialization.
+                 * @param start Monotonic time in nanoseconds when (de-)serializing started or 0 to skip.
+                 */
+                void addSerializationDuration(const bool &isSerialization, const int64_t &start) const;
+
             private:
                 DATATYPE m_dataType;
                 stringstream m_serializedData;
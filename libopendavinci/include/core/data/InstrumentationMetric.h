@@ -0,0 +1,129 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_DATA_INSTRUMENTATIONMETRIC_H_
+#define OPENDAVINCI_CORE_DATA_INSTRUMENTATIONMETRIC_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/base/Histogram.h"
+#include "core/data/SerializableData.h"
+
+namespace core {
+    namespace data {
+
+        using namespace std;
+
+        /**
+         * This class summarizes one counter or histogram from
+         * core::base::Instrumentation for one reporting interval.
+         * Durations are given in nanoseconds.
+         */
+        class OPENDAVINCI_API InstrumentationMetric : public SerializableData {
+            public:
+                enum METRICTYPE {
+                    COUNTER = 0,
+                    HISTOGRAM = 1
+                };
+
+            public:
+                InstrumentationMetric();
+
+                /**
+                 * Constructor for a counter.
+                 *
+                 * @param name Name of the counter.
+                 * @param value Value of the counter.
+                 */
+                InstrumentationMetric(const string &name, const uint64_t &value);
+
+                /**
+                 * Constructor for a histogram.
+                 *
+                 * @param name Name of the histogram.
+                 * @param h Histogram to be summarized.
+                 */
+                InstrumentationMetric(const string &name, const core::base::Histogram &h);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                InstrumentationMetric(const InstrumentationMetric &obj);
+
+                virtual ~InstrumentationMetric();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                InstrumentationMetric& operator=(const InstrumentationMetric &obj);
+
+                const string getName() const;
+
+                METRICTYPE getType() const;
+
+                /**
+                 * This method returns the value of a counter or the
+                 * number of values recorded in a histogram.
+                 *
+                 * @return Count.
+                 */
+                uint32_t getCount() const;
+
+                double getMinimum() const;
+
+                double getMaximum() const;
+
+                double getMean() const;
+
+                double getPercentile50() const;
+
+                double getPercentile90() const;
+
+                double getPercentile99() const;
+
+                double getPercentile999() const;
+
+                virtual ostream& operator<<(ostream &out) const;
+                virtual istream& operator>>(istream &in);
+
+                virtual const string toString() const;
+
+            private:
+                string m_name;
+                METRICTYPE m_type;
+                uint32_t m_count;
+                double m_minimum;
+                double m_maximum;
+                double m_mean;
+                double m_percentile50;
+                double m_percentile90;
+                double m_percentile99;
+                double m_percentile999;
+        };
+
+    }
+} // core::data
+
+#endif /*OPENDAVINCI_CORE_DATA_INSTRUMENTATIONMETRIC_H_*/
@@ -0,0 +1,96 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_DATA_INSTRUMENTATIONSTATISTIC_H_
+#define OPENDAVINCI_CORE_DATA_INSTRUMENTATIONSTATISTIC_H_
+
+#include <vector>
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/data/InstrumentationMetric.h"
+#include "core/data/SerializableData.h"
+
+namespace core {
+    namespace data {
+
+        using namespace std;
+
+        /**
+         * This class contains all counters and histograms recorded
+         * by core::base::Instrumentation within one reporting interval.
+         * It is sent periodically from every ClientModule to
+         * supercomponent.
+         */
+        class OPENDAVINCI_API InstrumentationStatistic : public SerializableData {
+            public:
+                InstrumentationStatistic();
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                InstrumentationStatistic(const InstrumentationStatistic &obj);
+
+                virtual ~InstrumentationStatistic();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                InstrumentationStatistic& operator=(const InstrumentationStatistic &obj);
+
+                /**
+                 * This method returns all metrics.
+                 *
+                 * @return List of metrics.
+                 */
+                const vector<InstrumentationMetric> getListOfMetrics() const;
+
+                /**
+                 * This method adds a metric.
+                 *
+                 * @param metric Metric to be added.
+                 */
+                void addMetric(const InstrumentationMetric &metric);
+
+                /**
+                 * This method returns true if no metric is contained.
+                 *
+                 * @return true if no metric is contained.
+                 */
+                bool isEmpty() const;
+
+                virtual ostream& operator<<(ostream &out) const;
+                virtual istream& operator>>(istream &in);
+
+                virtual const string toString() const;
+
+            private:
+                vector<InstrumentationMetric> m_listOfMetrics;
+        };
+
+    }
+} // core::data
+
+#endif /*OPENDAVINCI_CORE_DATA_INSTRUMENTATIONSTATISTIC_H_*/
@@ -34,6 +34,11 @@ namespace core {
          * This class can be used for gathering information about runtime.
          */
         class OPENDAVINCI_API RuntimeStatistic : public SerializableData {
+            public:
+                enum JITTER_HISTOGRAM {
+                    NUMBER_OF_JITTER_BUCKETS = 8
+                };
+
             public:
                 RuntimeStatistic();
 
@@ -68,6 +73,55 @@ namespace core {
                  */
                 void setSliceConsumption(const float &sc);
 
+                /**
+                 * This method returns the number of missed deadlines.
+                 *
+                 * @return Number of overruns.
+                 */
+                uint32_t getOverruns() const;
+
+                /**
+                 * This method sets the number of missed deadlines.
+                 *
+                 * @param overruns Number of overruns.
+                 */
+                void setOverruns(const uint32_t &overruns);
+
+                /**
+                 * This method adds the jitter of one cycle (i.e. the
+                 * lateness of the wake up after the deadline) to the
+                 * jitter histogram.
+                 *
+                 * @param jitterInMicroseconds Jitter in microseconds.
+                 */
+                void addJitter(const uint32_t &jitterInMicroseconds);
+
+                /**
+                 * This method returns the number of cycles in the
+                 * given bucket of the jitter histogram.
+                 *
+                 * @param bucket Bucket (0..NUMBER_OF_JITTER_BUCKETS-1).
+                 * @return Number of cycles.
+                 */
+                uint32_t getJitterCount(const uint32_t &bucket) const;
+
+                /**
+                 * This method returns the exclusive upper bound of the
+                 * given bucket of the jitter histogram. The last bucket
+                 * is unbounded and 0 is returned.
+                 *
+                 * @param bucket Bucket (0..NUMBER_OF_JITTER_BUCKETS-1).
+                 * @return Upper bound in microseconds.
+                 */
+                static uint32_t getJitterBucketUpperBound(const uint32_t &bucket);
+
+                /**
+                 * This method returns the maximum jitter.
+                 *
+                 * @return Maximum jitter in microseconds.
+                 */
+                uint32_t getMaximumJitter() const;
+
                 virtual ostream& operator<<(ostream &out) const;
                 virtual istream& operator>>(istream &in);
 
@@ -75,6 +129,9 @@ namespace core {
 
             private:
                 float m_sliceConsumption;
+                uint32_t m_overruns;
+                uint32_t m_maximumJitter;
+                uint32_t m_jitterHistogram[NUMBER_OF_JITTER_BUCKETS];
         };
 
     }
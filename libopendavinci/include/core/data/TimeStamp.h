@@ -31,7 +31,9 @@ namespace core {
         using namespace std;
 
         /**
-         * This class can be used for time computations.
+         * This class can be used for time computations. It carries
+         * nanoseconds internally; however, only seconds and microseconds
+         * are serialized and compared to keep the wire format.
          */
         class OPENDAVINCI_API TimeStamp : public SerializableData {
             private:
@@ -116,6 +118,14 @@ namespace core {
                  */
                 long toMicroseconds() const;
 
+                /**
+                 * This method converts the specified time into
+                 * nanoseconds.
+                 *
+                 * @return This time converted into nanoseconds.
+                 */
+                int64_t toNanoseconds() const;
+
                 /**
                  * This method returns the fractional microseconds
                  * to the next full second.
@@ -124,6 +134,14 @@ namespace core {
                  */
                 int32_t getFractionalMicroseconds() const;
 
+                /**
+                 * This method returns the fractional nanoseconds
+                 * to the next full second.
+                 *
+                 * @return nanoseconds.
+                 */
+                int32_t getFractionalNanoseconds() const;
+
                 /**
                  * This method returns the seconds.
                  *
@@ -201,8 +219,18 @@ namespace core {
                 virtual const string toString() const;
 
             private:
+                /**
+                 * This method normalizes the given time and sets
+                 * it to this instance.
+                 *
+                 * @param seconds Seconds.
+                 * @param nanoseconds Nanoseconds.
+                 */
+                void setNormalized(int32_t seconds, int64_t nanoseconds);
+
                 int32_t m_seconds;
                 int32_t m_microseconds;
+                int32_t m_nanoseconds; // Nanoseconds on top of m_microseconds (not serialized).
 
                 /**
                  * This method returns true if the given year is
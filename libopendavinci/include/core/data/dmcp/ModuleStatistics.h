@@ -23,6 +23,7 @@
 // core/platform.h must be included to setup platform-dependent header files and configurations.
 #include "core/platform.h"
 
+#include "core/data/InstrumentationStatistic.h"
 #include "core/data/SerializableData.h"
 #include "core/data/RuntimeStatistic.h"
 #include "core/data/dmcp/ModuleDescriptorComparator.h"
@@ -69,6 +70,21 @@ namespace core {
                      */
                     void setRuntimeStatistic(const ModuleDescriptor &md, const core::data::RuntimeStatistic &rts);
 
+                    /**
+                     * This method returns the instrumentation statistics.
+                     *
+                     * @return Instrumentation statistics.
+                     */
+                    map<ModuleDescriptor, core::data::InstrumentationStatistic, ModuleDescriptorComparator> getInstrumentationStatistic() const;
+
+                    /**
+                     * This method sets a module's instrumentation statistic.
+                     *
+                     * @param md ModuleDescriptor.
+                     * @param is InstrumentationStatistic.
+                     */
+                    void setInstrumentationStatistic(const ModuleDescriptor &md, const core::data::InstrumentationStatistic &is);
+
                     virtual ostream& operator<<(ostream &out) const;
                     virtual istream& operator>>(istream &in);
 
@@ -76,6 +92,7 @@ namespace core {
 
                 private:
                     map<ModuleDescriptor, core::data::RuntimeStatistic, ModuleDescriptorComparator> m_moduleStatistics;
+                    map<ModuleDescriptor, core::data::InstrumentationStatistic, ModuleDescriptorComparator> m_instrumentationStatistics;
             };
         }
     }
@@ -25,6 +25,7 @@
 
 #include "core/base/ModuleState.h"
 #include "core/data/Container.h"
+#include "core/data/InstrumentationStatistic.h"
 #include "core/data/RuntimeStatistic.h"
 #include "core/data/dmcp/ModuleDescriptor.h"
 
@@ -44,6 +45,9 @@ namespace core {
                 virtual void handleRuntimeStatistics(const core::data::dmcp::ModuleDescriptor& md,
                                                      const core::data::RuntimeStatistic& rs) = 0;
 
+                virtual void handleInstrumentationStatistic(const core::data::dmcp::ModuleDescriptor& md,
+                                                            const core::data::InstrumentationStatistic& is) = 0;
+
                 virtual void handleConnectionLost(const core::data::dmcp::ModuleDescriptor& md) = 0;
 
                 virtual void handleUnkownContainer(const core::data::dmcp::ModuleDescriptor& md,
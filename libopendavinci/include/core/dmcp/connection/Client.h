@@ -27,6 +27,7 @@
 #include "core/base/KeyValueConfiguration.h"
 #include "core/base/ModuleState.h"
 #include "core/data/Container.h"
+#include "core/data/InstrumentationStatistic.h"
 #include "core/data/RuntimeStatistic.h"
 
 #include "core/io/Connection.h"
@@ -76,9 +77,19 @@ namespace core {
                     void sendModuleExitCode(const core::base::ModuleState::MODULE_EXITCODE& me);
                     void sendModuleState(const core::base::ModuleState::MODULE_STATE& me);
                     void sendStatistics(const core::data::RuntimeStatistic& rs);
+                    void sendInstrumentationStatistic(const core::data::InstrumentationStatistic& is);
 
                     core::base::KeyValueConfiguration getConfiguration();
 
+                    /**
+                     * This method returns the version of the configuration
+                     * that is incremented whenever a new configuration was
+                     * received from supercomponent.
+                     *
+                     * @return Version of the current configuration.
+                     */
+                    uint32_t getConfigurationVersion();
+
                     const core::data::dmcp::PulseMessage getPulseMessage();
 
                     /**
@@ -115,6 +126,7 @@ namespace core {
 
                     core::base::Mutex m_configurationMutex;
                     core::base::KeyValueConfiguration m_configuration;
+                    uint32_t m_configurationVersion;
 
                     bool m_configured;
                     core::base::Mutex m_configuredMutex;
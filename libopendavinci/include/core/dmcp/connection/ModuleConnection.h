@@ -67,7 +67,23 @@ namespace core {
 
                     void setModuleStateListener(ModuleStateListener* listener);
 
-                    void waitForModuleDescription();
+                    /**
+                     * This method waits for the module's descriptor that
+                     * is sent by the module right after connecting.
+                     *
+                     * @param timeout Timeout in milliseconds.
+                     * @return true if the descriptor was received in time.
+                     */
+                    bool waitForModuleDescription(const uint32_t &timeout);
+
+                    /**
+                     * This method sends the current configuration from
+                     * the ModuleConfigurationProvider to the connected
+                     * module. It is sent automatically when the module
+                     * connects and can be sent again to update a
+                     * running module.
+                     */
+                    void sendConfiguration();
 
                     /**
                      * This method sends a pulse to the connected module.
@@ -100,12 +116,66 @@ namespace core {
                      */
                     vector<core::data::Container> pulse_ack_containers(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout);
 
+                    /**
+                     * This method sends a pulse to the connected module like
+                     * pulse_ack but returns immediately without waiting for
+                     * the ACK message. The ACK can be queried afterwards by
+                     * isPulseAckPending; its arrival is additionally signaled
+                     * to the condition set by setPulseAckObserver.
+                     *
+                     * @param pm Pulse to be sent.
+                     * @return true if the pulse was sent, false if the connection was already lost.
+                     */
+                    bool pulse_ack_nonblocking(const core::data::dmcp::PulseMessage &pm);
+
+                    /**
+                     * This method sends a pulse to the connected module like
+                     * pulse_ack_containers but returns immediately without
+                     * waiting for the ACK message. The received containers
+                     * can be queried by getContainersFromPulseAck once
+                     * isPulseAckContainersPending returns false.
+                     *
+                     * @param pm Pulse to be sent.
+                     * @return true if the pulse was sent, false if the connection was already lost.
+                     */
+                    bool pulse_ack_containers_nonblocking(const core::data::dmcp::PulseMessage &pm);
+
+                    /**
+                     * @return true if the ACK for the last pulse sent by pulse_ack_nonblocking has neither been received nor the connection has been lost.
+                     */
+                    bool isPulseAckPending();
+
+                    /**
+                     * @return true if the ACK for the last pulse sent by pulse_ack_containers_nonblocking has neither been received nor the connection has been lost.
+                     */
+                    bool isPulseAckContainersPending();
+
+                    /**
+                     * @return Containers received with the last ACK to be transferred to supercomponent.
+                     */
+                    vector<core::data::Container> getContainersFromPulseAck();
+
+                    /**
+                     * This method sets an additional condition that is woken
+                     * up whenever an ACK was received or the connection was
+                     * lost. Thus, several ModuleConnections can be waited for
+                     * using one aggregated condition.
+                     *
+                     * @param observer Condition to be woken up or NULL.
+                     */
+                    void setPulseAckObserver(core::base::Condition *observer);
+
                     const core::data::dmcp::ModuleDescriptor getModuleDescriptor() const;
 
                 protected:
                     virtual void nextContainer(core::data::Container &c);
                     virtual void handleConnectionError();
 
+                    /**
+                     * This method wakes up the condition set by setPulseAckObserver.
+                     */
+                    void notifyPulseAckObserver();
+
                     core::SharedPointer<core::io::Connection> m_connection;
                     ModuleConfigurationProvider& m_configurationProvider;
 
@@ -126,6 +196,9 @@ namespace core {
                     core::base::Mutex m_stateListenerMutex;
 
                     vector<core::data::Container> m_containersToBeTransferredToSupercomponent;
+
+                    core::base::Mutex m_pulseAckObserverMutex;
+                    core::base::Condition *m_pulseAckObserver;
             };
         }
     }
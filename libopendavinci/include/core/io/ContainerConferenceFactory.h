@@ -89,6 +89,15 @@ namespace core {
                  */
                 static void setSingleton(ContainerConferenceFactory* singleton);
 
+                /**
+                 * This method sets a ContainerConferenceFactory only for
+                 * the calling thread; it takes precedence over the
+                 * process-wide singleton.
+                 *
+                 * @param singleton Factory for the calling thread or NULL to use the process-wide one again.
+                 */
+                static void setSingletonForCurrentThread(ContainerConferenceFactory* singleton);
+
             private:
                 static base::Mutex m_singletonMutex;
                 static ContainerConferenceFactory* m_singleton;
@@ -0,0 +1,113 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_IO_MEMORYSTREAMBUFFER_H_
+#define OPENDAVINCI_CORE_IO_MEMORYSTREAMBUFFER_H_
+
+#include <streambuf>
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+namespace core {
+    namespace io {
+
+        using namespace std;
+
+        /**
+         * This class exposes a contiguous, read-only buffer as input
+         * stream without copying it. The buffer is owned by the caller
+         * or by a derived class and must outlive this stream buffer.
+         */
+        class OPENDAVINCI_API MemoryStreamBuffer : public streambuf {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                MemoryStreamBuffer(const MemoryStreamBuffer &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                MemoryStreamBuffer& operator=(const MemoryStreamBuffer &);
+
+            public:
+                /**
+                 * Constructor for an empty stream buffer.
+                 */
+                MemoryStreamBuffer();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param buffer Contents to be read.
+                 * @param length Number of bytes in buffer.
+                 */
+                MemoryStreamBuffer(const char *buffer, const uint32_t &length);
+
+                virtual ~MemoryStreamBuffer();
+
+                /**
+                 * This method returns the contents.
+                 *
+                 * @return Pointer to getLength() bytes or NULL if empty.
+                 */
+                const char* getBuffer() const;
+
+                /**
+                 * This method returns the number of bytes.
+                 *
+                 * @return Length.
+                 */
+                uint32_t getLength() const;
+
+                /**
+                 * This method returns an input stream for the contents.
+                 *
+                 * @return Input stream.
+                 */
+                istream* getInputStream();
+
+            protected:
+                /**
+                 * This method replaces the contents and rewinds the stream.
+                 *
+                 * @param buffer Contents to be read.
+                 * @param length Number of bytes in buffer.
+                 */
+                void setBuffer(const char *buffer, const uint32_t &length);
+
+                virtual pos_type seekoff(off_type off, ios_base::seekdir way, ios_base::openmode which = ios_base::in);
+
+                virtual pos_type seekpos(pos_type pos, ios_base::openmode which = ios_base::in);
+
+            private:
+                const char *m_buffer;
+                uint32_t m_length;
+                istream *m_stream;
+        };
+
+    }
+} // core::io
+
+#endif /*OPENDAVINCI_CORE_IO_MEMORYSTREAMBUFFER_H_*/
@@ -67,4 +67,13 @@
     #define OPENDAVINCI_API
 #endif // _WIN32
 
+/**
+ * Storage class for variables having one instance per thread.
+ */
+#ifdef _WIN32
+    #define OPENDAVINCI_THREAD_LOCAL __declspec(thread)
+#else
+    #define OPENDAVINCI_THREAD_LOCAL __thread
+#endif
+
 #endif // OPENDAVINCI_CORE_NATIVE_H_
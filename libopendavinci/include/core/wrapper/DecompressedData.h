@@ -53,6 +53,19 @@ namespace core {
                  * @return Input stream or NULL if the specified file could not be found.
                  */
                 virtual istream* getInputStreamFor(const string &entry) = 0;
+
+                /**
+                 * This method returns the contents of one specific
+                 * entry as one contiguous buffer that is owned by
+                 * this object. The look up for the specified entry is
+                 * done case insensitively.
+                 *
+                 * @param entry Name of the entry.
+                 * @param buffer Pointer to the contents (NULL for empty entries).
+                 * @param length Length of the contents.
+                 * @return true if the specified entry could be found.
+                 */
+                virtual bool getBufferFor(const string &entry, const char* &buffer, uint32_t &length) = 0;
         };
 
     }
@@ -23,7 +23,7 @@
 // core/platform.h must be included to setup platform-dependent header files and configurations.
 #include "core/platform.h"
 
-#include <sstream>
+#include <string>
 
 #include "core/wrapper/Mutex.h"
 #include "core/wrapper/AbstractProtocol.h"
@@ -81,6 +81,10 @@ namespace core {
                 virtual void receivedPartialString(const string &partialData);
 
             private:
+                /**
+                 * This method decodes all complete Netstrings from the
+                 * buffered data and keeps any incomplete remainder.
+                 */
                 void decodeNetstring();
 
                 /**
@@ -92,7 +96,7 @@ namespace core {
                 std::auto_ptr<Mutex> m_stringListenerMutex;
                 StringListener *m_stringListener;
 
-                stringstream m_partialData;
+                string m_partialData;
         };
     }
 }
@@ -0,0 +1,155 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIXREACTOR_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIXREACTOR_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include <map>
+
+#include "core/wrapper/Mutex.h"
+#include "core/wrapper/Runnable.h"
+#include "core/wrapper/Thread.h"
+
+namespace core {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            /**
+             * This interface must be implemented by all classes whose
+             * file descriptors are multiplexed by the POSIXReactor.
+             */
+            class POSIXReactorHandler {
+                public:
+                    virtual ~POSIXReactorHandler() {};
+
+                    /**
+                     * This method is called from the reactor's thread
+                     * when the registered file descriptor is ready.
+                     *
+                     * @param isReadable true if the file descriptor can be read.
+                     * @param isWritable true if the file descriptor can be written.
+                     * @param hasError true if the file descriptor has an error or was hung up.
+                     */
+                    virtual void handleEvents(const bool &isReadable, const bool &isWritable, const bool &hasError) = 0;
+            };
+
+            /**
+             * This class multiplexes the file descriptors of all
+             * registered POSIXReactorHandlers using epoll on one
+             * shared I/O thread instead of one thread per socket.
+             *
+             * Handlers are identified by a unique ID that is stored in
+             * the epoll events; thus, events that were fetched before
+             * a handler was removed are discarded safely.
+             */
+            class POSIXReactor : public Runnable {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXReactor(const POSIXReactor &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXReactor& operator=(const POSIXReactor &);
+
+                protected:
+                    POSIXReactor();
+
+                public:
+                    virtual ~POSIXReactor();
+
+                    /**
+                     * Singleton getter. The reactor's thread is started
+                     * with the first call.
+                     *
+                     * @return Instance of the reactor.
+                     */
+                    static POSIXReactor& getInstance();
+
+                    /**
+                     * This method registers a file descriptor for reading.
+                     *
+                     * @param fileDescriptor File descriptor to be observed.
+                     * @param handler Handler to be called for events.
+                     * @return ID of the registration.
+                     */
+                    uint64_t add(const int32_t &fileDescriptor, POSIXReactorHandler *handler);
+
+                    /**
+                     * This method enables or disables the notification
+                     * about a writable file descriptor.
+                     *
+                     * @param fileDescriptor File descriptor to be observed.
+                     * @param id ID returned by add.
+                     * @param observeWritable true if the handler shall be called when the file descriptor is writable.
+                     */
+                    void modify(const int32_t &fileDescriptor, const uint64_t &id, const bool &observeWritable);
+
+                    /**
+                     * This method unregisters a file descriptor. When called
+                     * from any other thread than the reactor's thread, this
+                     * method blocks until a currently running dispatching
+                     * has finished; thus, the handler will not be called
+                     * anymore after this method returns.
+                     *
+                     * @param fileDescriptor File descriptor to be removed.
+                     * @param id ID returned by add.
+                     */
+                    void remove(const int32_t &fileDescriptor, const uint64_t &id);
+
+                    virtual bool isRunning();
+                    virtual void run();
+
+                private:
+                    bool isReactorThread();
+
+                    static Mutex *m_singletonMutex;
+                    static POSIXReactor *m_singleton;
+
+                    enum {MAX_EVENTS = 64};
+                    enum {WAKEUP_ID = 0};
+
+                    Thread *m_thread;
+                    int32_t m_epollFileDescriptor;
+                    int32_t m_wakeupPipe[2];
+
+                    pthread_t m_reactorThread;
+                    bool m_hasReactorThread;
+                    bool m_running;
+
+                    Mutex *m_dispatchMutex;
+                    Mutex *m_handlersMutex;
+                    uint64_t m_nextID;
+                    map<uint64_t, POSIXReactorHandler*> m_handlers;
+            };
+        }
+    }
+}
+#endif /* OPENDAVINCI_CORE_WRAPPER_POSIXREACTOR_H_ */
@@ -0,0 +1,88 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIXREACTORTCPACCEPTOR_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIXREACTORTCPACCEPTOR_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include <deque>
+
+#include "core/wrapper/Condition.h"
+#include "core/wrapper/Mutex.h"
+#include "core/wrapper/POSIX/POSIXReactor.h"
+#include "core/wrapper/POSIX/POSIXTCPAcceptor.h"
+
+namespace core {
+    namespace wrapper {
+        namespace POSIX {
+
+            /**
+             * This class implements a TCP acceptor that is served by
+             * the shared POSIXReactor. All accepted connections are
+             * POSIXReactorTCPConnections.
+             *
+             * As a listener may block while handling a new connection
+             * (e.g. waiting for the first data from the new peer), the
+             * accepted connections are handed over from the reactor's
+             * thread to this acceptor's own thread that invokes the
+             * TCPAcceptorListener.
+             */
+            class POSIXReactorTCPAcceptor : public POSIXTCPAcceptor, public POSIXReactorHandler {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXReactorTCPAcceptor(const POSIXReactorTCPAcceptor &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXReactorTCPAcceptor& operator=(const POSIXReactorTCPAcceptor &);
+
+                public:
+                    POSIXReactorTCPAcceptor(const uint32_t& port);
+                    virtual ~POSIXReactorTCPAcceptor();
+
+                    virtual void start();
+                    virtual void stop();
+
+                    virtual bool isRunning();
+                    virtual void run();
+
+                    virtual void handleEvents(const bool &isReadable, const bool &isWritable, const bool &hasError);
+
+                protected:
+                    Mutex *m_registrationMutex;
+                    bool m_registered;
+                    uint64_t m_reactorID;
+
+                    Condition *m_pendingConnectionsCondition;
+                    bool m_isDispatching;
+                    std::deque<TCPConnection*> m_pendingConnections;
+            };
+        }
+    }
+}
+#endif /* OPENDAVINCI_CORE_WRAPPER_POSIXREACTORTCPACCEPTOR_H_ */
@@ -0,0 +1,105 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIXREACTORTCPCONNECTION_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIXREACTORTCPCONNECTION_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/wrapper/Mutex.h"
+#include "core/wrapper/POSIX/POSIXReactor.h"
+#include "core/wrapper/POSIX/POSIXTCPConnection.h"
+
+namespace core {
+    namespace wrapper {
+        namespace POSIX {
+
+            /**
+             * This class implements a TCP connection that is served by
+             * the shared POSIXReactor instead of an own thread. Data to
+             * be sent is written without blocking; any data that could
+             * not be written immediately is buffered and sent as soon
+             * as the socket becomes writable again. A peer that does not
+             * consume its data is disconnected as soon as the buffered
+             * data exceeds MAX_OUTPUT_BUFFER_SIZE.
+             */
+            class POSIXReactorTCPConnection : public POSIXTCPConnection, public POSIXReactorHandler {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXReactorTCPConnection(const POSIXReactorTCPConnection &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXReactorTCPConnection& operator=(const POSIXReactorTCPConnection &);
+
+                public:
+                    enum CONSTANTS {
+                        MAX_OUTPUT_BUFFER_SIZE = 32 * 1024 * 1024
+                    };
+
+                    POSIXReactorTCPConnection(const int32_t fileDescriptor);
+
+                    POSIXReactorTCPConnection(const std::string& ip, const uint32_t &port);
+
+                    virtual ~POSIXReactorTCPConnection();
+
+                    virtual void sendImplementation(const std::string& data);
+
+                    virtual void start();
+                    virtual void stop();
+
+                    virtual bool isRunning();
+
+                    virtual void handleEvents(const bool &isReadable, const bool &isWritable, const bool &hasError);
+
+                protected:
+                    /**
+                     * This method writes as much buffered data as possible.
+                     * m_socketMutex must be locked by the caller.
+                     *
+                     * @return false in the case of an error.
+                     */
+                    bool flushOutputBuffer();
+
+                    /**
+                     * This method unregisters this connection and informs
+                     * the connection listener about the error.
+                     */
+                    void handleError();
+
+                    std::auto_ptr<Mutex> m_registrationMutex;
+                    bool m_registered;
+                    uint64_t m_reactorID;
+
+                    std::string m_outputBuffer;
+                    uint32_t m_outputOffset;
+                    bool m_isWaitingForWritable;
+            };
+        }
+    }
+}
+#endif /* OPENDAVINCI_CORE_WRAPPER_POSIXREACTORTCPCONNECTION_H_ */
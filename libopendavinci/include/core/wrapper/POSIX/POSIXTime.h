@@ -64,9 +64,26 @@ namespace core {
 
                     virtual int32_t getPartialMicroseconds() const;
 
+                    virtual int32_t getPartialNanoseconds() const;
+
+                    /**
+                     * This method reads the realtime clock.
+                     *
+                     * @param seconds Seconds since Jan. 1, 1970.
+                     * @param partialNanoseconds Partial nanoseconds from the next full second.
+                     */
+                    static void getRealtime(int32_t &seconds, int32_t &partialNanoseconds);
+
+                    /**
+                     * This method reads the monotonic clock.
+                     *
+                     * @return Nanoseconds of the monotonic clock.
+                     */
+                    static int64_t getMonotonicNanoseconds();
+
                 private:
                     int32_t m_seconds;
-                    int32_t m_partialMicroseconds;
+                    int32_t m_partialNanoseconds;
             };
 
         }
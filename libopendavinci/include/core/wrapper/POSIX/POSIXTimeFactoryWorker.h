@@ -36,6 +36,16 @@ namespace core {
                 {
                     return new POSIX::POSIXTime();
                 }
+
+                void getRealtime(int32_t &seconds, int32_t &partialNanoseconds)
+                {
+                    POSIX::POSIXTime::getRealtime(seconds, partialNanoseconds);
+                }
+
+                int64_t getMonotonicNanoseconds()
+                {
+                    return POSIX::POSIXTime::getMonotonicNanoseconds();
+                }
         };
     }
 } // core::wrapper
@@ -0,0 +1,133 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_PERIODICSCHEDULER_H_
+#define OPENDAVINCI_CORE_WRAPPER_PERIODICSCHEDULER_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+namespace core {
+    namespace wrapper {
+
+        /**
+         * This class paces a periodic loop using absolute deadlines
+         * on the monotonic clock. In contrast to sleeping for a relative
+         * waiting time, oversleeping in one cycle does not shift the
+         * following cycles and thus, the loop does not drift. On Linux,
+         * clock_nanosleep with TIMER_ABSTIME is used.
+         *
+         * It can be used as follows:
+         *
+         * @code
+         * PeriodicScheduler ps;
+         * ps.setPeriod(10 * 1000 * 1000); // 100Hz.
+         *
+         * while (isRunning()) {
+         *     // Do some things right here.
+         *
+         *     int64_t lateness = 0;
+         *     const uint32_t overruns = ps.waitForNextPeriod(lateness);
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API PeriodicScheduler {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                PeriodicScheduler(const PeriodicScheduler &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                PeriodicScheduler& operator=(const PeriodicScheduler &);
+
+            public:
+                PeriodicScheduler();
+
+                virtual ~PeriodicScheduler();
+
+                /**
+                 * This method sets the period. If the period differs
+                 * from the current one, the schedule is restarted
+                 * with the next call to waitForNextPeriod().
+                 *
+                 * @param periodInNanoseconds Period in nanoseconds.
+                 */
+                void setPeriod(const int64_t &periodInNanoseconds);
+
+                /**
+                 * @return Period in nanoseconds.
+                 */
+                int64_t getPeriod() const;
+
+                /**
+                 * This method blocks until the next absolute deadline. If
+                 * the deadline has already passed, it returns immediately
+                 * and the schedule continues with the next deadline in the
+                 * future.
+                 *
+                 * @param latenessInNanoseconds Time between the deadline and the actual wake up (0 in case of an overrun).
+                 * @return Number of missed deadlines (0 if the deadline was met).
+                 */
+                uint32_t waitForNextPeriod(int64_t &latenessInNanoseconds);
+
+                /**
+                 * This method enables SCHED_FIFO with the given priority
+                 * for the calling thread.
+                 *
+                 * @param priority Realtime priority (1..99).
+                 * @throw string if the scheduling policy could not be changed.
+                 */
+                static void setRealtimePriority(const int32_t &priority);
+
+                /**
+                 * This method pins the calling thread to the given CPU.
+                 *
+                 * @param cpu Index of the CPU.
+                 * @throw string if the affinity could not be changed.
+                 */
+                static void setCPUAffinity(const int32_t &cpu);
+
+            private:
+                /**
+                 * @return Nanoseconds of the monotonic clock.
+                 */
+                int64_t now() const;
+
+                /**
+                 * This method sleeps until the given absolute time.
+                 *
+                 * @param deadline Nanoseconds of the monotonic clock.
+                 */
+                void sleepUntil(const int64_t &deadline) const;
+
+                int64_t m_periodInNanoseconds;
+                int64_t m_nextDeadline;
+        };
+
+    }
+} // core::wrapper
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_PERIODICSCHEDULER_H_*/
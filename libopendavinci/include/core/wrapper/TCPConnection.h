@@ -108,7 +108,14 @@ namespace core {
                 void invokeConnectionListener();
 
             private:
-                bool hasCompleteData();
+                /**
+                 * This method checks whether a complete data packet
+                 * starting at the given read position has been gathered.
+                 *
+                 * @param position Read position in the gathered data.
+                 * @return true if the complete data packet is available.
+                 */
+                bool hasCompleteData(const uint32_t &position);
 
                 /**
                  * This method is used to pass received data thread-safe
@@ -122,7 +129,7 @@ namespace core {
                 std::auto_ptr<Mutex> m_stringListenerMutex;
                 StringListener *m_stringListener;
 
-                stringstream m_partialData;
+                string m_partialData;
 
                 /**
                  * "Forbidden" copy constructor. Goal: The compiler should warn
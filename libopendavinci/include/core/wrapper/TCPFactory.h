@@ -31,6 +31,30 @@ namespace core {
 
         struct OPENDAVINCI_API TCPFactory
         {
+            /**
+             * Transports for TCP acceptors and connections: Either every
+             * acceptor and connection has its own thread or all of them
+             * are multiplexed by one event loop (only available on Linux;
+             * otherwise, THREAD_PER_CONNECTION is used).
+             */
+            enum TRANSPORT {
+                THREAD_PER_CONNECTION,
+                EVENT_LOOP
+            };
+
+            /**
+             * This method selects the transport for all acceptors and
+             * connections that are created afterwards.
+             *
+             * @param transport Transport to be used.
+             */
+            static void setTransport(const TRANSPORT &transport);
+
+            /**
+             * @return Transport used for newly created acceptors and connections.
+             */
+            static TRANSPORT getTransport();
+
             static TCPAcceptor* createTCPAcceptor(const uint32_t &port);
             static TCPConnection* createTCPConnectionTo(const std::string& ip, const uint32_t& port);
         };
@@ -52,6 +52,15 @@ namespace core {
                  */
                 virtual int32_t getPartialMicroseconds() const = 0;
 
+                /**
+                 * This method returns the partial nanoseconds from
+                 * the next full second. The default implementation
+                 * is based on getPartialMicroseconds().
+                 *
+                 * @return Partial nanoseconds from the next full second.
+                 */
+                virtual int32_t getPartialNanoseconds() const;
+
         };
 
     }
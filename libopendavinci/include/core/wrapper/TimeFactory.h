@@ -61,11 +61,43 @@ namespace core {
             public:
                 virtual ~TimeFactory() {};
                 virtual Time* now();
+
+                /**
+                 * This method returns the current time without allocating
+                 * a Time instance as long as no controlled TimeFactory
+                 * is in use.
+                 *
+                 * @param seconds Seconds since Jan. 1, 1970.
+                 * @param partialNanoseconds Partial nanoseconds from the next full second.
+                 */
+                void getRealtime(int32_t &seconds, int32_t &partialNanoseconds);
+
+                /**
+                 * This method returns the nanoseconds of a monotonic clock
+                 * to be used for measuring durations. In contrast to now(),
+                 * this clock is not affected by changes to the system time
+                 * like NTP corrections. If a controlled TimeFactory is in
+                 * use, its time is returned instead.
+                 *
+                 * @return Nanoseconds with an arbitrary but fixed origin.
+                 */
+                int64_t getMonotonicNanoseconds();
+
                 static TimeFactory& getInstance();
 
             protected:
                 TimeFactory();
                 static void setSingleton(TimeFactory *tf);
+
+                /**
+                 * This method sets a TimeFactory only for the calling
+                 * thread; it takes precedence over the process-wide
+                 * singleton and allows several independent controlled
+                 * times within one process.
+                 *
+                 * @param tf TimeFactory for the calling thread or NULL to use the process-wide one again.
+                 */
+                static void setSingletonForCurrentThread(TimeFactory *tf);
                 static TimeFactory *instance;
                 static TimeFactory *controlledInstance;
 
@@ -51,6 +51,25 @@ namespace core {
                  * @return time based on the type of instance this factory is.
                  */
                 static Time* now();
+
+                /**
+                 * This method returns the current realtime without
+                 * allocating a Time instance.
+                 *
+                 * @param seconds Seconds since Jan. 1, 1970.
+                 * @param partialNanoseconds Partial nanoseconds from the next full second.
+                 */
+                static void getRealtime(int32_t &seconds, int32_t &partialNanoseconds);
+
+                /**
+                 * This method returns the nanoseconds of a monotonic
+                 * clock with an arbitrary origin that is not affected
+                 * by changes to the system time. It must be used
+                 * for durations only.
+                 *
+                 * @return Nanoseconds of the monotonic clock.
+                 */
+                static int64_t getMonotonicNanoseconds();
         };
 
     }
@@ -36,6 +36,16 @@ namespace core {
                 {
                     return new WIN32Impl::WIN32Time();
                 }
+
+                void getRealtime(int32_t &seconds, int32_t &partialNanoseconds)
+                {
+                    WIN32Impl::WIN32Time::getRealtime(seconds, partialNanoseconds);
+                }
+
+                int64_t getMonotonicNanoseconds()
+                {
+                    return WIN32Impl::WIN32Time::getMonotonicNanoseconds();
+                }
         };
     }
 } // core::wrapper
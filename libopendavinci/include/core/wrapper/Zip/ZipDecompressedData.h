@@ -23,8 +23,10 @@
 // core/platform.h must be included to setup platform-dependent header files and configurations.
 #include "core/platform.h"
 
+#include "core/base/Mutex.h"
 #include "core/wrapper/DecompressedData.h"
 #include "core/wrapper/StringComparator.h"
+#include "core/wrapper/Zip/ZipEntry.h"
 
 #include "core/wrapper/CompressionFactoryWorker.h"
 #include "core/wrapper/CompressionLibraryProducts.h"
@@ -38,13 +40,17 @@ namespace core {
             /**
              * This class implements an abstract object containing
              * the decompressed contents of a compressed archive.
+             * The archive is read into memory at once and its entries
+             * are located using the central directory; every entry
+             * is only decompressed on its first access. Concurrent
+             * accesses to the entries are serialized.
              *
              * @See DecompressedData.
              */
             class ZipDecompressedData : public DecompressedData {
                 private:
                     enum {
-                        BUFFER_SIZE = 1024
+                        BUFFER_SIZE = 65536
                     };
 
                 private:
@@ -79,16 +85,45 @@ namespace core {
 
                     virtual istream* getInputStreamFor(const string &entry);
 
+                    virtual bool getBufferFor(const string &entry, const char* &buffer, uint32_t &length);
+
                 private:
-                    map<string, stringstream*, StringComparator> m_mapOfDecompressedEntries;
+                    vector<char> m_archive;
+                    core::base::Mutex m_entriesMutex;
+                    map<string, ZipEntry*, StringComparator> m_mapOfEntries;
 
                     /**
-                     * This method tries to decompress the given archive and
-                     * read the complete content into memory.
+                     * This method reads the given archive into memory and
+                     * reads all entries from its central directory.
                      *
                      * @param in Stream to be used for reading the contents.
                      */
                     void decompressData(istream &in);
+
+                    /**
+                     * This method returns the decompressed entry. The
+                     * caller must hold m_entriesMutex.
+                     *
+                     * @param entry Name of the entry.
+                     * @return Decompressed entry or NULL if the entry could not be found or decompressed.
+                     */
+                    ZipEntry* getDecompressedEntry(const string &entry);
+
+                    /**
+                     * This method reads a little endian value from the archive.
+                     *
+                     * @param offset Offset within the archive.
+                     * @return Value.
+                     */
+                    uint16_t getUInt16(const uint32_t &offset) const;
+
+                    /**
+                     * This method reads a little endian value from the archive.
+                     *
+                     * @param offset Offset within the archive.
+                     * @return Value.
+                     */
+                    uint32_t getUInt32(const uint32_t &offset) const;
             };
 
         }
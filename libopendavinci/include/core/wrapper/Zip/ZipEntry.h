@@ -0,0 +1,123 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_ZIP_ZIPENTRY_H_
+#define OPENDAVINCI_CORE_WRAPPER_ZIP_ZIPENTRY_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/io/MemoryStreamBuffer.h"
+
+namespace core {
+    namespace wrapper {
+        namespace Zip {
+
+            using namespace std;
+
+            /**
+             * This class describes one entry of a ZIP archive as found
+             * in its central directory. The entry's contents are
+             * decompressed on first access into one contiguous buffer,
+             * which is also exposed as input stream without copying.
+             */
+            class ZipEntry : public core::io::MemoryStreamBuffer {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    ZipEntry(const ZipEntry &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    ZipEntry& operator=(const ZipEntry &);
+
+                public:
+                    enum COMPRESSION_METHOD {
+                        STORED = 0,
+                        DEFLATED = 8
+                    };
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param compressionMethod Compression method.
+                     * @param crc CRC-32 of the uncompressed contents.
+                     * @param compressedSize Size of the compressed contents.
+                     * @param uncompressedSize Size of the uncompressed contents.
+                     * @param localHeaderOffset Offset of the entry's local header within the archive.
+                     */
+                    ZipEntry(const uint16_t &compressionMethod, const uint32_t &crc,
+                             const uint32_t &compressedSize, const uint32_t &uncompressedSize,
+                             const uint32_t &localHeaderOffset);
+
+                    virtual ~ZipEntry();
+
+                    /**
+                     * This method returns the offset of this entry's local
+                     * header within the archive.
+                     *
+                     * @return Offset.
+                     */
+                    uint32_t getLocalHeaderOffset() const;
+
+                    /**
+                     * This method returns the size of the uncompressed contents.
+                     *
+                     * @return Size.
+                     */
+                    uint32_t getUncompressedSize() const;
+
+                    /**
+                     * This method returns true if the contents were
+                     * already decompressed.
+                     *
+                     * @return true if decompressed.
+                     */
+                    bool isDecompressed() const;
+
+                    /**
+                     * This method decompresses the entry's contents.
+                     *
+                     * @param compressedData Compressed contents of this entry.
+                     * @param size Number of available bytes in compressedData.
+                     * @return true if the contents could be decompressed and match the CRC-32.
+                     */
+                    bool decompress(const char *compressedData, const uint32_t &size);
+
+                private:
+                    uint16_t m_compressionMethod;
+                    uint32_t m_crc;
+                    uint32_t m_compressedSize;
+                    uint32_t m_uncompressedSize;
+                    uint32_t m_localHeaderOffset;
+                    bool m_decompressed;
+                    vector<char> m_data;
+            };
+
+        }
+    }
+} // core::wrapper::Zip
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_ZIP_ZIPENTRY_H_*/
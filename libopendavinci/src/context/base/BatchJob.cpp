@@ -0,0 +1,95 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "context/base/BatchJob.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+        using namespace core::base;
+
+        BatchJob::BatchJob() :
+            m_name(),
+            m_maxRunningTimeInSeconds(0),
+            m_configuration(),
+            m_snapshot() {}
+
+        BatchJob::BatchJob(const string &name, const uint32_t &maxRunningTimeInSeconds, const KeyValueConfiguration &configuration) :
+            m_name(name),
+            m_maxRunningTimeInSeconds(maxRunningTimeInSeconds),
+            m_configuration(configuration),
+            m_snapshot() {}
+
+        BatchJob::BatchJob(const BatchJob &obj) :
+            RuntimeControlInterface(),
+            m_name(obj.m_name),
+            m_maxRunningTimeInSeconds(obj.m_maxRunningTimeInSeconds),
+            m_configuration(obj.m_configuration),
+            m_snapshot(obj.m_snapshot) {}
+
+        BatchJob::~BatchJob() {}
+
+        BatchJob& BatchJob::operator=(const BatchJob &obj) {
+            m_name = obj.m_name;
+            m_maxRunningTimeInSeconds = obj.m_maxRunningTimeInSeconds;
+            m_configuration = obj.m_configuration;
+            m_snapshot = obj.m_snapshot;
+
+            return (*this);
+        }
+
+        const string BatchJob::getName() const {
+            return m_name;
+        }
+
+        uint32_t BatchJob::getMaxRunningTimeInSeconds() const {
+            return m_maxRunningTimeInSeconds;
+        }
+
+        void BatchJob::setSnapshot(const SimulationSnapshot &snapshot) {
+            m_snapshot = snapshot;
+        }
+
+        const SimulationSnapshot BatchJob::getSnapshot() const {
+            return m_snapshot;
+        }
+
+        const KeyValueConfiguration BatchJob::getConfiguration() const {
+            return m_configuration;
+        }
+
+        const string BatchJob::getMulticastGroup() const {
+            // Not used since no supercomponent is created.
+            return "";
+        }
+
+        uint32_t BatchJob::getCID() const {
+            return 0;
+        }
+
+        bool BatchJob::isVerbose() const {
+            return false;
+        }
+
+        bool BatchJob::isSupercomponent() const {
+            return false;
+        }
+    }
+} // context::base
@@ -0,0 +1,90 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <sstream>
+
+#include "context/base/BatchResult.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        BatchResult::BatchResult() :
+            m_name(),
+            m_errorCode(RuntimeControl::NO_ERROR_OCCURRED),
+            m_correctlyWorked(false),
+            m_durationInSeconds(0) {}
+
+        BatchResult::BatchResult(const string &name, const enum RuntimeControl::ERRORCODES &errorCode, const bool &correctlyWorked, const double &durationInSeconds) :
+            m_name(name),
+            m_errorCode(errorCode),
+            m_correctlyWorked(correctlyWorked),
+            m_durationInSeconds(durationInSeconds) {}
+
+        BatchResult::BatchResult(const BatchResult &obj) :
+            m_name(obj.m_name),
+            m_errorCode(obj.m_errorCode),
+            m_correctlyWorked(obj.m_correctlyWorked),
+            m_durationInSeconds(obj.m_durationInSeconds) {}
+
+        BatchResult::~BatchResult() {}
+
+        BatchResult& BatchResult::operator=(const BatchResult &obj) {
+            m_name = obj.m_name;
+            m_errorCode = obj.m_errorCode;
+            m_correctlyWorked = obj.m_correctlyWorked;
+            m_durationInSeconds = obj.m_durationInSeconds;
+
+            return (*this);
+        }
+
+        const string BatchResult::getName() const {
+            return m_name;
+        }
+
+        enum RuntimeControl::ERRORCODES BatchResult::getErrorCode() const {
+            return m_errorCode;
+        }
+
+        bool BatchResult::hasCorrectlyWorked() const {
+            return m_correctlyWorked;
+        }
+
+        double BatchResult::getDurationInSeconds() const {
+            return m_durationInSeconds;
+        }
+
+        bool BatchResult::hasPassed() const {
+            const bool regularEnd = ( (m_errorCode == RuntimeControl::APPLICATIONS_FINISHED) ||
+                                      (m_errorCode == RuntimeControl::RUNTIME_TIMEOUT) );
+            return (regularEnd && m_correctlyWorked);
+        }
+
+        const string BatchResult::toString() const {
+            stringstream s;
+            s << m_name << ": " << (hasPassed() ? "PASSED" : "FAILED")
+              << " (error code: " << m_errorCode
+              << ", reports: " << (m_correctlyWorked ? "correct" : "incorrect")
+              << ", duration: " << m_durationInSeconds << "s)";
+            return s.str();
+        }
+
+    }
+} // context::base
@@ -0,0 +1,220 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <sstream>
+#include <string>
+
+#include "core/macros.h"
+#include "core/base/Lock.h"
+#include "core/exceptions/Exceptions.h"
+#include "core/wrapper/TimeFactory.h"
+#include "context/base/BatchRunner.h"
+#include "context/base/RuntimeControl.h"
+#include "context/base/RuntimeEnvironment.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+        using namespace core::base;
+
+        BatchRunner::BatchRunner(BatchSimulationFactory &factory, const uint32_t &numberOfWorkers) :
+            m_factory(factory),
+            m_parallelExecutor(numberOfWorkers),
+            m_jobsMutex(),
+            m_jobs(NULL),
+            m_results() {}
+
+        BatchRunner::~BatchRunner() {}
+
+        vector<BatchJob> BatchRunner::readJobs(istream &in, const KeyValueConfiguration &baseConfiguration) {
+            vector<BatchJob> jobs;
+
+            stringstream base;
+            base << baseConfiguration;
+
+            uint32_t lineNumber = 0;
+            while (in.good()) {
+                string line;
+                getline(in, line);
+                lineNumber++;
+
+                stringstream tokens(line);
+                string name;
+                tokens >> name;
+
+                // Skip empty lines and comments.
+                if ( (name.length() == 0) || (name.at(0) == '#') ) {
+                    continue;
+                }
+
+                uint32_t maxRunningTimeInSeconds = 0;
+                tokens >> maxRunningTimeInSeconds;
+                if (tokens.fail() || (maxRunningTimeInSeconds == 0)) {
+                    clog << "(context::base::BatchRunner) Skipping invalid job in line " << lineNumber << ": '" << line << "'." << endl;
+                    continue;
+                }
+
+                // Apply overrides after the base configuration.
+                stringstream configuration;
+                configuration << base.str() << endl;
+                string keyValue;
+                while (tokens >> keyValue) {
+                    configuration << keyValue << endl;
+                }
+
+                KeyValueConfiguration kvc;
+                configuration >> kvc;
+
+                jobs.push_back(BatchJob(name, maxRunningTimeInSeconds, kvc));
+            }
+
+            return jobs;
+        }
+
+        vector<BatchResult> BatchRunner::run(const vector<BatchJob> &jobs) {
+            {
+                Lock l(m_jobsMutex);
+                m_jobs = &jobs;
+                m_results.clear();
+                m_results.resize(jobs.size());
+            }
+
+            const uint32_t NUMBER_OF_WORKERS = (jobs.size() < m_parallelExecutor.getNumberOfWorkers()) ? jobs.size() : m_parallelExecutor.getNumberOfWorkers();
+            clog << "(context::base::BatchRunner) Executing " << jobs.size() << " jobs using " << NUMBER_OF_WORKERS << " workers." << endl;
+
+            m_parallelExecutor.execute(*this, jobs.size());
+
+            vector<BatchResult> results;
+            {
+                Lock l(m_jobsMutex);
+                results = m_results;
+                m_jobs = NULL;
+            }
+            return results;
+        }
+
+        void BatchRunner::execute(const uint32_t &index) {
+            const BatchJob *job = NULL;
+            {
+                Lock l(m_jobsMutex);
+                if ( (m_jobs == NULL) || (index >= m_jobs->size()) ) {
+                    return;
+                }
+                job = &(m_jobs->at(index));
+            }
+
+            const BatchResult result = runJob(*job);
+
+            {
+                Lock l(m_jobsMutex);
+                m_results[index] = result;
+            }
+        }
+
+        BatchResult BatchRunner::runJob(const BatchJob &job) {
+            // This thread is not yet controlled; thus, the wall time is measured.
+            const int64_t start = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+
+            enum RuntimeControl::ERRORCODES errorCode = RuntimeControl::NO_ERROR_OCCURRED;
+            bool correctlyWorked = true;
+            {
+                RuntimeControl rc(job);
+                rc.setup(RuntimeControl::TAKE_CONTROL_FOR_CURRENT_THREAD);
+
+                RuntimeEnvironment rte;
+                BatchSimulation *simulation = NULL;
+                try {
+                    simulation = m_factory.createSimulation(job);
+                    if (simulation != NULL) {
+                        simulation->setUp(rte);
+
+                        errorCode = rc.run(rte, job.getMaxRunningTimeInSeconds(), job.getSnapshot());
+
+                        // Aggregate the results from all reporters.
+                        vector<SystemReportingComponent*> listOfSystemReportingComponents = rte.getListOfSystemReportingComponents();
+                        vector<SystemReportingComponent*>::iterator it = listOfSystemReportingComponents.begin();
+                        while (it != listOfSystemReportingComponents.end()) {
+                            SystemReportingComponent *src = (*it++);
+                            if (src != NULL) {
+                                correctlyWorked &= src->hasCorrectlyWorked();
+                            }
+                        }
+                    }
+                    else {
+                        clog << "(context::base::BatchRunner) No simulation created for job '" << job.getName() << "'." << endl;
+                        errorCode = RuntimeControl::SETUP_NOT_CALLED;
+                    }
+                }
+                catch(core::exceptions::Exceptions &e) {
+                    clog << "(context::base::BatchRunner) Exception occurred in job '" << job.getName() << "': " << e.toString() << endl;
+                    errorCode = RuntimeControl::EXCEPTION_CAUGHT;
+                }
+                catch(string &s) {
+                    clog << "(context::base::BatchRunner) String exception occurred in job '" << job.getName() << "': " << s << endl;
+                    errorCode = RuntimeControl::STRING_EXCEPTION_CAUGHT;
+                }
+                catch(...) {
+                    clog << "(context::base::BatchRunner) Unknown exception occurred in job '" << job.getName() << "'." << endl;
+                    errorCode = RuntimeControl::UNKNOWN_EXCEPTION_CAUGHT;
+                }
+
+                // Destroy the simulation before its ContainerConferenceFactory and TimeFactory.
+                if (simulation != NULL) {
+                    try {
+                        simulation->tearDown();
+                    }
+                    catch(...) {
+                        clog << "(context::base::BatchRunner) Exception occurred while tearing down job '" << job.getName() << "'." << endl;
+
+                        // Keep the first error of this job.
+                        if ( (errorCode == RuntimeControl::NO_ERROR_OCCURRED) ||
+                             (errorCode == RuntimeControl::APPLICATIONS_FINISHED) ||
+                             (errorCode == RuntimeControl::RUNTIME_TIMEOUT) ) {
+                            errorCode = RuntimeControl::EXCEPTION_CAUGHT;
+                        }
+                    }
+                    OPENDAVINCI_CORE_DELETE_POINTER(simulation);
+                }
+
+                rc.tearDown();
+            }
+
+            const int64_t end = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+
+            return BatchResult(job.getName(), errorCode, correctlyWorked, (end - start) / (1000.0 * 1000.0 * 1000.0));
+        }
+
+        void BatchRunner::writeSummary(ostream &out, const vector<BatchResult> &results) {
+            uint32_t passed = 0;
+            double duration = 0;
+
+            vector<BatchResult>::const_iterator it = results.begin();
+            while (it != results.end()) {
+                const BatchResult &result = (*it++);
+                out << result.toString() << endl;
+
+                passed += (result.hasPassed() ? 1 : 0);
+                duration += result.getDurationInSeconds();
+            }
+
+            out << results.size() << " jobs, " << passed << " passed, " << (results.size() - passed) << " failed, " << duration << "s accumulated duration." << endl;
+        }
+    }
+} // context::base
@@ -46,10 +46,11 @@ namespace context {
         }
 
         void Clock::increment(const uint32_t &ms) {
-            uint32_t newMicroseconds = m_theTime.getPartialMicroseconds() + ms*1000;
-            uint32_t additionalSeconds = 0;
+            // Split the increment first to allow large jumps without overflows.
+            uint32_t additionalSeconds = ms / 1000;
+            uint32_t newMicroseconds = m_theTime.getPartialMicroseconds() + (ms % 1000) * 1000;
             const uint32_t ONESECONDINMICROSECONDS = 1 * 1000 * 1000;
-            while (newMicroseconds >= ONESECONDINMICROSECONDS) {
+            if (newMicroseconds >= ONESECONDINMICROSECONDS) {
                 additionalSeconds++;
                 newMicroseconds -= ONESECONDINMICROSECONDS;
             }
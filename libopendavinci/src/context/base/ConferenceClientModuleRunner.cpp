@@ -44,7 +44,9 @@ namespace context {
             m_conferenceClientModuleFinished(false),
             m_conferenceClientModule(ccm),
             m_blockableContainerListener(dynamic_cast<ControlledContainerConferenceForSystemUnderTest&>(ccm.getConference()).getBlockableContainerReceiver()),
-            m_runModuleBreakpoint(dynamic_cast<ControlledContainerConferenceForSystemUnderTest&>(ccm.getConference()).getBlockableContainerReceiver()) {
+            m_runModuleBreakpoint(dynamic_cast<ControlledContainerConferenceForSystemUnderTest&>(ccm.getConference()).getBlockableContainerReceiver()),
+            m_controlledTimeFactory(NULL),
+            m_controlledContainerConferenceFactory(NULL) {
             ccm.setBreakpoint(&m_runModuleBreakpoint);
         }
 
@@ -113,7 +115,20 @@ namespace context {
             return retVal;
         }
 
+        void ConferenceClientModuleRunner::setThreadScopedFactories(ControlledTimeFactory *ctf, ControlledContainerConferenceFactory *cccf) {
+            m_controlledTimeFactory = ctf;
+            m_controlledContainerConferenceFactory = cccf;
+        }
+
         void ConferenceClientModuleRunner::run() {
+            // Use the same factories as the controlling thread.
+            if (m_controlledTimeFactory != NULL) {
+                m_controlledTimeFactory->attachToCurrentThread();
+            }
+            if (m_controlledContainerConferenceFactory != NULL) {
+                m_controlledContainerConferenceFactory->attachToCurrentThread();
+            }
+
             // Allow sending containers for applications which already send containers BEFORE they call getModuleState() for the first time.
             m_blockableContainerListener.setNextContainerAllowed(true);
 
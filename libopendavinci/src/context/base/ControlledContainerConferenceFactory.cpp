@@ -32,14 +32,24 @@ namespace context {
         using namespace core::data;
         using namespace core::io;
 
-        ControlledContainerConferenceFactory::ControlledContainerConferenceFactory() :
+        ControlledContainerConferenceFactory::ControlledContainerConferenceFactory(const bool &processWide) :
             m_listOfContainerListenersToReceiveContainersFromSystemsUnderTestMutex(),
             m_listOfContainerListenersToReceiveContainersFromSystemsUnderTest(),
             m_listOfContainerDelivererToSystemUnderTestMutex(),
             m_listOfContainerDelivererToSystemUnderTest(),
             m_listOfContainerDelivererFromSystemUnderTestMutex(),
             m_listOfContainerDelivererFromSystemUnderTest() {
-            ContainerConferenceFactory::setSingleton(this);
+            if (processWide) {
+                ContainerConferenceFactory::setSingleton(this);
+            }
+        }
+
+        void ControlledContainerConferenceFactory::attachToCurrentThread() {
+            ContainerConferenceFactory::setSingletonForCurrentThread(this);
+        }
+
+        void ControlledContainerConferenceFactory::detachFromCurrentThread() {
+            ContainerConferenceFactory::setSingletonForCurrentThread(NULL);
         }
 
         ControlledContainerConferenceFactory::~ControlledContainerConferenceFactory() {
@@ -25,14 +25,24 @@ namespace context {
 
         using namespace core::base;
 
-        ControlledTimeFactory::ControlledTimeFactory() :
+        ControlledTimeFactory::ControlledTimeFactory(const bool &processWide) :
             m_timeMutex(),
             m_time() {
-            core::wrapper::TimeFactory::setSingleton(this);
+            if (processWide) {
+                core::wrapper::TimeFactory::setSingleton(this);
+            }
         }
 
         ControlledTimeFactory::~ControlledTimeFactory() {}
 
+        void ControlledTimeFactory::attachToCurrentThread() {
+            core::wrapper::TimeFactory::setSingletonForCurrentThread(this);
+        }
+
+        void ControlledTimeFactory::detachFromCurrentThread() {
+            core::wrapper::TimeFactory::setSingletonForCurrentThread(NULL);
+        }
+
         core::wrapper::Time* ControlledTimeFactory::now() {
             core::wrapper::Time *t = NULL;
             {
@@ -48,5 +48,29 @@ namespace context {
             return (retVal && !hasFinished());
         }
 
+        uint64_t Runner::getNextExecution(const core::wrapper::Time &t) const {
+            uint64_t retVal = 0;
+            if (getFrequency() > 0) {
+                uint64_t THIS_RUN_AT_TIME = static_cast<uint64_t>(TimeConstants::ONE_SECOND_IN_MILLISECONDS / getFrequency());
+                THIS_RUN_AT_TIME = (THIS_RUN_AT_TIME > 0) ? THIS_RUN_AT_TIME : 1;
+
+                const uint64_t SECONDS_IN_MILLISECONDS = static_cast<uint64_t>(t.getSeconds()) * TimeConstants::ONE_SECOND_IN_MILLISECONDS;
+                const uint64_t PARTIAL_MILLISECONDS = t.getPartialMicroseconds() / TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS;
+
+                if (THIS_RUN_AT_TIME > TimeConstants::ONE_SECOND_IN_MILLISECONDS) {
+                    // Modules slower than 1 Hz are executed on multiples of their period.
+                    const uint64_t CURRENT_MILLISECONDS = SECONDS_IN_MILLISECONDS + PARTIAL_MILLISECONDS;
+                    retVal = (CURRENT_MILLISECONDS / THIS_RUN_AT_TIME + 1) * THIS_RUN_AT_TIME;
+                }
+                else {
+                    // All other modules restart their period with every full second.
+                    const uint64_t NEXT_PARTIAL_MILLISECONDS = (PARTIAL_MILLISECONDS / THIS_RUN_AT_TIME + 1) * THIS_RUN_AT_TIME;
+                    retVal = SECONDS_IN_MILLISECONDS + ( (NEXT_PARTIAL_MILLISECONDS < TimeConstants::ONE_SECOND_IN_MILLISECONDS) ? NEXT_PARTIAL_MILLISECONDS : static_cast<uint64_t>(TimeConstants::ONE_SECOND_IN_MILLISECONDS) );
+                }
+            }
+
+            return retVal;
+        }
+
     }
 } // context::base
@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "core/base/Lock.h"
@@ -47,7 +48,9 @@ namespace context {
             m_runtimeControlInterface(sci),
             m_superComponent(NULL),
             m_controlledContainerConferenceFactory(NULL),
-            m_controlledTimeFactory(NULL) {
+            m_controlledTimeFactory(NULL),
+            m_simulatedSecondsPerSecond(0),
+            m_snapshot() {
             // Initialize TimeFactory to avoid SEGFAULT.
             core::data::TimeStamp ts;
             if (ts.getSeconds() > 0) {};
@@ -66,9 +69,14 @@ namespace context {
             }
 
             if (m_controlledTimeFactory != NULL) {
-                // Disable exchanged timefactory AND destroy.
-                RuntimeControl::DisableTimeFactory dtf;
-                dtf.disable();
+                if (m_control == RuntimeControl::TAKE_CONTROL_FOR_CURRENT_THREAD) {
+                    ControlledTimeFactory::detachFromCurrentThread();
+                }
+                else {
+                    // Disable exchanged timefactory AND destroy.
+                    RuntimeControl::DisableTimeFactory dtf;
+                    dtf.disable();
+                }
 
                 OPENDAVINCI_CORE_DELETE_POINTER(m_controlledTimeFactory);
             }
@@ -96,12 +104,29 @@ namespace context {
                     removeExistingContainerConferenceFactory();
                     m_controlledContainerConferenceFactory = new ControlledContainerConferenceFactory();
                 }
+                else if (takeControl == RuntimeControl::TAKE_CONTROL_FOR_CURRENT_THREAD) {
+                    clog << "(context::base::RuntimeControl) Taking control for current thread..." << endl;
+                    // Leave the process-wide factories untouched.
+                    const bool PROCESS_WIDE = false;
+                    m_controlledTimeFactory = new ControlledTimeFactory(PROCESS_WIDE);
+                    m_controlledTimeFactory->attachToCurrentThread();
+
+                    m_controlledContainerConferenceFactory = new ControlledContainerConferenceFactory(PROCESS_WIDE);
+                    m_controlledContainerConferenceFactory->attachToCurrentThread();
+                }
 
                 m_control = takeControl;
             }
         }
 
         void RuntimeControl::removeExistingContainerConferenceFactory() {
+            if (m_control == RuntimeControl::TAKE_CONTROL_FOR_CURRENT_THREAD) {
+                // Only destroy our own ContainerConferenceFactory.
+                ControlledContainerConferenceFactory::detachFromCurrentThread();
+                OPENDAVINCI_CORE_DELETE_POINTER(m_controlledContainerConferenceFactory);
+                return;
+            }
+
             // Destroy any existing ContainerConferenceFactory.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
             ContainerConferenceFactory *ccf2 = &ccf;
@@ -228,6 +253,9 @@ namespace context {
                         // Create a blockable receiver per system under test.
                         // Register ContainerDispatcher to distribute Containers to all SystemParts.
                         SharedPointer<ConferenceClientModuleRunner> wrappedConferenceClientModule(new ConferenceClientModuleRunner(*ccm));
+                        if (m_control == RuntimeControl::TAKE_CONTROL_FOR_CURRENT_THREAD) {
+                            wrappedConferenceClientModule->setThreadScopedFactories(m_controlledTimeFactory, m_controlledContainerConferenceFactory);
+                        }
                         listOfWrappedConferenceClientModules.push_back(wrappedConferenceClientModule);
                     }
                 }
@@ -244,7 +272,9 @@ namespace context {
                 while (mt != listOfSystemReportingComponents.end()) {
                     SystemReportingComponent *src = (*mt++);
                     if (src != NULL) {
-                        clog << "[SRC] at " << time.getSeconds() << "." << time.getPartialMicroseconds() << endl;
+                        if (m_runtimeControlInterface.isVerbose()) {
+                            clog << "[SRC] at " << time.getSeconds() << "." << time.getPartialMicroseconds() << endl;
+                        }
 
                         src->report(time);
                     }
@@ -252,8 +282,85 @@ namespace context {
             }
         }
 
+        void RuntimeControl::schedule(priority_queue<ScheduledExecution, vector<ScheduledExecution>, greater<ScheduledExecution> > &scheduler,
+                                      const Runner *runner, const uint32_t &index, const core::wrapper::Time &time, const bool &includeCurrentTime) {
+            if (runner != NULL) {
+                if (includeCurrentTime && runner->needsExecution(time)) {
+                    const uint64_t currentTime = static_cast<uint64_t>(time.getSeconds()) * TimeConstants::ONE_SECOND_IN_MILLISECONDS
+                                                 + time.getPartialMicroseconds() / TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS;
+                    scheduler.push(ScheduledExecution(currentTime, index));
+                }
+                else {
+                    const uint64_t nextExecution = runner->getNextExecution(time);
+                    if (nextExecution > 0) {
+                        scheduler.push(ScheduledExecution(nextExecution, index));
+                    }
+                }
+            }
+        }
+
+        double RuntimeControl::getSimulatedSecondsPerSecond() const {
+            return m_simulatedSecondsPerSecond;
+        }
+
+        SimulationSnapshot RuntimeControl::createSnapshot(RuntimeEnvironment &rte, const ControlledTime &time) {
+            SimulationSnapshot snapshot(time);
+
+            vector<SystemFeedbackComponent*> listOfSystemFeedbackComponents = rte.getListOfSystemFeedbackComponents();
+            vector<SystemFeedbackComponent*>::iterator it = listOfSystemFeedbackComponents.begin();
+            while (it != listOfSystemFeedbackComponents.end()) {
+                stringstream state;
+                (*it++)->store(state);
+                snapshot.addState(state.str());
+            }
+
+            vector<SystemReportingComponent*> listOfSystemReportingComponents = rte.getListOfSystemReportingComponents();
+            vector<SystemReportingComponent*>::iterator jt = listOfSystemReportingComponents.begin();
+            while (jt != listOfSystemReportingComponents.end()) {
+                stringstream state;
+                (*jt++)->store(state);
+                snapshot.addState(state.str());
+            }
+
+            return snapshot;
+        }
+
+        void RuntimeControl::restoreSnapshot(RuntimeEnvironment &rte, const SimulationSnapshot &snapshot) {
+            vector<SystemFeedbackComponent*> listOfSystemFeedbackComponents = rte.getListOfSystemFeedbackComponents();
+            vector<SystemReportingComponent*> listOfSystemReportingComponents = rte.getListOfSystemReportingComponents();
+
+            if (snapshot.getNumberOfStates() != (listOfSystemFeedbackComponents.size() + listOfSystemReportingComponents.size())) {
+                stringstream s;
+                s << "(context::base::RuntimeControl) Snapshot contains " << snapshot.getNumberOfStates() << " states but RuntimeEnvironment has "
+                  << listOfSystemFeedbackComponents.size() << " SystemFeedbackComponents and " << listOfSystemReportingComponents.size() << " SystemReportingComponents.";
+                throw s.str();
+            }
+
+            uint32_t index = 0;
+            vector<SystemFeedbackComponent*>::iterator it = listOfSystemFeedbackComponents.begin();
+            while (it != listOfSystemFeedbackComponents.end()) {
+                stringstream state(snapshot.getState(index++));
+                (*it++)->restore(state);
+            }
+
+            vector<SystemReportingComponent*>::iterator jt = listOfSystemReportingComponents.begin();
+            while (jt != listOfSystemReportingComponents.end()) {
+                stringstream state(snapshot.getState(index++));
+                (*jt++)->restore(state);
+            }
+        }
+
+        const SimulationSnapshot RuntimeControl::getSnapshot() const {
+            return m_snapshot;
+        }
+
         enum RuntimeControl::ERRORCODES RuntimeControl::run(RuntimeEnvironment &rte, const uint32_t &maxRunningTimeInSeconds) {
+            return run(rte, maxRunningTimeInSeconds, SimulationSnapshot());
+        }
+
+        enum RuntimeControl::ERRORCODES RuntimeControl::run(RuntimeEnvironment &rte, const uint32_t &maxRunningTimeInSeconds, const SimulationSnapshot &snapshot) {
             enum ERRORCODES retVal = RuntimeControl::NO_ERROR_OCCURRED;
+            m_snapshot = SimulationSnapshot();
 
             // Check if the user called setup(...) properly.
             enum RUNTIMECONTROL control = RuntimeControl::UNSPECIFIED;
@@ -262,7 +369,7 @@ namespace context {
                 control = m_control;
             }
 
-            if (control == RuntimeControl::TAKE_CONTROL) {
+            if ( (control == RuntimeControl::TAKE_CONTROL) || (control == RuntimeControl::TAKE_CONTROL_FOR_CURRENT_THREAD) ) {
                 if ( rte.isValid() && (maxRunningTimeInSeconds > 0) ) {
                     try {
                         // Stop adding further modules.
@@ -280,80 +387,128 @@ namespace context {
                         // Create list of wrapper ConferenceClientModules.
                         vector<SharedPointer<ConferenceClientModuleRunner> > listOfWrappedConferenceClientModules = createListOfConferenceClientModuleRunners(rte);
 
-                        // Compute greatest possible time step in the runtime environment.
-                        const uint32_t SLEEPING_TIME = rte.getGreatestTimeStep();
-                        clog << "(context::base::RuntimeControl) greatest common divisor: " << SLEEPING_TIME << "ms." << endl;
-
                         ////////////////////////////////////////////////////////
                         // Assert necessary things.
-                        assert(SLEEPING_TIME > 0);
                         assert(listOfSystemFeedbackComponents.size() > 0);
-                        assert(listOfWrappedConferenceClientModules.size() > 0);
+                        // RuntimeEnvironments without any ConferenceClientModules are simulated until maxRunningTimeInSeconds.
                         ////////////////////////////////////////////////////////
 
                         // Ladies and Gentlemen: The time.
                         Clock time;
 
+                        // Continue a previous simulation.
+                        if (snapshot.isValid()) {
+                            restoreSnapshot(rte, snapshot);
+                            time = Clock(snapshot.getTime().getSeconds(), snapshot.getTime().getPartialMicroseconds());
+                            clog << "(context::base::RuntimeControl) Continuing from snapshot at " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << "." << endl;
+                        }
+
                         // Declare actual time.
                         m_controlledTimeFactory->setTime(time.now());
 
+                        // Instead of advancing the time by the greatest common
+                        // divisor of all periods, the time jumps directly to the
+                        // next point in time at which any module is due. The queue
+                        // is ordered by the next execution and afterwards by the
+                        // module's index (SystemFeedbackComponents first, followed
+                        // by ConferenceClientModules) to keep the order of execution.
+                        const uint32_t NUMBER_OF_SFCS = listOfSystemFeedbackComponents.size();
+                        const uint32_t NUMBER_OF_CCMS = listOfWrappedConferenceClientModules.size();
+                        priority_queue<ScheduledExecution, vector<ScheduledExecution>, greater<ScheduledExecution> > scheduler;
+                        for (uint32_t i = 0; i < NUMBER_OF_SFCS; i++) {
+                            schedule(scheduler, listOfSystemFeedbackComponents.at(i), i, time.now(), true);
+                        }
+                        for (uint32_t i = 0; i < NUMBER_OF_CCMS; i++) {
+                            schedule(scheduler, listOfWrappedConferenceClientModules.at(i).operator->(), NUMBER_OF_SFCS + i, time.now(), true);
+                        }
+                        clog << "(context::base::RuntimeControl) Scheduling " << NUMBER_OF_SFCS << " SystemFeedbackComponent(s) and " << NUMBER_OF_CCMS << " ConferenceClientModule(s) on demand." << endl;
+
+                        const uint64_t MAX_RUNNING_TIME = static_cast<uint64_t>(maxRunningTimeInSeconds) * TimeConstants::ONE_SECOND_IN_MILLISECONDS;
+                        const uint64_t START_TIME = static_cast<uint64_t>(time.now().getSeconds()) * TimeConstants::ONE_SECOND_IN_MILLISECONDS
+                                                    + time.now().getPartialMicroseconds() / TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS;
+                        uint64_t currentTime = START_TIME;
+                        uint32_t numberOfTimeSteps = 0;
+                        const int64_t startOfSimulation = core::wrapper::SystemTimeFactory::getInstance().getMonotonicNanoseconds();
+
                         bool moreModulesSchedulable = true;
 
+                        // Skip logging every time step for non-verbose runs.
+                        const bool VERBOSE = m_runtimeControlInterface.isVerbose();
+
                         // Perform system's context simulation.
                         setModuleState(ModuleState::RUNNING);
                         while ( (moreModulesSchedulable) && (static_cast<uint32_t>(time.now().getSeconds()) < maxRunningTimeInSeconds) && (getModuleState() == ModuleState::RUNNING) ) {
-                            clog << "------------------------------------------------------------------------------" << endl;
-                            clog << "Time " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                            if (VERBOSE) {
+                                clog << "------------------------------------------------------------------------------" << endl;
+                                clog << "Time " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                            }
 
-                            // Execute SystemFeedbackComponents.
-                            vector<SystemFeedbackComponent*>::iterator jt = listOfSystemFeedbackComponents.begin();
-                            while (jt != listOfSystemFeedbackComponents.end()) {
-                                SystemFeedbackComponent *sfc = (*jt++);
+                            // Execute all modules being due now.
+                            while ( (!scheduler.empty()) && (scheduler.top().first == currentTime) ) {
+                                const uint32_t index = scheduler.top().second;
+                                scheduler.pop();
 
-                                bool hasExecutedSystemComponent = false;
-                                if ( (sfc != NULL) && (sfc->needsExecution(time.now())) ) {
-                                    clog << "[SFC] at " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                                if (index < NUMBER_OF_SFCS) {
+                                    // Execute SystemFeedbackComponent.
+                                    SystemFeedbackComponent *sfc = listOfSystemFeedbackComponents.at(index);
+                                    if (VERBOSE) {
+                                        clog << "[SFC] at " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                                    }
 
                                     sfc->step(time.now(), *m_controlledContainerConferenceFactory);
 
-                                    hasExecutedSystemComponent = true;
-                                }
-
-                                // When the SystemContextComponent was executed, call all reporters.
-                                if (hasExecutedSystemComponent) {
+                                    // When the SystemContextComponent was executed, call all reporters.
                                     doReporting(rte, time.now());
+
+                                    schedule(scheduler, sfc, index, time.now(), false);
+                                }
+                                else {
+                                    // Execute wrapped ConferenceClientModule.
+                                    SharedPointer<ConferenceClientModuleRunner> runner = listOfWrappedConferenceClientModules.at(index - NUMBER_OF_SFCS);
+                                    if (runner->needsExecution(time.now())) {
+                                        runner->step(time.now());
+
+                                        // When the application was executed, call all reporters.
+                                        doReporting(rte, time.now());
+                                    }
+
+                                    // Finished applications are not scheduled anymore.
+                                    if (!runner->hasFinished()) {
+                                        schedule(scheduler, runner.operator->(), index, time.now(), false);
+                                    }
                                 }
                             }
+                            numberOfTimeSteps++;
 
-                            // Execute wrapped ConferenceClientModules.
-                            vector<SharedPointer<ConferenceClientModuleRunner> >::iterator kt = listOfWrappedConferenceClientModules.begin();
-                            while (kt != listOfWrappedConferenceClientModules.end()) {
-                                SharedPointer<ConferenceClientModuleRunner> runner = (*kt++);
-
-                                // Check, if further cycles are necessary.
+                            // Check, if further cycles are necessary.
+                            if (NUMBER_OF_CCMS > 0) {
                                 moreModulesSchedulable = false;
-                                moreModulesSchedulable |= ( (runner.isValid()) && (!runner->hasFinished()) );
-
-                                // Check if the application needs to be executed.
-                                bool hasExecutedApplication = false;
-                                if ( runner.isValid() && (runner->needsExecution(time.now())) ) {
-                                    runner->step(time.now());
-                                    hasExecutedApplication = true;
-                                }
-
-                                // When the application was executed, call all reporters.
-                                if (hasExecutedApplication) {
-                                    doReporting(rte, time.now());
+                                vector<SharedPointer<ConferenceClientModuleRunner> >::iterator kt = listOfWrappedConferenceClientModules.begin();
+                                while (kt != listOfWrappedConferenceClientModules.end()) {
+                                    SharedPointer<ConferenceClientModuleRunner> runner = (*kt++);
+                                    moreModulesSchedulable |= ( (runner.isValid()) && (!runner->hasFinished()) );
                                 }
                             }
 
-                            // Increment the time using the computed greatest common divisor.
-                            time.increment(SLEEPING_TIME);
+                            // Jump to the next due module or to the end of the simulation.
+                            uint64_t nextTime = (scheduler.empty() || (scheduler.top().first > MAX_RUNNING_TIME)) ? MAX_RUNNING_TIME : scheduler.top().first;
+                            nextTime = (nextTime > currentTime) ? nextTime : currentTime;
+                            time.increment(static_cast<uint32_t>(nextTime - currentTime));
+                            currentTime = nextTime;
 
                             // Feed forward current valid system time to TimeFactory.
                             m_controlledTimeFactory->setTime(time.now());
                         }
 
+                        // Report the simulation's throughput.
+                        const double wallTime = (core::wrapper::SystemTimeFactory::getInstance().getMonotonicNanoseconds() - startOfSimulation) / (1000.0 * 1000.0 * 1000.0);
+                        const double simulatedTime = (currentTime - START_TIME) / static_cast<double>(TimeConstants::ONE_SECOND_IN_MILLISECONDS);
+                        m_simulatedSecondsPerSecond = (wallTime > 0) ? (simulatedTime / wallTime) : 0;
+                        clog << "(context::base::RuntimeControl) Simulated " << simulatedTime << "s in " << wallTime << "s using " << numberOfTimeSteps << " time steps (" << m_simulatedSecondsPerSecond << " simulated seconds per second)." << endl;
+
+                        // Keep the state of all components to allow continuing from here.
+                        m_snapshot = createSnapshot(rte, time.now());
+
                         // Stop wrapped application.
                         vector<SharedPointer<ConferenceClientModuleRunner> >::iterator kt = listOfWrappedConferenceClientModules.begin();
                         while (kt != listOfWrappedConferenceClientModules.end()) {
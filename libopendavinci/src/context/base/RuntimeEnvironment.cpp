@@ -78,9 +78,9 @@ namespace context {
             {
                 Lock l(m_listsMutex);
 
-                retVal = ( (m_listOfConferenceClientModules.size() > 0) && (m_listOfSystemFeedbackComponents.size() > 0) );
+                retVal = (m_listOfSystemFeedbackComponents.size() > 0);
 
-                // Reporting components are not required but still useful...
+                // ConferenceClientModules and reporting components are not required but still useful...
             }
             return retVal;
         }
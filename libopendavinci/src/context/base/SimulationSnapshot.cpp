@@ -0,0 +1,80 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <sstream>
+
+#include "context/base/SimulationSnapshot.h"
+
+namespace context {
+    namespace base {
+
+        using namespace std;
+
+        SimulationSnapshot::SimulationSnapshot() :
+            m_valid(false),
+            m_time(),
+            m_listOfStates() {}
+
+        SimulationSnapshot::SimulationSnapshot(const ControlledTime &time) :
+            m_valid(true),
+            m_time(time),
+            m_listOfStates() {}
+
+        SimulationSnapshot::SimulationSnapshot(const SimulationSnapshot &obj) :
+            m_valid(obj.m_valid),
+            m_time(obj.m_time),
+            m_listOfStates(obj.m_listOfStates) {}
+
+        SimulationSnapshot::~SimulationSnapshot() {}
+
+        SimulationSnapshot& SimulationSnapshot::operator=(const SimulationSnapshot &obj) {
+            m_valid = obj.m_valid;
+            m_time = obj.m_time;
+            m_listOfStates = obj.m_listOfStates;
+
+            return (*this);
+        }
+
+        bool SimulationSnapshot::isValid() const {
+            return m_valid;
+        }
+
+        const ControlledTime SimulationSnapshot::getTime() const {
+            return m_time;
+        }
+
+        void SimulationSnapshot::addState(const string &state) {
+            m_listOfStates.push_back(state);
+        }
+
+        uint32_t SimulationSnapshot::getNumberOfStates() const {
+            return m_listOfStates.size();
+        }
+
+        const string SimulationSnapshot::getState(const uint32_t &index) const {
+            if (index >= m_listOfStates.size()) {
+                stringstream s;
+                s << "(context::base::SimulationSnapshot) No state for component " << index << " available; snapshot contains " << m_listOfStates.size() << " states.";
+                throw s.str();
+            }
+            return m_listOfStates.at(index);
+        }
+
+    }
+} // context::base
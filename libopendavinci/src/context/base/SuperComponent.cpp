@@ -177,6 +177,10 @@ namespace context {
             clog << "(context::base::SuperComponent) Received RuntimeStatistics for " << md.toString() << ": " << rs.toString() << endl;
         }
 
+        void SuperComponent::handleInstrumentationStatistic(const core::data::dmcp::ModuleDescriptor& md,  const core::data::InstrumentationStatistic& is) {
+            clog << "(context::base::SuperComponent) Received InstrumentationStatistic for " << md.toString() << ":" << endl << is.toString();
+        }
+
         void SuperComponent::handleConnectionLost(const core::data::dmcp::ModuleDescriptor& md) {
             clog << "(context::base::SuperComponent) Lost connection to " << md.toString() << endl;
         }
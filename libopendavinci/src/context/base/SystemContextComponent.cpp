@@ -17,6 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <sstream>
+
+#include "core/base/Deserializer.h"
+#include "core/base/Hash.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
 #include "core/wrapper/KeyValueDatabaseFactory.h"
 
 #include "context/base/SystemContextComponent.h"
@@ -51,5 +57,65 @@ namespace context {
         	return *m_keyValueDataStore;
         }
 
+        void SystemContextComponent::store(ostream &out) {
+            // Serialize all pending containers and put them back in the same order.
+            const uint32_t SIZE = m_fifo.getSize();
+            stringstream containers;
+            for (uint32_t i = 0; i < SIZE; i++) {
+                core::data::Container c = m_fifo.leave();
+                containers << c;
+                m_fifo.add(c);
+            }
+
+            stringstream state;
+            storeState(state);
+
+            SerializationFactory sf;
+            Serializer &s = sf.getSerializer(out);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'i', 'z', 'e') >::RESULT,
+                    SIZE);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('f', 'i', 'f', 'o') >::RESULT,
+                    containers.str());
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('s', 't', 'a', 't', 'e') >::RESULT,
+                    state.str());
+        }
+
+        void SystemContextComponent::restore(istream &in) {
+            uint32_t size = 0;
+            string containers;
+            string state;
+
+            SerializationFactory sf;
+            Deserializer &d = sf.getDeserializer(in);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'i', 'z', 'e') >::RESULT,
+                   size);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('f', 'i', 'f', 'o') >::RESULT,
+                   containers);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('s', 't', 'a', 't', 'e') >::RESULT,
+                   state);
+
+            // Replace all pending containers.
+            m_fifo.clear();
+            stringstream sstrContainers(containers);
+            for (uint32_t i = 0; i < size; i++) {
+                core::data::Container c;
+                sstrContainers >> c;
+                SystemContextComponent::nextContainer(c);
+            }
+
+            stringstream sstrState(state);
+            restoreState(sstrState);
+        }
+
+        void SystemContextComponent::storeState(ostream &/*out*/) const {}
+
+        void SystemContextComponent::restoreState(istream &/*in*/) {}
+
     }
 } // context::base
@@ -26,6 +26,10 @@ namespace context {
 
         SystemReportingComponent::~SystemReportingComponent() {}
 
+        bool SystemReportingComponent::hasCorrectlyWorked() const {
+            return true;
+        }
+
         float SystemReportingComponent::getFrequency() const {
             return 0;
         }
@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include "core/base/Instrumentation.h"
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
 #include "core/data/RuntimeStatistic.h"
@@ -48,9 +49,18 @@ namespace core {
                 m_name(name),
                 m_keyValueConfiguration(),
                 m_serverInformation(),
-                m_dmcpClient() {}
-
-        ClientModule::~ClientModule() {}
+                m_dmcpClient(),
+                m_keyValueConfigurationVersion(0),
+                m_listOfKeyValueConfigurationHandles() {}
+
+        ClientModule::~ClientModule() {
+            vector<AbstractKeyValueConfigurationHandle*>::iterator it = m_listOfKeyValueConfigurationHandles.begin();
+            while (it != m_listOfKeyValueConfigurationHandles.end()) {
+                AbstractKeyValueConfigurationHandle *handle = (*it++);
+                OPENDAVINCI_CORE_DELETE_POINTER(handle);
+            }
+            m_listOfKeyValueConfigurationHandles.clear();
+        }
 
         core::SharedPointer<core::dmcp::connection::Client>& ClientModule::getDMCPClient() {
             return m_dmcpClient;
@@ -64,6 +74,31 @@ namespace core {
             return m_keyValueConfiguration;
         }
 
+        void ClientModule::updateKeyValueConfigurationHandles() {
+            vector<AbstractKeyValueConfigurationHandle*>::iterator it = m_listOfKeyValueConfigurationHandles.begin();
+            while (it != m_listOfKeyValueConfigurationHandles.end()) {
+                (*it++)->update(m_keyValueConfiguration);
+            }
+        }
+
+        void ClientModule::handleKeyValueConfigurationChange() {}
+
+        void ClientModule::calledGetModuleState() {
+            InterruptibleModule::calledGetModuleState();
+
+            // Apply a new configuration only between two cycles of the module's loop.
+            if (m_dmcpClient.isValid()) {
+                const uint32_t version = m_dmcpClient->getConfigurationVersion();
+                if (version != m_keyValueConfigurationVersion) {
+                    m_keyValueConfigurationVersion = version;
+                    m_keyValueConfiguration = m_dmcpClient->getConfiguration();
+                    updateKeyValueConfigurationHandles();
+
+                    handleKeyValueConfigurationChange();
+                }
+            }
+        }
+
         const core::dmcp::ServerInformation ClientModule::getServerInformation() const {
             return m_serverInformation;
         }
@@ -112,7 +147,15 @@ namespace core {
                 m_dmcpClient->initialize();
 
                 // Get configuration from DMCP client.
+                m_keyValueConfigurationVersion = m_dmcpClient->getConfigurationVersion();
                 m_keyValueConfiguration = m_dmcpClient->getConfiguration();
+                updateKeyValueConfigurationHandles();
+
+                // Record counters and histograms only if requested.
+                try {
+                    Instrumentation::setEnabled(m_keyValueConfiguration.getValue<int32_t>("global.instrumentation") == 1);
+                }
+                catch(const ValueForKeyNotFoundException &) {}
             } catch (ConnectException& e) {
                 clog << "(ClientModule) connecting to supercomponent failed: " << e.getMessage() << endl;
                 return ModuleState::SERIOUS_ERROR;
@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include "core/base/Instrumentation.h"
 #include "core/base/Lock.h"
 #include "core/io/ContainerConferenceFactory.h"
 #include "core/wrapper/KeyValueDatabaseFactory.h"
@@ -39,6 +40,8 @@ namespace core {
                 m_dataStoresMutex(),
                 m_listOfDataStores(),
                 m_mapOfListOfDataStores(),
+                m_receiveToDispatchHistogram(Instrumentation::getInstance().getHistogram("ConferenceClientModule.receiveToDispatch")),
+                m_mapOfQueueDepthHistograms(),
                 m_keyValueDataStore() {
             // Create an in-memory database.
             m_keyValueDataStore = SharedPointer<KeyValueDataStore>(new KeyValueDataStore(wrapper::KeyValueDatabaseFactory::createKeyValueDatabase("")));
@@ -72,31 +75,66 @@ namespace core {
             }
         }
 
+        uint32_t ConferenceClientModule::getQueueDepthHistogram(const Container &c) {
+            map<Container::DATATYPE, uint32_t>::iterator it = m_mapOfQueueDepthHistograms.find(c.getDataType());
+            if (it != m_mapOfQueueDepthHistograms.end()) {
+                return it->second;
+            }
+
+            stringstream name;
+            name << "ConferenceClientModule.queueDepth." << (c.toString().empty() ? "" : c.toString() + ".") << c.getDataType();
+            const uint32_t histogram = Instrumentation::getInstance().getHistogram(name.str());
+            m_mapOfQueueDepthHistograms[c.getDataType()] = histogram;
+
+            return histogram;
+        }
+
         void ConferenceClientModule::nextContainer(Container &c) {
             // Distribute data to datastores.
             {
                 Lock l(m_dataStoresMutex);
 
+                // Largest number of entries waiting in any data store after adding this container.
+                uint32_t queueDepth = 0;
+                bool hasDataStores = false;
+
                 vector<AbstractDataStore*>::iterator it = m_listOfDataStores.begin();
                 while (it != m_listOfDataStores.end()) {
                     AbstractDataStore *ads = (*it++);
                     if (ads != NULL) {
                         ads->add(c); // Currently waiting threads are awaken automagically.
+                        queueDepth = max(queueDepth, ads->getSize());
+                        hasDataStores = true;
                     }
                 }
 
-                vector<AbstractDataStore*> listOfDataStores = m_mapOfListOfDataStores[c.getDataType()];
-                vector<AbstractDataStore*>::iterator jt = listOfDataStores.begin();
-                while (jt != listOfDataStores.end()) {
-                    AbstractDataStore *ads = (*jt++);
-                    if (ads != NULL) {
-                        ads->add(c); // Currently waiting threads are awaken automagically.
+                map<Container::DATATYPE, vector<AbstractDataStore*> >::iterator kt = m_mapOfListOfDataStores.find(c.getDataType());
+                if (kt != m_mapOfListOfDataStores.end()) {
+                    vector<AbstractDataStore*>::iterator jt = kt->second.begin();
+                    while (jt != kt->second.end()) {
+                        AbstractDataStore *ads = (*jt++);
+                        if (ads != NULL) {
+                            ads->add(c); // Currently waiting threads are awaken automagically.
+                            queueDepth = max(queueDepth, ads->getSize());
+                            hasDataStores = true;
+                        }
                     }
                 }
+
+                if (hasDataStores && Instrumentation::isEnabled()) {
+                    Instrumentation::getInstance().add(getQueueDepthHistogram(c), queueDepth);
+                }
             }
 
             // Store data using a plain map.
             m_keyValueDataStore->put(c.getDataType(), c);
+
+            // Time between receiving the container and making it available to the module.
+            const long receivedInMicroseconds = c.getReceivedTimeStamp().toMicroseconds();
+            if ( (receivedInMicroseconds > 0) && Instrumentation::isEnabled() ) {
+                const long latencyInMicroseconds = TimeStamp().toMicroseconds() - receivedInMicroseconds;
+                Instrumentation::getInstance().add(m_receiveToDispatchHistogram, (latencyInMicroseconds > 0) ? static_cast<uint64_t>(latencyInMicroseconds) * 1000 : 0);
+            }
         }
 
         ContainerConference& ConferenceClientModule::getConference() {
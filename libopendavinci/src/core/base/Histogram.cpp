@@ -0,0 +1,164 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "core/base/Histogram.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        Histogram::Histogram() :
+            m_count(0),
+            m_sum(0),
+            m_minimum(0),
+            m_maximum(0),
+            m_buckets() {
+            reset();
+        }
+
+        Histogram::Histogram(const Histogram &obj) :
+            m_count(obj.m_count),
+            m_sum(obj.m_sum),
+            m_minimum(obj.m_minimum),
+            m_maximum(obj.m_maximum),
+            m_buckets() {
+            memcpy(m_buckets, obj.m_buckets, sizeof(m_buckets));
+        }
+
+        Histogram::~Histogram() {}
+
+        Histogram& Histogram::operator=(const Histogram &obj) {
+            m_count = obj.m_count;
+            m_sum = obj.m_sum;
+            m_minimum = obj.m_minimum;
+            m_maximum = obj.m_maximum;
+            memcpy(m_buckets, obj.m_buckets, sizeof(m_buckets));
+
+            return (*this);
+        }
+
+        uint32_t Histogram::getBucket(const uint64_t &value) {
+            if (value < SUB_BUCKETS) {
+                return static_cast<uint32_t>(value);
+            }
+
+            // Find the most significant bit which determines the magnitude.
+            uint32_t magnitude = 0;
+            uint64_t v = value >> SUB_BUCKET_BITS;
+            while ( (v > 0) && (magnitude < MAGNITUDES) ) {
+                v >>= 1;
+                magnitude++;
+            }
+            if (v > 0) {
+                // Value is out of range.
+                return NUMBER_OF_BUCKETS - 1;
+            }
+
+            // The next SUB_BUCKET_BITS bits below the most significant one select the sub-bucket.
+            const uint32_t subBucket = static_cast<uint32_t>(value >> (magnitude - 1)) - SUB_BUCKETS;
+            return SUB_BUCKETS + (magnitude - 1) * SUB_BUCKETS + subBucket;
+        }
+
+        uint64_t Histogram::getBucketUpperBound(const uint32_t &bucket) {
+            if (bucket < SUB_BUCKETS) {
+                return bucket;
+            }
+
+            const uint32_t shift = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+            const uint64_t subBucket = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+            const uint64_t lowerBound = (SUB_BUCKETS + subBucket) << shift;
+            return lowerBound + (static_cast<uint64_t>(1) << shift) - 1;
+        }
+
+        void Histogram::add(const uint64_t &value) {
+            m_buckets[getBucket(value)]++;
+
+            m_minimum = ( (m_count == 0) || (value < m_minimum) ) ? value : m_minimum;
+            m_maximum = (value > m_maximum) ? value : m_maximum;
+            m_sum += value;
+            m_count++;
+        }
+
+        void Histogram::merge(const Histogram &h) {
+            if (h.m_count == 0) {
+                return;
+            }
+
+            for (uint32_t i = 0; i < NUMBER_OF_BUCKETS; i++) {
+                m_buckets[i] += h.m_buckets[i];
+            }
+
+            m_minimum = ( (m_count == 0) || (h.m_minimum < m_minimum) ) ? h.m_minimum : m_minimum;
+            m_maximum = (h.m_maximum > m_maximum) ? h.m_maximum : m_maximum;
+            m_sum += h.m_sum;
+            m_count += h.m_count;
+        }
+
+        void Histogram::reset() {
+            m_count = 0;
+            m_sum = 0;
+            m_minimum = 0;
+            m_maximum = 0;
+            memset(m_buckets, 0, sizeof(m_buckets));
+        }
+
+        uint64_t Histogram::getCount() const {
+            return m_count;
+        }
+
+        uint64_t Histogram::getSum() const {
+            return m_sum;
+        }
+
+        uint64_t Histogram::getMinimum() const {
+            return m_minimum;
+        }
+
+        uint64_t Histogram::getMaximum() const {
+            return m_maximum;
+        }
+
+        double Histogram::getMean() const {
+            return (m_count > 0) ? (static_cast<double>(m_sum) / m_count) : 0;
+        }
+
+        uint64_t Histogram::getValueAtPercentile(const double &percentile) const {
+            if (m_count == 0) {
+                return 0;
+            }
+
+            const double p = (percentile < 0) ? 0 : ( (percentile > 100) ? 100 : percentile );
+            uint64_t rank = static_cast<uint64_t>(ceil(p / 100.0 * m_count));
+            rank = (rank < 1) ? 1 : rank;
+
+            uint64_t cumulated = 0;
+            for (uint32_t i = 0; i < NUMBER_OF_BUCKETS; i++) {
+                cumulated += m_buckets[i];
+                if (cumulated >= rank) {
+                    const uint64_t upperBound = getBucketUpperBound(i);
+                    return (upperBound < m_maximum) ? upperBound : m_maximum;
+                }
+            }
+
+            return m_maximum;
+        }
+
+    }
+} // core::base
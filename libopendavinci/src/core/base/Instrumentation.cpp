@@ -0,0 +1,343 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+
+#ifndef WIN32
+    #include <pthread.h>
+#endif
+
+#include "core/macros.h"
+#include "core/base/Histogram.h"
+#include "core/base/Instrumentation.h"
+#include "core/base/Lock.h"
+#include "core/wrapper/TimeFactory.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+        using namespace core::data;
+
+        /**
+         * This class contains the counters and histograms recorded by
+         * one thread. Its mutex is taken by the owning thread for every
+         * record but it is only contended while the data is collected
+         * by Instrumentation::getInstrumentationStatistic() or while
+         * Instrumentation::setEnabled() runs. The cache of keyed
+         * histograms is only used by the owning thread.
+         */
+        class InstrumentationThreadStorage {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                InstrumentationThreadStorage(const InstrumentationThreadStorage &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                InstrumentationThreadStorage& operator=(const InstrumentationThreadStorage &);
+
+            public:
+                InstrumentationThreadStorage() :
+                    m_mutex(),
+                    m_enabled(false),
+                    m_listOfCounters(),
+                    m_listOfHistograms(),
+                    m_mapOfKeyedHistograms() {}
+
+                ~InstrumentationThreadStorage() {
+                    vector<Histogram*>::iterator it = m_listOfHistograms.begin();
+                    while (it != m_listOfHistograms.end()) {
+                        Histogram *h = (*it++);
+                        OPENDAVINCI_CORE_DELETE_POINTER(h);
+                    }
+                    m_listOfHistograms.clear();
+                }
+
+            public:
+                Mutex m_mutex;
+                bool m_enabled;
+                vector<uint64_t> m_listOfCounters;
+                vector<Histogram*> m_listOfHistograms;
+                map<pair<const char*, uint32_t>, uint32_t> m_mapOfKeyedHistograms;
+        };
+
+        // Initialize singleton instance.
+        Mutex Instrumentation::m_singletonMutex;
+        Instrumentation* Instrumentation::m_singleton = NULL;
+        bool Instrumentation::m_enabled = false;
+
+        // Instance and storage as seen from the current thread.
+        static OPENDAVINCI_THREAD_LOCAL Instrumentation *threadInstance = NULL;
+        static OPENDAVINCI_THREAD_LOCAL InstrumentationThreadStorage *threadStorage = NULL;
+
+#ifndef WIN32
+        // Key to get notified when a thread having a storage terminates;
+        // on Windows, storages are kept until the instance is destroyed.
+        static pthread_key_t threadStorageKey;
+#endif
+
+        Instrumentation::Instrumentation() :
+            m_metricsMutex(),
+            m_mapOfMetrics(),
+            m_listOfNames(),
+            m_listOfTypes(),
+            m_listOfThreadStorages(),
+            m_listOfRetiredCounters(),
+            m_listOfRetiredHistograms() {
+#ifndef WIN32
+            pthread_key_create(&threadStorageKey, &Instrumentation::threadTerminated);
+#endif
+        }
+
+        Instrumentation::~Instrumentation() {
+#ifndef WIN32
+            pthread_key_delete(threadStorageKey);
+#endif
+
+            Lock l(m_metricsMutex);
+            vector<InstrumentationThreadStorage*>::iterator it = m_listOfThreadStorages.begin();
+            while (it != m_listOfThreadStorages.end()) {
+                InstrumentationThreadStorage *its = (*it++);
+                OPENDAVINCI_CORE_DELETE_POINTER(its);
+            }
+            m_listOfThreadStorages.clear();
+        }
+
+        Instrumentation& Instrumentation::getInstance() {
+            // The lock is only taken once per thread.
+            if (threadInstance == NULL) {
+                Lock l(Instrumentation::m_singletonMutex);
+                if (Instrumentation::m_singleton == NULL) {
+                    Instrumentation::m_singleton = new Instrumentation();
+                }
+                threadInstance = Instrumentation::m_singleton;
+            }
+
+            return (*threadInstance);
+        }
+
+        void Instrumentation::setEnabled(const bool &enabled) {
+            Instrumentation &instr = Instrumentation::getInstance();
+
+            // Threads read their own copy of the flag which is guarded by their storage's mutex.
+            Lock l(instr.m_metricsMutex);
+            Instrumentation::m_enabled = enabled;
+
+            vector<InstrumentationThreadStorage*>::iterator it = instr.m_listOfThreadStorages.begin();
+            while (it != instr.m_listOfThreadStorages.end()) {
+                InstrumentationThreadStorage *its = (*it++);
+
+                Lock ll(its->m_mutex);
+                its->m_enabled = enabled;
+            }
+        }
+
+        bool Instrumentation::isEnabled() {
+            InstrumentationThreadStorage &its = Instrumentation::getInstance().getThreadStorage();
+
+            Lock l(its.m_mutex);
+            return its.m_enabled;
+        }
+
+        int64_t Instrumentation::getMonotonicNanoseconds() {
+#ifdef HAVE_LINUX_RT
+            struct timespec t;
+            ::clock_gettime(CLOCK_MONOTONIC, &t);
+            return static_cast<int64_t>(t.tv_sec) * 1000000000L + t.tv_nsec;
+#else
+            return core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+#endif
+        }
+
+        uint32_t Instrumentation::getMetric(const string &name, const InstrumentationMetric::METRICTYPE &type) {
+            Lock l(m_metricsMutex);
+
+            map<string, uint32_t>::iterator it = m_mapOfMetrics.find(name);
+            if (it != m_mapOfMetrics.end()) {
+                return it->second;
+            }
+
+            const uint32_t metric = m_listOfNames.size();
+            m_mapOfMetrics[name] = metric;
+            m_listOfNames.push_back(name);
+            m_listOfTypes.push_back(type);
+
+            return metric;
+        }
+
+        uint32_t Instrumentation::getCounter(const string &name) {
+            return getMetric(name, InstrumentationMetric::COUNTER);
+        }
+
+        uint32_t Instrumentation::getHistogram(const string &name) {
+            return getMetric(name, InstrumentationMetric::HISTOGRAM);
+        }
+
+        bool Instrumentation::findHistogram(const char *family, const uint32_t &key, uint32_t &histogram) {
+            InstrumentationThreadStorage &its = getThreadStorage();
+
+            map<pair<const char*, uint32_t>, uint32_t>::const_iterator it = its.m_mapOfKeyedHistograms.find(make_pair(family, key));
+            if (it != its.m_mapOfKeyedHistograms.end()) {
+                histogram = it->second;
+                return true;
+            }
+            return false;
+        }
+
+        uint32_t Instrumentation::getHistogram(const string &name, const char *family, const uint32_t &key) {
+            const uint32_t histogram = getHistogram(name);
+            getThreadStorage().m_mapOfKeyedHistograms[make_pair(family, key)] = histogram;
+            return histogram;
+        }
+
+        InstrumentationThreadStorage& Instrumentation::getThreadStorage() {
+            if (threadStorage == NULL) {
+                InstrumentationThreadStorage *its = new InstrumentationThreadStorage();
+
+                Lock l(m_metricsMutex);
+                its->m_enabled = Instrumentation::m_enabled;
+                m_listOfThreadStorages.push_back(its);
+                threadStorage = its;
+#ifndef WIN32
+                pthread_setspecific(threadStorageKey, its);
+#endif
+            }
+
+            return *threadStorage;
+        }
+
+        void Instrumentation::threadTerminated(void *its) {
+            if (Instrumentation::m_singleton != NULL) {
+                Instrumentation::m_singleton->removeThreadStorage(static_cast<InstrumentationThreadStorage*>(its));
+            }
+        }
+
+        void Instrumentation::removeThreadStorage(InstrumentationThreadStorage *its) {
+            Lock l(m_metricsMutex);
+
+            vector<InstrumentationThreadStorage*>::iterator it = find(m_listOfThreadStorages.begin(), m_listOfThreadStorages.end(), its);
+            if (it != m_listOfThreadStorages.end()) {
+                m_listOfThreadStorages.erase(it);
+
+                // Keep the data recorded by this thread for the next statistic.
+                m_listOfRetiredCounters.resize(m_listOfNames.size(), 0);
+                m_listOfRetiredHistograms.resize(m_listOfNames.size());
+                {
+                    Lock ll(its->m_mutex);
+                    collect(*its, m_listOfRetiredCounters, m_listOfRetiredHistograms, false);
+                }
+
+                OPENDAVINCI_CORE_DELETE_POINTER(its);
+            }
+        }
+
+        void Instrumentation::increment(const uint32_t &counter, const uint64_t &delta) {
+            InstrumentationThreadStorage &its = getThreadStorage();
+
+            Lock l(its.m_mutex);
+            if (!its.m_enabled) {
+                return;
+            }
+
+            if (counter >= its.m_listOfCounters.size()) {
+                its.m_listOfCounters.resize(counter + 1, 0);
+            }
+            its.m_listOfCounters[counter] += delta;
+        }
+
+        void Instrumentation::add(const uint32_t &histogram, const uint64_t &value) {
+            InstrumentationThreadStorage &its = getThreadStorage();
+
+            Lock l(its.m_mutex);
+            if (!its.m_enabled) {
+                return;
+            }
+
+            if (histogram >= its.m_listOfHistograms.size()) {
+                its.m_listOfHistograms.resize(histogram + 1, NULL);
+            }
+            if (its.m_listOfHistograms[histogram] == NULL) {
+                its.m_listOfHistograms[histogram] = new Histogram();
+            }
+            its.m_listOfHistograms[histogram]->add(value);
+        }
+
+        void Instrumentation::collect(InstrumentationThreadStorage &its, vector<uint64_t> &counters, vector<Histogram> &histograms, const bool &reset) {
+            for (uint32_t i = 0; i < its.m_listOfCounters.size(); i++) {
+                counters[i] += its.m_listOfCounters[i];
+                if (reset) {
+                    its.m_listOfCounters[i] = 0;
+                }
+            }
+            for (uint32_t i = 0; i < its.m_listOfHistograms.size(); i++) {
+                if (its.m_listOfHistograms[i] != NULL) {
+                    histograms[i].merge(*(its.m_listOfHistograms[i]));
+                    if (reset) {
+                        its.m_listOfHistograms[i]->reset();
+                    }
+                }
+            }
+        }
+
+        InstrumentationStatistic Instrumentation::getInstrumentationStatistic(const bool &reset) {
+            Lock l(m_metricsMutex);
+
+            const uint32_t numberOfMetrics = m_listOfNames.size();
+            vector<uint64_t> counters(m_listOfRetiredCounters);
+            vector<Histogram> histograms(m_listOfRetiredHistograms);
+            counters.resize(numberOfMetrics, 0);
+            histograms.resize(numberOfMetrics);
+
+            if (reset) {
+                m_listOfRetiredCounters.clear();
+                m_listOfRetiredHistograms.clear();
+            }
+
+            // Merge the data from all running threads.
+            vector<InstrumentationThreadStorage*>::iterator it = m_listOfThreadStorages.begin();
+            while (it != m_listOfThreadStorages.end()) {
+                InstrumentationThreadStorage *its = (*it++);
+
+                Lock ll(its->m_mutex);
+                collect(*its, counters, histograms, reset);
+            }
+
+            // Only metrics having data in this interval are reported.
+            InstrumentationStatistic is;
+            for (uint32_t i = 0; i < numberOfMetrics; i++) {
+                if ( (m_listOfTypes[i] == InstrumentationMetric::COUNTER) && (counters[i] > 0) ) {
+                    is.addMetric(InstrumentationMetric(m_listOfNames[i], counters[i]));
+                }
+                else if ( (m_listOfTypes[i] == InstrumentationMetric::HISTOGRAM) && (histograms[i].getCount() > 0) ) {
+                    is.addMetric(InstrumentationMetric(m_listOfNames[i], histograms[i]));
+                }
+            }
+
+            return is;
+        }
+
+    }
+} // core::base
@@ -17,11 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include "core/base/Instrumentation.h"
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
 #include "core/data/RuntimeStatistic.h"
 #include "core/data/TimeStamp.h"
 #include "core/exceptions/Exceptions.h"
+#include "core/wrapper/TimeFactory.h"
 
 #include "core/base/ManagedClientModule.h"
 
@@ -42,8 +44,13 @@ namespace core {
             m_startOfCurrentCycle(),
             m_startOfLastCycle(),
             m_lastCycle(),
+            m_lastCycleMonotonic(core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds()),
             m_lastWaitTime(0),
             m_cycleCounter(0),
+            m_periodicScheduler(),
+            m_runtimeStatistic(),
+            m_timeConsumptionHistogram(Instrumentation::getInstance().getHistogram("ManagedClientModule.timeConsumption")),
+            m_overrunsCounter(Instrumentation::getInstance().getCounter("ManagedClientModule.overruns")),
             m_profilingFile(NULL),
             m_firstCallToBreakpoint_ManagedLevel_Pulse(true),
             m_time(),
@@ -200,8 +207,7 @@ namespace core {
                     waitingTimeCurrent << ";" <<
                     (100.0-(waitingTimeCurrent*100.0/((float)nominalDuration))) << ";" <<
                     (waitingTimeCurrent*100.0/((float)nominalDuration)) << ";" <<
-                    cycleCounter << endl;
-                m_profilingFile->flush();
+                    cycleCounter << "\n"; // Not flushed per cycle to avoid a write per cycle; flushed when closing.
             }
         }
 
@@ -213,6 +219,9 @@ namespace core {
             ModuleState::MODULE_EXITCODE retVal = ModuleState::OKAY;
 
             try {
+                // Configure realtime scheduling for this module if requested.
+                configureRealtimeScheduling();
+
                 // Setup the module itself.
                 setUp();
 
@@ -257,13 +266,20 @@ namespace core {
             m_startOfCurrentCycle = current;
             m_startOfLastCycle = m_lastCycle;
 
+            // Durations are measured with the monotonic clock to be robust against NTP corrections.
+            const int64_t currentMonotonic = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+
             const float FREQ = getFrequency();
-            const long TIME_CONSUMPTION_OF_CURRENT_SLICE = (current.toMicroseconds() - m_lastCycle.toMicroseconds()) - m_lastWaitTime;
+            const long TIME_CONSUMPTION_OF_CURRENT_SLICE = static_cast<long>((currentMonotonic - m_lastCycleMonotonic) / 1000) - m_lastWaitTime;
 
             const long ONE_SECOND_IN_MICROSECONDS = 1000 * 1000 * 1;
             const long NOMINAL_DURATION_OF_ONE_SLICE = static_cast<long>((1.0f/FREQ) * ONE_SECOND_IN_MICROSECONDS);
             const long WAITING_TIME_OF_CURRENT_SLICE = NOMINAL_DURATION_OF_ONE_SLICE - TIME_CONSUMPTION_OF_CURRENT_SLICE;
 
+            if (Instrumentation::isEnabled()) {
+                Instrumentation::getInstance().add(m_timeConsumptionHistogram, (TIME_CONSUMPTION_OF_CURRENT_SLICE > 0) ? static_cast<uint64_t>(TIME_CONSUMPTION_OF_CURRENT_SLICE) * 1000 : 0);
+            }
+
             // Inform supercomponent about statistical runtime data.
             bool sendStatistics = false;
             if (FREQ < 1) {
@@ -282,9 +298,19 @@ namespace core {
 
             // Send RuntimeStatistic to supercomponent.
             if (sendStatistics && getDMCPClient().isValid()) {
-                RuntimeStatistic rts;
-                rts.setSliceConsumption((float)TIME_CONSUMPTION_OF_CURRENT_SLICE/(float)NOMINAL_DURATION_OF_ONE_SLICE);
-                getDMCPClient()->sendStatistics(rts);
+                m_runtimeStatistic.setSliceConsumption((float)TIME_CONSUMPTION_OF_CURRENT_SLICE/(float)NOMINAL_DURATION_OF_ONE_SLICE);
+                getDMCPClient()->sendStatistics(m_runtimeStatistic);
+
+                // Jitter and overruns are reported per interval.
+                m_runtimeStatistic = RuntimeStatistic();
+
+                // Send all counters and histograms recorded within this interval.
+                if (Instrumentation::isEnabled()) {
+                    const InstrumentationStatistic is = Instrumentation::getInstance().getInstrumentationStatistic(true);
+                    if (!is.isEmpty()) {
+                        getDMCPClient()->sendInstrumentationStatistic(is);
+                    }
+                }
             }
 
             // Check whether we need to save profiling data.
@@ -294,6 +320,7 @@ namespace core {
 
             // Store "now" to m_lastCycle for usage in next cycle.
             m_lastCycle = current;
+            m_lastCycleMonotonic = currentMonotonic;
 
             // Save the time to be waited.
             if (WAITING_TIME_OF_CURRENT_SLICE > 0) {
@@ -307,19 +334,70 @@ namespace core {
         }
 
         void ManagedClientModule::wait_ManagedLevel_None() {
-            const long WAITING_TIME_OF_CURRENT_SLICE = getWaitingTimeAndUpdateRuntimeStatistics();
+            getWaitingTimeAndUpdateRuntimeStatistics();
 
-            // Enforce waiting to consume the rest of the time slice but ensure that there is no overflow.
-            const long ONE_SECOND_IN_MICROSECONDS = 1000 * 1000 * 1;
-            if ( (WAITING_TIME_OF_CURRENT_SLICE > 0) && (WAITING_TIME_OF_CURRENT_SLICE < ONE_SECOND_IN_MICROSECONDS) ) {
-                Thread::usleep(WAITING_TIME_OF_CURRENT_SLICE);
+            // Consume the rest of the time slice by waiting for the next absolute
+            // deadline; thus, oversleeping does not accumulate into drift.
+            const double ONE_SECOND_IN_NANOSECONDS = 1000.0 * 1000.0 * 1000.0;
+            m_periodicScheduler.setPeriod(static_cast<int64_t>((1.0 / getFrequency()) * ONE_SECOND_IN_NANOSECONDS));
+
+            int64_t latenessInNanoseconds = 0;
+            const int64_t beforeWaiting = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+            const uint32_t overruns = m_periodicScheduler.waitForNextPeriod(latenessInNanoseconds);
+            const int64_t afterWaiting = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+
+            if (overruns > 0) {
+                m_runtimeStatistic.setOverruns(m_runtimeStatistic.getOverruns() + overruns);
+                Instrumentation::getInstance().increment(m_overrunsCounter, overruns);
+            }
+            else {
+                m_runtimeStatistic.addJitter(static_cast<uint32_t>(latenessInNanoseconds / 1000));
             }
 
+            // Store the time actually waited for computing the slice consumption of the next cycle.
+            m_lastWaitTime = static_cast<long>((afterWaiting - beforeWaiting) / 1000);
+
             if (isVerbose()) {
                 clog << "Starting next cycle at " << TimeStamp().toString() << endl;
             }
         }
 
+        void ManagedClientModule::configureRealtimeScheduling() {
+            const KeyValueConfiguration kvc = getKeyValueConfiguration();
+
+            int32_t priority = 0;
+            try {
+                priority = kvc.getValue<int32_t>(getName() + ".realtime.priority");
+            }
+            catch(...) {}
+
+            int32_t cpu = -1;
+            try {
+                cpu = kvc.getValue<int32_t>(getName() + ".realtime.cpu");
+            }
+            catch(...) {}
+
+            if (priority > 0) {
+                try {
+                    core::wrapper::PeriodicScheduler::setRealtimePriority(priority);
+                    clog << "(ManagedClientModule) Using SCHED_FIFO with priority " << priority << "." << endl;
+                }
+                catch(string &s) {
+                    clog << "(ManagedClientModule) " << s << endl;
+                }
+            }
+
+            if (cpu > -1) {
+                try {
+                    core::wrapper::PeriodicScheduler::setCPUAffinity(cpu);
+                    clog << "(ManagedClientModule) Pinned to CPU " << cpu << "." << endl;
+                }
+                catch(string &s) {
+                    clog << "(ManagedClientModule) " << s << endl;
+                }
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Implementation for managed level pulse.
         ///////////////////////////////////////////////////////////////////////
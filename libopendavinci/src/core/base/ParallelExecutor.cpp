@@ -0,0 +1,108 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <vector>
+
+#include "core/macros.h"
+#include "core/base/Lock.h"
+#include "core/base/ParallelExecutor.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        ParallelExecutor::ParallelExecutor(const uint32_t &numberOfWorkers) :
+            m_numberOfWorkers((numberOfWorkers > 0) ? numberOfWorkers : 1),
+            m_taskMutex(),
+            m_task(NULL),
+            m_numberOfUnits(0),
+            m_nextUnit(0) {}
+
+        ParallelExecutor::~ParallelExecutor() {}
+
+        uint32_t ParallelExecutor::getNumberOfWorkers() const {
+            return m_numberOfWorkers;
+        }
+
+        void ParallelExecutor::execute(ParallelTask &task, const uint32_t &numberOfUnits) {
+            {
+                Lock l(m_taskMutex);
+                m_task = &task;
+                m_numberOfUnits = numberOfUnits;
+                m_nextUnit = 0;
+            }
+
+            const uint32_t NUMBER_OF_WORKERS = (numberOfUnits < m_numberOfWorkers) ? numberOfUnits : m_numberOfWorkers;
+            vector<Worker*> listOfWorkers;
+            for (uint32_t i = 0; i < NUMBER_OF_WORKERS; i++) {
+                Worker *w = new Worker(*this);
+                listOfWorkers.push_back(w);
+                w->start();
+            }
+
+            // Wait for all workers to finish.
+            vector<Worker*>::iterator it = listOfWorkers.begin();
+            while (it != listOfWorkers.end()) {
+                Worker *w = (*it++);
+                w->stop();
+                OPENDAVINCI_CORE_DELETE_POINTER(w);
+            }
+
+            {
+                Lock l(m_taskMutex);
+                m_task = NULL;
+                m_numberOfUnits = 0;
+            }
+        }
+
+        void ParallelExecutor::work() {
+            while (true) {
+                ParallelTask *task = NULL;
+                uint32_t index = 0;
+                {
+                    Lock l(m_taskMutex);
+                    if ( (m_task == NULL) || (m_nextUnit >= m_numberOfUnits) ) {
+                        break;
+                    }
+                    task = m_task;
+                    index = m_nextUnit++;
+                }
+
+                task->execute(index);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+
+        ParallelExecutor::Worker::Worker(ParallelExecutor &executor) :
+            m_executor(executor) {}
+
+        ParallelExecutor::Worker::~Worker() {}
+
+        void ParallelExecutor::Worker::beforeStop() {}
+
+        void ParallelExecutor::Worker::run() {
+            serviceReady();
+
+            m_executor.work();
+        }
+
+    }
+} // core::base
@@ -19,6 +19,7 @@
 
 #include "core/base/Hash.h"
 #include "core/base/Deserializer.h"
+#include "core/base/Instrumentation.h"
 #include "core/base/SerializationFactory.h"
 #include "core/base/Serializer.h"
 #include "core/data/Container.h"
@@ -29,6 +30,10 @@ namespace core {
         using namespace std;
         using namespace base;
 
+        // Families of histograms for the serialization and deserialization per data type.
+        static const char SERIALIZATION_HISTOGRAMS[] = "Container.serialize.";
+        static const char DESERIALIZATION_HISTOGRAMS[] = "Container.deserialize.";
+
         Container::Container() :
                 m_dataType(UNDEFINEDDATA),
                 m_serializedData(),
@@ -40,8 +45,12 @@ namespace core {
                 m_serializedData(),
                 m_sent(TimeStamp(0, 0)),
                 m_received(TimeStamp(0, 0)) {
+            const int64_t start = getSerializationStart();
+
             // Get data for container.
             m_serializedData << serializableData;
+
+            addSerializationDuration(true, start);
         }
 
         Container::Container(const Container &obj) :
@@ -64,6 +73,30 @@ namespace core {
 
         Container::~Container() {}
 
+        int64_t Container::getSerializationStart() {
+            return (Instrumentation::isEnabled() ? Instrumentation::getMonotonicNanoseconds() : 0);
+        }
+
+        void Container::addSerializationDuration(const bool &isSerialization, const int64_t &start) const {
+            if (start == 0) {
+                return;
+            }
+
+            const int64_t duration = Instrumentation::getMonotonicNanoseconds() - start;
+
+            Instrumentation &instr = Instrumentation::getInstance();
+            const char *family = (isSerialization ? SERIALIZATION_HISTOGRAMS : DESERIALIZATION_HISTOGRAMS);
+
+            uint32_t histogram = 0;
+            if (!instr.findHistogram(family, m_dataType, histogram)) {
+                stringstream name;
+                name << family << (toString().empty() ? "" : toString() + ".") << m_dataType;
+                histogram = instr.getHistogram(name.str(), family, m_dataType);
+            }
+
+            instr.add(histogram, (duration > 0) ? static_cast<uint64_t>(duration) : 0);
+        }
+
         Container::DATATYPE Container::getDataType() const {
             return m_dataType;
         }
@@ -171,6 +204,8 @@ namespace core {
                     return "SharedImage";
                 case POSITION:
                     return "Position";
+                case INSTRUMENTATIONSTATISTIC:
+                    return "InstrumentationStatistic";
                 case CONTOUREDOBJECT:
                     return "ContouredObject";
                 case CONTOUREDOBJECTS:
@@ -0,0 +1,234 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "core/base/Hash.h"
+#include "core/base/Deserializer.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
+#include "core/data/InstrumentationMetric.h"
+
+namespace core {
+    namespace data {
+
+        using namespace std;
+        using namespace base;
+
+        InstrumentationMetric::InstrumentationMetric() :
+                m_name(""),
+                m_type(COUNTER),
+                m_count(0),
+                m_minimum(0),
+                m_maximum(0),
+                m_mean(0),
+                m_percentile50(0),
+                m_percentile90(0),
+                m_percentile99(0),
+                m_percentile999(0) {}
+
+        InstrumentationMetric::InstrumentationMetric(const string &name, const uint64_t &value) :
+                m_name(name),
+                m_type(COUNTER),
+                m_count(static_cast<uint32_t>(value)),
+                m_minimum(0),
+                m_maximum(0),
+                m_mean(0),
+                m_percentile50(0),
+                m_percentile90(0),
+                m_percentile99(0),
+                m_percentile999(0) {}
+
+        InstrumentationMetric::InstrumentationMetric(const string &name, const Histogram &h) :
+                m_name(name),
+                m_type(HISTOGRAM),
+                m_count(static_cast<uint32_t>(h.getCount())),
+                m_minimum(static_cast<double>(h.getMinimum())),
+                m_maximum(static_cast<double>(h.getMaximum())),
+                m_mean(h.getMean()),
+                m_percentile50(static_cast<double>(h.getValueAtPercentile(50))),
+                m_percentile90(static_cast<double>(h.getValueAtPercentile(90))),
+                m_percentile99(static_cast<double>(h.getValueAtPercentile(99))),
+                m_percentile999(static_cast<double>(h.getValueAtPercentile(99.9))) {}
+
+        InstrumentationMetric::InstrumentationMetric(const InstrumentationMetric &obj) :
+                SerializableData(),
+                m_name(obj.m_name),
+                m_type(obj.m_type),
+                m_count(obj.m_count),
+                m_minimum(obj.m_minimum),
+                m_maximum(obj.m_maximum),
+                m_mean(obj.m_mean),
+                m_percentile50(obj.m_percentile50),
+                m_percentile90(obj.m_percentile90),
+                m_percentile99(obj.m_percentile99),
+                m_percentile999(obj.m_percentile999) {}
+
+        InstrumentationMetric::~InstrumentationMetric() {}
+
+        InstrumentationMetric& InstrumentationMetric::operator=(const InstrumentationMetric &obj) {
+            m_name = obj.m_name;
+            m_type = obj.m_type;
+            m_count = obj.m_count;
+            m_minimum = obj.m_minimum;
+            m_maximum = obj.m_maximum;
+            m_mean = obj.m_mean;
+            m_percentile50 = obj.m_percentile50;
+            m_percentile90 = obj.m_percentile90;
+            m_percentile99 = obj.m_percentile99;
+            m_percentile999 = obj.m_percentile999;
+
+            return (*this);
+        }
+
+        const string InstrumentationMetric::getName() const {
+            return m_name;
+        }
+
+        InstrumentationMetric::METRICTYPE InstrumentationMetric::getType() const {
+            return m_type;
+        }
+
+        uint32_t InstrumentationMetric::getCount() const {
+            return m_count;
+        }
+
+        double InstrumentationMetric::getMinimum() const {
+            return m_minimum;
+        }
+
+        double InstrumentationMetric::getMaximum() const {
+            return m_maximum;
+        }
+
+        double InstrumentationMetric::getMean() const {
+            return m_mean;
+        }
+
+        double InstrumentationMetric::getPercentile50() const {
+            return m_percentile50;
+        }
+
+        double InstrumentationMetric::getPercentile90() const {
+            return m_percentile90;
+        }
+
+        double InstrumentationMetric::getPercentile99() const {
+            return m_percentile99;
+        }
+
+        double InstrumentationMetric::getPercentile999() const {
+            return m_percentile999;
+        }
+
+        const string InstrumentationMetric::toString() const {
+            stringstream s;
+            s << m_name << ": " << m_count;
+            if (m_type == HISTOGRAM) {
+                s << " values, min: " << m_minimum << ", mean: " << m_mean
+                  << ", p50: " << m_percentile50 << ", p90: " << m_percentile90
+                  << ", p99: " << m_percentile99 << ", p99.9: " << m_percentile999
+                  << ", max: " << m_maximum;
+            }
+            return s.str();
+        }
+
+        ostream& InstrumentationMetric::operator<<(ostream &out) const {
+            SerializationFactory sf;
+
+            Serializer &s = sf.getSerializer(out);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('n', 'a', 'm', 'e') >::RESULT,
+                    m_name);
+
+            const uint32_t type = m_type;
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('t', 'y', 'p', 'e') >::RESULT,
+                    type);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('c', 'o', 'u', 'n', 't') >::RESULT,
+                    m_count);
+
+            if (m_type == HISTOGRAM) {
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('m', 'i', 'n') >::RESULT,
+                        m_minimum);
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('m', 'a', 'x') >::RESULT,
+                        m_maximum);
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('m', 'e', 'a', 'n') >::RESULT,
+                        m_mean);
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', '5', '0') >::RESULT,
+                        m_percentile50);
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', '9', '0') >::RESULT,
+                        m_percentile90);
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', '9', '9') >::RESULT,
+                        m_percentile99);
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('p', '9', '9', '9') >::RESULT,
+                        m_percentile999);
+            }
+
+            return out;
+        }
+
+        istream& InstrumentationMetric::operator>>(istream &in) {
+            SerializationFactory sf;
+
+            Deserializer &d = sf.getDeserializer(in);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('n', 'a', 'm', 'e') >::RESULT,
+                   m_name);
+
+            uint32_t type = 0;
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('t', 'y', 'p', 'e') >::RESULT,
+                   type);
+            m_type = static_cast<METRICTYPE>(type);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('c', 'o', 'u', 'n', 't') >::RESULT,
+                   m_count);
+
+            if (m_type == HISTOGRAM) {
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('m', 'i', 'n') >::RESULT,
+                       m_minimum);
+
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('m', 'a', 'x') >::RESULT,
+                       m_maximum);
+
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('m', 'e', 'a', 'n') >::RESULT,
+                       m_mean);
+
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', '5', '0') >::RESULT,
+                       m_percentile50);
+
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', '9', '0') >::RESULT,
+                       m_percentile90);
+
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', '9', '9') >::RESULT,
+                       m_percentile99);
+
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('p', '9', '9', '9') >::RESULT,
+                       m_percentile999);
+            }
+
+            return in;
+        }
+
+    }
+} // core::data
@@ -0,0 +1,121 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "core/base/Hash.h"
+#include "core/base/Deserializer.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
+#include "core/data/InstrumentationStatistic.h"
+
+namespace core {
+    namespace data {
+
+        using namespace std;
+        using namespace base;
+
+        InstrumentationStatistic::InstrumentationStatistic() :
+                m_listOfMetrics() {}
+
+        InstrumentationStatistic::InstrumentationStatistic(const InstrumentationStatistic &obj) :
+                SerializableData(),
+                m_listOfMetrics(obj.m_listOfMetrics) {}
+
+        InstrumentationStatistic::~InstrumentationStatistic() {}
+
+        InstrumentationStatistic& InstrumentationStatistic::operator=(const InstrumentationStatistic &obj) {
+            m_listOfMetrics = obj.m_listOfMetrics;
+
+            return (*this);
+        }
+
+        const vector<InstrumentationMetric> InstrumentationStatistic::getListOfMetrics() const {
+            return m_listOfMetrics;
+        }
+
+        void InstrumentationStatistic::addMetric(const InstrumentationMetric &metric) {
+            m_listOfMetrics.push_back(metric);
+        }
+
+        bool InstrumentationStatistic::isEmpty() const {
+            return m_listOfMetrics.empty();
+        }
+
+        const string InstrumentationStatistic::toString() const {
+            stringstream s;
+            vector<InstrumentationMetric>::const_iterator it = m_listOfMetrics.begin();
+            while (it != m_listOfMetrics.end()) {
+                s << it->toString() << endl;
+                it++;
+            }
+            return s.str();
+        }
+
+        ostream& InstrumentationStatistic::operator<<(ostream &out) const {
+            SerializationFactory sf;
+
+            Serializer &s = sf.getSerializer(out);
+
+            const uint32_t size = m_listOfMetrics.size();
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'i', 'z', 'e') >::RESULT,
+                    size);
+
+            if (size > 0) {
+                stringstream dataStream;
+                vector<InstrumentationMetric>::const_iterator it = m_listOfMetrics.begin();
+                while (it != m_listOfMetrics.end()) {
+                    dataStream << (*it);
+                    it++;
+                }
+
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('d', 'a', 't', 'a') >::RESULT,
+                        dataStream.str());
+            }
+
+            return out;
+        }
+
+        istream& InstrumentationStatistic::operator>>(istream &in) {
+            SerializationFactory sf;
+
+            Deserializer &d = sf.getDeserializer(in);
+
+            m_listOfMetrics.clear();
+
+            uint32_t size = 0;
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'i', 'z', 'e') >::RESULT,
+                   size);
+
+            if (size > 0) {
+                string dataStr;
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('d', 'a', 't', 'a') >::RESULT,
+                       dataStr);
+
+                stringstream data(dataStr);
+                for (uint32_t i = 0; i < size; i++) {
+                    InstrumentationMetric metric;
+                    data >> metric;
+                    m_listOfMetrics.push_back(metric);
+                }
+            }
+
+            return in;
+        }
+
+    }
+} // core::data
@@ -30,16 +30,31 @@ namespace core {
         using namespace base;
 
         RuntimeStatistic::RuntimeStatistic() :
-                m_sliceConsumption(0) {}
+                m_sliceConsumption(0),
+                m_overruns(0),
+                m_maximumJitter(0),
+                m_jitterHistogram() {}
 
         RuntimeStatistic::RuntimeStatistic(const RuntimeStatistic &obj) :
                 SerializableData(),
-                m_sliceConsumption(obj.getSliceConsumption()) {}
+                m_sliceConsumption(obj.getSliceConsumption()),
+                m_overruns(obj.getOverruns()),
+                m_maximumJitter(obj.getMaximumJitter()),
+                m_jitterHistogram() {
+            for (uint32_t i = 0; i < NUMBER_OF_JITTER_BUCKETS; i++) {
+                m_jitterHistogram[i] = obj.getJitterCount(i);
+            }
+        }
 
         RuntimeStatistic::~RuntimeStatistic() {}
 
         RuntimeStatistic& RuntimeStatistic::operator=(const RuntimeStatistic &obj) {
             setSliceConsumption(obj.getSliceConsumption());
+            setOverruns(obj.getOverruns());
+            m_maximumJitter = obj.getMaximumJitter();
+            for (uint32_t i = 0; i < NUMBER_OF_JITTER_BUCKETS; i++) {
+                m_jitterHistogram[i] = obj.getJitterCount(i);
+            }
             return (*this);
         }
 
@@ -51,9 +66,54 @@ namespace core {
             m_sliceConsumption = sc;
         }
 
+        uint32_t RuntimeStatistic::getOverruns() const {
+            return m_overruns;
+        }
+
+        void RuntimeStatistic::setOverruns(const uint32_t &overruns) {
+            m_overruns = overruns;
+        }
+
+        uint32_t RuntimeStatistic::getJitterBucketUpperBound(const uint32_t &bucket) {
+            // Upper bounds in microseconds; the last bucket is unbounded.
+            static const uint32_t UPPER_BOUNDS[NUMBER_OF_JITTER_BUCKETS] = { 10, 50, 100, 500, 1000, 5000, 10000, 0 };
+
+            if (bucket < NUMBER_OF_JITTER_BUCKETS) {
+                return UPPER_BOUNDS[bucket];
+            }
+            return 0;
+        }
+
+        void RuntimeStatistic::addJitter(const uint32_t &jitterInMicroseconds) {
+            uint32_t bucket = 0;
+            while ( (bucket < (NUMBER_OF_JITTER_BUCKETS - 1)) &&
+                    (jitterInMicroseconds >= getJitterBucketUpperBound(bucket)) ) {
+                bucket++;
+            }
+            m_jitterHistogram[bucket]++;
+
+            if (jitterInMicroseconds > m_maximumJitter) {
+                m_maximumJitter = jitterInMicroseconds;
+            }
+        }
+
+        uint32_t RuntimeStatistic::getJitterCount(const uint32_t &bucket) const {
+            if (bucket < NUMBER_OF_JITTER_BUCKETS) {
+                return m_jitterHistogram[bucket];
+            }
+            return 0;
+        }
+
+        uint32_t RuntimeStatistic::getMaximumJitter() const {
+            return m_maximumJitter;
+        }
+
         const string RuntimeStatistic::toString() const {
             stringstream s;
             s << getSliceConsumption() << "%";
+            if ( (getOverruns() > 0) || (getMaximumJitter() > 0) ) {
+                s << ", overruns: " << getOverruns() << ", max. jitter: " << getMaximumJitter() << "us";
+            }
             return s.str();
         }
 
@@ -65,6 +125,20 @@ namespace core {
             s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('s', 'c') >::RESULT,
                     getSliceConsumption());
 
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('o', 'v', 'r') >::RESULT,
+                    getOverruns());
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('j', 'm', 'a', 'x') >::RESULT,
+                    getMaximumJitter());
+
+            // The histogram is encoded as a space separated list of counts.
+            stringstream histogram;
+            for (uint32_t i = 0; i < NUMBER_OF_JITTER_BUCKETS; i++) {
+                histogram << getJitterCount(i) << " ";
+            }
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('j', 'i', 't') >::RESULT,
+                    histogram.str());
+
             return out;
         }
 
@@ -76,6 +150,22 @@ namespace core {
             d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('s', 'c') >::RESULT,
                    m_sliceConsumption);
 
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('o', 'v', 'r') >::RESULT,
+                   m_overruns);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('j', 'm', 'a', 'x') >::RESULT,
+                   m_maximumJitter);
+
+            string histogram;
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('j', 'i', 't') >::RESULT,
+                   histogram);
+
+            stringstream histogramStream(histogram);
+            for (uint32_t i = 0; i < NUMBER_OF_JITTER_BUCKETS; i++) {
+                m_jitterHistogram[i] = 0;
+                histogramStream >> m_jitterHistogram[i];
+            }
+
             return in;
         }
 
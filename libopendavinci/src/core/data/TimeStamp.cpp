@@ -33,23 +33,23 @@ namespace core {
 
         TimeStamp::TimeStamp() :
                 m_seconds(0),
-                m_microseconds(0) {
-            wrapper::Time *time = wrapper::TimeFactory::getInstance().now();
-            if (time != NULL) {
-                m_seconds = time->getSeconds();
-                m_microseconds = time->getPartialMicroseconds();
-                delete time;
-                time = NULL;
-            }
+                m_microseconds(0),
+                m_nanoseconds(0) {
+            int32_t partialNanoseconds = 0;
+            wrapper::TimeFactory::getInstance().getRealtime(m_seconds, partialNanoseconds);
+            m_microseconds = partialNanoseconds / 1000;
+            m_nanoseconds = partialNanoseconds % 1000;
         }
 
         TimeStamp::TimeStamp(const int32_t &seconds, const int32_t &microSeconds) :
                 m_seconds(seconds),
-                m_microseconds(microSeconds) {}
+                m_microseconds(microSeconds),
+                m_nanoseconds(0) {}
 
         TimeStamp::TimeStamp(const string &ddmmyyyyhhmmss) :
             m_seconds(0),
-            m_microseconds(0) {
+            m_microseconds(0),
+            m_nanoseconds(0) {
             if (ddmmyyyyhhmmss.size() == 14) {
                 stringstream dataDD;
                 dataDD.str(ddmmyyyyhhmmss.substr(0, 2));
@@ -138,38 +138,45 @@ namespace core {
         TimeStamp::TimeStamp(const TimeStamp &obj) :
                 SerializableData(),
                 m_seconds(obj.m_seconds),
-                m_microseconds(obj.m_microseconds) {}
+                m_microseconds(obj.m_microseconds),
+                m_nanoseconds(obj.m_nanoseconds) {}
 
         TimeStamp::~TimeStamp() {}
 
         TimeStamp& TimeStamp::operator=(const TimeStamp &obj) {
             m_seconds = obj.m_seconds;
             m_microseconds = obj.m_microseconds;
+            m_nanoseconds = obj.m_nanoseconds;
             return (*this);
         }
 
-        TimeStamp TimeStamp::operator+(const TimeStamp & t) const {
-            int32_t sumSeconds = m_seconds + t.getSeconds();
-            int32_t sumMicroseconds = m_microseconds + t.getFractionalMicroseconds();
+        void TimeStamp::setNormalized(int32_t seconds, int64_t nanoseconds) {
+            const int64_t ONE_SECOND_IN_NANOSECONDS = 1000000000L;
 
-            while (sumMicroseconds > 1000000L) {
-                sumSeconds++;
-                sumMicroseconds -= 1000000L;
+            seconds += static_cast<int32_t>(nanoseconds / ONE_SECOND_IN_NANOSECONDS);
+            nanoseconds = nanoseconds % ONE_SECOND_IN_NANOSECONDS;
+            if (nanoseconds < 0) {
+                seconds--;
+                nanoseconds += ONE_SECOND_IN_NANOSECONDS;
             }
 
-            return TimeStamp(sumSeconds, sumMicroseconds);
+            m_seconds = seconds;
+            m_microseconds = static_cast<int32_t>(nanoseconds / 1000);
+            m_nanoseconds = static_cast<int32_t>(nanoseconds % 1000);
         }
 
-        TimeStamp TimeStamp::operator-(const TimeStamp & t) const {
-            int32_t deltaSeconds = m_seconds - t.getSeconds();
-            int32_t deltaMicroseconds = m_microseconds - t.getFractionalMicroseconds();
-
-            while (deltaMicroseconds < 0) {
-                deltaSeconds--;
-                deltaMicroseconds += 1000000L;
-            }
+        TimeStamp TimeStamp::operator+(const TimeStamp & t) const {
+            TimeStamp sum(*this);
+            sum.setNormalized(m_seconds + t.m_seconds,
+                              (static_cast<int64_t>(m_microseconds) + t.m_microseconds) * 1000L + m_nanoseconds + t.m_nanoseconds);
+            return sum;
+        }
 
-            return TimeStamp(deltaSeconds, deltaMicroseconds);
+        TimeStamp TimeStamp::operator-(const TimeStamp & t) const {
+            TimeStamp delta(*this);
+            delta.setNormalized(m_seconds - t.m_seconds,
+                                (static_cast<int64_t>(m_microseconds) - t.m_microseconds) * 1000L + m_nanoseconds - t.m_nanoseconds);
+            return delta;
         }
 
         bool TimeStamp::operator==(const TimeStamp& t) const {
@@ -204,10 +211,18 @@ namespace core {
             return getSeconds() * 1000000L + getFractionalMicroseconds();
         }
 
+        int64_t TimeStamp::toNanoseconds() const {
+            return (static_cast<int64_t>(m_seconds) * 1000000L + m_microseconds) * 1000L + m_nanoseconds;
+        }
+
         int32_t TimeStamp::getFractionalMicroseconds() const {
             return m_microseconds;
         }
 
+        int32_t TimeStamp::getFractionalNanoseconds() const {
+            return m_microseconds * 1000 + m_nanoseconds;
+        }
+
         int32_t TimeStamp::getSeconds() const {
             return m_seconds;
         }
@@ -424,6 +439,8 @@ namespace core {
             d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('m', 'i', 'c') >::RESULT,
                    m_microseconds);
 
+            m_nanoseconds = 0;
+
             return in;
         }
 
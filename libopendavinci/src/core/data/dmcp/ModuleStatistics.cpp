@@ -34,16 +34,19 @@ namespace core {
 
             ModuleStatistics::ModuleStatistics() :
                 SerializableData(),
-                m_moduleStatistics() {}
+                m_moduleStatistics(),
+                m_instrumentationStatistics() {}
 
             ModuleStatistics::ModuleStatistics(const ModuleStatistics &obj) :
 		SerializableData(),
-                m_moduleStatistics(obj.getRuntimeStatistic()) {}
+                m_moduleStatistics(obj.getRuntimeStatistic()),
+                m_instrumentationStatistics(obj.getInstrumentationStatistic()) {}
 
             ModuleStatistics::~ModuleStatistics() {}
 
             ModuleStatistics& ModuleStatistics::operator=(const ModuleStatistics &obj) {
                 m_moduleStatistics = obj.getRuntimeStatistic();
+                m_instrumentationStatistics = obj.getInstrumentationStatistic();
 
                 return (*this);
             }
@@ -56,6 +59,14 @@ namespace core {
                 m_moduleStatistics[md] = rts;
             }
 
+            map<ModuleDescriptor, core::data::InstrumentationStatistic, ModuleDescriptorComparator> ModuleStatistics::getInstrumentationStatistic() const {
+                return m_instrumentationStatistics;
+            }
+
+            void ModuleStatistics::setInstrumentationStatistic(const ModuleDescriptor &md, const core::data::InstrumentationStatistic &is) {
+                m_instrumentationStatistics[md] = is;
+            }
+
             const string ModuleStatistics::toString() const {
                 stringstream sstr;
                 sstr << m_moduleStatistics.size() << " statistical data.";
@@ -85,6 +96,23 @@ namespace core {
                             dataStream.str());
                 }
 
+                // Instrumentation statistics use separate keys to remain readable for older receivers.
+                const uint32_t instrumentationSize = m_instrumentationStatistics.size();
+                if (instrumentationSize > 0) {
+                    s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('i', 's', 'i', 'z', 'e') >::RESULT,
+                            instrumentationSize);
+
+                    stringstream instrumentationStream;
+                    map<ModuleDescriptor, core::data::InstrumentationStatistic, ModuleDescriptorComparator>::const_iterator jt = m_instrumentationStatistics.begin();
+                    while (jt != m_instrumentationStatistics.end()) {
+                        instrumentationStream << jt->first << jt->second;
+                        jt++;
+                    }
+
+                    s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('i', 'd', 'a', 't', 'a') >::RESULT,
+                            instrumentationStream.str());
+                }
+
                 return out;
             }
 
@@ -115,6 +143,27 @@ namespace core {
                     }
                 }
 
+                uint32_t instrumentationSize = 0;
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('i', 's', 'i', 'z', 'e') >::RESULT,
+                       instrumentationSize);
+
+                if (instrumentationSize > 0) {
+                    string instrumentationStr;
+
+                    d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('i', 'd', 'a', 't', 'a') >::RESULT,
+                           instrumentationStr);
+
+                    stringstream instrumentation(instrumentationStr);
+                    for (uint32_t i = 0; i < instrumentationSize; i++) {
+                        ModuleDescriptor md;
+                        InstrumentationStatistic is;
+
+                        instrumentation >> md >> is;
+
+                        setInstrumentationStatistic(md, is);
+                    }
+                }
+
                 return in;
             }
 
@@ -52,6 +52,7 @@ namespace core {
                 m_connection(serverInformation.getIP(), serverInformation.getPort()),
                 m_configurationMutex(),
                 m_configuration(),
+                m_configurationVersion(0),
                 m_configured(false),
                 m_configuredMutex(),
                 m_configurationRequestCondition(),
@@ -99,12 +100,24 @@ namespace core {
                 m_connection.send(container);
             }
 
+            void Client::sendInstrumentationStatistic(const InstrumentationStatistic& is)
+            {
+                Container container(Container::INSTRUMENTATIONSTATISTIC, is);
+                m_connection.send(container);
+            }
+
             KeyValueConfiguration Client::getConfiguration()
             {
                 Lock l(m_configurationMutex);
                 return m_configuration;
             }
 
+            uint32_t Client::getConfigurationVersion()
+            {
+                Lock l(m_configurationMutex);
+                return m_configurationVersion;
+            }
+
             void Client::setSupercomponentStateListener(SupercomponentStateListener* listener)
             {
                 Lock l(m_listenerMutex);
@@ -193,6 +206,7 @@ namespace core {
                     {
                         Lock ll(m_configurationMutex);
                         m_configuration = kvc;
+                        m_configurationVersion++;
                     }
 
                 } catch (...) {
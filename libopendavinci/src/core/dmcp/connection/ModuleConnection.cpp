@@ -53,7 +53,9 @@ namespace core {
                 m_connectionLost(false),
                 m_stateListener(),
                 m_stateListenerMutex(),
-                m_containersToBeTransferredToSupercomponent()
+                m_containersToBeTransferredToSupercomponent(),
+                m_pulseAckObserverMutex(),
+                m_pulseAckObserver(NULL)
             {
                 m_connection->setContainerListener(this);
                 m_connection->setErrorListener(this);
@@ -73,12 +75,21 @@ namespace core {
                 m_stateListener = listener;
             }
 
-            void ModuleConnection::waitForModuleDescription()
+            bool ModuleConnection::waitForModuleDescription(const uint32_t &timeout)
             {
                 Lock l(m_discriptorCondition);
                 if (!m_hasDescriptor) {
-                    m_discriptorCondition.waitOnSignal();
+                    m_discriptorCondition.waitOnSignalWithTimeout(timeout);
                 }
+                return m_hasDescriptor;
+            }
+
+            void ModuleConnection::sendConfiguration()
+            {
+                KeyValueConfiguration config = m_configurationProvider.getConfiguration(m_descriptor);
+
+                Container c(Container::CONFIGURATION, Configuration(config));
+                m_connection->send(c);
             }
 
             const ModuleDescriptor ModuleConnection::getModuleDescriptor() const
@@ -158,6 +169,93 @@ namespace core {
                 return m_containersToBeTransferredToSupercomponent;
             }
 
+            bool ModuleConnection::pulse_ack_nonblocking(const core::data::dmcp::PulseMessage &pm) {
+                bool connectionLost = true;
+                {
+                    Lock l(m_connectionLostMutex);
+                    connectionLost = m_connectionLost;
+                }
+
+                if (!connectionLost) {
+                    {
+                        Lock l(m_pulseAckCondition);
+                        m_hasReceivedPulseAck = false;
+                    }
+
+                    Container c(Container::DMCP_PULSE_MESSAGE, pm);
+                    m_connection->send(c);
+                }
+
+                return !connectionLost;
+            }
+
+            bool ModuleConnection::pulse_ack_containers_nonblocking(const core::data::dmcp::PulseMessage &pm) {
+                bool connectionLost = true;
+                {
+                    Lock l(m_connectionLostMutex);
+                    connectionLost = m_connectionLost;
+                }
+
+                {
+                    Lock l(m_pulseAckContainersCondition);
+
+                    // Assume that we don't receive any further containers.
+                    m_containersToBeTransferredToSupercomponent.clear();
+                    m_hasReceivedPulseAckContainers = false;
+                }
+
+                if (!connectionLost) {
+                    Container c(Container::DMCP_PULSE_MESSAGE, pm);
+                    m_connection->send(c);
+                }
+
+                return !connectionLost;
+            }
+
+            bool ModuleConnection::isPulseAckPending() {
+                {
+                    Lock l(m_connectionLostMutex);
+                    if (m_connectionLost) {
+                        return false;
+                    }
+                }
+
+                Lock l(m_pulseAckCondition);
+                return !m_hasReceivedPulseAck;
+            }
+
+            bool ModuleConnection::isPulseAckContainersPending() {
+                {
+                    Lock l(m_connectionLostMutex);
+                    if (m_connectionLost) {
+                        return false;
+                    }
+                }
+
+                Lock l(m_pulseAckContainersCondition);
+                return !m_hasReceivedPulseAckContainers;
+            }
+
+            vector<core::data::Container> ModuleConnection::getContainersFromPulseAck() {
+                Lock l(m_pulseAckContainersCondition);
+                return m_containersToBeTransferredToSupercomponent;
+            }
+
+            void ModuleConnection::setPulseAckObserver(core::base::Condition *observer) {
+                Lock l(m_pulseAckObserverMutex);
+                m_pulseAckObserver = observer;
+            }
+
+            void ModuleConnection::notifyPulseAckObserver() {
+                // The own conditions must not be locked here as the observer
+                // locks them while holding its condition (cf. isPulseAckPending).
+                Lock l(m_pulseAckObserverMutex);
+                if (m_pulseAckObserver != NULL) {
+                    Lock l2(*m_pulseAckObserver);
+                    m_pulseAckObserver->wakeAll();
+                }
+            }
+
             void ModuleConnection::nextContainer(Container &container)
             {
                 switch (container.getDataType()) {
@@ -170,10 +268,7 @@ namespace core {
                             m_discriptorCondition.wakeAll();
                         }
 
-                        KeyValueConfiguration config = m_configurationProvider.getConfiguration(m_descriptor);
-
-                        Container c(Container::CONFIGURATION, Configuration(config));
-                        m_connection->send(c);
+                        sendConfiguration();
                         break;
                     }
 
@@ -213,25 +308,44 @@ namespace core {
                         break;
                     }
 
+                    case Container::INSTRUMENTATIONSTATISTIC:
+                    {
+                        InstrumentationStatistic is = container.getData<InstrumentationStatistic>();
+
+                        Lock l(m_stateListenerMutex);
+                        if (m_stateListener) {
+                            m_stateListener->handleInstrumentationStatistic(m_descriptor, is);
+                        }
+
+                        break;
+                    }
+
                     case Container::DMCP_PULSE_ACK_MESSAGE:
                     {
-                        Lock l(m_pulseAckCondition);
-                        m_hasReceivedPulseAck = true;
-                        m_pulseAckCondition.wakeAll();
+                        {
+                            Lock l(m_pulseAckCondition);
+                            m_hasReceivedPulseAck = true;
+                            m_pulseAckCondition.wakeAll();
+                        }
+
+                        notifyPulseAckObserver();
 
                         break;
                     }
 
                     case Container::DMCP_PULSE_ACK_CONTAINERS_MESSAGE:
                     {
-                        Lock l(m_pulseAckContainersCondition);
-                        m_hasReceivedPulseAckContainers = true;
-
                         // Get containers to be transferred to supercomponent.
                         PulseAckContainersMessage pac = container.getData<PulseAckContainersMessage>();
-                        m_containersToBeTransferredToSupercomponent = pac.getListOfContainers();
 
-                        m_pulseAckContainersCondition.wakeAll();
+                        {
+                            Lock l(m_pulseAckContainersCondition);
+                            m_hasReceivedPulseAckContainers = true;
+                            m_containersToBeTransferredToSupercomponent = pac.getListOfContainers();
+                            m_pulseAckContainersCondition.wakeAll();
+                        }
+
+                        notifyPulseAckObserver();
 
                         break;
                     }
@@ -268,6 +382,8 @@ namespace core {
                     m_pulseAckContainersCondition.wakeAll();
                 }
 
+                notifyPulseAckObserver();
+
                 // Change module's state.
                 {
                     Lock l(m_stateListenerMutex);
@@ -31,17 +31,32 @@ namespace core {
         Mutex ContainerConferenceFactory::m_singletonMutex;
         ContainerConferenceFactory* ContainerConferenceFactory::m_singleton = NULL;
 
+        // ContainerConferenceFactory that is only valid for the current thread.
+        static OPENDAVINCI_THREAD_LOCAL ContainerConferenceFactory *threadSingleton = NULL;
+
         ContainerConferenceFactory::ContainerConferenceFactory() {}
 
         ContainerConferenceFactory::~ContainerConferenceFactory() {
-            setSingleton(NULL);
+            // Only reset the process-wide singleton if it is this instance.
+            Lock l(ContainerConferenceFactory::m_singletonMutex);
+            if (ContainerConferenceFactory::m_singleton == this) {
+                setSingleton(NULL);
+            }
         }
 
         void ContainerConferenceFactory::setSingleton(ContainerConferenceFactory *singleton) {
             ContainerConferenceFactory::m_singleton = singleton;
         }
 
+        void ContainerConferenceFactory::setSingletonForCurrentThread(ContainerConferenceFactory *singleton) {
+            threadSingleton = singleton;
+        }
+
         ContainerConferenceFactory& ContainerConferenceFactory::getInstance() {
+            if (threadSingleton != NULL) {
+                return *threadSingleton;
+            }
+
             {
                 Lock l(ContainerConferenceFactory::m_singletonMutex);
                 if (ContainerConferenceFactory::m_singleton == NULL) {
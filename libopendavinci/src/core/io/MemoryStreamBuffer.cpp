@@ -0,0 +1,103 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "core/io/MemoryStreamBuffer.h"
+
+namespace core {
+    namespace io {
+
+        using namespace std;
+
+        MemoryStreamBuffer::MemoryStreamBuffer() :
+            streambuf(),
+            m_buffer(NULL),
+            m_length(0),
+            m_stream(NULL) {}
+
+        MemoryStreamBuffer::MemoryStreamBuffer(const char *buffer, const uint32_t &length) :
+            streambuf(),
+            m_buffer(NULL),
+            m_length(0),
+            m_stream(NULL) {
+            setBuffer(buffer, length);
+        }
+
+        MemoryStreamBuffer::~MemoryStreamBuffer() {
+            if (m_stream != NULL) {
+                delete m_stream;
+            }
+            m_stream = NULL;
+        }
+
+        void MemoryStreamBuffer::setBuffer(const char *buffer, const uint32_t &length) {
+            m_buffer = buffer;
+            m_length = (buffer != NULL) ? length : 0;
+
+            if (m_length > 0) {
+                // The stream operates directly on the given buffer which is never written.
+                char *begin = const_cast<char*>(m_buffer);
+                setg(begin, begin, begin + m_length);
+            }
+            else {
+                setg(NULL, NULL, NULL);
+            }
+        }
+
+        const char* MemoryStreamBuffer::getBuffer() const {
+            return ( (m_length > 0) ? m_buffer : NULL);
+        }
+
+        uint32_t MemoryStreamBuffer::getLength() const {
+            return m_length;
+        }
+
+        istream* MemoryStreamBuffer::getInputStream() {
+            if (m_stream == NULL) {
+                m_stream = new istream(this);
+            }
+            return m_stream;
+        }
+
+        MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekoff(off_type off, ios_base::seekdir way, ios_base::openmode which) {
+            if ( (m_length == 0) || ((which & ios_base::in) == 0) ) {
+                return pos_type(off_type(-1));
+            }
+
+            off_type position = off;
+            if (way == ios_base::cur) {
+                position += gptr() - eback();
+            }
+            else if (way == ios_base::end) {
+                position += m_length;
+            }
+
+            if ( (position < 0) || (position > static_cast<off_type>(m_length)) ) {
+                return pos_type(off_type(-1));
+            }
+
+            setg(eback(), eback() + position, egptr());
+            return pos_type(position);
+        }
+
+        MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekpos(pos_type pos, ios_base::openmode which) {
+            return seekoff(off_type(pos), ios_base::beg, which);
+        }
+
+    }
+} // core::io
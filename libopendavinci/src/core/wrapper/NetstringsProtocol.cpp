@@ -47,75 +47,95 @@ namespace core {
 
         void NetstringsProtocol::send(const string& data) {
             if (data.length() > 0) {
-                stringstream netstring;
-
-                netstring << (int)data.length() << ":" << data << ",";
-
-                sendByStringSender(netstring.str());
+                // Encode the length in place instead of going through a
+                // stringstream to avoid an additional copy of the payload.
+                char length[12];
+                uint32_t lengthSize = 0;
+                uint32_t value = data.length();
+                do {
+                    length[sizeof(length) - 1 - lengthSize] = static_cast<char>('0' + (value % 10));
+                    value /= 10;
+                    lengthSize++;
+                } while (value > 0);
+
+                string netstring;
+                netstring.reserve(lengthSize + 1 + data.length() + 1);
+                netstring.append(length + sizeof(length) - lengthSize, lengthSize);
+                netstring.append(1, ':');
+                netstring.append(data);
+                netstring.append(1, ',');
+
+                sendByStringSender(netstring);
             }
         }
 
         void NetstringsProtocol::receivedPartialString(const string &s) {
-            m_partialData.write(s.c_str(), s.length());
+            m_partialData.append(s);
 
             decodeNetstring();
-
-            // After using str() to set the remaining string, the write pointer
-            // points to the beginning of the stream and further receivedString() calls
-            // would override existing data. So the write pointer has to point to the
-            // end of the stream.
-            m_partialData.seekp(0, ios_base::end);
         }
 
         void NetstringsProtocol::decodeNetstring(void) {
             // Netstrings have the following format:
             // ASCII Number representing the length of the payload + ':' + payload + ','
+            //
+            // All complete Netstrings are decoded in place by advancing a read
+            // position; the consumed bytes are removed only once at the end.
 
-            m_partialData.seekg(0, ios_base::beg);
+            const uint32_t MAX_LENGTH_DIGITS = 10;
+            const uint32_t size = m_partialData.length();
+            uint32_t position = 0;
+            bool corrupted = false;
 
             // Start decoding only if we have received enough data.
-            while(m_partialData.str().length() > 3) {
-                unsigned int lengthOld = m_partialData.str().length();
-                // On WIN32, the .str() returns a temporary object that is destroyed after the expression.
-                // The reference keeps its existence instead.
-                const string &m_partialDataString = m_partialData.str();
-                const char *receiveBuffer = m_partialDataString.c_str();
-                char *colonSign = NULL;
-                unsigned int lengthOfPayload = strtol(receiveBuffer, &colonSign, 10);
-                if (lengthOfPayload == 0) {
-                    // Remove empty Netstring: 0:, (size is 3).
-
-                    m_partialData.str(m_partialData.str().substr(3));
-                    continue; // Try to decode next Netstring if any.
+            while ( (size - position) >= 3) {
+                // Parse the length of the payload.
+                uint32_t colonSign = position;
+                uint64_t lengthOfPayload = 0;
+                while ( (colonSign < size) && (colonSign - position <= MAX_LENGTH_DIGITS) &&
+                        (m_partialData[colonSign] >= '0') && (m_partialData[colonSign] <= '9') ) {
+                    lengthOfPayload = lengthOfPayload * 10 + (m_partialData[colonSign] - '0');
+                    colonSign++;
                 }
 
-                if (lengthOfPayload > lengthOld) {
-                    // Incomplete Netstring received. Wait for more data.
+                if (colonSign == size) {
+                    // Length not yet completely received. Wait for more data.
                     break;
                 }
 
-                if (*colonSign == 0x3a) {
-                    // Found colon sign. Now, check if (receiveBuffer + 1 + lengthOfPayload) == ','.
-                    if ((colonSign[1 + lengthOfPayload]) == 0x2c) {
-                        // Successfully found a complete Netstring.
-                        string receivedPayload = m_partialData.str().substr((colonSign + 1) - receiveBuffer, lengthOfPayload);
+                if ( (colonSign == position) || (colonSign - position > MAX_LENGTH_DIGITS) || (m_partialData[colonSign] != ':') ) {
+                    corrupted = true;
+                    break;
+                }
 
-                        invokeStringListener(receivedPayload);
+                const uint64_t endOfNetstring = colonSign + 1 + lengthOfPayload;
+                if (endOfNetstring >= size) {
+                    // Incomplete Netstring received. Wait for more data.
+                    break;
+                }
 
-                        // Remove decoded Netstring: "<lengthOfPayload> : <payload> ,"
-                        int lengthOfNetstring = (colonSign + 1 + lengthOfPayload + 1) - receiveBuffer;
+                if (m_partialData[endOfNetstring] != ',') {
+                    corrupted = true;
+                    break;
+                }
 
-                        m_partialData.str(m_partialData.str().substr(lengthOfNetstring));
-                    }
+                if (lengthOfPayload > 0) {
+                    // Successfully found a complete Netstring.
+                    invokeStringListener(m_partialData.substr(colonSign + 1, lengthOfPayload));
                 }
 
-                if (lengthOld == m_partialData.str().length()) {
-                    // This should not happen, received data might be corrupted.
+                // Skip decoded Netstring: "<lengthOfPayload> : <payload> ,"
+                position = endOfNetstring + 1;
+            }
 
-                    // Reset buffer.
-                    m_partialData.str("");
-                }
-            }    
+            if (corrupted || (position == size)) {
+                // Either everything has been consumed or the received data
+                // is corrupted; in both cases, reset the buffer.
+                m_partialData.clear();
+            }
+            else if (position > 0) {
+                m_partialData.erase(0, position);
+            }
         }
 
         void NetstringsProtocol::invokeStringListener(const string& data) {
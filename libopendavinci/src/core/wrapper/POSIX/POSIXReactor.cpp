@@ -0,0 +1,272 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+
+#include <sys/epoll.h>
+
+#include "core/wrapper/ConcurrencyFactory.h"
+#include "core/wrapper/MutexFactory.h"
+#include "core/wrapper/POSIX/POSIXReactor.h"
+
+namespace core {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            // Initialization of the singleton instance.
+            Mutex* POSIXReactor::m_singletonMutex = MutexFactory::createMutex();
+            POSIXReactor* POSIXReactor::m_singleton = NULL;
+
+            POSIXReactor::POSIXReactor() :
+                m_thread(NULL),
+                m_epollFileDescriptor(-1),
+                m_wakeupPipe(),
+                m_reactorThread(),
+                m_hasReactorThread(false),
+                m_running(true),
+                m_dispatchMutex(NULL),
+                m_handlersMutex(NULL),
+                m_nextID(WAKEUP_ID + 1),
+                m_handlers() {
+                m_dispatchMutex = MutexFactory::createMutex();
+                if (m_dispatchMutex == NULL) {
+                    stringstream s;
+                    s << "Error while creating mutex at " << __FILE__ << ": " << __LINE__;
+                    throw s.str();
+                }
+
+                m_handlersMutex = MutexFactory::createMutex();
+                if (m_handlersMutex == NULL) {
+                    stringstream s;
+                    s << "Error while creating mutex at " << __FILE__ << ": " << __LINE__;
+                    throw s.str();
+                }
+
+                m_epollFileDescriptor = epoll_create(MAX_EVENTS);
+                if (m_epollFileDescriptor < 0) {
+                    stringstream s;
+                    s << "Error while creating epoll file descriptor at " << __FILE__ << ": " << __LINE__ << ": " << strerror(errno);
+                    throw s.str();
+                }
+
+                // The pipe is used to wake up the reactor's thread when the reactor is destroyed.
+                if (pipe(m_wakeupPipe) < 0) {
+                    stringstream s;
+                    s << "Error while creating pipe at " << __FILE__ << ": " << __LINE__ << ": " << strerror(errno);
+                    throw s.str();
+                }
+                fcntl(m_wakeupPipe[0], F_SETFL, fcntl(m_wakeupPipe[0], F_GETFL, 0) | O_NONBLOCK);
+
+                epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN;
+                event.data.u64 = WAKEUP_ID;
+                epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, m_wakeupPipe[0], &event);
+
+                m_thread = ConcurrencyFactory::createThread(*this);
+                if (m_thread == NULL) {
+                    stringstream s;
+                    s << "Error while creating thread at " << __FILE__ << ": " << __LINE__;
+                    throw s.str();
+                }
+
+                m_thread->start();
+            }
+
+            POSIXReactor::~POSIXReactor() {
+                m_handlersMutex->lock();
+                    m_running = false;
+                m_handlersMutex->unlock();
+
+                // Wake up the reactor's thread.
+                const char c = 0;
+                if (write(m_wakeupPipe[1], &c, 1) < 0) {
+                    clog << "(POSIXReactor) Error while waking up reactor: " << strerror(errno) << endl;
+                }
+
+                m_thread->stop();
+                delete m_thread;
+                m_thread = NULL;
+
+                close(m_wakeupPipe[0]);
+                close(m_wakeupPipe[1]);
+                close(m_epollFileDescriptor);
+
+                delete m_handlersMutex;
+                m_handlersMutex = NULL;
+
+                delete m_dispatchMutex;
+                m_dispatchMutex = NULL;
+
+                POSIXReactor::m_singleton = NULL;
+            }
+
+            POSIXReactor& POSIXReactor::getInstance() {
+                POSIXReactor::m_singletonMutex->lock();
+                {
+                    if (POSIXReactor::m_singleton == NULL) {
+                        POSIXReactor::m_singleton = new POSIXReactor();
+                    }
+                }
+                POSIXReactor::m_singletonMutex->unlock();
+
+                return *m_singleton;
+            }
+
+            uint64_t POSIXReactor::add(const int32_t &fileDescriptor, POSIXReactorHandler *handler) {
+                uint64_t id = 0;
+
+                m_handlersMutex->lock();
+                {
+                    id = m_nextID++;
+                    m_handlers[id] = handler;
+
+                    epoll_event event;
+                    memset(&event, 0, sizeof(event));
+                    event.events = EPOLLIN;
+                    event.data.u64 = id;
+
+                    if (epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event) < 0) {
+                        m_handlers.erase(id);
+                        m_handlersMutex->unlock();
+
+                        stringstream s;
+                        s << "Error while adding file descriptor to epoll at " << __FILE__ << ": " << __LINE__ << ": " << strerror(errno);
+                        throw s.str();
+                    }
+                }
+                m_handlersMutex->unlock();
+
+                return id;
+            }
+
+            void POSIXReactor::modify(const int32_t &fileDescriptor, const uint64_t &id, const bool &observeWritable) {
+                epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN;
+                if (observeWritable) {
+                    event.events |= EPOLLOUT;
+                }
+                event.data.u64 = id;
+
+                // epoll_ctl is thread-safe; a removed file descriptor is silently ignored.
+                epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_MOD, fileDescriptor, &event);
+            }
+
+            void POSIXReactor::remove(const int32_t &fileDescriptor, const uint64_t &id) {
+                // Wait for a running dispatching unless we are called from within a handler.
+                const bool lockDispatching = !isReactorThread();
+                if (lockDispatching) {
+                    m_dispatchMutex->lock();
+                }
+
+                m_handlersMutex->lock();
+                {
+                    if (m_handlers.erase(id) > 0) {
+                        // The event parameter is ignored but must not be NULL for kernels before 2.6.9.
+                        epoll_event event;
+                        memset(&event, 0, sizeof(event));
+                        epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, &event);
+                    }
+                }
+                m_handlersMutex->unlock();
+
+                if (lockDispatching) {
+                    m_dispatchMutex->unlock();
+                }
+            }
+
+            bool POSIXReactor::isReactorThread() {
+                bool retVal = false;
+                m_handlersMutex->lock();
+                {
+                    retVal = m_hasReactorThread && (pthread_equal(m_reactorThread, pthread_self()) != 0);
+                }
+                m_handlersMutex->unlock();
+                return retVal;
+            }
+
+            bool POSIXReactor::isRunning() {
+                bool retVal = false;
+                m_handlersMutex->lock();
+                {
+                    retVal = m_running;
+                }
+                m_handlersMutex->unlock();
+                return retVal;
+            }
+
+            void POSIXReactor::run() {
+                m_handlersMutex->lock();
+                {
+                    m_reactorThread = pthread_self();
+                    m_hasReactorThread = true;
+                }
+                m_handlersMutex->unlock();
+
+                epoll_event events[MAX_EVENTS];
+
+                while (isRunning()) {
+                    const int32_t numberOfEvents = epoll_wait(m_epollFileDescriptor, events, MAX_EVENTS, -1);
+
+                    if (numberOfEvents < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        clog << "(POSIXReactor) Error while waiting for events: " << strerror(errno) << endl;
+                        break;
+                    }
+
+                    m_dispatchMutex->lock();
+                    for (int32_t i = 0; i < numberOfEvents; i++) {
+                        const uint64_t id = events[i].data.u64;
+
+                        if (id == WAKEUP_ID) {
+                            char c;
+                            while (read(m_wakeupPipe[0], &c, 1) > 0) {}
+                            continue;
+                        }
+
+                        // Find the handler as it might have been removed by a previous handler in this batch.
+                        POSIXReactorHandler *handler = NULL;
+                        m_handlersMutex->lock();
+                        {
+                            map<uint64_t, POSIXReactorHandler*>::iterator it = m_handlers.find(id);
+                            if (it != m_handlers.end()) {
+                                handler = it->second;
+                            }
+                        }
+                        m_handlersMutex->unlock();
+
+                        if (handler != NULL) {
+                            handler->handleEvents( (events[i].events & EPOLLIN) != 0,
+                                                   (events[i].events & EPOLLOUT) != 0,
+                                                   (events[i].events & (EPOLLERR | EPOLLHUP)) != 0 );
+                        }
+                    }
+                    m_dispatchMutex->unlock();
+                }
+            }
+        }
+    }
+}
+
+#endif /* __linux__ */
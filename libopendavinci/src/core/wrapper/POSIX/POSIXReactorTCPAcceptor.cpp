@@ -0,0 +1,179 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+
+#include "core/wrapper/ConditionFactory.h"
+#include "core/wrapper/MutexFactory.h"
+#include "core/wrapper/POSIX/POSIXReactorTCPAcceptor.h"
+#include "core/wrapper/POSIX/POSIXReactorTCPConnection.h"
+
+namespace core {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            POSIXReactorTCPAcceptor::POSIXReactorTCPAcceptor(const uint32_t& port) :
+                    POSIXTCPAcceptor(port),
+                    m_registrationMutex(NULL),
+                    m_registered(false),
+                    m_reactorID(0),
+                    m_pendingConnectionsCondition(NULL),
+                    m_isDispatching(false),
+                    m_pendingConnections() {
+                m_registrationMutex = MutexFactory::createMutex();
+                if (m_registrationMutex == NULL) {
+                    throw std::string("[POSIXReactorTCPAcceptor] Error creating mutex");
+                }
+
+                m_pendingConnectionsCondition = ConditionFactory::createCondition();
+                if (m_pendingConnectionsCondition == NULL) {
+                    throw std::string("[POSIXReactorTCPAcceptor] Error creating condition");
+                }
+            }
+
+            POSIXReactorTCPAcceptor::~POSIXReactorTCPAcceptor() {
+                stop();
+
+                // Delete all connections that were not handed over to the listener.
+                while (!m_pendingConnections.empty()) {
+                    delete m_pendingConnections.front();
+                    m_pendingConnections.pop_front();
+                }
+
+                if (m_pendingConnectionsCondition != NULL) {
+                    delete m_pendingConnectionsCondition;
+                    m_pendingConnectionsCondition = NULL;
+                }
+
+                if (m_registrationMutex != NULL) {
+                    delete m_registrationMutex;
+                    m_registrationMutex = NULL;
+                }
+            }
+
+            void POSIXReactorTCPAcceptor::start() {
+                m_registrationMutex->lock();
+                {
+                    if (!m_registered) {
+                        fcntl(m_fileDescriptor, F_SETFL, fcntl(m_fileDescriptor, F_GETFL, 0) | O_NONBLOCK);
+
+                        m_pendingConnectionsCondition->lock();
+                        {
+                            m_isDispatching = true;
+                        }
+                        m_pendingConnectionsCondition->unlock();
+                        m_thread->start();
+
+                        m_reactorID = POSIXReactor::getInstance().add(m_fileDescriptor, this);
+                        m_registered = true;
+                    }
+                }
+                m_registrationMutex->unlock();
+            }
+
+            void POSIXReactorTCPAcceptor::stop() {
+                bool doRemove = false;
+                m_registrationMutex->lock();
+                {
+                    doRemove = m_registered;
+                    m_registered = false;
+                }
+                m_registrationMutex->unlock();
+
+                if (doRemove) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor, m_reactorID);
+
+                    // Like POSIXTCPAcceptor, a stopped acceptor does not accept any further connections.
+                    close(m_fileDescriptor);
+                    m_fileDescriptor = -1;
+
+                    // Wait for a listener that is currently handling a new connection.
+                    m_pendingConnectionsCondition->lock();
+                    {
+                        m_isDispatching = false;
+                        m_pendingConnectionsCondition->wakeAll();
+                    }
+                    m_pendingConnectionsCondition->unlock();
+                    m_thread->stop();
+                }
+            }
+
+            bool POSIXReactorTCPAcceptor::isRunning() {
+                bool retVal = false;
+                m_registrationMutex->lock();
+                {
+                    retVal = m_registered;
+                }
+                m_registrationMutex->unlock();
+                return retVal;
+            }
+
+            void POSIXReactorTCPAcceptor::handleEvents(const bool &isReadable, const bool &/*isWritable*/, const bool &/*hasError*/) {
+                if (isReadable) {
+                    sockaddr clientsock;
+                    socklen_t csize = sizeof(clientsock);
+
+                    // Accept all pending connections and hand them over to the dispatching thread.
+                    int32_t client = accept(m_fileDescriptor, &clientsock, &csize);
+                    while (client >= 0) {
+                        m_pendingConnectionsCondition->lock();
+                        {
+                            m_pendingConnections.push_back(new POSIXReactorTCPConnection(client));
+                            m_pendingConnectionsCondition->wakeAll();
+                        }
+                        m_pendingConnectionsCondition->unlock();
+
+                        csize = sizeof(clientsock);
+                        client = accept(m_fileDescriptor, &clientsock, &csize);
+                    }
+                }
+            }
+
+            void POSIXReactorTCPAcceptor::run() {
+                bool isDispatching = true;
+                while (isDispatching) {
+                    TCPConnection *connection = NULL;
+
+                    m_pendingConnectionsCondition->lock();
+                    {
+                        if (m_isDispatching && m_pendingConnections.empty()) {
+                            m_pendingConnectionsCondition->waitOnSignal();
+                        }
+
+                        isDispatching = m_isDispatching;
+                        if (isDispatching && !m_pendingConnections.empty()) {
+                            connection = m_pendingConnections.front();
+                            m_pendingConnections.pop_front();
+                        }
+                    }
+                    m_pendingConnectionsCondition->unlock();
+
+                    // The listener must be called without holding any lock as it might block.
+                    if (connection != NULL) {
+                        invokeAcceptorListener(connection);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif /* __linux__ */
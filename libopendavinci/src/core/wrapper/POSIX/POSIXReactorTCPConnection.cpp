@@ -0,0 +1,223 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+
+#include "core/wrapper/MutexFactory.h"
+#include "core/wrapper/POSIX/POSIXReactorTCPConnection.h"
+
+namespace core {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            POSIXReactorTCPConnection::POSIXReactorTCPConnection(const int32_t fileDescriptor) :
+                    POSIXTCPConnection(fileDescriptor),
+                    m_registrationMutex(),
+                    m_registered(false),
+                    m_reactorID(0),
+                    m_outputBuffer(),
+                    m_outputOffset(0),
+                    m_isWaitingForWritable(false) {
+                m_registrationMutex = auto_ptr<Mutex>(MutexFactory::createMutex());
+                if (m_registrationMutex.get() == NULL) {
+                    throw std::string("[POSIXReactorTCPConnection] Error creating mutex for registration");
+                }
+            }
+
+            POSIXReactorTCPConnection::POSIXReactorTCPConnection(const std::string& ip, const uint32_t &port) :
+                    POSIXTCPConnection(ip, port),
+                    m_registrationMutex(),
+                    m_registered(false),
+                    m_reactorID(0),
+                    m_outputBuffer(),
+                    m_outputOffset(0),
+                    m_isWaitingForWritable(false) {
+                m_registrationMutex = auto_ptr<Mutex>(MutexFactory::createMutex());
+                if (m_registrationMutex.get() == NULL) {
+                    throw std::string("[POSIXReactorTCPConnection] Error creating mutex for registration");
+                }
+            }
+
+            POSIXReactorTCPConnection::~POSIXReactorTCPConnection() {
+                stop();
+            }
+
+            void POSIXReactorTCPConnection::start() {
+                m_registrationMutex->lock();
+                {
+                    if (!m_registered) {
+                        // The reactor must never block on a single socket.
+                        fcntl(m_fileDescriptor, F_SETFL, fcntl(m_fileDescriptor, F_GETFL, 0) | O_NONBLOCK);
+
+                        m_reactorID = POSIXReactor::getInstance().add(m_fileDescriptor, this);
+                        m_registered = true;
+                    }
+                }
+                m_registrationMutex->unlock();
+
+                // Continue sending data that was buffered before this connection was started.
+                m_socketMutex->lock();
+                {
+                    if (m_isWaitingForWritable) {
+                        POSIXReactor::getInstance().modify(m_fileDescriptor, m_reactorID, true);
+                    }
+                }
+                m_socketMutex->unlock();
+            }
+
+            void POSIXReactorTCPConnection::stop() {
+                bool doRemove = false;
+                m_registrationMutex->lock();
+                {
+                    doRemove = m_registered;
+                    m_registered = false;
+                }
+                m_registrationMutex->unlock();
+
+                // Removing must not happen while holding any lock as it waits for the reactor's dispatching.
+                if (doRemove) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor, m_reactorID);
+                }
+            }
+
+            bool POSIXReactorTCPConnection::isRunning() {
+                bool retVal = false;
+                m_registrationMutex->lock();
+                {
+                    retVal = m_registered;
+                }
+                m_registrationMutex->unlock();
+                return retVal;
+            }
+
+            void POSIXReactorTCPConnection::handleEvents(const bool &isReadable, const bool &isWritable, const bool &hasError) {
+                if (isReadable) {
+                    // Read only once per event to not starve the other connections.
+                    int32_t numBytes = recv(m_fileDescriptor, m_buffer, BUFFER_SIZE, MSG_DONTWAIT);
+
+                    if (numBytes > 0) {
+                        // Process data in higher layers.
+                        receivedString(string(m_buffer, numBytes));
+                    }
+                    else if ( (numBytes == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) ) {
+                        // Handle error: numBytes == 0 if peer shut down, numBytes < 0 in any case of error.
+                        handleError();
+                        return;
+                    }
+                }
+
+                if (hasError && !isReadable) {
+                    handleError();
+                    return;
+                }
+
+                if (isWritable) {
+                    bool failed = false;
+                    m_socketMutex->lock();
+                    {
+                        failed = !flushOutputBuffer();
+                    }
+                    m_socketMutex->unlock();
+
+                    if (failed) {
+                        invokeConnectionListener();
+                    }
+                }
+            }
+
+            void POSIXReactorTCPConnection::handleError() {
+                stop();
+                invokeConnectionListener();
+            }
+
+            void POSIXReactorTCPConnection::sendImplementation(const std::string& data) {
+                bool failed = false;
+                bool exceeded = false;
+                m_socketMutex->lock();
+                {
+                    if ( (m_outputBuffer.length() - m_outputOffset + data.length()) > static_cast<uint32_t>(MAX_OUTPUT_BUFFER_SIZE) ) {
+                        // The peer does not consume its data; dropping only parts would corrupt the stream.
+                        m_outputBuffer.clear();
+                        m_outputOffset = 0;
+                        exceeded = true;
+                    }
+                    else {
+                        // Keep the order of the data: Append to pending data or try to send immediately.
+                        m_outputBuffer.append(data);
+                        if (m_outputBuffer.length() - m_outputOffset == data.length()) {
+                            failed = !flushOutputBuffer();
+                        }
+                    }
+                }
+                m_socketMutex->unlock();
+
+                if (exceeded) {
+                    // The reactor detects the closed socket and informs the connection listener from its thread.
+                    clog << "(POSIXReactorTCPConnection) Disconnecting peer: More than " << MAX_OUTPUT_BUFFER_SIZE << " bytes pending." << endl;
+                    ::shutdown(m_fileDescriptor, SHUT_RDWR);
+                }
+                else if (failed) {
+                    // Handle error.
+                    invokeConnectionListener();
+                }
+            }
+
+            bool POSIXReactorTCPConnection::flushOutputBuffer() {
+                while (m_outputOffset < m_outputBuffer.length()) {
+                    int32_t numBytes = ::send(m_fileDescriptor, m_outputBuffer.c_str() + m_outputOffset, m_outputBuffer.length() - m_outputOffset, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+                    if (numBytes > 0) {
+                        m_outputOffset += numBytes;
+                    }
+                    else if ( (numBytes < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ) {
+                        // Socket's buffer is full; continue as soon as the socket is writable again.
+                        if (!m_isWaitingForWritable) {
+                            POSIXReactor::getInstance().modify(m_fileDescriptor, m_reactorID, true);
+                            m_isWaitingForWritable = true;
+                        }
+                        return true;
+                    }
+                    else if ( (numBytes < 0) && (errno == EINTR) ) {
+                        continue;
+                    }
+                    else {
+                        m_outputBuffer.clear();
+                        m_outputOffset = 0;
+                        return false;
+                    }
+                }
+
+                // Everything was sent.
+                m_outputBuffer.clear();
+                m_outputOffset = 0;
+
+                if (m_isWaitingForWritable) {
+                    POSIXReactor::getInstance().modify(m_fileDescriptor, m_reactorID, false);
+                    m_isWaitingForWritable = false;
+                }
+
+                return true;
+            }
+        }
+    }
+}
+
+#endif /* __linux__ */
@@ -25,11 +25,8 @@ namespace core {
 
             POSIXTime::POSIXTime() :
                     m_seconds(0),
-                    m_partialMicroseconds(0) {
-                struct timeval t;
-                gettimeofday(&t, NULL);
-                m_seconds = t.tv_sec;
-                m_partialMicroseconds = t.tv_usec;
+                    m_partialNanoseconds(0) {
+                getRealtime(m_seconds, m_partialNanoseconds);
             }
 
             POSIXTime::~POSIXTime() {}
@@ -39,7 +36,40 @@ namespace core {
             }
 
             int32_t POSIXTime::getPartialMicroseconds() const {
-                return m_partialMicroseconds;
+                return m_partialNanoseconds / 1000;
+            }
+
+            int32_t POSIXTime::getPartialNanoseconds() const {
+                return m_partialNanoseconds;
+            }
+
+            void POSIXTime::getRealtime(int32_t &seconds, int32_t &partialNanoseconds) {
+#ifdef HAVE_LINUX_RT
+                // clock_gettime is served by the vDSO on Linux and does not enter the kernel.
+                struct timespec t;
+                clock_gettime(CLOCK_REALTIME, &t);
+                seconds = t.tv_sec;
+                partialNanoseconds = t.tv_nsec;
+#else
+                struct timeval t;
+                gettimeofday(&t, NULL);
+                seconds = t.tv_sec;
+                partialNanoseconds = t.tv_usec * 1000;
+#endif
+            }
+
+            int64_t POSIXTime::getMonotonicNanoseconds() {
+#ifdef HAVE_LINUX_RT
+                // CLOCK_MONOTONIC is never stepped by NTP and, contrary to
+                // CLOCK_MONOTONIC_RAW, is served by the vDSO on all kernels.
+                struct timespec t;
+                clock_gettime(CLOCK_MONOTONIC, &t);
+                return static_cast<int64_t>(t.tv_sec) * 1000000000L + t.tv_nsec;
+#else
+                struct timeval t;
+                gettimeofday(&t, NULL);
+                return static_cast<int64_t>(t.tv_sec) * 1000000000L + t.tv_usec * 1000L;
+#endif
             }
 
         }
@@ -0,0 +1,139 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "core/wrapper/ConcurrencyFactory.h"
+#include "core/wrapper/PeriodicScheduler.h"
+#include "core/wrapper/TimeFactory.h"
+
+namespace core {
+    namespace wrapper {
+
+        using namespace std;
+
+        PeriodicScheduler::PeriodicScheduler() :
+            m_periodInNanoseconds(0),
+            m_nextDeadline(0) {}
+
+        PeriodicScheduler::~PeriodicScheduler() {}
+
+        void PeriodicScheduler::setPeriod(const int64_t &periodInNanoseconds) {
+            if (periodInNanoseconds != m_periodInNanoseconds) {
+                m_periodInNanoseconds = periodInNanoseconds;
+
+                // Restart the schedule.
+                m_nextDeadline = 0;
+            }
+        }
+
+        int64_t PeriodicScheduler::getPeriod() const {
+            return m_periodInNanoseconds;
+        }
+
+        uint32_t PeriodicScheduler::waitForNextPeriod(int64_t &latenessInNanoseconds) {
+            latenessInNanoseconds = 0;
+
+            if (m_periodInNanoseconds <= 0) {
+                return 0;
+            }
+
+            const int64_t current = now();
+            if (m_nextDeadline == 0) {
+                // First cycle: The schedule starts now.
+                m_nextDeadline = current + m_periodInNanoseconds;
+            }
+
+            if (current >= m_nextDeadline) {
+                // Overrun: Skip all missed deadlines and continue immediately
+                // while keeping the schedule aligned to its original start.
+                const uint32_t overruns = static_cast<uint32_t>((current - m_nextDeadline) / m_periodInNanoseconds) + 1;
+                m_nextDeadline += overruns * m_periodInNanoseconds;
+                return overruns;
+            }
+
+            sleepUntil(m_nextDeadline);
+
+            latenessInNanoseconds = now() - m_nextDeadline;
+            m_nextDeadline += m_periodInNanoseconds;
+
+            return 0;
+        }
+
+        int64_t PeriodicScheduler::now() const {
+#ifdef HAVE_LINUX_RT
+            struct timespec t;
+            ::clock_gettime(CLOCK_MONOTONIC, &t);
+            return static_cast<int64_t>(t.tv_sec) * 1000000000L + t.tv_nsec;
+#else
+            return TimeFactory::getInstance().getMonotonicNanoseconds();
+#endif
+        }
+
+        void PeriodicScheduler::sleepUntil(const int64_t &deadline) const {
+#ifdef HAVE_LINUX_RT
+            struct timespec t;
+            t.tv_sec = static_cast<time_t>(deadline / 1000000000L);
+            t.tv_nsec = static_cast<long>(deadline % 1000000000L);
+
+            // Restart the sleep if it is interrupted by a signal; the deadline is absolute.
+            while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL) == EINTR) {}
+#else
+            const int64_t remaining = deadline - now();
+            if (remaining > 0) {
+                ConcurrencyFactory::usleep(static_cast<long>(remaining / 1000));
+            }
+#endif
+        }
+
+        void PeriodicScheduler::setRealtimePriority(const int32_t &priority) {
+#ifdef HAVE_LINUX_RT
+            struct sched_param param;
+            param.sched_priority = priority;
+
+            if (::sched_setscheduler(0, SCHED_FIFO, &param) == -1) {
+                stringstream s;
+                s << "[PeriodicScheduler] Failed to configure SCHED_FIFO with priority " << priority << ": " << strerror(errno) << ". Are you superuser?";
+                throw s.str();
+            }
+#else
+            stringstream s;
+            s << "[PeriodicScheduler] Realtime priority " << priority << " is only available on Linux.";
+            throw s.str();
+#endif
+        }
+
+        void PeriodicScheduler::setCPUAffinity(const int32_t &cpu) {
+#ifdef HAVE_LINUX_RT
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(cpu, &cpuSet);
+
+            if (::sched_setaffinity(0, sizeof(cpu_set_t), &cpuSet) == -1) {
+                stringstream s;
+                s << "[PeriodicScheduler] Failed to pin thread to CPU " << cpu << ": " << strerror(errno);
+                throw s.str();
+            }
+#else
+            stringstream s;
+            s << "[PeriodicScheduler] CPU affinity " << cpu << " is only available on Linux.";
+            throw s.str();
+#endif
+        }
+
+    }
+} // core::wrapper
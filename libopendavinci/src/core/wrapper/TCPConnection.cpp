@@ -79,57 +79,52 @@ namespace core {
 
         void TCPConnection::send(const string& data) {
             const uint32_t dataSize = htonl(data.length());
-            stringstream dataStream;
-            dataStream.write(reinterpret_cast<const char*>(&dataSize), sizeof(uint32_t));
-            dataStream << data;
 
-            sendImplementation(dataStream.str());
+            string frame;
+            frame.reserve(sizeof(uint32_t) + data.length());
+            frame.append(reinterpret_cast<const char*>(&dataSize), sizeof(uint32_t));
+            frame.append(data);
+
+            sendImplementation(frame);
         }
 
         void TCPConnection::receivedString(const string &s)
         {
-            m_partialData.write(s.c_str(), s.length());
-
-            if ( hasCompleteData() ) {
-                m_partialData.seekg(0, ios_base::beg);
+            m_partialData.append(s);
 
+            // Deliver all complete messages by advancing a read position;
+            // the consumed bytes are removed only once at the end.
+            uint32_t position = 0;
+            while ( hasCompleteData(position) ) {
                 uint32_t dataSize = 0;
-                m_partialData.read(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t));
+                m_partialData.copy(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t), position);
                 dataSize = ntohl(dataSize);
-                const uint32_t bytesToIgnore = m_partialData.gcount();
-
-                // Split the stringstreams's string into to pieces. The first
-                // piece contains the data for the StringListener, the second
-                // piece will remain in the stringstream.
-                invokeStringListener(m_partialData.str().substr(bytesToIgnore, dataSize));
-                m_partialData.str(m_partialData.str().substr(bytesToIgnore+dataSize));
-
-                // After using str() to set the remaining string, the write pointer
-                // points to the beginning of the stream and further receivedString() calls
-                // would override existing data. So the write pointer as to point to the
-                // end of the stream.
-                m_partialData.seekp(0, ios_base::end);
+
+                invokeStringListener(m_partialData.substr(position + sizeof(uint32_t), dataSize));
+                position += sizeof(uint32_t) + dataSize;
+            }
+
+            if (position == m_partialData.length()) {
+                m_partialData.clear();
+            }
+            else if (position > 0) {
+                m_partialData.erase(0, position);
             }
         }
 
-        bool TCPConnection::hasCompleteData()
+        bool TCPConnection::hasCompleteData(const uint32_t &position)
         {
-            // Get size of stringstream
-            m_partialData.seekg(0, ios_base::end);
-            const uint32_t streamSize = m_partialData.tellg();
-            m_partialData.seekg(0, ios_base::beg);
+            const uint32_t available = m_partialData.length() - position;
+            if (available < sizeof(uint32_t)) {
+                return false;
+            }
 
             // Read size of transfered data
             uint32_t dataSize = 0;
-            m_partialData.read(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t));
+            m_partialData.copy(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t), position);
             dataSize = ntohl(dataSize);
-            const uint32_t bytesToIgnore = m_partialData.gcount();
-
-            if ( streamSize >= dataSize + bytesToIgnore) {
-                return true;
-            }
 
-            return false;
+            return ( (available - sizeof(uint32_t)) >= dataSize );
         }
     }
 }
@@ -31,11 +31,34 @@
     #include "core/wrapper/POSIX/POSIXTCPFactoryWorker.h"
 #endif
 
+#ifdef __linux__
+    #include "core/wrapper/POSIX/POSIXReactorTCPFactoryWorker.h"
+#endif
+
 namespace core {
     namespace wrapper {
 
+        // Transport used for all newly created acceptors and connections.
+        static TCPFactory::TRANSPORT s_transport = TCPFactory::THREAD_PER_CONNECTION;
+
+        void TCPFactory::setTransport(const TRANSPORT &transport)
+        {
+            s_transport = transport;
+        }
+
+        TCPFactory::TRANSPORT TCPFactory::getTransport()
+        {
+            return s_transport;
+        }
+
         TCPAcceptor* TCPFactory::createTCPAcceptor(const uint32_t &port)
         {
+#ifdef __linux__
+            if (s_transport == EVENT_LOOP) {
+                return POSIXReactorTCPFactoryWorker::createTCPAcceptor(port);
+            }
+#endif
+
             typedef ConfigurationTraits<NetworkLibraryProducts>::configuration configuration;
 
             return TCPFactoryWorker<configuration::value>::createTCPAcceptor(port);
@@ -43,6 +66,12 @@ namespace core {
 
         TCPConnection* TCPFactory::createTCPConnectionTo(const std::string& ip, const uint32_t& port)
         {
+#ifdef __linux__
+            if (s_transport == EVENT_LOOP) {
+                return POSIXReactorTCPFactoryWorker::createTCPConnectionTo(ip, port);
+            }
+#endif
+
             typedef ConfigurationTraits<NetworkLibraryProducts>::configuration configuration;
 
             return TCPFactoryWorker<configuration::value>::createTCPConnectionTo(ip, port);
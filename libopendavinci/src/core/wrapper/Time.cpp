@@ -24,5 +24,9 @@ namespace core {
 
         Time::~Time() {}
 
+        int32_t Time::getPartialNanoseconds() const {
+            return getPartialMicroseconds() * 1000;
+        }
+
     }
 } // core::wrapper
@@ -29,6 +29,9 @@ namespace core {
         Mutex* TimeFactory::m_singletonMutex = MutexFactory::createMutex();
 
         SystemTimeFactory::worker_type SystemTimeFactory::instance = SystemTimeFactory::worker_type();
+
+        // TimeFactory that is only valid for the current thread.
+        static OPENDAVINCI_THREAD_LOCAL TimeFactory *threadInstance = NULL;
         
         TimeFactory::TimeFactory() {
             if (TimeFactory::instance == NULL) {
@@ -37,6 +40,10 @@ namespace core {
         }
 
         TimeFactory& TimeFactory::getInstance() {
+            if (threadInstance != NULL) {
+                return *threadInstance;
+            }
+
         	TimeFactory::m_singletonMutex->lock();
             if (TimeFactory::instance == NULL) {
                 TimeFactory::instance = new TimeFactory();
@@ -53,7 +60,7 @@ namespace core {
         Time* TimeFactory::now() {
         	Time *t = NULL;
         	TimeFactory::m_singletonMutex->lock();
-            if (TimeFactory::controlledInstance == NULL) {
+            if ( (TimeFactory::controlledInstance == NULL) && (threadInstance == NULL) ) {
                 t = SystemTimeFactory::getInstance().now();
             }
             TimeFactory::m_singletonMutex->unlock();
@@ -65,11 +72,61 @@ namespace core {
             return t;
         }
 
+        void TimeFactory::getRealtime(int32_t &seconds, int32_t &partialNanoseconds) {
+            bool isControlled = false;
+        	TimeFactory::m_singletonMutex->lock();
+            if ( (TimeFactory::controlledInstance == NULL) && (threadInstance == NULL) ) {
+                SystemTimeFactory::getInstance().getRealtime(seconds, partialNanoseconds);
+            }
+            else {
+                isControlled = true;
+            }
+            TimeFactory::m_singletonMutex->unlock();
+
+            if (isControlled) {
+                seconds = 0;
+                partialNanoseconds = 0;
+
+                Time *t = TimeFactory::getInstance().now();
+                if (t != NULL) {
+                    seconds = t->getSeconds();
+                    partialNanoseconds = t->getPartialNanoseconds();
+                    delete t;
+                }
+            }
+        }
+
+        int64_t TimeFactory::getMonotonicNanoseconds() {
+            bool isControlled = false;
+            int64_t nanoseconds = 0;
+        	TimeFactory::m_singletonMutex->lock();
+            if ( (TimeFactory::controlledInstance == NULL) && (threadInstance == NULL) ) {
+                nanoseconds = SystemTimeFactory::getInstance().getMonotonicNanoseconds();
+            }
+            else {
+                isControlled = true;
+            }
+            TimeFactory::m_singletonMutex->unlock();
+
+            if (isControlled) {
+                // Durations follow the controlled time.
+                int32_t seconds = 0;
+                int32_t partialNanoseconds = 0;
+                getRealtime(seconds, partialNanoseconds);
+                nanoseconds = static_cast<int64_t>(seconds) * 1000000000L + partialNanoseconds;
+            }
+            return nanoseconds;
+        }
+
         void TimeFactory::setSingleton(TimeFactory *tf) {
         	TimeFactory::m_singletonMutex->lock();
             	TimeFactory::controlledInstance = tf;
             TimeFactory::m_singletonMutex->unlock();
         }  
 
+        void TimeFactory::setSingletonForCurrentThread(TimeFactory *tf) {
+            threadInstance = tf;
+        }
+
     }
 } // core::wrapper
@@ -28,31 +28,44 @@ namespace core {
 
             WIN32Time::WIN32Time() :
                 m_seconds(0),
-                m_partialMicroseconds(0) {
+                m_partialNanoseconds(0) {
+                getRealtime(m_seconds, m_partialNanoseconds);
+            }
+
+            WIN32Time::~WIN32Time() {}
+
+            int32_t WIN32Time::getSeconds() const {
+                return m_seconds;
+            }
+
+            int32_t WIN32Time::getPartialMicroseconds() const {
+                return m_partialNanoseconds / 1000;
+            }
+
+            int32_t WIN32Time::getPartialNanoseconds() const {
+                return m_partialNanoseconds;
+            }
+
+            void WIN32Time::getRealtime(int32_t &seconds, int32_t &partialNanoseconds) {
                 std::chrono::time_point<std::chrono::system_clock> t(std::chrono::system_clock::now());
                 auto duration = t.time_since_epoch();
 
                 typedef std::chrono::duration<int32_t> seconds_type;
-				typedef std::chrono::duration<int64_t, std::micro> microseconds_type;
+                typedef std::chrono::duration<int64_t, std::nano> nanoseconds_type;
 
                 seconds_type s = std::chrono::duration_cast<seconds_type>(duration);
-                microseconds_type us = std::chrono::duration_cast<microseconds_type>(duration);
-
-                microseconds_type partial_us = us - std::chrono::duration_cast<microseconds_type>(s); // The seconds are converted to microseconds and subtracted from the microseconds representation of duration. Thus, we end up with the same behavior as gettimeofday.
-
-                // The following calculations ensure identical behavior to the gettimeofday call.
-                m_seconds = s.count();
-                m_partialMicroseconds = partial_us.count();
-            }
+                nanoseconds_type ns = std::chrono::duration_cast<nanoseconds_type>(duration);
 
-            WIN32Time::~WIN32Time() {}
+                nanoseconds_type partial_ns = ns - std::chrono::duration_cast<nanoseconds_type>(s); // The seconds are converted to nanoseconds and subtracted from the nanoseconds representation of duration. Thus, we end up with the same behavior as clock_gettime.
 
-            int32_t WIN32Time::getSeconds() const {
-                return m_seconds;
+                seconds = s.count();
+                partialNanoseconds = static_cast<int32_t>(partial_ns.count());
             }
 
-            int32_t WIN32Time::getPartialMicroseconds() const {
-                return m_partialMicroseconds;
+            int64_t WIN32Time::getMonotonicNanoseconds() {
+                // steady_clock is based on QueryPerformanceCounter.
+                typedef std::chrono::duration<int64_t, std::nano> nanoseconds_type;
+                return std::chrono::duration_cast<nanoseconds_type>(std::chrono::steady_clock::now().time_since_epoch()).count();
             }
 
         }
@@ -17,8 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include <zip.h>
-
+#include "core/base/Lock.h"
 #include "core/wrapper/Zip/ZipDecompressedData.h"
 
 namespace core {
@@ -27,127 +26,152 @@ namespace core {
 
             using namespace std;
 
-            ZipDecompressedData::ZipDecompressedData(istream &in)
-                    : m_mapOfDecompressedEntries() {
+            // Signatures and sizes of the ZIP records (cf. PKWARE APPNOTE).
+            static const uint32_t LOCAL_FILE_HEADER_SIGNATURE = 0x04034b50;
+            static const uint32_t LOCAL_FILE_HEADER_SIZE = 30;
+            static const uint32_t CENTRAL_DIRECTORY_SIGNATURE = 0x02014b50;
+            static const uint32_t CENTRAL_DIRECTORY_HEADER_SIZE = 46;
+            static const uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+            static const uint32_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+            static const uint32_t MAX_COMMENT_SIZE = 65535;
+
+            ZipDecompressedData::ZipDecompressedData(istream &in) :
+                m_archive(),
+                m_entriesMutex(),
+                m_mapOfEntries() {
                 decompressData(in);
             }
 
             ZipDecompressedData::~ZipDecompressedData() {
                 // Clean up.
-                map<string, stringstream*, StringComparator>::iterator it = m_mapOfDecompressedEntries.begin();
-                while (it != m_mapOfDecompressedEntries.end()) {
-                    stringstream *data = it->second;
-                    if (data != NULL) {
-                        delete data;
+                map<string, ZipEntry*, StringComparator>::iterator it = m_mapOfEntries.begin();
+                while (it != m_mapOfEntries.end()) {
+                    ZipEntry *entry = it->second;
+                    if (entry != NULL) {
+                        delete entry;
                     }
-                    data = NULL;
+                    entry = NULL;
 
                     // Iterate.
                     it++;
                 }
-                m_mapOfDecompressedEntries.clear();
+                m_mapOfEntries.clear();
+            }
+
+            uint16_t ZipDecompressedData::getUInt16(const uint32_t &offset) const {
+                const unsigned char *p = reinterpret_cast<const unsigned char*>(&m_archive[offset]);
+                return static_cast<uint16_t>(p[0] | (p[1] << 8));
+            }
+
+            uint32_t ZipDecompressedData::getUInt32(const uint32_t &offset) const {
+                const unsigned char *p = reinterpret_cast<const unsigned char*>(&m_archive[offset]);
+                return (static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24));
             }
 
             void ZipDecompressedData::decompressData(istream &in) {
-                // TODO: libzip needs a file to read from. Therefore, we need to buffer the istream...
-                char *tempFileName;
-#ifdef WIN32
-                tempFileName = _tempnam("test", NULL);
-#else
-                tempFileName = strdup("tmpfileXXXXXX");
-                if (mkstemp(tempFileName) == -1) {
-                    cerr << "ZipDecompressedData: temporary file cannot be created" << endl;
+                // Read the complete archive into memory.
+                char *buffer = new char[ZipDecompressedData::BUFFER_SIZE];
+                while (in.good()) {
+                    in.read(buffer, ZipDecompressedData::BUFFER_SIZE);
+                    m_archive.insert(m_archive.end(), buffer, buffer + in.gcount());
                 }
-#endif
-                fstream fout(tempFileName, ios::binary | ios::out);
+                delete [] buffer;
+
+                const uint32_t SIZE = m_archive.size();
+                if (SIZE < END_OF_CENTRAL_DIRECTORY_SIZE) {
+                    return;
+                }
+
+                // Find the end of central directory record which is followed by an optional comment.
+                uint32_t endOfCentralDirectory = SIZE - END_OF_CENTRAL_DIRECTORY_SIZE;
+                const uint32_t LOWEST = (SIZE > (END_OF_CENTRAL_DIRECTORY_SIZE + MAX_COMMENT_SIZE)) ? (SIZE - END_OF_CENTRAL_DIRECTORY_SIZE - MAX_COMMENT_SIZE) : 0;
+                while ( (getUInt32(endOfCentralDirectory) != END_OF_CENTRAL_DIRECTORY_SIGNATURE) && (endOfCentralDirectory > LOWEST) ) {
+                    endOfCentralDirectory--;
+                }
+                if (getUInt32(endOfCentralDirectory) != END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+                    clog << "(core::wrapper::Zip::ZipDecompressedData) No ZIP archive found." << endl;
+                    return;
+                }
+
+                const uint16_t numberOfEntries = getUInt16(endOfCentralDirectory + 10);
+                uint32_t offset = getUInt32(endOfCentralDirectory + 16);
 
-                if (fout.good()) {
-                    char c = 0;
-                    while (in.get(c)) {
-                        fout << c;
+                // Read all entries from the central directory.
+                for (uint16_t i = 0; i < numberOfEntries; i++) {
+                    if ( (offset + CENTRAL_DIRECTORY_HEADER_SIZE > endOfCentralDirectory) || (getUInt32(offset) != CENTRAL_DIRECTORY_SIGNATURE) ) {
+                        clog << "(core::wrapper::Zip::ZipDecompressedData) Corrupt central directory." << endl;
+                        break;
                     }
-                    fout.flush();
-                    fout.close();
-
-                    // Do decompression.
-                    struct zip *zipArchive = NULL;
-
-                    // Open the ZIP archive.
-                    zipArchive = zip_open(tempFileName, 0, NULL);
-                    if (zipArchive != NULL) {
-
-                        // Get the number of compressed entries.
-                        int32_t numberOfEntries = zip_get_num_files(zipArchive);
-                        if (numberOfEntries > 0) {
-
-                            // Allocate memory for decompression.
-                            char *buffer = new char[ZipDecompressedData::BUFFER_SIZE];
-                            if (buffer != NULL) {
-
-                                // Start decompression.
-                                for (int32_t i = 0; i < numberOfEntries; i++) {
-
-                                    // Get i-th entry.
-                                    const char *nameOfEntry = zip_get_name(zipArchive, i, 0);
-                                    if (nameOfEntry != NULL) {
-                                        string name(nameOfEntry);
-
-                                        // Remove leading ./
-                                        if ( (name.length() > 2) && (name.at(0) == '.') && (name.at(1) == '/') ) {
-                                            name = string(nameOfEntry+2);
-                                        }
-
-                                        // Transform to lower case for case insensitive searches.
-                                        transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
-
-                                        // Get entry from zip file.
-                                        struct zip_file *entry = zip_fopen_index(zipArchive, i, ZIP_FL_NOCASE);
-                                        if (entry != NULL) {
-
-                                            // Create stream for storing content.
-                                            stringstream *stream = new stringstream();
-                                            if (stream != NULL) {
-
-                                                // Decompress data.
-                                                int32_t nbytes = 0;
-                                                while ( (nbytes = zip_fread(entry, buffer, ZipDecompressedData::BUFFER_SIZE)) > 0) {
-                                                    string s(buffer, nbytes);
-                                                    (*stream) << s;
-                                                }
-
-                                                // Store read content into map.
-                                                m_mapOfDecompressedEntries[name] = stream;
-                                            }
-
-                                            // Close entry.
-                                            zip_fclose(entry);
-                                        }
-                                    }
-                                }
-
-                                // De-allocate memory.
-                                delete [] buffer;
-                            }
-                        }
-
-                        // Close given archive.
-                        zip_close(zipArchive);
+
+                    const uint16_t compressionMethod = getUInt16(offset + 10);
+                    const uint32_t crc = getUInt32(offset + 16);
+                    const uint32_t compressedSize = getUInt32(offset + 20);
+                    const uint32_t uncompressedSize = getUInt32(offset + 24);
+                    const uint16_t lengthOfName = getUInt16(offset + 28);
+                    const uint16_t lengthOfExtraField = getUInt16(offset + 30);
+                    const uint16_t lengthOfComment = getUInt16(offset + 32);
+                    const uint32_t localHeaderOffset = getUInt32(offset + 42);
+
+                    if (offset + CENTRAL_DIRECTORY_HEADER_SIZE + lengthOfName > endOfCentralDirectory) {
+                        break;
+                    }
+
+                    string name(&m_archive[offset + CENTRAL_DIRECTORY_HEADER_SIZE], lengthOfName);
+
+                    // Remove leading ./
+                    if ( (name.length() > 2) && (name.at(0) == '.') && (name.at(1) == '/') ) {
+                        name = name.substr(2);
+                    }
+
+                    // Transform to lower case for case insensitive searches.
+                    transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
+
+                    map<string, ZipEntry*, StringComparator>::iterator it = m_mapOfEntries.find(name);
+                    if (it == m_mapOfEntries.end()) {
+                        m_mapOfEntries[name] = new ZipEntry(compressionMethod, crc, compressedSize, uncompressedSize, localHeaderOffset);
                     }
+
+                    offset += CENTRAL_DIRECTORY_HEADER_SIZE + lengthOfName + lengthOfExtraField + lengthOfComment;
                 }
+            }
 
-#ifdef WIN32
-                _unlink(tempFileName);
-#else
-                unlink(tempFileName);
-#endif
-                free(tempFileName);
+            ZipEntry* ZipDecompressedData::getDecompressedEntry(const string &entry) {
+                string key = entry;
+
+                // Transform key name to lower case for case insensitive lookups.
+                transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
+
+                // Try to find the key/value.
+                map<string, ZipEntry*, StringComparator>::const_iterator it = m_mapOfEntries.find(key);
+                if (it == m_mapOfEntries.end()) {
+                    return NULL;
+                }
+
+                ZipEntry *zipEntry = it->second;
+                if (!zipEntry->isDecompressed()) {
+                    // Skip the local header to find the compressed contents.
+                    const uint32_t offset = zipEntry->getLocalHeaderOffset();
+                    if ( (offset + LOCAL_FILE_HEADER_SIZE > m_archive.size()) || (getUInt32(offset) != LOCAL_FILE_HEADER_SIGNATURE) ) {
+                        clog << "(core::wrapper::Zip::ZipDecompressedData) Corrupt local header for " << key << "." << endl;
+                        return NULL;
+                    }
+
+                    const uint32_t begin = offset + LOCAL_FILE_HEADER_SIZE + getUInt16(offset + 26) + getUInt16(offset + 28);
+                    const uint32_t available = (begin < m_archive.size()) ? (m_archive.size() - begin) : 0;
+                    if (!zipEntry->decompress( (available > 0) ? &m_archive[begin] : NULL, available)) {
+                        clog << "(core::wrapper::Zip::ZipDecompressedData) Could not decompress " << key << "." << endl;
+                        return NULL;
+                    }
+                }
+
+                return zipEntry;
             }
 
             vector<string> ZipDecompressedData::getListOfEntries() {
                 vector<string> listOfEntries;
 
-                map<string, stringstream*, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.begin();
-                while (it != m_mapOfDecompressedEntries.end()) {
+                map<string, ZipEntry*, StringComparator>::const_iterator it = m_mapOfEntries.begin();
+                while (it != m_mapOfEntries.end()) {
                     listOfEntries.push_back(it->first);
                     it++;
                 }
@@ -158,18 +182,26 @@ namespace core {
             istream* ZipDecompressedData::getInputStreamFor(const string &entry) {
                 istream *stream = NULL;
 
-                string key = entry;
+                // Entries are decompressed lazily; thus, concurrent callers must not race.
+                core::base::Lock l(m_entriesMutex);
+                ZipEntry *zipEntry = getDecompressedEntry(entry);
+                if (zipEntry != NULL) {
+                    stream = zipEntry->getInputStream();
+                }
 
-                // Transform key name to lower case for case insensitive lookups.
-                transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
+                return stream;
+            }
 
-                // Try to find the key/value.
-                map<string, stringstream*, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.find(key);
-                if (it != m_mapOfDecompressedEntries.end()) {
-                    stream = it->second;
+            bool ZipDecompressedData::getBufferFor(const string &entry, const char* &buffer, uint32_t &length) {
+                core::base::Lock l(m_entriesMutex);
+                ZipEntry *zipEntry = getDecompressedEntry(entry);
+                if (zipEntry != NULL) {
+                    buffer = zipEntry->getBuffer();
+                    length = zipEntry->getUncompressedSize();
+                    return true;
                 }
 
-                return stream;
+                return false;
             }
 
         }
@@ -0,0 +1,122 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <zlib.h>
+
+#include "core/wrapper/Zip/ZipEntry.h"
+
+namespace core {
+    namespace wrapper {
+        namespace Zip {
+
+            using namespace std;
+
+            ZipEntry::ZipEntry(const uint16_t &compressionMethod, const uint32_t &crc,
+                               const uint32_t &compressedSize, const uint32_t &uncompressedSize,
+                               const uint32_t &localHeaderOffset) :
+                MemoryStreamBuffer(),
+                m_compressionMethod(compressionMethod),
+                m_crc(crc),
+                m_compressedSize(compressedSize),
+                m_uncompressedSize(uncompressedSize),
+                m_localHeaderOffset(localHeaderOffset),
+                m_decompressed(false),
+                m_data() {}
+
+            ZipEntry::~ZipEntry() {}
+
+            uint32_t ZipEntry::getLocalHeaderOffset() const {
+                return m_localHeaderOffset;
+            }
+
+            uint32_t ZipEntry::getUncompressedSize() const {
+                return m_uncompressedSize;
+            }
+
+            bool ZipEntry::isDecompressed() const {
+                return m_decompressed;
+            }
+
+            bool ZipEntry::decompress(const char *compressedData, const uint32_t &size) {
+                if (m_decompressed) {
+                    return true;
+                }
+
+                if ( (compressedData == NULL) || (size < m_compressedSize) ) {
+                    return false;
+                }
+
+                m_data.resize(m_uncompressedSize);
+
+                bool retVal = false;
+                if (m_compressionMethod == ZipEntry::STORED) {
+                    if (m_compressedSize == m_uncompressedSize) {
+                        if (m_uncompressedSize > 0) {
+                            memcpy(&m_data[0], compressedData, m_uncompressedSize);
+                        }
+                        retVal = true;
+                    }
+                }
+                else if (m_compressionMethod == ZipEntry::DEFLATED) {
+                    if (m_uncompressedSize == 0) {
+                        retVal = true;
+                    }
+                    else {
+                        z_stream zs;
+                        memset(&zs, 0, sizeof(z_stream));
+
+                        // ZIP archives contain raw deflate data without zlib header.
+                        if (inflateInit2(&zs, -MAX_WBITS) == Z_OK) {
+                            zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressedData));
+                            zs.avail_in = m_compressedSize;
+                            zs.next_out = reinterpret_cast<Bytef*>(&m_data[0]);
+                            zs.avail_out = m_uncompressedSize;
+
+                            retVal = (inflate(&zs, Z_FINISH) == Z_STREAM_END) && (zs.total_out == m_uncompressedSize);
+
+                            inflateEnd(&zs);
+                        }
+                    }
+                }
+                else {
+                    clog << "(core::wrapper::Zip::ZipEntry) Unsupported compression method " << m_compressionMethod << "." << endl;
+                }
+
+                if (retVal && (m_uncompressedSize > 0)) {
+                    const uLong crc = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(&m_data[0]), m_uncompressedSize);
+                    retVal = (crc == m_crc);
+                }
+
+                if (!retVal) {
+                    m_data.clear();
+                    return false;
+                }
+
+                // Let the stream operate directly on the decompressed contents.
+                if (m_uncompressedSize > 0) {
+                    setBuffer(&m_data[0], m_uncompressedSize);
+                }
+                m_decompressed = true;
+
+                return true;
+            }
+
+        }
+    }
+} // core::wrapper::Zip
@@ -141,6 +141,11 @@ namespace tools {
                 if (!(delta.toMicroseconds() < 0)) {
                     m_delay = (long)(delta.toMicroseconds());
                 }
+                else {
+                    // The recording's clock was stepped backwards (e.g. by an NTP correction);
+                    // send the successor immediately instead of reusing the previous delay.
+                    m_delay = 0;
+                }
             }
 
             // If the actual container is a SHARED_IMAGE then copy next entry into the shared memory before sending the actual container.
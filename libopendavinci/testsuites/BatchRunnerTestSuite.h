@@ -0,0 +1,240 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BATCHRUNNERTESTSUITE_H_
+#define CONTEXT_BATCHRUNNERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <stdint.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/macros.h"
+#include "core/base/KeyValueConfiguration.h"
+#include "core/data/TimeStamp.h"
+#include "core/exceptions/Exceptions.h"
+#include "context/base/BatchJob.h"
+#include "context/base/BatchResult.h"
+#include "context/base/BatchRunner.h"
+#include "context/base/BatchSimulation.h"
+#include "context/base/BatchSimulationFactory.h"
+#include "context/base/RuntimeEnvironment.h"
+#include "context/base/SystemFeedbackComponent.h"
+#include "context/base/SystemReportingComponent.h"
+
+using namespace std;
+using namespace core::base;
+using namespace core::data;
+using namespace context::base;
+
+class BatchRunnerTestCounter : public SystemFeedbackComponent {
+    public:
+        BatchRunnerTestCounter(const float &freq) :
+            m_freq(freq),
+            m_steps(0),
+            m_timeMatches(true) {}
+
+        float getFrequency() const {
+            return m_freq;
+        }
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void step(const core::wrapper::Time &t, SendContainerToSystemsUnderTest &/*sender*/) {
+            // The time of this thread must follow this simulation only.
+            TimeStamp now;
+            m_timeMatches &= ( (now.getSeconds() == t.getSeconds()) && (now.getFractionalMicroseconds() == t.getPartialMicroseconds()) );
+            m_steps++;
+        }
+
+        const float m_freq;
+        uint32_t m_steps;
+        bool m_timeMatches;
+};
+
+class BatchRunnerTestReport : public SystemReportingComponent {
+    public:
+        BatchRunnerTestReport(const BatchRunnerTestCounter &counter, const bool &fail) :
+            m_counter(counter),
+            m_fail(fail) {}
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void report(const core::wrapper::Time &/*t*/) {}
+
+        virtual bool hasCorrectlyWorked() const {
+            return (!m_fail) && m_counter.m_timeMatches && (m_counter.m_steps > 0);
+        }
+
+        const BatchRunnerTestCounter &m_counter;
+        const bool m_fail;
+};
+
+class BatchRunnerTestSimulation : public BatchSimulation {
+    public:
+        BatchRunnerTestSimulation(const BatchJob &job) :
+            m_job(job),
+            m_counter(NULL),
+            m_report(NULL) {}
+
+        virtual void setUp(RuntimeEnvironment &rte) {
+            const KeyValueConfiguration kvc = m_job.getConfiguration();
+            m_counter = new BatchRunnerTestCounter(kvc.getValue<float>("batchtest.frequency"));
+
+            bool fail = false;
+            try {
+                fail = (kvc.getValue<int32_t>("batchtest.fail") == 1);
+            }
+            catch(const core::exceptions::ValueForKeyNotFoundException &) {}
+
+            if (getFailure() == "setup") {
+                throw string("Failing setup.");
+            }
+            m_report = new BatchRunnerTestReport(*m_counter, fail);
+
+            rte.add(*m_counter);
+            rte.add(*m_report);
+        }
+
+        virtual void tearDown() {
+            OPENDAVINCI_CORE_DELETE_POINTER(m_report);
+            OPENDAVINCI_CORE_DELETE_POINTER(m_counter);
+
+            if (getFailure() == "teardown") {
+                throw string("Failing tear down.");
+            }
+        }
+
+        const string getFailure() const {
+            string failure;
+            try {
+                failure = m_job.getConfiguration().getValue<string>("batchtest.failure");
+            }
+            catch(const core::exceptions::ValueForKeyNotFoundException &) {}
+            return failure;
+        }
+
+        const BatchJob m_job;
+        BatchRunnerTestCounter *m_counter;
+        BatchRunnerTestReport *m_report;
+};
+
+class BatchRunnerTestFactory : public BatchSimulationFactory {
+    public:
+        virtual BatchSimulation* createSimulation(const BatchJob &job) {
+            return new BatchRunnerTestSimulation(job);
+        }
+};
+
+class BatchRunnerTest : public CxxTest::TestSuite {
+    public:
+        void testReadJobs() {
+            stringstream base;
+            base << "batchtest.frequency = 10" << endl
+                 << "global.key = value" << endl;
+            KeyValueConfiguration kvc;
+            base >> kvc;
+
+            stringstream jobFile;
+            jobFile << "# name maxRunningTimeInSeconds [key=value ...]" << endl
+                    << "job1 3" << endl
+                    << endl
+                    << "job2 5 batchtest.frequency=20 batchtest.fail=1" << endl
+                    << "invalid" << endl;
+
+            vector<BatchJob> jobs = BatchRunner::readJobs(jobFile, kvc);
+            TS_ASSERT(jobs.size() == 2);
+            TS_ASSERT(jobs.at(0).getName() == "job1");
+            TS_ASSERT(jobs.at(0).getMaxRunningTimeInSeconds() == 3);
+            TS_ASSERT(jobs.at(0).getConfiguration().getValue<uint32_t>("batchtest.frequency") == 10);
+            TS_ASSERT(jobs.at(1).getName() == "job2");
+            TS_ASSERT(jobs.at(1).getMaxRunningTimeInSeconds() == 5);
+            TS_ASSERT(jobs.at(1).getConfiguration().getValue<uint32_t>("batchtest.frequency") == 20);
+            TS_ASSERT(jobs.at(1).getConfiguration().getValue<string>("global.key") == "value");
+            TS_ASSERT(!jobs.at(1).isSupercomponent());
+        }
+
+        void testRunConcurrently() {
+            stringstream base;
+            base << "batchtest.frequency = 10" << endl;
+            KeyValueConfiguration kvc;
+            base >> kvc;
+
+            stringstream jobFile;
+            for (uint32_t i = 0; i < 12; i++) {
+                jobFile << "job" << i << " " << (2 + i % 3) << " batchtest.frequency=" << (1 + i % 4) * 5 << ((i == 7) ? " batchtest.fail=1" : "") << endl;
+            }
+            vector<BatchJob> jobs = BatchRunner::readJobs(jobFile, kvc);
+            TS_ASSERT(jobs.size() == 12);
+
+            BatchRunnerTestFactory factory;
+            BatchRunner runner(factory, 4);
+            vector<BatchResult> results = runner.run(jobs);
+
+            TS_ASSERT(results.size() == 12);
+            for (uint32_t i = 0; i < results.size(); i++) {
+                TS_ASSERT(results.at(i).getName() == jobs.at(i).getName());
+                TS_ASSERT(results.at(i).getErrorCode() == RuntimeControl::RUNTIME_TIMEOUT);
+                TS_ASSERT(results.at(i).hasPassed() == (i != 7));
+            }
+
+            stringstream summary;
+            BatchRunner::writeSummary(summary, results);
+            TS_ASSERT(summary.str().find("12 jobs, 11 passed, 1 failed") != string::npos);
+
+            // The process-wide time must not be affected.
+            TimeStamp now;
+            TS_ASSERT(now.getSeconds() > 1000000);
+        }
+
+        void testFailuresAreRecorded() {
+            stringstream base;
+            base << "batchtest.frequency = 10" << endl;
+            KeyValueConfiguration kvc;
+            base >> kvc;
+
+            stringstream jobFile;
+            jobFile << "setup 2 batchtest.failure=setup" << endl
+                    << "teardown 2 batchtest.failure=teardown" << endl
+                    << "passed 2" << endl;
+            vector<BatchJob> jobs = BatchRunner::readJobs(jobFile, kvc);
+            TS_ASSERT(jobs.size() == 3);
+
+            BatchRunnerTestFactory factory;
+            BatchRunner runner(factory, 2);
+            vector<BatchResult> results = runner.run(jobs);
+
+            TS_ASSERT(results.size() == 3);
+            TS_ASSERT(results.at(0).getErrorCode() == RuntimeControl::STRING_EXCEPTION_CAUGHT);
+            TS_ASSERT(!results.at(0).hasPassed());
+            TS_ASSERT(results.at(1).getErrorCode() == RuntimeControl::EXCEPTION_CAUGHT);
+            TS_ASSERT(!results.at(1).hasPassed());
+            TS_ASSERT(results.at(2).getErrorCode() == RuntimeControl::RUNTIME_TIMEOUT);
+            TS_ASSERT(results.at(2).hasPassed());
+        }
+};
+
+#endif /*CONTEXT_BATCHRUNNERTESTSUITE_H_*/
@@ -0,0 +1,280 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_INSTRUMENTATIONTESTSUITE_H_
+#define CORE_INSTRUMENTATIONTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "core/base/Histogram.h"
+#include "core/base/Instrumentation.h"
+#include "core/base/ScopedTimer.h"
+#include "core/base/Service.h"
+#include "core/base/Thread.h"
+#include "core/data/Container.h"
+#include "core/data/InstrumentationStatistic.h"
+#include "core/data/TimeStamp.h"
+#include "core/data/dmcp/ModuleDescriptor.h"
+#include "core/data/dmcp/ModuleStatistics.h"
+
+using namespace std;
+using namespace core::base;
+using namespace core::data;
+using namespace core::data::dmcp;
+
+class InstrumentationTestService : public Service {
+    public:
+        InstrumentationTestService(const uint32_t &counter, const uint32_t &histogram) :
+            m_counter(counter),
+            m_histogram(histogram) {}
+
+        void beforeStop() {}
+
+        void run() {
+            for (uint32_t i = 0; i < 1000; i++) {
+                Instrumentation::getInstance().increment(m_counter);
+                Instrumentation::getInstance().add(m_histogram, 100000 + i);
+            }
+            serviceReady();
+            while (isRunning()) {
+                Thread::usleep(1000);
+            }
+        }
+
+    private:
+        uint32_t m_counter;
+        uint32_t m_histogram;
+};
+
+class InstrumentationTest : public CxxTest::TestSuite {
+    public:
+        const InstrumentationMetric getMetric(const InstrumentationStatistic &is, const string &name) {
+            const vector<InstrumentationMetric> metrics = is.getListOfMetrics();
+            vector<InstrumentationMetric>::const_iterator it = metrics.begin();
+            while (it != metrics.end()) {
+                if (it->getName() == name) {
+                    return (*it);
+                }
+                it++;
+            }
+            return InstrumentationMetric();
+        }
+
+        void testHistogramBuckets() {
+            // Values below 16 are exact.
+            for (uint64_t v = 0; v < 16; v++) {
+                TS_ASSERT(Histogram::getBucketUpperBound(Histogram::getBucket(v)) == v);
+            }
+
+            // Every value lies within its bucket and the relative error is bounded.
+            bool valid = true;
+            for (uint64_t v = 16; v < (static_cast<uint64_t>(1) << 40); v = v * 3 / 2 + 7) {
+                const uint32_t bucket = Histogram::getBucket(v);
+                const uint64_t upper = Histogram::getBucketUpperBound(bucket);
+                const uint64_t lower = Histogram::getBucketUpperBound(bucket - 1) + 1;
+                valid &= (bucket < Histogram::NUMBER_OF_BUCKETS);
+                valid &= (lower <= v) && (v <= upper);
+                valid &= (static_cast<double>(upper - lower) / lower < 1.0 / 16.0 + 1e-9);
+            }
+            TS_ASSERT(valid);
+
+            // Out of range values are counted in the last bucket.
+            TS_ASSERT(Histogram::getBucket(static_cast<uint64_t>(1) << 50) == Histogram::NUMBER_OF_BUCKETS - 1);
+        }
+
+        void testHistogramPercentiles() {
+            Histogram h;
+            TS_ASSERT(h.getCount() == 0);
+            TS_ASSERT(h.getValueAtPercentile(99) == 0);
+
+            vector<uint64_t> values;
+            uint64_t x = 12345;
+            for (uint32_t i = 0; i < 10000; i++) {
+                // Simple linear congruential generator for reproducible values.
+                x = (x * 1103515245 + 12345) % 2147483648UL;
+                const uint64_t value = 1000 + (x % 1000000);
+                values.push_back(value);
+                h.add(value);
+            }
+            sort(values.begin(), values.end());
+
+            TS_ASSERT(h.getCount() == 10000);
+            TS_ASSERT(h.getMinimum() == values.front());
+            TS_ASSERT(h.getMaximum() == values.back());
+            TS_ASSERT(h.getValueAtPercentile(100) == values.back());
+
+            const double percentiles[] = { 50, 90, 99, 99.9 };
+            for (uint32_t i = 0; i < 4; i++) {
+                const uint64_t exact = values[static_cast<uint32_t>(ceil(percentiles[i] / 100.0 * values.size())) - 1];
+                const uint64_t approximated = h.getValueAtPercentile(percentiles[i]);
+                TS_ASSERT(approximated >= exact);
+                TS_ASSERT(static_cast<double>(approximated - exact) / exact < 1.0 / 16.0);
+            }
+
+            Histogram h2;
+            h2.add(5);
+            h2.add(5000000);
+            h.merge(h2);
+            TS_ASSERT(h.getCount() == 10002);
+            TS_ASSERT(h.getMinimum() == 5);
+            TS_ASSERT(h.getMaximum() == 5000000);
+
+            h.reset();
+            TS_ASSERT(h.getCount() == 0);
+            TS_ASSERT(h.getMaximum() == 0);
+        }
+
+        void testInstrumentationFromSeveralThreads() {
+            Instrumentation::setEnabled(true);
+            Instrumentation &instr = Instrumentation::getInstance();
+            const uint32_t counter = instr.getCounter("InstrumentationTest.counter");
+            const uint32_t histogram = instr.getHistogram("InstrumentationTest.histogram");
+            const uint32_t timer = instr.getHistogram("InstrumentationTest.timer");
+
+            // Registering the same name again returns the same metric.
+            TS_ASSERT(counter == instr.getCounter("InstrumentationTest.counter"));
+            TS_ASSERT(counter != histogram);
+
+            // Discard anything recorded before.
+            instr.getInstrumentationStatistic(true);
+
+            InstrumentationTestService s1(counter, histogram);
+            InstrumentationTestService s2(counter, histogram);
+            s1.start();
+            s2.start();
+
+            instr.increment(counter, 5);
+            {
+                ScopedTimer st(timer);
+                Thread::usleep(1000);
+            }
+
+            // The data of both threads is kept after they terminated.
+            s1.stop();
+            s2.stop();
+
+            InstrumentationStatistic is = instr.getInstrumentationStatistic(true);
+            const InstrumentationMetric c = getMetric(is, "InstrumentationTest.counter");
+            TS_ASSERT(c.getType() == InstrumentationMetric::COUNTER);
+            TS_ASSERT(c.getCount() == 2005);
+
+            const InstrumentationMetric h = getMetric(is, "InstrumentationTest.histogram");
+            TS_ASSERT(h.getType() == InstrumentationMetric::HISTOGRAM);
+            TS_ASSERT(h.getCount() == 2000);
+            TS_ASSERT_DELTA(h.getMinimum(), 100000, 1e-3);
+            TS_ASSERT_DELTA(h.getMaximum(), 100999, 1e-3);
+            TS_ASSERT_DELTA(h.getMean(), 100499.5, 1e-3);
+            TS_ASSERT(h.getPercentile50() >= 100499);
+            TS_ASSERT(h.getPercentile99() <= h.getMaximum());
+
+            const InstrumentationMetric t = getMetric(is, "InstrumentationTest.timer");
+            TS_ASSERT(t.getCount() == 1);
+            TS_ASSERT(t.getMinimum() >= 1000 * 1000);
+
+            // All metrics were reset.
+            is = instr.getInstrumentationStatistic(false);
+            TS_ASSERT(getMetric(is, "InstrumentationTest.counter").getCount() == 0);
+            TS_ASSERT(getMetric(is, "InstrumentationTest.histogram").getCount() == 0);
+        }
+
+        void testSerializationIsInstrumented() {
+            Instrumentation::setEnabled(true);
+            Instrumentation &instr = Instrumentation::getInstance();
+            instr.getInstrumentationStatistic(true);
+
+            Container c(Container::TIMESTAMP, TimeStamp(1, 2));
+            TimeStamp ts = c.getData<TimeStamp>();
+            TS_ASSERT(ts.getSeconds() == 1);
+
+            InstrumentationStatistic is = instr.getInstrumentationStatistic(true);
+            TS_ASSERT(getMetric(is, "Container.serialize.TimeStamp.12").getCount() == 1);
+            TS_ASSERT(getMetric(is, "Container.deserialize.TimeStamp.12").getCount() == 1);
+        }
+
+        void testDisabledInstrumentationRecordsNothing() {
+            Instrumentation &instr = Instrumentation::getInstance();
+            const uint32_t counter = instr.getCounter("InstrumentationTest.disabledCounter");
+            const uint32_t histogram = instr.getHistogram("InstrumentationTest.disabledHistogram");
+
+            Instrumentation::setEnabled(true);
+            instr.getInstrumentationStatistic(true);
+
+            Instrumentation::setEnabled(false);
+            TS_ASSERT(!Instrumentation::isEnabled());
+            instr.increment(counter);
+            instr.add(histogram, 1000);
+            {
+                ScopedTimer st(histogram);
+            }
+
+            Container c(Container::TIMESTAMP, TimeStamp(1, 2));
+            TimeStamp ts = c.getData<TimeStamp>();
+            TS_ASSERT(ts.getSeconds() == 1);
+
+            InstrumentationStatistic is = instr.getInstrumentationStatistic(true);
+            TS_ASSERT(is.isEmpty());
+
+            Instrumentation::setEnabled(true);
+        }
+
+        void testStatisticSerialization() {
+            Histogram h;
+            h.add(1000);
+            h.add(2000);
+            h.add(3000);
+
+            InstrumentationStatistic is;
+            is.addMetric(InstrumentationMetric("A.counter", 42));
+            is.addMetric(InstrumentationMetric("B.histogram", h));
+
+            ModuleStatistics ms;
+            ms.setInstrumentationStatistic(ModuleDescriptor("Module", "1", "Version", 10), is);
+
+            stringstream sstr;
+            sstr << ms;
+            ModuleStatistics ms2;
+            sstr >> ms2;
+
+            TS_ASSERT(ms2.getRuntimeStatistic().size() == 0);
+            map<ModuleDescriptor, InstrumentationStatistic, ModuleDescriptorComparator> data = ms2.getInstrumentationStatistic();
+            TS_ASSERT(data.size() == 1);
+
+            const InstrumentationStatistic is2 = data.begin()->second;
+            TS_ASSERT(data.begin()->first.getName() == "Module");
+            TS_ASSERT(is2.getListOfMetrics().size() == 2);
+
+            const InstrumentationMetric c = getMetric(is2, "A.counter");
+            TS_ASSERT(c.getType() == InstrumentationMetric::COUNTER);
+            TS_ASSERT(c.getCount() == 42);
+
+            const InstrumentationMetric m = getMetric(is2, "B.histogram");
+            TS_ASSERT(m.getType() == InstrumentationMetric::HISTOGRAM);
+            TS_ASSERT(m.getCount() == 3);
+            TS_ASSERT_DELTA(m.getMinimum(), 1000, 1e-3);
+            TS_ASSERT_DELTA(m.getMaximum(), 3000, 1e-3);
+            TS_ASSERT_DELTA(m.getMean(), 2000, 1e-3);
+            TS_ASSERT_DELTA(m.getPercentile50(), h.getValueAtPercentile(50), 1e-3);
+        }
+};
+
+#endif /*CORE_INSTRUMENTATIONTESTSUITE_H_*/
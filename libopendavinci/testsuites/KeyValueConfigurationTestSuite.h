@@ -26,6 +26,7 @@
 #include <string>
 
 #include "core/base/KeyValueConfiguration.h"
+#include "core/base/KeyValueConfigurationHandle.h"
 #include "core/exceptions/Exceptions.h"
 
 using namespace std;
@@ -233,6 +234,56 @@ class ConfigurationTest : public CxxTest::TestSuite {
 
             TS_ASSERT_DELTA(key4, 3.1415, 1e-3);
         }
+
+        void testKeyValueConfigurationHandle() {
+            stringstream s;
+            s << "Section1.key1=String1" << endl
+            << "Section1.key2=10" << endl
+            << "Section1.key3=3.1415" << endl;
+
+            KeyValueConfiguration kvc;
+            s >> kvc;
+
+            KeyValueConfigurationHandle<string> key1("section1.KEY1", "Default");
+            KeyValueConfigurationHandle<int32_t> key2("Section1.key2", 0);
+            KeyValueConfigurationHandle<double> key3("Section1.key3", 0);
+            KeyValueConfigurationHandle<double> key4("Section1.key4", 2.5);
+
+            // Default values before the first update.
+            TS_ASSERT(key1.getValue() == "Default");
+            TS_ASSERT(!key1.isAvailable());
+
+            key1.update(kvc);
+            key2.update(kvc);
+            key3.update(kvc);
+            key4.update(kvc);
+
+            TS_ASSERT(*key1 == "String1");
+            TS_ASSERT(key1->size() == 7);
+            TS_ASSERT(key1.isAvailable());
+            TS_ASSERT(*key2 == 10);
+            TS_ASSERT_DELTA(*key3, 3.1415, 1e-3);
+            TS_ASSERT(!key4.isAvailable());
+            TS_ASSERT_DELTA(*key4, 2.5, 1e-3);
+
+            // New configuration with changed and removed values.
+            stringstream s2;
+            s2 << "Section1.key2=20" << endl
+            << "Section1.key4=1.5" << endl;
+
+            KeyValueConfiguration kvc2;
+            s2 >> kvc2;
+
+            key1.update(kvc2);
+            key2.update(kvc2);
+            key4.update(kvc2);
+
+            TS_ASSERT(*key1 == "Default");
+            TS_ASSERT(!key1.isAvailable());
+            TS_ASSERT(*key2 == 20);
+            TS_ASSERT(key4.isAvailable());
+            TS_ASSERT_DELTA(*key4, 1.5, 1e-3);
+        }
 };
 
 #endif /*CORE_KEYVALUECONFIGURATIONTESTSUITE_H_*/
@@ -123,6 +123,51 @@ class NetstringsProtocolTest : public CxxTest::TestSuite, public core::wrapper::
             TS_ASSERT(m_receivedData.compare(testDataToBeSent) == 0); 
         }
 
+        void testNetstringsProtocolPartialReceive3() {
+            core::wrapper::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            nsp.setStringSender(this);
+
+            m_receivedData = "";
+            TS_ASSERT(m_receivedData.length() == 0); 
+
+            // Netstring split within its length and within its payload.
+            nsp.receivedPartialString("0:,1");
+            TS_ASSERT(m_receivedData.length() == 0); 
+
+            nsp.receivedPartialString("0:Hello");
+            TS_ASSERT(m_receivedData.length() == 0); 
+
+            nsp.receivedPartialString("World,5:Adieu,3:");
+            TS_ASSERT(m_receivedData.compare("Adieu") == 0); 
+
+            nsp.receivedPartialString("Bye,");
+            TS_ASSERT(m_receivedData.compare("Bye") == 0); 
+        }
+
+        void testNetstringsProtocolPartialReceive4() {
+            core::wrapper::NetstringsProtocol nsp;
+            nsp.setStringListener(this);
+            nsp.setStringSender(this);
+
+            m_receivedData = "";
+            TS_ASSERT(m_receivedData.length() == 0); 
+
+            // Payload shorter than the buffered data but not yet complete.
+            nsp.receivedPartialString("5:Hel");
+            TS_ASSERT(m_receivedData.length() == 0); 
+
+            nsp.receivedPartialString("lo,");
+            TS_ASSERT(m_receivedData.compare("Hello") == 0); 
+
+            // Corrupted data is discarded.
+            nsp.receivedPartialString("3:Bye;");
+            TS_ASSERT(m_receivedData.compare("Hello") == 0); 
+
+            nsp.receivedPartialString("5:Adieu,");
+            TS_ASSERT(m_receivedData.compare("Adieu") == 0); 
+        }
+
 };
 
 #endif /*CORE_NETSTRINGSPROTOCOLTESTSUITE_H_*/
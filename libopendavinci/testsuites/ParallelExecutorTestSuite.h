@@ -0,0 +1,91 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_PARALLELEXECUTORTESTSUITE_H_
+#define CORE_PARALLELEXECUTORTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <vector>
+
+#include "core/base/Lock.h"
+#include "core/base/Mutex.h"
+#include "core/base/ParallelTask.h"
+#include "core/base/Thread.h"
+#include "core/base/ParallelExecutor.h"
+
+using namespace std;
+using namespace core::base;
+
+class ParallelExecutorTestTask : public ParallelTask {
+    public:
+        ParallelExecutorTestTask(const uint32_t &numberOfUnits) :
+            m_mutex(),
+            m_executions(numberOfUnits, 0) {}
+
+        virtual void execute(const uint32_t &index) {
+            // Give other workers the chance to fetch units concurrently.
+            Thread::usleep(100);
+
+            Lock l(m_mutex);
+            m_executions.at(index)++;
+        }
+
+        bool hasExecutedEveryUnitOnce() {
+            Lock l(m_mutex);
+            for (uint32_t i = 0; i < m_executions.size(); i++) {
+                if (m_executions[i] != 1) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        Mutex m_mutex;
+        vector<uint32_t> m_executions;
+};
+
+class ParallelExecutorTest : public CxxTest::TestSuite {
+    public:
+        void testExecuteAllUnits() {
+            ParallelExecutor executor(4);
+            TS_ASSERT(executor.getNumberOfWorkers() == 4);
+
+            ParallelExecutorTestTask task(100);
+            executor.execute(task, 100);
+            TS_ASSERT(task.hasExecutedEveryUnitOnce());
+
+            // The executor can be reused.
+            ParallelExecutorTestTask other(3);
+            executor.execute(other, 3);
+            TS_ASSERT(other.hasExecutedEveryUnitOnce());
+        }
+
+        void testNoUnits() {
+            ParallelExecutor executor(0);
+            TS_ASSERT(executor.getNumberOfWorkers() == 1);
+
+            ParallelExecutorTestTask task(0);
+            executor.execute(task, 0);
+            TS_ASSERT(task.hasExecutedEveryUnitOnce());
+        }
+};
+
+#endif /*CORE_PARALLELEXECUTORTESTSUITE_H_*/
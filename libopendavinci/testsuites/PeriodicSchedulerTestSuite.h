@@ -0,0 +1,115 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_PERIODICSCHEDULERTESTSUITE_H_
+#define CORE_PERIODICSCHEDULERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "core/base/Thread.h"
+#include "core/data/RuntimeStatistic.h"
+#include "core/wrapper/PeriodicScheduler.h"
+#include "core/wrapper/TimeFactory.h"
+
+using namespace std;
+using namespace core::base;
+using namespace core::data;
+using namespace core::wrapper;
+
+class PeriodicSchedulerTest : public CxxTest::TestSuite {
+    public:
+        void testNoDrift() {
+            const int64_t PERIOD = 10 * 1000 * 1000;
+            const uint32_t CYCLES = 20;
+
+            PeriodicScheduler ps;
+            ps.setPeriod(PERIOD);
+            TS_ASSERT(ps.getPeriod() == PERIOD);
+
+            int64_t lateness = 0;
+            ps.waitForNextPeriod(lateness);
+            const int64_t start = TimeFactory::getInstance().getMonotonicNanoseconds();
+
+            for (uint32_t i = 0; i < CYCLES; i++) {
+                // Simulate some work within the slice.
+                Thread::usleep(2000);
+                ps.waitForNextPeriod(lateness);
+                TS_ASSERT(lateness >= 0);
+            }
+
+            const int64_t duration = TimeFactory::getInstance().getMonotonicNanoseconds() - start;
+
+            // The overall duration must not accumulate the work and the oversleeping.
+            TS_ASSERT(duration >= (CYCLES - 1) * PERIOD);
+            TS_ASSERT(duration < (CYCLES + 2) * PERIOD);
+        }
+
+        void testOverrun() {
+            const int64_t PERIOD = 5 * 1000 * 1000;
+
+            PeriodicScheduler ps;
+            ps.setPeriod(PERIOD);
+
+            int64_t lateness = 0;
+            ps.waitForNextPeriod(lateness);
+
+            // Miss at least two deadlines.
+            Thread::usleep(12000);
+            const uint32_t overruns = ps.waitForNextPeriod(lateness);
+            TS_ASSERT(overruns >= 2);
+            TS_ASSERT(lateness == 0);
+
+            // The schedule continues with the next deadline in the future.
+            TS_ASSERT(ps.waitForNextPeriod(lateness) == 0);
+        }
+
+        void testRuntimeStatisticJitterHistogram() {
+            RuntimeStatistic rts1;
+            rts1.setSliceConsumption(0.5f);
+            rts1.setOverruns(3);
+            rts1.addJitter(5);
+            rts1.addJitter(9);
+            rts1.addJitter(700);
+            rts1.addJitter(20000);
+
+            TS_ASSERT(rts1.getJitterCount(0) == 2);
+            TS_ASSERT(rts1.getJitterCount(4) == 1);
+            TS_ASSERT(rts1.getJitterCount(RuntimeStatistic::NUMBER_OF_JITTER_BUCKETS - 1) == 1);
+            TS_ASSERT(rts1.getMaximumJitter() == 20000);
+
+            stringstream sstr;
+            sstr << rts1;
+
+            RuntimeStatistic rts2;
+            sstr >> rts2;
+
+            TS_ASSERT(rts2.getOverruns() == 3);
+            TS_ASSERT(rts2.getMaximumJitter() == 20000);
+            for (uint32_t i = 0; i < RuntimeStatistic::NUMBER_OF_JITTER_BUCKETS; i++) {
+                TS_ASSERT(rts1.getJitterCount(i) == rts2.getJitterCount(i));
+            }
+            TS_ASSERT(rts1.toString() == rts2.toString());
+        }
+};
+
+#endif /*CORE_PERIODICSCHEDULERTESTSUITE_H_*/
@@ -63,6 +63,32 @@ class RunnerTest : public CxxTest::TestSuite {
             TS_ASSERT(!r3.needsExecution(ControlledTime(1, 999999)));
             TS_ASSERT(r3.needsExecution(ControlledTime(2, 0)));
         }
+
+        void testNextExecution() {
+            // Compare with executions found by stepping every millisecond.
+            const float frequencies[] = { 1, 2, 0.5, 7, 3, 1000, 0.3 };
+            for (uint32_t i = 0; i < sizeof(frequencies)/sizeof(frequencies[0]); i++) {
+                RunnerTestApp r(frequencies[i]);
+
+                uint64_t expectedNextExecution = 0;
+                bool sameResults = true;
+                for (uint32_t ms = 10000; ms > 0; ms--) {
+                    const ControlledTime t(ms / 1000, (ms % 1000) * 1000);
+                    if (r.needsExecution(t)) {
+                        expectedNextExecution = ms;
+                    }
+
+                    const ControlledTime previous((ms - 1) / 1000, ((ms - 1) % 1000) * 1000);
+                    if ( (expectedNextExecution > 0) && (r.getNextExecution(previous) != expectedNextExecution) ) {
+                        sameResults = false;
+                    }
+                }
+                TS_ASSERT(sameResults);
+            }
+
+            RunnerTestApp r0(0);
+            TS_ASSERT(r0.getNextExecution(ControlledTime(1, 0)) == 0);
+        }
 };
 
 #endif /*CONTEXT_RUNNERTESTSUITE_H_*/
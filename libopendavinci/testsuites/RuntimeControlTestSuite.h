@@ -28,6 +28,7 @@
 
 #include "core/base/KeyValueConfiguration.h"
 #include "core/base/ConferenceClientModule.h"
+#include "core/data/TimeStamp.h"
 #include "context/base/DirectInterface.h"
 #include "context/base/RuntimeControl.h"
 #include "context/base/RuntimeEnvironment.h"
@@ -101,6 +102,75 @@ class RuntimeControlTestDummySystemPart : public SystemFeedbackComponent {
         bool m_tearDownCalled;
 };
 
+class RuntimeControlTestSnapshotSender : public SystemFeedbackComponent {
+    public:
+        RuntimeControlTestSnapshotSender(const uint32_t &increment) :
+            m_increment(increment),
+            m_value(0) {}
+
+        float getFrequency() const {
+            return 10;
+        }
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void step(const core::wrapper::Time &/*t*/, SendContainerToSystemsUnderTest &sender) {
+            getFIFO().clear();
+
+            m_value += m_increment;
+            core::data::Container c(core::data::Container::TIMESTAMP, core::data::TimeStamp(m_value, 0));
+            sender.sendToSystemsUnderTest(c);
+        }
+
+        const uint32_t m_increment;
+        uint32_t m_value;
+
+    protected:
+        virtual void storeState(ostream &out) const {
+            out << m_value;
+        }
+
+        virtual void restoreState(istream &in) {
+            in >> m_value;
+        }
+};
+
+class RuntimeControlTestSnapshotReceiver : public SystemFeedbackComponent {
+    public:
+        RuntimeControlTestSnapshotReceiver() :
+            m_sum(0) {}
+
+        float getFrequency() const {
+            return 1;
+        }
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void step(const core::wrapper::Time &/*t*/, SendContainerToSystemsUnderTest &/*sender*/) {
+            while (!getFIFO().isEmpty()) {
+                core::data::Container c = getFIFO().leave();
+                if (c.getDataType() == core::data::Container::TIMESTAMP) {
+                    m_sum += c.getData<core::data::TimeStamp>().getSeconds();
+                }
+            }
+        }
+
+        uint32_t m_sum;
+
+    protected:
+        virtual void storeState(ostream &out) const {
+            out << m_sum;
+        }
+
+        virtual void restoreState(istream &in) {
+            in >> m_sum;
+        }
+};
+
 class RuntimeControlTest : public CxxTest::TestSuite {
     public:
         void testRuntimeControlRegularRun() {
@@ -262,6 +332,101 @@ class RuntimeControlTest : public CxxTest::TestSuite {
             TS_ASSERT(rctm.getCycleCounter() == 0);
         }
 
+        void testRuntimeControlSnapshotAndFork() {
+            DirectInterface di("225.0.0.100", 100, "");
+
+            // Reference run for 10s.
+            uint32_t referenceValue = 0;
+            uint32_t referenceSum = 0;
+            {
+                RuntimeControl sc(di);
+                sc.setup(RuntimeControl::TAKE_CONTROL);
+
+                RuntimeControlTestSnapshotSender sender(1);
+                RuntimeControlTestSnapshotReceiver receiver;
+                RuntimeEnvironment rte;
+                rte.add(sender);
+                rte.add(receiver);
+
+                TS_ASSERT(sc.run(rte, 10) == RuntimeControl::RUNTIME_TIMEOUT);
+                sc.tearDown();
+
+                referenceValue = sender.m_value;
+                referenceSum = receiver.m_sum;
+            }
+            TS_ASSERT(referenceValue == 100);
+
+            // Warm-up for 5s.
+            SimulationSnapshot snapshot;
+            {
+                RuntimeControl sc(di);
+                sc.setup(RuntimeControl::TAKE_CONTROL);
+
+                RuntimeControlTestSnapshotSender sender(1);
+                RuntimeControlTestSnapshotReceiver receiver;
+                RuntimeEnvironment rte;
+                rte.add(sender);
+                rte.add(receiver);
+
+                TS_ASSERT(sc.run(rte, 5) == RuntimeControl::RUNTIME_TIMEOUT);
+                sc.tearDown();
+
+                snapshot = sc.getSnapshot();
+                TS_ASSERT(sender.m_value == 50);
+            }
+            TS_ASSERT(snapshot.isValid());
+            TS_ASSERT(snapshot.getTime().getSeconds() == 5);
+            TS_ASSERT(snapshot.getNumberOfStates() == 2);
+
+            // Continuation must match the reference including the pending containers.
+            {
+                RuntimeControl sc(di);
+                sc.setup(RuntimeControl::TAKE_CONTROL);
+
+                RuntimeControlTestSnapshotSender sender(1);
+                RuntimeControlTestSnapshotReceiver receiver;
+                RuntimeEnvironment rte;
+                rte.add(sender);
+                rte.add(receiver);
+
+                TS_ASSERT(sc.run(rte, 10, snapshot) == RuntimeControl::RUNTIME_TIMEOUT);
+                sc.tearDown();
+
+                TS_ASSERT(sender.m_value == referenceValue);
+                TS_ASSERT(receiver.m_sum == referenceSum);
+            }
+
+            // Fork with a different parameter.
+            {
+                RuntimeControl sc(di);
+                sc.setup(RuntimeControl::TAKE_CONTROL);
+
+                RuntimeControlTestSnapshotSender sender(2);
+                RuntimeControlTestSnapshotReceiver receiver;
+                RuntimeEnvironment rte;
+                rte.add(sender);
+                rte.add(receiver);
+
+                TS_ASSERT(sc.run(rte, 10, snapshot) == RuntimeControl::RUNTIME_TIMEOUT);
+                sc.tearDown();
+
+                TS_ASSERT(sender.m_value == 150);
+            }
+
+            // Snapshot not matching the RuntimeEnvironment.
+            {
+                RuntimeControl sc(di);
+                sc.setup(RuntimeControl::TAKE_CONTROL);
+
+                RuntimeControlTestSnapshotSender sender(1);
+                RuntimeEnvironment rte;
+                rte.add(sender);
+
+                TS_ASSERT(sc.run(rte, 10, snapshot) == RuntimeControl::STRING_EXCEPTION_CAUGHT);
+                sc.tearDown();
+            }
+        }
+
         void testRuntimeControlRegularRunNoSetupCalled() {
             // Setup configuration.
             stringstream sstr;
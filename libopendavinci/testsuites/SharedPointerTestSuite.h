@@ -176,6 +176,27 @@ class SharedPointerTest : public CxxTest::TestSuite {
             clog << endl;
         }
 
+        void testReferenceCount() {
+            using namespace core;
+
+            SharedPointer<SharedPointerTestData> p1;
+            TS_ASSERT(p1.getReferenceCount() == 0);
+
+            p1 = SharedPointer<SharedPointerTestData>(new SharedPointerTestData());
+            TS_ASSERT(p1.getReferenceCount() == 1);
+            {
+                SharedPointer<SharedPointerTestData> p2(p1);
+                SharedPointer<SharedPointerTestData> p3 = p2;
+                TS_ASSERT(p1.getReferenceCount() == 3);
+                TS_ASSERT(p3.getReferenceCount() == 3);
+            }
+            TS_ASSERT(p1.getReferenceCount() == 1);
+
+            p1.release();
+            TS_ASSERT(p1.getReferenceCount() == 0);
+            clog << endl;
+        }
+
         void testSharedPointerInsideSTL() {
             using namespace core;
 
@@ -36,6 +36,9 @@
 #ifndef WIN32
 	#include "core/wrapper/POSIX/POSIXTCPFactoryWorker.h"
 #endif
+#ifdef __linux__
+	#include "core/wrapper/POSIX/POSIXReactorTCPFactoryWorker.h"
+#endif
 #ifdef WIN32
 	#include "core/wrapper/WIN32/WIN32TCPFactoryWorker.h"
 #endif
@@ -49,6 +52,50 @@ using namespace std;
 using namespace core;
 using namespace core::base;
 
+/**
+ * This listener waits for the first data from a new connection before
+ * returning from onNewConnection, like a handshake does.
+ */
+class HandshakingAcceptorListener : public wrapper::TCPAcceptorListener {
+    private:
+        HandshakingAcceptorListener(const HandshakingAcceptorListener &);
+        HandshakingAcceptorListener& operator=(const HandshakingAcceptorListener &);
+
+    public:
+        HandshakingAcceptorListener() :
+            m_connection(NULL),
+            m_stringListener(),
+            m_hasReceivedData(false),
+            CALLWAITER_onNewConnection() {}
+
+        ~HandshakingAcceptorListener() {
+            if (m_connection != NULL) {
+                delete m_connection;
+            }
+        }
+
+        virtual void onNewConnection(wrapper::TCPConnection* connection) {
+            m_connection = connection;
+            m_connection->setStringListener(&m_stringListener);
+            m_connection->start();
+
+            m_hasReceivedData = m_stringListener.CALLWAITER_nextString.wait();
+            CALLWAITER_onNewConnection.called();
+        }
+
+        bool hasReceivedData() const {
+            return m_hasReceivedData;
+        }
+
+    private:
+        wrapper::TCPConnection* m_connection;
+        mocks::StringListenerMock m_stringListener;
+        bool m_hasReceivedData;
+
+    public:
+        mocks::FunctionCallWaiter CALLWAITER_onNewConnection;
+};
+
 template <typename worker> struct TCPAcceptorTests
 {
         static void acceptTest()
@@ -117,6 +164,23 @@ template <typename worker> struct TCPAcceptorTests
             TS_ASSERT(!am2.CALLWAITER_onNewConnection.wasCalled());
         }
 
+        static void blockingListenerTest() {
+            HandshakingAcceptorListener hl;
+
+            SharedPointer<wrapper::TCPAcceptor> acceptor(worker::createTCPAcceptor(20000));
+            acceptor->setAcceptorListener(&hl);
+            acceptor->start();
+
+            SharedPointer<wrapper::TCPConnection> connection(worker::createTCPConnectionTo("127.0.0.1", 20000));
+            connection->start();
+            connection->send("Hello");
+
+            // The listener's connection must be served while the listener is blocked.
+            TS_ASSERT(hl.CALLWAITER_onNewConnection.wait());
+            TS_ASSERT(hl.hasReceivedData());
+
+            acceptor->stop();
+        }
 };
 
 class TCPAcceptorTestsuite : public CxxTest::TestSuite
@@ -139,6 +203,14 @@ class TCPAcceptorTestsuite : public CxxTest::TestSuite
                     core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
                 >::acceptTest();
             #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPAcceptorTestsuite::testAccept using POSIXReactor" << endl;
+                TCPAcceptorTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::acceptTest();
+            #endif
         }
 
         void testMultipleAccept()
@@ -158,6 +230,14 @@ class TCPAcceptorTestsuite : public CxxTest::TestSuite
                     core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
                 >::multipleAcceptTest();
             #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPAcceptorTestsuite::testMultipleAccept using POSIXReactor" << endl;
+                TCPAcceptorTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::multipleAcceptTest();
+            #endif
         }
 
         void testNoAccept()
@@ -177,6 +257,41 @@ class TCPAcceptorTestsuite : public CxxTest::TestSuite
                     core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
                 >::noAcceptTest();
             #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPAcceptorTestsuite::testNoAccept using POSIXReactor" << endl;
+                TCPAcceptorTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::noAcceptTest();
+            #endif
+        }
+
+        void testBlockingListener()
+        {
+            #ifdef WIN32
+                clog << endl << "TCPAcceptorTestsuite::testBlockingListener using NetworkLibraryWin32" << endl;
+                TCPAcceptorTests
+                <
+                     core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryWin32>
+                >::blockingListenerTest();
+            #endif
+
+            #ifndef WIN32
+                clog << endl << "TCPAcceptorTestsuite::testBlockingListener using NetworkLibraryPosix" << endl;
+                TCPAcceptorTests
+                <
+                    core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
+                >::blockingListenerTest();
+            #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPAcceptorTestsuite::testBlockingListener using POSIXReactor" << endl;
+                TCPAcceptorTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::blockingListenerTest();
+            #endif
         }
 };
 
@@ -225,6 +340,34 @@ template <typename worker> struct TCPConnectionTests
         stmAcceptedConnection.CALLWAITER_nextString.reset();
     }
 
+    static void largeTransferTest()
+    {
+        mocks::TCPAcceptorListenerMock am;
+
+        auto_ptr<wrapper::TCPAcceptor> acceptor(worker::createTCPAcceptor(20000));
+        acceptor->setAcceptorListener(&am);
+        acceptor->start();
+
+        auto_ptr<wrapper::TCPConnection> connection(worker::createTCPConnectionTo("127.0.0.1", 20000));
+        connection->start();
+
+        TS_ASSERT(am.CALLWAITER_onNewConnection.wait());
+        am.getConnection()->start();
+
+        // The data exceeds the socket's buffers and must be sent in several steps.
+        const string data(4*1024*1024, 'x');
+
+        mocks::StringListenerMock stmAcceptedConnection;
+        stmAcceptedConnection.VALUES_nextString.addItem(data);
+        stmAcceptedConnection.VALUES_nextString.prepare();
+        am.getConnection()->setStringListener(&stmAcceptedConnection);
+
+        connection->send(data);
+
+        TS_ASSERT( stmAcceptedConnection.CALLWAITER_nextString.wait() );
+        TS_ASSERT( stmAcceptedConnection.correctCalled() );
+    }
+
     static void errorTest() {
         bool failed = true;
         try {
@@ -294,6 +437,33 @@ class TCPConnectionTestSuite  : public CxxTest::TestSuite
                      core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
                 >::transferTest();
             #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPConnectionTestSuite::testTransfer using POSIXReactor" << endl;
+                TCPConnectionTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::transferTest();
+            #endif
+        }
+
+        void testLargeTransfer()
+        {
+            #ifndef WIN32
+                clog << endl << "TCPConnectionTestSuite::testLargeTransfer using NetworkLibraryPosix" << endl;
+                TCPConnectionTests
+                <
+                     core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
+                >::largeTransferTest();
+            #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPConnectionTestSuite::testLargeTransfer using POSIXReactor" << endl;
+                TCPConnectionTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::largeTransferTest();
+            #endif
         }
 
         void testError()
@@ -313,6 +483,43 @@ class TCPConnectionTestSuite  : public CxxTest::TestSuite
                      core::wrapper::TCPFactoryWorker<core::wrapper::NetworkLibraryPosix>
                 >::errorTest();
             #endif
+
+            #ifdef __linux__
+                clog << endl << "TCPConnectionTestSuite::testError using POSIXReactor" << endl;
+                TCPConnectionTests
+                <
+                    core::wrapper::POSIXReactorTCPFactoryWorker
+                >::errorTest();
+            #endif
+        }
+
+        void testOutputBufferLimit()
+        {
+            #ifdef __linux__
+                clog << endl << "TCPConnectionTestSuite::testOutputBufferLimit using POSIXReactor" << endl;
+                mocks::TCPAcceptorListenerMock am;
+
+                auto_ptr<wrapper::TCPAcceptor> acceptor(core::wrapper::POSIXReactorTCPFactoryWorker::createTCPAcceptor(20000));
+                acceptor->setAcceptorListener(&am);
+                acceptor->start();
+
+                auto_ptr<wrapper::TCPConnection> connection(core::wrapper::POSIXReactorTCPFactoryWorker::createTCPConnectionTo("127.0.0.1", 20000));
+                mocks::ConnectionListenerMock connectionListenerMock;
+                connection->setConnectionListener(&connectionListenerMock);
+                connection->start();
+
+                // The accepted connection is never started and does not consume any data.
+                TS_ASSERT(am.CALLWAITER_onNewConnection.wait());
+
+                const string data(1024*1024, 'x');
+                // Twice the limit as the sockets' buffers absorb some of the data.
+                const uint32_t CHUNKS = 2 * core::wrapper::POSIX::POSIXReactorTCPConnection::MAX_OUTPUT_BUFFER_SIZE / data.length();
+                for (uint32_t i = 0; i < CHUNKS; i++) {
+                    connection->send(data);
+                }
+
+                TS_ASSERT(connectionListenerMock.CALLWAITER_handleConnectionError.wait());
+            #endif
         }
 };
 
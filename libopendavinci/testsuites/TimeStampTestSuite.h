@@ -27,6 +27,7 @@
 #include <string>
 
 #include "core/data/TimeStamp.h"
+#include "core/wrapper/TimeFactory.h"
 
 using namespace std;
 using namespace core::data;
@@ -88,6 +89,45 @@ class TimeStampTest : public CxxTest::TestSuite {
             TS_ASSERT(ts2.getMinute() == 42);
             TS_ASSERT(ts2.getSecond() == 54);
         }
+
+        void testAddSubNanoseconds() {
+            TimeStamp ts1;
+            TimeStamp ts2(ts1);
+            TimeStamp ts3(1, 999999);
+
+            TS_ASSERT(ts1.getFractionalNanoseconds() / 1000 == ts1.getFractionalMicroseconds());
+            TS_ASSERT(ts1.toNanoseconds() / 1000 == ts1.toMicroseconds());
+
+            TimeStamp sum = ts1 + ts3;
+            TimeStamp delta = sum - ts2;
+
+            TS_ASSERT(delta.getSeconds() == 1);
+            TS_ASSERT(delta.getFractionalMicroseconds() == 999999);
+            TS_ASSERT(delta.getFractionalNanoseconds() == 999999000);
+            TS_ASSERT((sum - ts3).toNanoseconds() == ts1.toNanoseconds());
+        }
+
+        void testSerializationKeepsMicroseconds() {
+            TimeStamp ts1;
+
+            stringstream sstr;
+            sstr << ts1;
+
+            TimeStamp ts2(0, 0);
+            sstr >> ts2;
+
+            TS_ASSERT(ts1 == ts2);
+            TS_ASSERT(ts1.toString() == ts2.toString());
+            TS_ASSERT(ts2.getFractionalNanoseconds() == ts1.getFractionalMicroseconds() * 1000);
+        }
+
+        void testMonotonicClock() {
+            const int64_t t1 = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+            const int64_t t2 = core::wrapper::TimeFactory::getInstance().getMonotonicNanoseconds();
+
+            TS_ASSERT(t1 > 0);
+            TS_ASSERT(t2 >= t1);
+        }
 };
 
 #endif /*CORE_TIMESTAMPTESTSUITE_H_*/
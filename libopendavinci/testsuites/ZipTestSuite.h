@@ -89,6 +89,21 @@ class ZipTest : public CxxTest::TestSuite {
                 TS_ASSERT(decompressedData.str() == originalData.str());
             }
 
+            const char *buffer = NULL;
+            uint32_t length = 0;
+            TS_ASSERT(dd->getBufferFor("FILE1", buffer, length));
+            TS_ASSERT(length == 47);
+            TS_ASSERT(buffer != NULL);
+            if (buffer != NULL) {
+                TS_ASSERT(string(buffer, length) == "Dies ist ein Test.\nDies ist eine zweite Zeile.\n");
+            }
+
+            TS_ASSERT(dd->getBufferFor("directory/", buffer, length));
+            TS_ASSERT(length == 0);
+
+            TS_ASSERT(!dd->getBufferFor("file3", buffer, length));
+            TS_ASSERT(dd->getInputStreamFor("file3") == NULL);
+
             delete dd;
 
             UNLINK("ZipTest.zip");
@@ -0,0 +1,77 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_VEHICLEBATCH_H_
+#define VEHICLECONTEXT_VEHICLEBATCH_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+namespace vehiclecontext {
+
+    using namespace std;
+
+    /**
+     * This class executes a job file with the context::base::BatchRunner
+     * using VehicleBatchSimulations and writes the summary of all jobs.
+     *
+     * Usage: vehiclebatch --jobs=nightly.jobs [--configuration=configuration]
+     *                     [--workers=n] [--summary=file]
+     *
+     * The configuration file is shared by all jobs; without --summary,
+     * the summary is written to stdout.
+     */
+    class OPENDAVINCI_API VehicleBatch {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             */
+            VehicleBatch(const VehicleBatch &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             */
+            VehicleBatch& operator=(const VehicleBatch &/*obj*/);
+
+        public:
+            enum CONSTANTS {
+                DEFAULT_NUMBER_OF_WORKERS = 4
+            };
+
+            VehicleBatch();
+
+            virtual ~VehicleBatch();
+
+            /**
+             * This method executes the job file given on command line.
+             *
+             * @param argc Number of command line arguments.
+             * @param argv Command line arguments.
+             * @return 0 if all jobs passed.
+             */
+            int32_t run(const int32_t &argc, char **argv);
+    };
+
+} // vehiclecontext
+
+#endif /*VEHICLECONTEXT_VEHICLEBATCH_H_*/
@@ -0,0 +1,89 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_VEHICLEBATCHSIMULATION_H_
+#define VEHICLECONTEXT_VEHICLEBATCHSIMULATION_H_
+
+#include "context/base/BatchJob.h"
+#include "context/base/BatchSimulation.h"
+#include "context/base/BatchSimulationFactory.h"
+
+#include "vehiclecontext/model/SimplifiedBicycleModel.h"
+#include "vehiclecontext/report/DistanceToObjectsReport.h"
+
+namespace vehiclecontext {
+
+    using namespace std;
+
+    /**
+     * This class realizes one vehicle-related simulation for the
+     * context::base::BatchRunner. It uses the same configuration
+     * sections as VehicleRuntimeControl; additionally, the key
+     * vehiclecontext.report.distancetoobjects.threshold enables
+     * the DistanceToObjectsReport for the job.
+     */
+    class OPENDAVINCI_API VehicleBatchSimulation : public context::base::BatchSimulation {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             */
+            VehicleBatchSimulation(const VehicleBatchSimulation&);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             */
+            VehicleBatchSimulation& operator=(const VehicleBatchSimulation&);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param job Job to be simulated.
+             */
+            VehicleBatchSimulation(const context::base::BatchJob &job);
+
+            virtual ~VehicleBatchSimulation();
+
+            virtual void setUp(context::base::RuntimeEnvironment &rte);
+
+            virtual void tearDown();
+
+        private:
+            context::base::BatchJob m_job;
+            model::SimplifiedBicycleModel *m_simplifiedBicycleModel;
+            report::DistanceToObjectsReport *m_distanceToObjectsReport;
+    };
+
+    /**
+     * This class creates VehicleBatchSimulations.
+     */
+    class OPENDAVINCI_API VehicleBatchSimulationFactory : public context::base::BatchSimulationFactory {
+        public:
+            virtual ~VehicleBatchSimulationFactory();
+
+            virtual context::base::BatchSimulation* createSimulation(const context::base::BatchJob &job);
+    };
+
+} // vehiclecontext
+
+#endif /*VEHICLECONTEXT_VEHICLEBATCHSIMULATION_H_*/
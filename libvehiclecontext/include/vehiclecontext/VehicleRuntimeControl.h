@@ -62,6 +62,15 @@ namespace vehiclecontext {
 
             virtual ~VehicleRuntimeControl();
 
+            /**
+             * This method returns the appropriate configuration data
+             * from the given global configuration.
+             *
+             * @param globalConfiguration Configuration to extract the module's configuration from.
+             * @param module Module to get configuration for.
+             */
+            static const core::base::KeyValueConfiguration getConfigurationFor(const core::base::KeyValueConfiguration &globalConfiguration, const enum VEHICLECONTEXTMODULES &module);
+
         private:
             core::base::KeyValueConfiguration m_globalConfiguration;
 
@@ -31,6 +31,7 @@
 #include "hesperia/data/environment/Polygon.h"
 
 #include "vehiclecontext/model/PointSensor.h"
+#include "vehiclecontext/model/PolygonGrid.h"
 
 namespace vehiclecontext {
     namespace model {
@@ -83,6 +84,11 @@ namespace vehiclecontext {
 
                 virtual void step(const core::wrapper::Time &t, context::base::SendContainerToSystemsUnderTest &sender);
 
+            protected:
+                virtual void storeState(ostream &out) const;
+
+                virtual void restoreState(istream &in);
+
             private:
                 core::base::KeyValueConfiguration m_kvc;
                 float m_freq;
@@ -91,6 +97,7 @@ namespace vehiclecontext {
 
                 uint32_t m_numberOfPolygons;
                 map<uint32_t, hesperia::data::environment::Polygon> m_mapOfPolygons;
+                PolygonGrid m_polygonGrid;
                 vector<uint32_t> m_listOfPolygonsInsideFOV;
                 map<string, PointSensor*> m_mapOfPointSensors;
                 map<string, double> m_distances;
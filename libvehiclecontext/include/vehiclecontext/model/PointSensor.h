@@ -22,10 +22,13 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "core/data/environment/Point3.h"
 #include "hesperia/data/environment/Polygon.h"
 
+#include "vehiclecontext/model/PolygonGrid.h"
+
 namespace vehiclecontext {
     namespace model {
 
@@ -90,6 +93,17 @@ namespace vehiclecontext {
                  */
                 double getDistance(map<uint32_t, hesperia::data::environment::Polygon> &mapOfPolygons);
 
+                /**
+                 * This methods calculates the distance by testing only
+                 * those polygons from the spatial index that overlap
+                 * the bounding box of the FOV.
+                 *
+                 * @param grid Spatial index of the polygons.
+                 * @param candidates Scratch buffer for the candidate polygons to avoid allocations per call.
+                 * @return distance to the closest line or -1.
+                 */
+                double getDistance(PolygonGrid &grid, vector<uint32_t> &candidates);
+
                 bool hasShowFOV() const;
 
                 const string getName() const;
@@ -114,9 +128,30 @@ namespace vehiclecontext {
                 double m_totalRotation;
 
                 hesperia::data::environment::Polygon m_FOV;
+                double m_FOVMinX;
+                double m_FOVMinY;
+                double m_FOVMaxX;
+                double m_FOVMaxY;
                 core::data::environment::Point3 m_sensorPosition;
 
                 bool isInFOV(const core::data::environment::Point3 &pt) const;
+
+                /**
+                 * This method intersects the FOV with the given polygon
+                 * and updates the distance to the nearest point.
+                 *
+                 * @param p Polygon.
+                 * @param distanceToSensor Current distance (-1 if nothing was found so far).
+                 */
+                void updateDistance(const hesperia::data::environment::Polygon &p, double &distanceToSensor) const;
+
+                /**
+                 * This method clamps the distance and applies the fault model.
+                 *
+                 * @param distanceToSensor Distance to the closest point or -1.
+                 * @return Distance to be reported.
+                 */
+                double applyFaultModel(double distanceToSensor);
         };
 
     }
@@ -0,0 +1,156 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_MODEL_POLYGONGRID_H_
+#define VEHICLECONTEXT_MODEL_POLYGONGRID_H_
+
+#include <map>
+#include <vector>
+
+#include "hesperia/data/environment/Polygon.h"
+
+namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+
+        /**
+         * This class provides a static 2D spatial index for polygons
+         * based on a uniform grid. Every polygon is registered in all
+         * cells covered by its axis-aligned bounding box. Queries return
+         * every polygon whose bounding box overlaps the queried area
+         * exactly once.
+         */
+        class PolygonGrid {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                PolygonGrid(const PolygonGrid &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                PolygonGrid& operator=(const PolygonGrid &/*obj*/);
+
+            public:
+                enum {
+                    MAX_NUMBER_OF_CELLS = 1024 * 1024
+                };
+
+                PolygonGrid();
+
+                virtual ~PolygonGrid();
+
+                /**
+                 * This method builds the grid for the given polygons.
+                 * If the given cell size would exceed MAX_NUMBER_OF_CELLS,
+                 * the cell size is increased accordingly.
+                 *
+                 * @param mapOfPolygons Polygons to be indexed.
+                 * @param cellSize Edge length of a cell in meters.
+                 */
+                void build(const map<uint32_t, hesperia::data::environment::Polygon> &mapOfPolygons, const double &cellSize);
+
+                /**
+                 * This method removes all polygons.
+                 */
+                void clear();
+
+                /**
+                 * This method collects the indices of all polygons whose
+                 * bounding box overlaps the given area.
+                 *
+                 * @param minX Minimum X of the area.
+                 * @param minY Minimum Y of the area.
+                 * @param maxX Maximum X of the area.
+                 * @param maxY Maximum Y of the area.
+                 * @param candidates Vector to be filled with the indices (it is cleared first).
+                 */
+                void query(const double &minX, const double &minY, const double &maxX, const double &maxY, vector<uint32_t> &candidates);
+
+                /**
+                 * This method returns the polygon for the given index.
+                 *
+                 * @param index Index as returned by query.
+                 * @return Polygon.
+                 */
+                const hesperia::data::environment::Polygon& getPolygon(const uint32_t &index) const;
+
+                /**
+                 * @return Number of indexed polygons.
+                 */
+                uint32_t getNumberOfPolygons() const;
+
+                /**
+                 * @return Edge length of a cell in meters.
+                 */
+                double getCellSize() const;
+
+            private:
+                /**
+                 * This class describes an axis-aligned bounding box.
+                 */
+                class BoundingBox {
+                    public:
+                        BoundingBox();
+
+                        double m_minX;
+                        double m_minY;
+                        double m_maxX;
+                        double m_maxY;
+                };
+
+                /**
+                 * This method computes the cell range for the given area
+                 * clamped to the grid.
+                 *
+                 * @return false if the area does not overlap the grid.
+                 */
+                bool getCellRange(const double &minX, const double &minY, const double &maxX, const double &maxY,
+                                  int32_t &firstColumn, int32_t &firstRow, int32_t &lastColumn, int32_t &lastRow) const;
+
+                vector<hesperia::data::environment::Polygon> m_polygons;
+                vector<BoundingBox> m_boundingBoxes;
+
+                double m_cellSize;
+                double m_originX;
+                double m_originY;
+                int32_t m_columns;
+                int32_t m_rows;
+                vector<vector<uint32_t> > m_cells;
+
+                // Query stamps to report every polygon only once per query without allocating.
+                vector<uint32_t> m_queryStamps;
+                uint32_t m_currentQueryStamp;
+        };
+
+    }
+} // vehiclecontext::model
+
+#endif /*VEHICLECONTEXT_MODEL_POLYGONGRID_H_*/
@@ -81,6 +81,11 @@ namespace vehiclecontext {
 
                 virtual void step(const core::wrapper::Time &t, context::base::SendContainerToSystemsUnderTest &sender);
 
+            protected:
+                virtual void storeState(ostream &out) const;
+
+                virtual void restoreState(istream &in);
+
             private:
                 core::base::KeyValueConfiguration m_kvc;
                 float m_freq;
@@ -77,6 +77,13 @@ namespace vehiclecontext {
                  */
                 bool hasCorrectDistance() const;
 
+                virtual bool hasCorrectlyWorked() const;
+
+            protected:
+                virtual void storeState(ostream &out) const;
+
+                virtual void restoreState(istream &in);
+
             private:
                 core::base::KeyValueConfiguration m_configuration;
                 const float m_threshold;
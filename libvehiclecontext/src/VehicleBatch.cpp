@@ -0,0 +1,126 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "core/StringToolbox.h"
+#include "core/base/CommandLineParser.h"
+#include "core/base/KeyValueConfiguration.h"
+#include "context/base/BatchJob.h"
+#include "context/base/BatchResult.h"
+#include "context/base/BatchRunner.h"
+
+#include "vehiclecontext/VehicleBatch.h"
+#include "vehiclecontext/VehicleBatchSimulation.h"
+
+namespace vehiclecontext {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace context::base;
+
+    VehicleBatch::VehicleBatch() {}
+
+    VehicleBatch::~VehicleBatch() {}
+
+    int32_t VehicleBatch::run(const int32_t &argc, char **argv) {
+        CommandLineParser cmdParser;
+        cmdParser.addCommandLineArgument("jobs");
+        cmdParser.addCommandLineArgument("configuration");
+        cmdParser.addCommandLineArgument("workers");
+        cmdParser.addCommandLineArgument("summary");
+
+        cmdParser.parse(argc, argv);
+
+        CommandLineArgument cmdArgumentJOBS = cmdParser.getCommandLineArgument("jobs");
+        CommandLineArgument cmdArgumentCONFIGURATION = cmdParser.getCommandLineArgument("configuration");
+        CommandLineArgument cmdArgumentWORKERS = cmdParser.getCommandLineArgument("workers");
+        CommandLineArgument cmdArgumentSUMMARY = cmdParser.getCommandLineArgument("summary");
+
+        if (!cmdArgumentJOBS.isSet()) {
+            cerr << "Usage: " << argv[0] << " --jobs=nightly.jobs [--configuration=configuration] [--workers=n] [--summary=file]" << endl;
+            return 1;
+        }
+
+        string jobsFileName = cmdArgumentJOBS.getValue<string>();
+        core::StringToolbox::trim(jobsFileName);
+
+        string configurationFileName = "configuration";
+        if (cmdArgumentCONFIGURATION.isSet()) {
+            configurationFileName = cmdArgumentCONFIGURATION.getValue<string>();
+            core::StringToolbox::trim(configurationFileName);
+        }
+
+        uint32_t numberOfWorkers = VehicleBatch::DEFAULT_NUMBER_OF_WORKERS;
+        if (cmdArgumentWORKERS.isSet()) {
+            numberOfWorkers = max(cmdArgumentWORKERS.getValue<uint32_t>(), static_cast<uint32_t>(1));
+        }
+
+        KeyValueConfiguration baseConfiguration;
+        ifstream configurationStream(configurationFileName.c_str(), ios::in);
+        if (!configurationStream.good()) {
+            cerr << "(vehiclecontext) Could not open configuration " << configurationFileName << "." << endl;
+            return 1;
+        }
+        configurationStream >> baseConfiguration;
+
+        ifstream jobsStream(jobsFileName.c_str(), ios::in);
+        if (!jobsStream.good()) {
+            cerr << "(vehiclecontext) Could not open jobs " << jobsFileName << "." << endl;
+            return 1;
+        }
+        const vector<BatchJob> jobs = BatchRunner::readJobs(jobsStream, baseConfiguration);
+        if (jobs.empty()) {
+            cerr << "(vehiclecontext) " << jobsFileName << " does not contain any valid job." << endl;
+            return 1;
+        }
+
+        VehicleBatchSimulationFactory factory;
+        BatchRunner runner(factory, numberOfWorkers);
+        const vector<BatchResult> results = runner.run(jobs);
+
+        if (cmdArgumentSUMMARY.isSet()) {
+            string summaryFileName = cmdArgumentSUMMARY.getValue<string>();
+            core::StringToolbox::trim(summaryFileName);
+
+            ofstream summaryStream(summaryFileName.c_str(), ios::out | ios::trunc);
+            BatchRunner::writeSummary(summaryStream, results);
+            if (!summaryStream.good()) {
+                cerr << "(vehiclecontext) Could not write summary " << summaryFileName << "." << endl;
+                return 1;
+            }
+        }
+        else {
+            BatchRunner::writeSummary(cout, results);
+        }
+
+        // Fail if any job did not pass.
+        vector<BatchResult>::const_iterator it = results.begin();
+        while (it != results.end()) {
+            if (!(*it++).hasPassed()) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+} // vehiclecontext
@@ -0,0 +1,90 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <sstream>
+
+#include "core/macros.h"
+#include "core/exceptions/Exceptions.h"
+
+#include "vehiclecontext/VehicleBatchSimulation.h"
+#include "vehiclecontext/VehicleRuntimeControl.h"
+
+namespace vehiclecontext {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace context::base;
+    using namespace vehiclecontext::model;
+    using namespace vehiclecontext::report;
+
+    VehicleBatchSimulation::VehicleBatchSimulation(const BatchJob &job) :
+        m_job(job),
+        m_simplifiedBicycleModel(NULL),
+        m_distanceToObjectsReport(NULL) {}
+
+    VehicleBatchSimulation::~VehicleBatchSimulation() {
+        tearDown();
+    }
+
+    void VehicleBatchSimulation::setUp(RuntimeEnvironment &rte) {
+        const KeyValueConfiguration globalConfiguration = m_job.getConfiguration();
+
+        const KeyValueConfiguration kvcSimplifiedBicycleModel = VehicleRuntimeControl::getConfigurationFor(globalConfiguration, VehicleRuntimeControl::SIMPLIFIEDBICYCLEMODEL);
+        if (kvcSimplifiedBicycleModel.getListOfKeys().size() == 0) {
+            stringstream s;
+            s << "(vehiclecontext) No configuration for 'SimplifiedBicycleModel' in job '" << m_job.getName() << "'.";
+            throw s.str();
+        }
+
+        stringstream config;
+        config << kvcSimplifiedBicycleModel;
+        m_simplifiedBicycleModel = new SimplifiedBicycleModel(config.str());
+        rte.add(*m_simplifiedBicycleModel);
+
+        // The report is optional; any other error while creating it fails the job.
+        bool hasReport = false;
+        float threshold = 0;
+        try {
+            threshold = globalConfiguration.getValue<float>("vehiclecontext.report.distancetoobjects.threshold");
+            hasReport = true;
+        }
+        catch(const core::exceptions::ValueForKeyNotFoundException &) {}
+
+        if (hasReport) {
+            stringstream reportConfig;
+            reportConfig << globalConfiguration;
+            m_distanceToObjectsReport = new DistanceToObjectsReport(reportConfig.str(), threshold);
+            rte.add(*m_distanceToObjectsReport);
+        }
+    }
+
+    void VehicleBatchSimulation::tearDown() {
+        OPENDAVINCI_CORE_DELETE_POINTER(m_distanceToObjectsReport);
+        OPENDAVINCI_CORE_DELETE_POINTER(m_simplifiedBicycleModel);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    VehicleBatchSimulationFactory::~VehicleBatchSimulationFactory() {}
+
+    BatchSimulation* VehicleBatchSimulationFactory::createSimulation(const BatchJob &job) {
+        return new VehicleBatchSimulation(job);
+    }
+
+} // vehiclecontext
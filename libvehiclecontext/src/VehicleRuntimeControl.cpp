@@ -40,12 +40,16 @@ namespace vehiclecontext {
     VehicleRuntimeControl::~VehicleRuntimeControl() {}
 
     const KeyValueConfiguration VehicleRuntimeControl::getConfigurationFor(const enum VEHICLECONTEXTMODULES &module) {
+        return getConfigurationFor(m_globalConfiguration, module);
+    }
+
+    const KeyValueConfiguration VehicleRuntimeControl::getConfigurationFor(const KeyValueConfiguration &globalConfiguration, const enum VEHICLECONTEXTMODULES &module) {
         KeyValueConfiguration config;
 
         switch (module) {
             case VehicleRuntimeControl::SIMPLIFIEDBICYCLEMODEL:
             {
-                KeyValueConfiguration simplifiedBicycleModelSubset = m_globalConfiguration.getSubsetForSection("vehiclecontext.simplifiedbicyclemodel");
+                KeyValueConfiguration simplifiedBicycleModelSubset = globalConfiguration.getSubsetForSection("vehiclecontext.simplifiedbicyclemodel");
                 if (simplifiedBicycleModelSubset.getListOfKeys().size() > 0) {
                     // Remove leading "vehiclecontext.".
                     config = simplifiedBicycleModelSubset.getSubsetForSectionRemoveLeadingSectionName("vehiclecontext.");
@@ -55,7 +59,7 @@ namespace vehiclecontext {
         }
 
         // Add global.*.
-        KeyValueConfiguration globalConfig = m_globalConfiguration.getSubsetForSection("global");
+        KeyValueConfiguration globalConfig = globalConfiguration.getSubsetForSection("global");
         stringstream fusedConfig;
         fusedConfig << globalConfig << endl;
         fusedConfig << config;
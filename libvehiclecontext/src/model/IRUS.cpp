@@ -23,8 +23,12 @@
 #include <sstream>
 
 #include "core/macros.h"
+#include "core/base/Deserializer.h"
+#include "core/base/Hash.h"
 #include "core/base/KeyValueConfiguration.h"
 #include "core/base/KeyValueDataStore.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
 #include "core/io/URL.h"
@@ -70,6 +74,7 @@ namespace vehiclecontext {
             m_egoState(),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_polygonGrid(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -88,6 +93,7 @@ namespace vehiclecontext {
             m_egoState(),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_polygonGrid(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -110,7 +116,7 @@ namespace vehiclecontext {
             // Load scenario.
             const URL urlOfSCNXFile(m_kvc.getValue<string>("global.scenario"));
             if (urlOfSCNXFile.isValid()) {
-                SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
+                SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile, m_kvc);
 
                 hesperia::data::scenario::Scenario &scenario = scnxArchive.getScenario();
 
@@ -141,6 +147,7 @@ namespace vehiclecontext {
             }
 
             // Setup all point sensors.
+            double maxDistanceFOV = 1;
             for (uint32_t i = 0; i < m_kvc.getValue<uint32_t>("irus.numberOfSensors"); i++) {
                 stringstream sensorID;
                 sensorID << "irus.sensor" << i << ".id";
@@ -165,6 +172,7 @@ namespace vehiclecontext {
                 stringstream sensorDistanceFOV;
                 sensorDistanceFOV << "irus.sensor" << i << ".distanceFOV";
                 const double distanceFOV = m_kvc.getValue<double>(sensorDistanceFOV.str());
+                maxDistanceFOV = max(maxDistanceFOV, distanceFOV);
                 
                 stringstream sensorClampDistance;
                 sensorClampDistance << "irus.sensor" << i << ".clampDistance";
@@ -217,6 +225,12 @@ namespace vehiclecontext {
                     cout << "[IRUS] Registered point sensor " << ps->toString() << "." << endl;
                 }
             }
+
+            // Build the spatial index for the polygons once; the cells are
+            // sized to the largest FOV so that a query covers only few cells.
+            m_polygonGrid.build(m_mapOfPolygons, maxDistanceFOV);
+            m_listOfPolygonsInsideFOV.reserve(m_polygonGrid.getNumberOfPolygons());
+            cout << "[IRUS] Indexed " << m_polygonGrid.getNumberOfPolygons() << " polygons using a grid with cells of " << m_polygonGrid.getCellSize() << "m." << endl;
         }
 
         void IRUS::tearDown() {
@@ -227,6 +241,8 @@ namespace vehiclecontext {
                 OPENDAVINCI_CORE_DELETE_POINTER(sensor);           
             }
             m_mapOfPointSensors.clear();
+
+            m_polygonGrid.clear();
         }
 
         void IRUS::step(const core::wrapper::Time &t, SendContainerToSystemsUnderTest &sender) {
@@ -257,7 +273,7 @@ namespace vehiclecontext {
                 m_FOVs[sensor->getName()] = FOV;
 
                 // Calculate distance.
-                m_distances[sensor->getName()] = sensor->getDistance(m_mapOfPolygons);
+                m_distances[sensor->getName()] = sensor->getDistance(m_polygonGrid, m_listOfPolygonsInsideFOV);
                 cerr << sensor->getName() << ": " << m_distances[sensor->getName()] << endl;
 
                 // MSV: Store data for sensorboard.
@@ -290,5 +306,25 @@ namespace vehiclecontext {
             }
         }
 
+
+        void IRUS::storeState(ostream &out) const {
+            // FOVs and distances are recomputed from the EgoState in every step.
+            SerializationFactory sf;
+
+            Serializer &s = sf.getSerializer(out);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('e', 'g', 'o') >::RESULT,
+                    m_egoState);
+        }
+
+        void IRUS::restoreState(istream &in) {
+            SerializationFactory sf;
+
+            Deserializer &d = sf.getDeserializer(in);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('e', 'g', 'o') >::RESULT,
+                   m_egoState);
+        }
+
     }
 } // vehiclecontext::model
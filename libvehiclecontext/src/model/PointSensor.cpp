@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>
 #include <cmath>
 #include <strstream>
 
@@ -46,6 +47,10 @@ namespace vehiclecontext {
             m_faultModelNoise(faultModelNoise),
             m_totalRotation(0),
             m_FOV(),
+            m_FOVMinX(0),
+            m_FOVMinY(0),
+            m_FOVMaxX(0),
+            m_FOVMaxY(0),
             m_sensorPosition()
         {}
 
@@ -78,6 +83,12 @@ namespace vehiclecontext {
             FOV.add(m_sensorPosition);
             m_FOV = FOV;
 
+            // Bounding box of the FOV for querying the spatial index.
+            m_FOVMinX = min(m_sensorPosition.getX(), min(leftBoundaryFOV.getX(), rightBoundaryFOV.getX()));
+            m_FOVMinY = min(m_sensorPosition.getY(), min(leftBoundaryFOV.getY(), rightBoundaryFOV.getY()));
+            m_FOVMaxX = max(m_sensorPosition.getX(), max(leftBoundaryFOV.getX(), rightBoundaryFOV.getX()));
+            m_FOVMaxY = max(m_sensorPosition.getY(), max(leftBoundaryFOV.getY(), rightBoundaryFOV.getY()));
+
             return m_FOV;
         }
 
@@ -114,38 +125,55 @@ namespace vehiclecontext {
             return retVal;
         }
 
+        void PointSensor::updateDistance(const Polygon &p, double &distanceToSensor) const {
+            // Get overlapping parts of polygon...
+            Polygon contour = m_FOV.intersectIgnoreZ(p);
+
+            if (contour.getSize() > 0) {
+                // Get nearest point from contour.
+                const vector<Point3> &listOfPoints = contour.getVertices();
+                vector<Point3>::const_iterator jt = listOfPoints.begin();
+
+                while (jt != listOfPoints.end()) {
+                    const Point3 &pt = (*jt++);
+                    double d = (pt - m_sensorPosition).lengthXY();
+
+                    if (isInFOV(pt)) {
+                        if ((distanceToSensor < 0) || (d < distanceToSensor)) {
+                            distanceToSensor = d;
+                        }
+                    }
+                }
+            }
+        }
+
         double PointSensor::getDistance(map<uint32_t, hesperia::data::environment::Polygon> &mapOfPolygons) {
-            Point3 nearest;
             double distanceToSensor = -1;
 
             map<uint32_t, hesperia::data::environment::Polygon>::const_iterator it = mapOfPolygons.begin();
             while (it != mapOfPolygons.end()) {
-                Polygon p = it->second;
-
-                // Get overlapping parts of polygon...
-                Polygon contour = m_FOV.intersectIgnoreZ(p);
+                updateDistance(it->second, distanceToSensor);
+                it++;
+            }
 
-                if (contour.getSize() > 0) {
-                    // Get nearest point from contour.
-                    const vector<Point3> listOfPoints = contour.getVertices();
-                    vector<Point3>::const_iterator jt = listOfPoints.begin();
+            return applyFaultModel(distanceToSensor);
+        }
 
-                    while (jt != listOfPoints.end()) {
-                        Point3 pt = (*jt++);
-                        double d = (pt - m_sensorPosition).lengthXY();
+        double PointSensor::getDistance(PolygonGrid &grid, vector<uint32_t> &candidates) {
+            double distanceToSensor = -1;
 
-                        if (isInFOV(pt)) {
-                            if ((distanceToSensor < 0) || (d < distanceToSensor)) {
-                                nearest = pt;
-                                distanceToSensor = d;
-                            }
-                        }
-                    }
-                }
+            // Only test the polygons overlapping the FOV's bounding box.
+            grid.query(m_FOVMinX, m_FOVMinY, m_FOVMaxX, m_FOVMaxY, candidates);
 
-                it++;
+            vector<uint32_t>::const_iterator it = candidates.begin();
+            while (it != candidates.end()) {
+                updateDistance(grid.getPolygon(*it++), distanceToSensor);
             }
 
+            return applyFaultModel(distanceToSensor);
+        }
+
+        double PointSensor::applyFaultModel(double distanceToSensor) {
             if (distanceToSensor > m_clampDistance) {
                 distanceToSensor = -1;
             }
@@ -0,0 +1,212 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "vehiclecontext/model/PolygonGrid.h"
+
+namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+        using namespace core::data::environment;
+        using namespace hesperia::data::environment;
+
+        PolygonGrid::BoundingBox::BoundingBox() :
+            m_minX(0),
+            m_minY(0),
+            m_maxX(0),
+            m_maxY(0) {}
+
+        PolygonGrid::PolygonGrid() :
+            m_polygons(),
+            m_boundingBoxes(),
+            m_cellSize(1),
+            m_originX(0),
+            m_originY(0),
+            m_columns(0),
+            m_rows(0),
+            m_cells(),
+            m_queryStamps(),
+            m_currentQueryStamp(0) {}
+
+        PolygonGrid::~PolygonGrid() {}
+
+        void PolygonGrid::clear() {
+            m_polygons.clear();
+            m_boundingBoxes.clear();
+            m_cells.clear();
+            m_queryStamps.clear();
+            m_currentQueryStamp = 0;
+            m_columns = 0;
+            m_rows = 0;
+        }
+
+        void PolygonGrid::build(const map<uint32_t, Polygon> &mapOfPolygons, const double &cellSize) {
+            clear();
+
+            // Compute the bounding boxes of all polygons and of the whole scenario.
+            BoundingBox extent;
+            bool hasExtent = false;
+
+            map<uint32_t, Polygon>::const_iterator it = mapOfPolygons.begin();
+            while (it != mapOfPolygons.end()) {
+                const Polygon &p = it->second;
+                const vector<Point3> &listOfVertices = p.getVertices();
+
+                if (listOfVertices.size() > 0) {
+                    BoundingBox bb;
+                    bb.m_minX = bb.m_maxX = listOfVertices.front().getX();
+                    bb.m_minY = bb.m_maxY = listOfVertices.front().getY();
+
+                    vector<Point3>::const_iterator jt = listOfVertices.begin();
+                    while (jt != listOfVertices.end()) {
+                        bb.m_minX = min(bb.m_minX, jt->getX());
+                        bb.m_minY = min(bb.m_minY, jt->getY());
+                        bb.m_maxX = max(bb.m_maxX, jt->getX());
+                        bb.m_maxY = max(bb.m_maxY, jt->getY());
+                        jt++;
+                    }
+
+                    if (!hasExtent) {
+                        extent = bb;
+                        hasExtent = true;
+                    }
+                    else {
+                        extent.m_minX = min(extent.m_minX, bb.m_minX);
+                        extent.m_minY = min(extent.m_minY, bb.m_minY);
+                        extent.m_maxX = max(extent.m_maxX, bb.m_maxX);
+                        extent.m_maxY = max(extent.m_maxY, bb.m_maxY);
+                    }
+
+                    m_polygons.push_back(p);
+                    m_boundingBoxes.push_back(bb);
+                }
+                it++;
+            }
+
+            if (!hasExtent) {
+                return;
+            }
+
+            // Determine the grid's dimension and limit the number of cells.
+            m_cellSize = (cellSize > 0) ? cellSize : 1;
+            const double width = (extent.m_maxX - extent.m_minX);
+            const double height = (extent.m_maxY - extent.m_minY);
+            while (((floor(width / m_cellSize) + 1) * (floor(height / m_cellSize) + 1)) > MAX_NUMBER_OF_CELLS) {
+                m_cellSize *= 2;
+            }
+
+            m_originX = extent.m_minX;
+            m_originY = extent.m_minY;
+            m_columns = static_cast<int32_t>(floor(width / m_cellSize)) + 1;
+            m_rows = static_cast<int32_t>(floor(height / m_cellSize)) + 1;
+            m_cells.resize(m_columns * m_rows);
+            m_queryStamps.resize(m_polygons.size(), 0);
+
+            // Register every polygon in all cells covered by its bounding box.
+            for (uint32_t i = 0; i < m_polygons.size(); i++) {
+                const BoundingBox &bb = m_boundingBoxes[i];
+
+                int32_t firstColumn = 0, firstRow = 0, lastColumn = 0, lastRow = 0;
+                if (getCellRange(bb.m_minX, bb.m_minY, bb.m_maxX, bb.m_maxY, firstColumn, firstRow, lastColumn, lastRow)) {
+                    for (int32_t row = firstRow; row <= lastRow; row++) {
+                        for (int32_t column = firstColumn; column <= lastColumn; column++) {
+                            m_cells[row * m_columns + column].push_back(i);
+                        }
+                    }
+                }
+            }
+        }
+
+        bool PolygonGrid::getCellRange(const double &minX, const double &minY, const double &maxX, const double &maxY,
+                                       int32_t &firstColumn, int32_t &firstRow, int32_t &lastColumn, int32_t &lastRow) const {
+            if ( (m_columns == 0) || (m_rows == 0) ) {
+                return false;
+            }
+
+            firstColumn = static_cast<int32_t>(floor((minX - m_originX) / m_cellSize));
+            firstRow = static_cast<int32_t>(floor((minY - m_originY) / m_cellSize));
+            lastColumn = static_cast<int32_t>(floor((maxX - m_originX) / m_cellSize));
+            lastRow = static_cast<int32_t>(floor((maxY - m_originY) / m_cellSize));
+
+            if ( (lastColumn < 0) || (lastRow < 0) || (firstColumn >= m_columns) || (firstRow >= m_rows) ) {
+                return false;
+            }
+
+            firstColumn = max(firstColumn, 0);
+            firstRow = max(firstRow, 0);
+            lastColumn = min(lastColumn, m_columns - 1);
+            lastRow = min(lastRow, m_rows - 1);
+
+            return true;
+        }
+
+        void PolygonGrid::query(const double &minX, const double &minY, const double &maxX, const double &maxY, vector<uint32_t> &candidates) {
+            candidates.clear();
+
+            int32_t firstColumn = 0, firstRow = 0, lastColumn = 0, lastRow = 0;
+            if (!getCellRange(minX, minY, maxX, maxY, firstColumn, firstRow, lastColumn, lastRow)) {
+                return;
+            }
+
+            m_currentQueryStamp++;
+            if (m_currentQueryStamp == 0) {
+                // Stamps wrapped around; reset all of them.
+                fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+                m_currentQueryStamp = 1;
+            }
+
+            for (int32_t row = firstRow; row <= lastRow; row++) {
+                for (int32_t column = firstColumn; column <= lastColumn; column++) {
+                    const vector<uint32_t> &cell = m_cells[row * m_columns + column];
+
+                    vector<uint32_t>::const_iterator it = cell.begin();
+                    while (it != cell.end()) {
+                        const uint32_t index = (*it++);
+                        if (m_queryStamps[index] != m_currentQueryStamp) {
+                            m_queryStamps[index] = m_currentQueryStamp;
+
+                            // Check the bounding box as the cells are coarser than the query.
+                            const BoundingBox &bb = m_boundingBoxes[index];
+                            if ( (bb.m_maxX >= minX) && (bb.m_minX <= maxX) &&
+                                 (bb.m_maxY >= minY) && (bb.m_minY <= maxY) ) {
+                                candidates.push_back(index);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        const Polygon& PolygonGrid::getPolygon(const uint32_t &index) const {
+            return m_polygons.at(index);
+        }
+
+        uint32_t PolygonGrid::getNumberOfPolygons() const {
+            return m_polygons.size();
+        }
+
+        double PolygonGrid::getCellSize() const {
+            return m_cellSize;
+        }
+
+    }
+} // vehiclecontext::model
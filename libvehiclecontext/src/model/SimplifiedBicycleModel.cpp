@@ -22,6 +22,10 @@
 #include <iomanip>
 #include <sstream>
 
+#include "core/base/Deserializer.h"
+#include "core/base/Hash.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
 #include "core/data/Constants.h"
 #include "core/exceptions/Exceptions.h"
 
@@ -291,5 +295,90 @@ namespace vehiclecontext {
             m_previousTime = currentTime;
         }
 
+
+        void SimplifiedBicycleModel::storeState(ostream &out) const {
+            SerializationFactory sf;
+
+            Serializer &s = sf.getSerializer(out);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('e', 's', 'u', 'm') >::RESULT,
+                    m_esum);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL6('d', 's', 'p', 'e', 'e', 'd') >::RESULT,
+                    m_desiredSpeed);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('d', 'a', 'c', 'c') >::RESULT,
+                    m_desiredAcceleration);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL6('d', 's', 't', 'e', 'e', 'r') >::RESULT,
+                    m_desiredSteer);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('s', 'p', 'e', 'e', 'd') >::RESULT,
+                    m_speed);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('p', 't', 'i', 'm', 'e') >::RESULT,
+                    m_previousTime);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', 'o', 's') >::RESULT,
+                    m_oldPosition);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('o', 'r', 'i') >::RESULT,
+                    m_orientation);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('h', 'e', 'a', 'd') >::RESULT,
+                    m_heading);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('v', 'd') >::RESULT,
+                    m_vehicleData);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('v', 'c') >::RESULT,
+                    m_vehicleControl);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('h', 'a', 's', 'v', 'c') >::RESULT,
+                    m_hasReceivedVehicleControl);
+        }
+
+        void SimplifiedBicycleModel::restoreState(istream &in) {
+            SerializationFactory sf;
+
+            Deserializer &d = sf.getDeserializer(in);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('e', 's', 'u', 'm') >::RESULT,
+                   m_esum);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL6('d', 's', 'p', 'e', 'e', 'd') >::RESULT,
+                   m_desiredSpeed);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('d', 'a', 'c', 'c') >::RESULT,
+                   m_desiredAcceleration);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL6('d', 's', 't', 'e', 'e', 'r') >::RESULT,
+                   m_desiredSteer);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('s', 'p', 'e', 'e', 'd') >::RESULT,
+                   m_speed);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('p', 't', 'i', 'm', 'e') >::RESULT,
+                   m_previousTime);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('p', 'o', 's') >::RESULT,
+                   m_oldPosition);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL3('o', 'r', 'i') >::RESULT,
+                   m_orientation);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('h', 'e', 'a', 'd') >::RESULT,
+                   m_heading);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('v', 'd') >::RESULT,
+                   m_vehicleData);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('v', 'c') >::RESULT,
+                   m_vehicleControl);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('h', 'a', 's', 'v', 'c') >::RESULT,
+                   m_hasReceivedVehicleControl);
+        }
+
     }
 } // vehiclecontext::model
@@ -20,7 +20,11 @@
 #include <sstream>
 #include <vector>
 
+#include "core/base/Deserializer.h"
+#include "core/base/Hash.h"
 #include "core/base/KeyValueDataStore.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
 #include "core/data/Constants.h"
 #include "hesperia/data/environment/EgoState.h"
 #include "hesperia/data/environment/Line.h"
@@ -59,6 +63,10 @@ namespace vehiclecontext {
             return m_correctDistance;
         }
 
+        bool DistanceToObjectsReport::hasCorrectlyWorked() const {
+            return hasCorrectDistance();
+        }
+
         void DistanceToObjectsReport::report(const core::wrapper::Time &t) {
             cerr << "Call to DistanceToObjectsReport for t = " << t.getSeconds() << "." << t.getPartialMicroseconds() << ", containing " << getFIFO().getSize() << " containers." << endl;
 
@@ -120,5 +128,24 @@ namespace vehiclecontext {
             }
         }
 
+
+        void DistanceToObjectsReport::storeState(ostream &out) const {
+            SerializationFactory sf;
+
+            Serializer &s = sf.getSerializer(out);
+
+            s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('c', 'o', 'r', 'r') >::RESULT,
+                    m_correctDistance);
+        }
+
+        void DistanceToObjectsReport::restoreState(istream &in) {
+            SerializationFactory sf;
+
+            Deserializer &d = sf.getDeserializer(in);
+
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('c', 'o', 'r', 'r') >::RESULT,
+                   m_correctDistance);
+        }
+
     }
 } // vehiclecontext::report
@@ -0,0 +1,161 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_POLYGONGRIDTESTSUITE_H_
+#define VEHICLECONTEXT_POLYGONGRIDTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/Polygon.h"
+#include "vehiclecontext/model/PolygonGrid.h"
+
+using namespace std;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+using namespace vehiclecontext::model;
+
+class PolygonGridTest : public CxxTest::TestSuite {
+    public:
+        double random(const double &minimum, const double &maximum) {
+            return minimum + (maximum - minimum) * (static_cast<double>(rand()) / RAND_MAX);
+        }
+
+        map<uint32_t, Polygon> createRandomPolygons(const uint32_t &numberOfPolygons) {
+            map<uint32_t, Polygon> mapOfPolygons;
+            for (uint32_t i = 0; i < numberOfPolygons; i++) {
+                Polygon p;
+
+                // Every 50th polygon is empty and must not be indexed.
+                if ((i % 50) != 0) {
+                    const double x = random(-500, 500);
+                    const double y = random(-300, 300);
+                    const double size = random(0, 25);
+                    const uint32_t numberOfVertices = 3 + (rand() % 4);
+                    for (uint32_t j = 0; j < numberOfVertices; j++) {
+                        p.add(Point3(x + random(-size, size), y + random(-size, size), 0));
+                    }
+                }
+                // Keys are not consecutive.
+                mapOfPolygons[3 * i + 7] = p;
+            }
+            return mapOfPolygons;
+        }
+
+        // Brute force scan over all polygons in the grid's index order.
+        vector<uint32_t> scan(const map<uint32_t, Polygon> &mapOfPolygons, const double &minX, const double &minY, const double &maxX, const double &maxY) {
+            vector<uint32_t> result;
+            uint32_t index = 0;
+            map<uint32_t, Polygon>::const_iterator it = mapOfPolygons.begin();
+            while (it != mapOfPolygons.end()) {
+                const vector<Point3> &listOfVertices = (it++)->second.getVertices();
+                if (listOfVertices.empty()) {
+                    continue;
+                }
+
+                double x1 = listOfVertices.front().getX(), x2 = x1;
+                double y1 = listOfVertices.front().getY(), y2 = y1;
+                for (uint32_t i = 0; i < listOfVertices.size(); i++) {
+                    x1 = min(x1, listOfVertices[i].getX());
+                    x2 = max(x2, listOfVertices[i].getX());
+                    y1 = min(y1, listOfVertices[i].getY());
+                    y2 = max(y2, listOfVertices[i].getY());
+                }
+                const bool overlaps = (x2 >= minX) && (x1 <= maxX) && (y2 >= minY) && (y1 <= maxY);
+                if (overlaps) {
+                    result.push_back(index);
+                }
+                index++;
+            }
+            return result;
+        }
+
+        bool compareWithScan(PolygonGrid &grid, const map<uint32_t, Polygon> &mapOfPolygons, const uint32_t &numberOfQueries) {
+            bool equal = true;
+            vector<uint32_t> candidates;
+            for (uint32_t i = 0; i < numberOfQueries; i++) {
+                // Some areas are partly or completely outside the grid.
+                const double x = random(-600, 600);
+                const double y = random(-400, 400);
+                const double width = random(0, 150);
+                const double height = random(0, 150);
+
+                grid.query(x, y, x + width, y + height, candidates);
+                sort(candidates.begin(), candidates.end());
+
+                const vector<uint32_t> expected = scan(mapOfPolygons, x, y, x + width, y + height);
+                equal &= (candidates == expected);
+            }
+            return equal;
+        }
+
+        void testQueriesMatchBruteForceScan() {
+            srand(42);
+            const map<uint32_t, Polygon> mapOfPolygons = createRandomPolygons(1000);
+
+            PolygonGrid grid;
+            grid.build(mapOfPolygons, 20);
+            TS_ASSERT(grid.getNumberOfPolygons() == 980);
+            TS_ASSERT_DELTA(grid.getCellSize(), 20, 1e-9);
+
+            // Every candidate is reported once.
+            TS_ASSERT(compareWithScan(grid, mapOfPolygons, 500));
+
+            // Indices refer to the polygons in the order of their keys.
+            map<uint32_t, Polygon>::const_iterator it = mapOfPolygons.begin();
+            it++;
+            TS_ASSERT(grid.getPolygon(0).getVertices().size() == it->second.getVertices().size());
+            TS_ASSERT_DELTA(grid.getPolygon(0).getVertices().front().getX(), it->second.getVertices().front().getX(), 1e-9);
+        }
+
+        void testQueriesWithLimitedNumberOfCells() {
+            srand(43);
+            const map<uint32_t, Polygon> mapOfPolygons = createRandomPolygons(300);
+
+            // Tiny cells exceed MAX_NUMBER_OF_CELLS and are enlarged.
+            PolygonGrid grid;
+            grid.build(mapOfPolygons, 0.01);
+            TS_ASSERT(grid.getCellSize() > 0.01);
+            TS_ASSERT(compareWithScan(grid, mapOfPolygons, 200));
+
+            // Few large cells.
+            grid.build(mapOfPolygons, 1000);
+            TS_ASSERT(compareWithScan(grid, mapOfPolygons, 200));
+        }
+
+        void testEmptyGrid() {
+            PolygonGrid grid;
+            vector<uint32_t> candidates;
+            candidates.push_back(1);
+            grid.query(-10, -10, 10, 10, candidates);
+            TS_ASSERT(candidates.empty());
+
+            grid.build(map<uint32_t, Polygon>(), 10);
+            TS_ASSERT(grid.getNumberOfPolygons() == 0);
+            grid.query(-10, -10, 10, 10, candidates);
+            TS_ASSERT(candidates.empty());
+        }
+};
+
+#endif /*VEHICLECONTEXT_POLYGONGRIDTESTSUITE_H_*/
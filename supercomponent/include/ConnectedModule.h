@@ -43,10 +43,20 @@ namespace supercomponent {
             void setExitCode();
             bool hasExitCode() const;
 
+            /**
+             * This method marks this module to be skipped when sending
+             * pulses requiring an ACK confirmation.
+             *
+             * @param ignored true if this module shall not receive pulses.
+             */
+            void setIgnoredForPulseAck(const bool &ignored);
+            bool isIgnoredForPulseAck() const;
+
         protected:
             core::base::ModuleState::MODULE_STATE m_state;
             core::dmcp::connection::ModuleConnection* m_connection;
             bool m_hasExitCode;
+            bool m_ignoredForPulseAck;
 
         private:
             ConnectedModule(const ConnectedModule &);
@@ -23,9 +23,11 @@
 
 #include <vector>
 
+#include "core/base/Condition.h"
 #include "core/base/ModuleState.h"
 #include "core/base/Mutex.h"
 #include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
 #include "core/data/dmcp/PulseMessage.h"
 #include "core/data/dmcp/ModuleDescriptor.h"
 #include "core/data/dmcp/ModuleDescriptorComparator.h"
@@ -53,6 +55,12 @@ namespace supercomponent {
              */
             void pulse(const core::data::dmcp::PulseMessage &pm);
 
+            /**
+             * This method sends the current configuration to all
+             * connected modules.
+             */
+            void sendConfiguration();
+
             /**
              * This method sends a pulse to all connected modules but shifts
              * the alignment interval by shift microseconds for each connected
@@ -63,6 +71,16 @@ namespace supercomponent {
              */
             void pulseShift(const core::data::dmcp::PulseMessage &pm, const uint32_t &shift);
 
+            /**
+             * This method sets the modules that are skipped when sending
+             * pulses requiring an ACK confirmation. The module names are
+             * matched once when a module is added or when this method is
+             * called and not for every pulse.
+             *
+             * @param modulesToIgnore Lower-case names of the modules to be skipped.
+             */
+            void setModulesToIgnore(const vector<string> &modulesToIgnore);
+
             /**
              * This method sends a pulse to all connected modules and
              * requires an ACK confirmation sent from the respective,
@@ -71,9 +89,8 @@ namespace supercomponent {
              * @param pm Pulse to be sent.
              * @param timeout Timeout in milliseconds to wait for an ACK from the dependent module.
              * @param yield Time to wait in microseconds before sending the pulse to the next module in the list.
-             * @param modulesToIgnore Modules that are skipped when sending the pulse signal.
              */
-            void pulse_ack(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore);
+            void pulse_ack(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield);
 
             /**
              * This method sends a pulse to all connected modules and
@@ -83,19 +100,58 @@ namespace supercomponent {
              * @param pm Pulse to be sent.
              * @param timeout Timeout in milliseconds to wait for an ACK from the dependent module.
              * @param yield Time to wait in microseconds before sending the pulse to the next module in the list.
-             * @param modulesToIgnore Modules that are skipped when sending the pulse signal.
              * @return Containers to be transferred to supercomponent.
              */
-            vector<core::data::Container> pulse_ack_containers(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore);
+            vector<core::data::Container> pulse_ack_containers(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield);
+
+            /**
+             * This method sends a pulse to all connected modules at once
+             * and waits afterwards until all dependent modules have
+             * confirmed the processing of the PULSE or their respective
+             * timeouts have expired. Thus, the dependent modules are
+             * executed concurrently instead of one after another.
+             *
+             * @param pm Pulse to be sent.
+             * @param timeout Timeout in milliseconds to wait for an ACK from each dependent module.
+             */
+            void pulse_ack_parallel(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout);
+
+            /**
+             * This method sends a pulse to all connected modules at once
+             * and waits afterwards until all dependent modules have
+             * confirmed the processing of the PULSE and returned their
+             * containers or their respective timeouts have expired.
+             *
+             * @param pm Pulse to be sent.
+             * @param timeout Timeout in milliseconds to wait for an ACK from each dependent module.
+             * @return Containers to be transferred to supercomponent in the order of the connected modules.
+             */
+            vector<core::data::Container> pulse_ack_containers_parallel(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout);
 
             void deleteAllModules();
 
         protected:
+            /**
+             * This method waits until no module has a pending ACK anymore
+             * or the module's deadline has expired. m_modulesMutex must
+             * be locked by the caller.
+             *
+             * @param modules Modules to wait for.
+             * @param deadlines Point in time per module until its ACK is expected.
+             * @param withContainers true if the modules were pulsed by pulse_ack_containers_nonblocking.
+             */
+            void waitForPulseAcks(const vector<ConnectedModule*> &modules, const vector<core::data::TimeStamp> &deadlines, const bool &withContainers);
+
+            bool isIgnored(const core::data::dmcp::ModuleDescriptor& md) const;
+
             core::base::Mutex m_modulesMutex;
             map< core::data::dmcp::ModuleDescriptor,
                  ConnectedModule*,
                  core::data::dmcp::ModuleDescriptorComparator> m_modules;
 
+            vector<string> m_modulesToIgnore;
+            core::base::Condition m_pulseAckCondition;
+
         private:
             ConnectedModules(const ConnectedModule &);
             ConnectedModules& operator=(const ConnectedModule &);
@@ -44,6 +44,14 @@ namespace supercomponent {
             virtual core::base::KeyValueConfiguration getConfiguration(const core::data::dmcp::ModuleDescriptor& md);
             virtual core::base::KeyValueConfiguration getGlobalConfiguration() const;
 
+            /**
+             * This method replaces the configuration that is used for
+             * all subsequent calls to getConfiguration(...).
+             *
+             * @param configuration New configuration.
+             */
+            void setGlobalConfiguration(const core::base::KeyValueConfiguration& configuration);
+
         protected:
             core::base::KeyValueConfiguration m_configuration;
             core::base::Mutex m_configurationMutex;
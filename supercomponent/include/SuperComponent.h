@@ -108,6 +108,9 @@ namespace supercomponent {
             virtual void handleRuntimeStatistics(const core::data::dmcp::ModuleDescriptor& md,
                                                  const core::data::RuntimeStatistic& rs);
 
+            virtual void handleInstrumentationStatistic(const core::data::dmcp::ModuleDescriptor& md,
+                                                        const core::data::InstrumentationStatistic& is);
+
             virtual void handleConnectionLost(const core::data::dmcp::ModuleDescriptor& md);
 
             virtual void handleUnkownContainer(const core::data::dmcp::ModuleDescriptor& md,
@@ -134,6 +137,13 @@ namespace supercomponent {
         private:
             void parseAdditionalCommandLineParameters(const int &argc, char **argv);
 
+            /**
+             * This method re-reads the configuration file and sends
+             * the configuration to all connected modules if the file
+             * was modified.
+             */
+            void reloadConfiguration();
+
             core::data::TimeStamp m_startOfCurrentCycle;
             core::data::TimeStamp m_startOfLastCycle;
             core::data::TimeStamp m_lastCycle;
@@ -141,8 +151,12 @@ namespace supercomponent {
             uint32_t m_shiftMicroseconds;
             uint32_t m_timeoutACKMilliseconds;
             uint32_t m_yieldMicroseconds;
+            bool m_parallelPulseAck;
 
             vector<string> m_modulesToIgnore;
+
+            string m_configurationFileContent;
+            core::data::TimeStamp m_lastConfigurationCheck;
     };
 }
 
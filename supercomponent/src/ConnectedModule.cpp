@@ -29,7 +29,8 @@ namespace supercomponent {
     ConnectedModule::ConnectedModule(ModuleConnection* connection, const ModuleState::MODULE_STATE& state) :
         m_state(state),
         m_connection(connection),
-        m_hasExitCode(false)
+        m_hasExitCode(false),
+        m_ignoredForPulseAck(false)
     {}
 
     ConnectedModule::~ConnectedModule() {
@@ -48,6 +49,14 @@ namespace supercomponent {
         return m_hasExitCode;
     }
 
+    void ConnectedModule::setIgnoredForPulseAck(const bool &ignored) {
+        m_ignoredForPulseAck = ignored;
+    }
+
+    bool ConnectedModule::isIgnoredForPulseAck() const {
+        return m_ignoredForPulseAck;
+    }
+
     ModuleConnection& ConnectedModule::getConnection() {
         return *m_connection;
     }
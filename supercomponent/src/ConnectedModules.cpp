@@ -18,6 +18,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
+
 #include "ConnectedModules.h"
 
 #include "core/StringToolbox.h"
@@ -33,7 +35,9 @@ namespace supercomponent {
 
     ConnectedModules::ConnectedModules() :
         m_modulesMutex(),
-        m_modules()
+        m_modules(),
+        m_modulesToIgnore(),
+        m_pulseAckCondition()
     {}
 
     ConnectedModules::~ConnectedModules() {
@@ -42,6 +46,8 @@ namespace supercomponent {
 
     void ConnectedModules::addModule(const ModuleDescriptor& md, ConnectedModule* module) {
         Lock l(m_modulesMutex);
+        module->setIgnoredForPulseAck(isIgnored(md));
+        module->getConnection().setPulseAckObserver(&m_pulseAckCondition);
         m_modules[md] = module;
     }
 
@@ -52,7 +58,14 @@ namespace supercomponent {
 
     void ConnectedModules::removeModule(const ModuleDescriptor& md) {
         Lock l(m_modulesMutex);
-        m_modules.erase(md);
+        map< core::data::dmcp::ModuleDescriptor,
+             ConnectedModule*,
+             core::data::dmcp::ModuleDescriptorComparator>::iterator iter = m_modules.find(md);
+
+        if (iter != m_modules.end()) {
+            iter->second->getConnection().setPulseAckObserver(NULL);
+            m_modules.erase(iter);
+        }
     }
 
     bool ConnectedModules::hasModule(const ModuleDescriptor& md) {
@@ -71,6 +84,17 @@ namespace supercomponent {
         }
     }
 
+    void ConnectedModules::sendConfiguration() {
+        Lock l(m_modulesMutex);
+        map< core::data::dmcp::ModuleDescriptor,
+             ConnectedModule*,
+             core::data::dmcp::ModuleDescriptorComparator>::iterator iter;
+
+        for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
+            iter->second->getConnection().sendConfiguration();
+        }
+    }
+
     void ConnectedModules::pulseShift(const core::data::dmcp::PulseMessage &pm, const uint32_t &shift) {
         Lock l(m_modulesMutex);
         map< core::data::dmcp::ModuleDescriptor,
@@ -92,7 +116,28 @@ namespace supercomponent {
         }
     }
 
-    void ConnectedModules::pulse_ack(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore) {
+    bool ConnectedModules::isIgnored(const ModuleDescriptor& md) const {
+        // Get the module's name.
+        string s = md.getName();
+        transform(s.begin(), s.end(), s.begin(), ::tolower);
+
+        return (find(m_modulesToIgnore.begin(), m_modulesToIgnore.end(), s) != m_modulesToIgnore.end());
+    }
+
+    void ConnectedModules::setModulesToIgnore(const vector<string> &modulesToIgnore) {
+        Lock l(m_modulesMutex);
+        m_modulesToIgnore = modulesToIgnore;
+
+        map< core::data::dmcp::ModuleDescriptor,
+             ConnectedModule*,
+             core::data::dmcp::ModuleDescriptorComparator>::iterator iter;
+
+        for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
+            iter->second->setIgnoredForPulseAck(isIgnored(iter->first));
+        }
+    }
+
+    void ConnectedModules::pulse_ack(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield) {
         // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack_containers)
         // as in this case, the dependent client module will NOT send its containers to using
         // this TCP link but via the regular UDP multicast conference.
@@ -102,13 +147,8 @@ namespace supercomponent {
              core::data::dmcp::ModuleDescriptorComparator>::iterator iter;
 
         for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
-            // Get the module's name.
-            string s = iter->first.getName();
-            transform(s.begin(), s.end(), s.begin(), ::tolower);
-
             // Check whether we have to skip this module when sending pulses.
-            vector<string>::const_iterator it = find(modulesToIgnore.begin(), modulesToIgnore.end(), s);
-            if (it == modulesToIgnore.end()) {
+            if (!iter->second->isIgnoredForPulseAck()) {
                 // The following call blocks until the client has confirmed the processing of this pulse.
                 iter->second->getConnection().pulse_ack(pm, timeout);
 
@@ -118,7 +158,7 @@ namespace supercomponent {
         }
     }
 
-    vector<Container> ConnectedModules::pulse_ack_containers(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore) {
+    vector<Container> ConnectedModules::pulse_ack_containers(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield) {
         // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack)
         // as in this case, the dependent client module will send all its containers
         // via this TCP link and NOT via the regular UDP multicast conference.
@@ -130,13 +170,8 @@ namespace supercomponent {
              core::data::dmcp::ModuleDescriptorComparator>::iterator iter;
 
         for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
-            // Get the module's name.
-            string s = iter->first.getName();
-            transform(s.begin(), s.end(), s.begin(), ::tolower);
-
             // Check whether we have to skip this module when sending pulses.
-            vector<string>::const_iterator it = find(modulesToIgnore.begin(), modulesToIgnore.end(), s);
-            if (it == modulesToIgnore.end()) {
+            if (!iter->second->isIgnoredForPulseAck()) {
                 // The following call blocks until the client has confirmed the processing of this pulse.
                 vector<Container> containersToBeDeliveredInNextCycle = iter->second->getConnection().pulse_ack_containers(pm, timeout);
 
@@ -151,6 +186,104 @@ namespace supercomponent {
         return allContainersToBeDeliveredInNextCycle;
     }
 
+    void ConnectedModules::pulse_ack_parallel(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
+        Lock l(m_modulesMutex);
+        map< core::data::dmcp::ModuleDescriptor,
+             ConnectedModule*,
+             core::data::dmcp::ModuleDescriptorComparator>::iterator iter;
+
+        vector<ConnectedModule*> pulsedModules;
+        vector<TimeStamp> deadlines;
+        const TimeStamp TIMEOUT(timeout / 1000, (timeout % 1000) * 1000);
+
+        // Send all pulses first without waiting for the ACKs in between.
+        for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
+            if (!iter->second->isIgnoredForPulseAck()) {
+                if (iter->second->getConnection().pulse_ack_nonblocking(pm)) {
+                    TimeStamp now;
+                    pulsedModules.push_back(iter->second);
+                    deadlines.push_back(now + TIMEOUT);
+                }
+            }
+        }
+
+        waitForPulseAcks(pulsedModules, deadlines, false);
+    }
+
+    vector<Container> ConnectedModules::pulse_ack_containers_parallel(const core::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
+        vector<Container> allContainersToBeDeliveredInNextCycle;
+
+        Lock l(m_modulesMutex);
+        map< core::data::dmcp::ModuleDescriptor,
+             ConnectedModule*,
+             core::data::dmcp::ModuleDescriptorComparator>::iterator iter;
+
+        vector<ConnectedModule*> pulsedModules;
+        vector<TimeStamp> deadlines;
+        const TimeStamp TIMEOUT(timeout / 1000, (timeout % 1000) * 1000);
+
+        // Send all pulses first without waiting for the ACKs in between.
+        for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
+            if (!iter->second->isIgnoredForPulseAck()) {
+                if (iter->second->getConnection().pulse_ack_containers_nonblocking(pm)) {
+                    TimeStamp now;
+                    pulsedModules.push_back(iter->second);
+                    deadlines.push_back(now + TIMEOUT);
+                }
+            }
+        }
+
+        waitForPulseAcks(pulsedModules, deadlines, true);
+
+        // Collect the containers in the modules' order to have a deterministic sequence.
+        vector<ConnectedModule*>::iterator it = pulsedModules.begin();
+        while (it != pulsedModules.end()) {
+            vector<Container> containersToBeDeliveredInNextCycle = (*it)->getConnection().getContainersFromPulseAck();
+            allContainersToBeDeliveredInNextCycle.insert(allContainersToBeDeliveredInNextCycle.end(), containersToBeDeliveredInNextCycle.begin(), containersToBeDeliveredInNextCycle.end());
+            ++it;
+        }
+
+        return allContainersToBeDeliveredInNextCycle;
+    }
+
+    void ConnectedModules::waitForPulseAcks(const vector<ConnectedModule*> &modules, const vector<TimeStamp> &deadlines, const bool &withContainers) {
+        vector<bool> isWaiting(modules.size(), true);
+
+        Lock l(m_pulseAckCondition);
+        while (true) {
+            TimeStamp now;
+            bool hasPendingModules = false;
+            TimeStamp earliestDeadline;
+
+            for (uint32_t i = 0; i < modules.size(); i++) {
+                if (isWaiting[i]) {
+                    const bool isPending = (withContainers ? modules[i]->getConnection().isPulseAckContainersPending()
+                                                           : modules[i]->getConnection().isPulseAckPending());
+
+                    // Stop waiting for modules that have confirmed the pulse or whose deadline has expired.
+                    if ( (!isPending) || (deadlines[i] <= now) ) {
+                        isWaiting[i] = false;
+                    }
+                    else {
+                        if ( (!hasPendingModules) || (deadlines[i] < earliestDeadline) ) {
+                            earliestDeadline = deadlines[i];
+                        }
+                        hasPendingModules = true;
+                    }
+                }
+            }
+
+            if (!hasPendingModules) {
+                break;
+            }
+
+            // Wait until any ACK was received or the next deadline expires.
+            const long remainingMicroseconds = (earliestDeadline - now).toMicroseconds();
+            const unsigned long remainingMilliseconds = static_cast<unsigned long>((remainingMicroseconds + 999) / 1000);
+            m_pulseAckCondition.waitOnSignalWithTimeout(remainingMilliseconds);
+        }
+    }
+
     void ConnectedModules::deleteAllModules() {
         Lock l(m_modulesMutex);
         map< core::data::dmcp::ModuleDescriptor,
@@ -159,6 +292,7 @@ namespace supercomponent {
 
         for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
             iter->second->getConnection().setModuleStateListener(NULL);
+            iter->second->getConnection().setPulseAckObserver(NULL);
             delete iter->second;
         }
 
@@ -108,4 +108,9 @@ namespace supercomponent {
     KeyValueConfiguration GlobalConfigurationProvider::getGlobalConfiguration() const {
         return m_configuration;
     }
+
+    void GlobalConfigurationProvider::setGlobalConfiguration(const KeyValueConfiguration& configuration) {
+        Lock l(m_configurationMutex);
+        m_configuration = configuration;
+    }
 }
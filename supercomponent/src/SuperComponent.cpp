@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <sstream>
 
 #include "core/StringToolbox.h"
 #include "core/base/CommandLineParser.h"
@@ -35,6 +36,7 @@
 #include "core/data/Configuration.h"
 #include "core/dmcp/discoverer/Client.h"
 #include "core/dmcp/ServerInformation.h"
+#include "core/wrapper/TCPFactory.h"
 
 #include "SuperComponent.h"
 #include "ConnectedModule.h"
@@ -68,7 +70,10 @@ namespace supercomponent {
         m_shiftMicroseconds(0),
         m_timeoutACKMilliseconds(0),
         m_yieldMicroseconds(0),
-        m_modulesToIgnore() {
+        m_parallelPulseAck(false),
+        m_modulesToIgnore(),
+        m_configurationFileContent(),
+        m_lastConfigurationCheck() {
         // Check for any running supercomponents.
         checkForSuperComponent();
 
@@ -76,7 +81,11 @@ namespace supercomponent {
         cout << "(supercomponent) Parsing configuration file..." << endl;
         ifstream configStream("configuration", ios::in);
         if (configStream.good()) {
-            configStream >> m_configuration;
+            // Keep the file's content to detect modifications at runtime.
+            stringstream content;
+            content << configStream.rdbuf();
+            m_configurationFileContent = content.str();
+            content >> m_configuration;
         }
         else {
             OPENDAVINCI_CORE_THROW_EXCEPTION(ConfigurationFileNotFoundException, "Configuration stream invalid.");
@@ -85,6 +94,9 @@ namespace supercomponent {
         // Parse command line arguments.
         parseAdditionalCommandLineParameters(argc, argv);
 
+        // Determine the modules to be skipped once instead of for every pulse.
+        m_modules.setModulesToIgnore(m_modulesToIgnore);
+
         const uint32_t SERVER_PORT = CONNECTIONSERVER_PORT_BASE + getCID();
         // Listen on all interfaces.
         ServerInformation serverInformation("0.0.0.0", SERVER_PORT, m_managedLevel);
@@ -98,6 +110,17 @@ namespace supercomponent {
                                                     m_modulesToIgnore);
         m_discovererServer->startResponding();
 
+        // Multiplex all connections to the dependent modules on one event loop instead of one thread per module.
+        try {
+            if (m_configuration.getValue<int>("supercomponent.eventloop") == 1) {
+                cout << "(supercomponent) Using event loop for connections." << endl;
+                core::wrapper::TCPFactory::setTransport(core::wrapper::TCPFactory::EVENT_LOOP);
+            }
+        }
+        catch(...) {
+            // If "supercomponent.eventloop" is not specified, just ignore exception and use one thread per connection.
+        }
+
         cout << "(supercomponent) Creating connection server..." << endl;
         m_configurationProvider = GlobalConfigurationProvider(m_configuration);
         m_connectionServer = new connection::Server(serverInformation, m_configurationProvider);
@@ -181,6 +204,13 @@ namespace supercomponent {
                     cerr << "(supercomponent) Value for 'supercomponent.pulsetimeack.yield' not found in configuration, using " << m_yieldMicroseconds << " as default." << endl;
                 }
 
+                try {
+                    m_parallelPulseAck = (m_configuration.getValue<int>("supercomponent.pulsetimeack.parallel") == 1);
+                }
+                catch(...) {
+                    // If "supercomponent.pulsetimeack.parallel" is not specified, just ignore exception and pulse the modules sequentially.
+                }
+
                 try {
                     string s = m_configuration.getValue<string>("supercomponent.pulsetimeack.exclude");
                     transform(s.begin(), s.end(), s.begin(), ::tolower);
@@ -230,6 +260,12 @@ namespace supercomponent {
             // Remove disconnected modules.
             m_shutdownModules.deleteAllModules();
 
+            // Send a modified configuration to all modules.
+            if ((current - m_lastConfigurationCheck).toMicroseconds() >= ONE_SECOND_IN_MICROSECONDS) {
+                m_lastConfigurationCheck = current;
+                reloadConfiguration();
+            }
+
             if (m_managedLevel == core::dmcp::ServerInformation::ML_NONE) {
                 // Just sleep 2 seconds in the case of managed level == NONE.
                 Thread::usleep(2 * ONE_SECOND_IN_MICROSECONDS);
@@ -271,7 +307,14 @@ namespace supercomponent {
                     // m_yieldMicroseconds specifies the amount of time that we are going to wait before
                     // we trigger the next module (send the pulse to it) to allow delivery of any packets
                     // on the OS level.
-                    m_modules.pulse_ack(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore);
+                    //
+                    // If m_parallelPulseAck is set, all modules are pulsed at once and executed concurrently.
+                    if (m_parallelPulseAck) {
+                        m_modules.pulse_ack_parallel(pm, m_timeoutACKMilliseconds);
+                    }
+                    else {
+                        m_modules.pulse_ack(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds);
+                    }
                 }
                 else if ( (m_managedLevel == core::dmcp::ServerInformation::ML_SIMULATION) || (m_managedLevel == core::dmcp::ServerInformation::ML_SIMULATION_RT) ) {
                     // Managed level ML_SIMULATION requires a confirmation from the dependent
@@ -298,7 +341,12 @@ namespace supercomponent {
                     containersToBeDistributedToModules.clear();
 
                     // Save containers to be distributed in the next cycle.
-                    containersToBeDistributedToModules = m_modules.pulse_ack_containers(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds, m_modulesToIgnore);
+                    if (m_parallelPulseAck) {
+                        containersToBeDistributedToModules = m_modules.pulse_ack_containers_parallel(pm, m_timeoutACKMilliseconds);
+                    }
+                    else {
+                        containersToBeDistributedToModules = m_modules.pulse_ack_containers(pm, m_timeoutACKMilliseconds, m_yieldMicroseconds);
+                    }
                 }
 
                 // Increment the nomimal time slices.
@@ -338,8 +386,35 @@ namespace supercomponent {
         return ModuleState::OKAY;
     }
 
+    void SuperComponent::reloadConfiguration() {
+        ifstream configStream("configuration", ios::in);
+        if (!configStream.good()) {
+            return;
+        }
+
+        stringstream content;
+        content << configStream.rdbuf();
+        if (content.str() == m_configurationFileContent) {
+            return;
+        }
+        m_configurationFileContent = content.str();
+
+        KeyValueConfiguration kvc;
+        content >> kvc;
+        m_configuration = kvc;
+        m_configurationProvider.setGlobalConfiguration(m_configuration);
+
+        cout << "(supercomponent) Configuration file modified, sending new configuration to all modules." << endl;
+        m_modules.sendConfiguration();
+    }
+
     void SuperComponent::onNewModule(ModuleConnection* mc) {
-        mc->waitForModuleDescription();
+        if (!mc->waitForModuleDescription(core::dmcp::CONNECTION_TIMEOUT)) {
+            cout << "(supercomponent) New connection did not send a module description within " << core::dmcp::CONNECTION_TIMEOUT << " ms, disconnecting." << endl;
+            OPENDAVINCI_CORE_DELETE_POINTER(mc);
+            return;
+        }
+
         cout << "(supercomponent) New connected module " << mc->getModuleDescriptor().toString() << endl;
 
         ConnectedModule* module = new ConnectedModule(mc, ModuleState::NOT_RUNNING);
@@ -376,6 +451,11 @@ namespace supercomponent {
         m_moduleStatistics.setRuntimeStatistic(md, rs);
     }
 
+    void SuperComponent::handleInstrumentationStatistic(const ModuleDescriptor& md, const InstrumentationStatistic& is) {
+        Lock l(m_moduleStatisticsMutex);
+        m_moduleStatistics.setInstrumentationStatistic(md, is);
+    }
+
     void SuperComponent::handleConnectionLost(const ModuleDescriptor& md) {
         // This methods is called when a module terminates not properly.
         if (m_modules.hasModule(md)) {
@@ -0,0 +1,315 @@
+/**
+ * supercomponent - Configuration and monitoring component for
+ *                  distributed software systems
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CONNECTEDMODULESTESTSUITE_H_
+#define CONNECTEDMODULESTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/base/Condition.h"
+#include "core/base/KeyValueConfiguration.h"
+#include "core/base/Lock.h"
+#include "core/base/ModuleState.h"
+#include "core/base/Mutex.h"
+#include "core/base/Thread.h"
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+#include "core/data/dmcp/ModuleDescriptor.h"
+#include "core/data/dmcp/PulseAckContainersMessage.h"
+#include "core/data/dmcp/PulseAckMessage.h"
+#include "core/data/dmcp/PulseMessage.h"
+#include "core/dmcp/ModuleConfigurationProvider.h"
+#include "core/dmcp/connection/ModuleConnection.h"
+#include "core/io/Connection.h"
+#include "core/io/ConnectionAcceptor.h"
+#include "core/io/ConnectionAcceptorListener.h"
+#include "core/io/ContainerListener.h"
+
+#include "../include/ConnectedModule.h"
+#include "../include/ConnectedModules.h"
+
+using namespace std;
+using namespace core::base;
+using namespace core::data;
+using namespace core::data::dmcp;
+using namespace core::dmcp;
+using namespace core::dmcp::connection;
+using namespace core::io;
+using namespace supercomponent;
+
+/**
+ * This class simulates a dependent module that confirms every
+ * pulse after a given delay.
+ */
+class PulseAckTestModule : public ContainerListener {
+    public:
+        PulseAckTestModule(const uint32_t &port, const uint32_t &id, const uint32_t &delay, const bool &withContainers) :
+            m_connection("127.0.0.1", port),
+            m_id(id),
+            m_delay(delay),
+            m_withContainers(withContainers),
+            m_mutex(),
+            m_listOfCycles(),
+            m_listOfReceivedTimes(),
+            m_listOfAckTimes() {
+            m_connection.setContainerListener(this);
+            m_connection.start();
+        }
+
+        virtual ~PulseAckTestModule() {
+            m_connection.setContainerListener(NULL);
+            m_connection.stop();
+        }
+
+        virtual void nextContainer(Container &c) {
+            if (c.getDataType() == Container::DMCP_PULSE_MESSAGE) {
+                const PulseMessage pm = c.getData<PulseMessage>();
+                const TimeStamp received;
+
+                Thread::usleep(m_delay);
+
+                {
+                    Lock l(m_mutex);
+                    m_listOfCycles.push_back(pm.getCumulatedTimeSlice());
+                    m_listOfReceivedTimes.push_back(received);
+                    m_listOfAckTimes.push_back(TimeStamp());
+                }
+
+                if (m_withContainers) {
+                    // Identify the module and the cycle in the returned container.
+                    PulseAckContainersMessage pac;
+                    pac.addContainer(Container(Container::TIMESTAMP, TimeStamp(pm.getCumulatedTimeSlice(), m_id)));
+                    Container ack(Container::DMCP_PULSE_ACK_CONTAINERS_MESSAGE, pac);
+                    m_connection.send(ack);
+                }
+                else {
+                    Container ack(Container::DMCP_PULSE_ACK_MESSAGE, PulseAckMessage());
+                    m_connection.send(ack);
+                }
+            }
+        }
+
+        vector<uint32_t> getListOfCycles() {
+            Lock l(m_mutex);
+            return m_listOfCycles;
+        }
+
+        vector<TimeStamp> getListOfReceivedTimes() {
+            Lock l(m_mutex);
+            return m_listOfReceivedTimes;
+        }
+
+        vector<TimeStamp> getListOfAckTimes() {
+            Lock l(m_mutex);
+            return m_listOfAckTimes;
+        }
+
+    private:
+        PulseAckTestModule(const PulseAckTestModule &);
+        PulseAckTestModule& operator=(const PulseAckTestModule &);
+
+        Connection m_connection;
+        uint32_t m_id;
+        uint32_t m_delay;
+        bool m_withContainers;
+        Mutex m_mutex;
+        vector<uint32_t> m_listOfCycles;
+        vector<TimeStamp> m_listOfReceivedTimes;
+        vector<TimeStamp> m_listOfAckTimes;
+};
+
+/**
+ * This class collects the connections accepted on supercomponent's side.
+ */
+class PulseAckTestAcceptor : public ConnectionAcceptorListener,
+                             public ModuleConfigurationProvider {
+    public:
+        PulseAckTestAcceptor() :
+            m_condition(),
+            m_listOfConnections() {}
+
+        virtual void onNewConnection(Connection *connection) {
+            Lock l(m_condition);
+            m_listOfConnections.push_back(connection);
+            m_condition.wakeAll();
+        }
+
+        virtual KeyValueConfiguration getConfiguration(const ModuleDescriptor &/*md*/) {
+            return KeyValueConfiguration();
+        }
+
+        Connection* waitForConnection(const uint32_t &index) {
+            Lock l(m_condition);
+            if (m_listOfConnections.size() <= index) {
+                m_condition.waitOnSignalWithTimeout(1000);
+            }
+            return (m_listOfConnections.size() > index) ? m_listOfConnections.at(index) : NULL;
+        }
+
+    private:
+        PulseAckTestAcceptor(const PulseAckTestAcceptor &);
+        PulseAckTestAcceptor& operator=(const PulseAckTestAcceptor &);
+
+        Condition m_condition;
+        vector<Connection*> m_listOfConnections;
+};
+
+class ConnectedModulesTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * This method connects one test module per delay and registers
+         * it at the given ConnectedModules. Module i is named "module<i>"
+         * so that it is pulsed in the order of the delays.
+         */
+        void connect(const uint32_t &port, const vector<uint32_t> &delays, const bool &withContainers,
+                     PulseAckTestAcceptor &acceptor, ConnectedModules &connectedModules, vector<PulseAckTestModule*> &modules) {
+            for (uint32_t i = 0; i < delays.size(); i++) {
+                modules.push_back(new PulseAckTestModule(port, i, delays.at(i), withContainers));
+
+                Connection *connection = acceptor.waitForConnection(i);
+                TS_ASSERT(connection != NULL);
+                if (connection != NULL) {
+                    stringstream name;
+                    name << "module" << i;
+                    connectedModules.addModule(ModuleDescriptor(name.str(), "", "", 1),
+                                               new ConnectedModule(new ModuleConnection(connection, acceptor), ModuleState::RUNNING));
+                }
+            }
+        }
+
+        void disconnect(ConnectedModules &connectedModules, vector<PulseAckTestModule*> &modules) {
+            connectedModules.deleteAllModules();
+
+            vector<PulseAckTestModule*>::iterator it = modules.begin();
+            while (it != modules.end()) {
+                delete (*it++);
+            }
+            modules.clear();
+        }
+
+        void testParallelPulseAck() {
+            const uint32_t CYCLES = 4;
+            const uint32_t DELAY = 200 * 1000;
+            const uint32_t TIMEOUT = 2000;
+
+            ConnectionAcceptor acceptor(19871);
+            PulseAckTestAcceptor listener;
+            acceptor.setConnectionAcceptorListener(&listener);
+            acceptor.start();
+
+            // Two slow modules and one fast module.
+            vector<uint32_t> delays;
+            delays.push_back(0);
+            delays.push_back(DELAY);
+            delays.push_back(DELAY);
+
+            ConnectedModules connectedModules;
+            vector<PulseAckTestModule*> modules;
+            connect(19871, delays, false, listener, connectedModules, modules);
+            TS_ASSERT(modules.size() == delays.size());
+
+            const TimeStamp start;
+            for (uint32_t cycle = 0; cycle < CYCLES; cycle++) {
+                const TimeStamp beginOfCycle;
+                connectedModules.pulse_ack_parallel(PulseMessage(TimeStamp(), 1, cycle), TIMEOUT);
+                const TimeStamp endOfCycle;
+
+                // A slow ACK delays the cycle.
+                TS_ASSERT((endOfCycle - beginOfCycle).toMicroseconds() >= static_cast<int32_t>(DELAY));
+            }
+            const TimeStamp end;
+
+            // Both slow modules were executed concurrently.
+            TS_ASSERT((end - start).toMicroseconds() < static_cast<int32_t>(CYCLES * DELAY * 7 / 4));
+
+            for (uint32_t i = 0; i < modules.size(); i++) {
+                // Every module got exactly one pulse per cycle in the order of the cycles.
+                const vector<uint32_t> listOfCycles = modules.at(i)->getListOfCycles();
+                TS_ASSERT(listOfCycles.size() == CYCLES);
+                for (uint32_t cycle = 0; cycle < listOfCycles.size(); cycle++) {
+                    TS_ASSERT(listOfCycles.at(cycle) == cycle);
+                }
+
+                // No module got the next pulse before all modules confirmed the previous one.
+                const vector<TimeStamp> listOfReceivedTimes = modules.at(i)->getListOfReceivedTimes();
+                for (uint32_t j = 0; j < modules.size(); j++) {
+                    const vector<TimeStamp> listOfAckTimes = modules.at(j)->getListOfAckTimes();
+                    for (uint32_t cycle = 1; (cycle < listOfReceivedTimes.size()) && (cycle <= listOfAckTimes.size()); cycle++) {
+                        TS_ASSERT(listOfAckTimes.at(cycle - 1) < listOfReceivedTimes.at(cycle));
+                    }
+                }
+            }
+
+            disconnect(connectedModules, modules);
+            acceptor.stop();
+        }
+
+        void testParallelPulseAckContainers() {
+            const uint32_t CYCLES = 3;
+            const uint32_t DELAY = 100 * 1000;
+            const uint32_t TIMEOUT = 2000;
+
+            ConnectionAcceptor acceptor(19872);
+            PulseAckTestAcceptor listener;
+            acceptor.setConnectionAcceptorListener(&listener);
+            acceptor.start();
+
+            // The slow module is pulsed first.
+            vector<uint32_t> delays;
+            delays.push_back(DELAY);
+            delays.push_back(0);
+            delays.push_back(0);
+
+            ConnectedModules connectedModules;
+            vector<PulseAckTestModule*> modules;
+            connect(19872, delays, true, listener, connectedModules, modules);
+            TS_ASSERT(modules.size() == delays.size());
+
+            for (uint32_t cycle = 0; cycle < CYCLES; cycle++) {
+                const TimeStamp beginOfCycle;
+                vector<Container> listOfContainers = connectedModules.pulse_ack_containers_parallel(PulseMessage(TimeStamp(), 1, cycle), TIMEOUT);
+                const TimeStamp endOfCycle;
+
+                TS_ASSERT((endOfCycle - beginOfCycle).toMicroseconds() >= static_cast<int32_t>(DELAY));
+
+                // One container per module from this cycle in the modules' order regardless of the order of their ACKs.
+                TS_ASSERT(listOfContainers.size() == modules.size());
+                for (uint32_t i = 0; i < listOfContainers.size(); i++) {
+                    const TimeStamp ts = listOfContainers.at(i).getData<TimeStamp>();
+                    TS_ASSERT(ts.getSeconds() == static_cast<int32_t>(cycle));
+                    TS_ASSERT(ts.getFractionalMicroseconds() == static_cast<int32_t>(i));
+                }
+            }
+
+            for (uint32_t i = 0; i < modules.size(); i++) {
+                TS_ASSERT(modules.at(i)->getListOfCycles().size() == CYCLES);
+            }
+
+            disconnect(connectedModules, modules);
+            acceptor.stop();
+        }
+};
+
+#endif /*CONNECTEDMODULESTESTSUITE_H_*/
@@ -34,6 +34,7 @@
 #include "core/base/ModuleState.h"
 #include "core/base/FIFOQueue.h"
 #include "core/base/KeyValueConfiguration.h"
+#include "core/base/KeyValueConfigurationHandle.h"
 #include "core/base/Lock.h"
 #include "core/base/Mutex.h"
 #include "core/base/Service.h"
@@ -75,6 +76,80 @@ class ClientModuleApp : public ConferenceClientModule {
         }
 };
 
+class ConfigurationChangeApp : public ConferenceClientModule {
+    public:
+        ConfigurationChangeApp(const int32_t &argc, char **argv) :
+            ConferenceClientModule(argc, argv, "ConfigurationChangeApp"),
+            m_mutex(),
+            m_isRunning(false),
+            m_numberOfChanges(0),
+            m_speed(0) {}
+
+        bool isRunning() const {
+            Lock l(m_mutex);
+            return m_isRunning;
+        }
+
+        uint32_t getNumberOfChanges() const {
+            Lock l(m_mutex);
+            return m_numberOfChanges;
+        }
+
+        int32_t getSpeed() const {
+            Lock l(m_mutex);
+            return m_speed;
+        }
+
+        const KeyValueConfiguration getKVC() const {
+            return getKeyValueConfiguration();
+        }
+
+        void setUp() {}
+
+        void tearDown() {}
+
+        virtual void handleKeyValueConfigurationChange() {
+            Lock l(m_mutex);
+            m_numberOfChanges++;
+        }
+
+        core::base::ModuleState::MODULE_EXITCODE body() {
+            const KeyValueConfigurationHandle<int32_t> &speed = getKeyValueConfigurationHandle<int32_t>("configurationchangeapp.speed");
+
+            while (getModuleState() == ModuleState::RUNNING) {
+                Lock l(m_mutex);
+                m_isRunning = true;
+                m_speed = *speed;
+            }
+
+            return core::base::ModuleState::OKAY;
+        }
+
+    private:
+        mutable Mutex m_mutex;
+        bool m_isRunning;
+        uint32_t m_numberOfChanges;
+        int32_t m_speed;
+};
+
+class ConfigurationChangeTestService : public Service {
+    public:
+        ConfigurationChangeTestService(const int32_t &argc, char **argv) :
+            myApp(argc, argv) {}
+
+        virtual void beforeStop() {
+            // Stop app.
+            myApp.setModuleState(ModuleState::NOT_RUNNING);
+        }
+
+        virtual void run() {
+            serviceReady();
+            myApp.runModule();
+        }
+
+        ConfigurationChangeApp myApp;
+};
+
 class ClientModuleTestService : public Service {
     public:
         ClientModuleTestService(const int32_t &argc, char **argv, const string &name) :
@@ -315,6 +390,79 @@ class SupercomponentClientModuleTest : public CxxTest::TestSuite,
             TS_ASSERT(kvc.getValue<string>("clientmoduletestservice.key4") == "value4");
         }
 
+        void testConfigurationChange() {
+            // Setup DMCP.
+            stringstream sstr;
+            sstr << "configurationchangeapp.speed = 1" << endl;
+
+            KeyValueConfiguration _configuration;
+            sstr >> _configuration;
+            m_globaleConfigurationProvider = supercomponent::GlobalConfigurationProvider(_configuration);
+
+            vector<string> noModulesToIgnore;
+            ServerInformation serverInformation("127.0.0.1", 19000);
+            discoverer::Server dmcpDiscovererServer(serverInformation,
+                                                    "225.0.0.100",
+                                                    BROADCAST_PORT_SERVER,
+                                                    BROADCAST_PORT_CLIENT,
+                                                    noModulesToIgnore);
+            dmcpDiscovererServer.startResponding();
+
+            connection::Server dmcpConnectionServer(serverInformation, *this);
+            dmcpConnectionServer.setConnectionHandler(this);
+
+            // Setup module.
+            string argv0("ConfigurationChangeApp");
+            string argv1("--cid=100");
+            string argv2("--freq=20");
+            int32_t argc = 3;
+            char **argv;
+            argv = new char*[3];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+
+            ConfigurationChangeTestService cms(argc, argv);
+
+            cms.start();
+
+            uint32_t tries = 0;
+            const uint32_t ONE_SECOND = 1*1000*1000;
+            while ( (!cms.myApp.isRunning()) && (tries < 5) ) {
+                Thread::usleep(ONE_SECOND);
+                tries++;
+            }
+            TS_ASSERT(cms.myApp.isRunning());
+            TS_ASSERT(m_connection.isValid());
+            TS_ASSERT(cms.myApp.getSpeed() == 1);
+            TS_ASSERT(cms.myApp.getNumberOfChanges() == 0);
+
+            // Push a new configuration to the running module.
+            stringstream sstr2;
+            sstr2 << "configurationchangeapp.speed = 2" << endl;
+            KeyValueConfiguration _configuration2;
+            sstr2 >> _configuration2;
+            m_globaleConfigurationProvider.setGlobalConfiguration(_configuration2);
+            if (m_connection.isValid()) {
+                m_connection->sendConfiguration();
+            }
+
+            tries = 0;
+            while ( (cms.myApp.getNumberOfChanges() == 0) && (tries < 50) ) {
+                Thread::usleep(ONE_SECOND / 10);
+                tries++;
+            }
+
+            // The new value is available in the module's loop after handleKeyValueConfigurationChange was called.
+            Thread::usleep(ONE_SECOND / 5);
+            TS_ASSERT(cms.myApp.getNumberOfChanges() == 1);
+            TS_ASSERT(cms.myApp.getSpeed() == 2);
+            TS_ASSERT(cms.myApp.getKVC().getValue<int32_t>("configurationchangeapp.speed") == 2);
+
+            cms.stop();
+            m_connection = core::SharedPointer<connection::ModuleConnection>();
+        }
+
         void testConfigurationForModuleWithIDEmptyConfiguration() {
             // Setup DMCP.
             stringstream sstr;